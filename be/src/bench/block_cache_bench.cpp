@@ -25,6 +25,7 @@
 #include <memory>
 #include <numeric>
 
+#include "block_cache/io_buffer.h"
 #include "block_cache/starcache_wrapper.h"
 #include "common/config.h"
 #include "common/statusor.h"
@@ -42,7 +43,7 @@ constexpr size_t KB = 1024;
 constexpr size_t MB = KB * 1024;
 constexpr size_t GB = MB * 1024;
 
-constexpr std::string DISK_CACHE_PATH = "./bench_dir/block_disk_cache";
+static const std::string DISK_CACHE_PATH = "./bench_dir/block_disk_cache";
 
 void delete_dir_content(const std::string& dir_path) {
     for (const auto& entry : std::filesystem::directory_iterator(dir_path)) {
@@ -118,12 +119,11 @@ public:
         if (params.cache_engine == CacheEngine::STARCACHE) {
             _cache = new StarCacheWrapper;
 #ifdef WITH_CACHELIB
-        } else {
+        } else if (params.cache_engine == CacheEngine::CACHELIB) {
             _cache = new CacheLibWrapper;
 #endif
-        }
-        else {
-            DCHECK(false) << "Unsupported cache engine: " << params.cache_engine;
+        } else {
+            DCHECK(false) << "Unsupported cache engine: " << static_cast<int>(params.cache_engine);
         }
         Status st = _cache->init(options);
         DCHECK(st.ok()) << st.message();
@@ -159,6 +159,18 @@ public:
         return value;
     }
 
+    StatusOr<size_t> read_cache(const std::string& key, char* value, size_t off, size_t size) {
+        IOBuffer buffer;
+        RETURN_IF_ERROR(_cache->read_buffer(key, off, size, &buffer, nullptr));
+        return buffer.copy_to(value);
+    }
+
+    Status write_cache(const std::string& key, const char* value, size_t size) {
+        IOBuffer buffer;
+        buffer.append_user_data(const_cast<char*>(value), size, nullptr);
+        return _cache->write_buffer(key, buffer, nullptr);
+    }
+
     static bool check_buffer(const char* data, size_t length, char ch) {
         for (size_t i = 0; i < length; ++i) {
             if (data[i] != ch) {
@@ -176,7 +188,7 @@ public:
             // remove
             if (_params->remove_op_ratio > 0 && _ctx->rnd->Uniform(100) < _params->remove_op_ratio) {
                 int64_t start_us = MonotonicMicros();
-                Status st = _cache->remove_cache(_ctx->obj_keys[index]);
+                Status st = _cache->remove(_ctx->obj_keys[index]);
                 if (st.ok()) {
                     *(_ctx->remove_latency) << MonotonicMicros() - start_us;
                     *(_ctx->remove_op_count) << 1;
@@ -193,7 +205,7 @@ public:
                 offset = _ctx->rnd->Uniform(delta);
             }
             int64_t start_us = MonotonicMicros();
-            auto res = _cache->read_cache(_ctx->obj_keys[index], value, offset, _params->read_size);
+            auto res = read_cache(_ctx->obj_keys[index], value, offset, _params->read_size);
             if (res.ok()) {
                 *(_ctx->read_latency) << MonotonicMicros() - start_us;
                 *(_ctx->read_bytes) << res.value();
@@ -206,14 +218,14 @@ public:
             } else if (res.status().is_not_found()) {
                 std::string v = gen_obj_value(index, obj_value_size, _ctx);
                 start_us = MonotonicMicros();
-                Status st = _cache->write_cache(_ctx->obj_keys[index], v.data(), obj_value_size, 0);
+                Status st = write_cache(_ctx->obj_keys[index], v.data(), obj_value_size);
                 ASSERT_TRUE(st.ok()) << "write cache failed: " << st.message();
                 *(_ctx->write_latency) << MonotonicMicros() - start_us;
                 *(_ctx->write_bytes) << v.size();
                 *(_ctx->write_op_count) << 1;
 
                 char* read_value = new char[obj_value_size];
-                auto res = _cache->read_cache(_ctx->obj_keys[index], read_value, 0, _params->read_size);
+                auto res = read_cache(_ctx->obj_keys[index], read_value, 0, _params->read_size);
                 delete[] read_value;
             } else {
                 ASSERT_TRUE(false) << "read cache failed: " << res.status().message();
@@ -234,12 +246,12 @@ public:
                 std::string value = gen_obj_value(i, size, _ctx);
 
                 int64_t start_us = MonotonicMicros();
-                Status st = _cache->write_cache(key, value.data(), size, 0);
+                Status st = write_cache(key, value.data(), size);
                 ASSERT_OK(st);
 
                 char* read_value = new char[_params->obj_value_size];
                 std::string read_key = i == 0 ? key : _ctx->obj_keys[0];
-                auto res = _cache->read_cache(read_key, read_value, 0, _params->read_size);
+                auto res = read_cache(read_key, read_value, 0, _params->read_size);
                 delete[] read_value;
 
                 *(_ctx->write_latency) << MonotonicMicros() - start_us;
@@ -303,7 +315,9 @@ static void BM_bench_starcache(benchmark::State& state, Args&&... args) {
     options.meta_path = DISK_CACHE_PATH;
     options.disk_spaces.push_back({.path = DISK_CACHE_PATH, .size = 1 * GB});
     options.block_size = 4 * MB;
-    options.checksum = false;
+    options.max_concurrent_inserts = 100000;
+    options.max_flying_memory_mb = 100;
+    options.enable_checksum = false;
 
     BlockCacheBenchSuite::BenchParams params;
     params.obj_count = 1000;
@@ -322,7 +336,9 @@ static void BM_bench_starcache(benchmark::State& state, Args&&... args) {
     options.meta_path = DISK_CACHE_PATH;
     options.disk_spaces.push_back({.path = DISK_CACHE_PATH, .size = 10 * GB});
     options.block_size = 4 * MB;
-    options.checksum = true;
+    options.max_concurrent_inserts = 100000;
+    options.max_flying_memory_mb = 100;
+    options.enable_checksum = true;
 
     BlockCacheBenchSuite::BenchParams params;
     params.obj_count = 1000;
@@ -341,7 +357,9 @@ static void BM_bench_starcache(benchmark::State& state, Args&&... args) {
     options.meta_path = DISK_CACHE_PATH;
     options.disk_spaces.push_back({.path = DISK_CACHE_PATH, .size = 10 * GB});
     options.block_size = 4 * MB;
-    options.checksum = true;
+    options.max_concurrent_inserts = 100000;
+    options.max_flying_memory_mb = 100;
+    options.enable_checksum = true;
 
     BlockCacheBenchSuite::BenchParams params;
     params.obj_count = 1000;
@@ -363,7 +381,9 @@ static void BM_bench_starcache(benchmark::State& state, Args&&... args) {
     options.meta_path = DISK_CACHE_PATH;
     options.disk_spaces.push_back({.path = DISK_CACHE_PATH, .size = 10 * GB});
     options.block_size = 1 * MB;
-    options.checksum = true;
+    options.max_concurrent_inserts = 100000;
+    options.max_flying_memory_mb = 100;
+    options.enable_checksum = true;
 
     BlockCacheBenchSuite::BenchParams params;
     params.obj_count = 1000;
@@ -38,6 +38,7 @@
 #include "runtime/sorted_chunks_merger.h"
 #include "runtime/types.h"
 #include "types/logical_type.h"
+#include "util/defer_op.h"
 #include "util/runtime_profile.h"
 
 namespace starrocks {
@@ -159,6 +160,7 @@ struct SortParameters {
     bool low_card = false;
     bool nullable = false;
     int max_buffered_chunks = ChunksSorterTopn::kDefaultBufferedChunks;
+    bool normalized_key = false;
 
     SortParameters() = default;
 
@@ -185,6 +187,12 @@ struct SortParameters {
         params.max_buffered_chunks = max_buffered_chunks;
         return params;
     }
+
+    static SortParameters with_normalized_key(bool normalized_key) {
+        SortParameters params;
+        params.normalized_key = normalized_key;
+        return params;
+    }
 };
 
 static void do_bench(benchmark::State& state, SortAlgorithm sorter_algo, LogicalType data_type, int num_chunks,
@@ -192,6 +200,8 @@ static void do_bench(benchmark::State& state, SortAlgorithm sorter_algo, Logical
     // state.PauseTiming();
     ChunkSorterBase suite;
     suite.SetUp();
+    config::enable_sort_normalized_key = params.normalized_key;
+    DeferOp defer([]() { config::enable_sort_normalized_key = false; });
 
     TypeDescriptor type_desc;
     if (data_type == TYPE_INT) {
@@ -458,6 +468,14 @@ static void BM_fullsort_float_notnull(benchmark::State& state) {
 static void BM_fullsort_nullable(benchmark::State& state) {
     do_bench(state, FullSort, TYPE_INT, state.range(0), state.range(1), SortParameters::with_nullable(true));
 }
+static void BM_fullsort_notnull_normalized_key(benchmark::State& state) {
+    do_bench(state, FullSort, TYPE_INT, state.range(0), state.range(1), SortParameters::with_normalized_key(true));
+}
+static void BM_fullsort_nullable_normalized_key(benchmark::State& state) {
+    SortParameters params = SortParameters::with_normalized_key(true);
+    params.nullable = true;
+    do_bench(state, FullSort, TYPE_INT, state.range(0), state.range(1), params);
+}
 static void BM_fullsort_varchar_column_incr(benchmark::State& state) {
     do_bench(state, FullSort, TYPE_VARCHAR, state.range(0), state.range(1));
 }
@@ -484,6 +502,11 @@ static void BM_topn_limit_mergesort_nullable(benchmark::State& state) {
     params.nullable = true;
     do_bench(state, MergeSort, TYPE_INT, state.range(0), state.range(1), params);
 }
+static void BM_topn_limit_mergesort_notnull_normalized_key(benchmark::State& state) {
+    SortParameters params = SortParameters::with_limit(state.range(2));
+    params.normalized_key = true;
+    do_bench(state, MergeSort, TYPE_INT, state.range(0), state.range(1), params);
+}
 static void BM_topn_buffered_chunks(benchmark::State& state) {
     SortParameters params;
     params.max_buffered_chunks = state.range(0);
@@ -533,6 +556,8 @@ static void CustomArgsLimit(benchmark::internal::Benchmark* b) {
 // Full sort
 BENCHMARK(BM_fullsort_notnull)->Apply(CustomArgsFull);
 BENCHMARK(BM_fullsort_nullable)->Apply(CustomArgsFull);
+BENCHMARK(BM_fullsort_notnull_normalized_key)->Apply(CustomArgsFull);
+BENCHMARK(BM_fullsort_nullable_normalized_key)->Apply(CustomArgsFull);
 BENCHMARK(BM_fullsort_float_notnull)->Apply(CustomArgsFull);
 BENCHMARK(BM_fullsort_varchar_column_incr)->Apply(CustomArgsFull);
 
@@ -544,6 +569,7 @@ BENCHMARK(BM_fullsort_low_card_nullable)->Apply(CustomArgsFull);
 BENCHMARK(BM_topn_limit_heapsort)->Apply(CustomArgsLimit);
 BENCHMARK(BM_topn_limit_mergesort_notnull)->Apply(CustomArgsLimit);
 BENCHMARK(BM_topn_limit_mergesort_nullable)->Apply(CustomArgsLimit);
+BENCHMARK(BM_topn_limit_mergesort_notnull_normalized_key)->Apply(CustomArgsLimit);
 
 // Tunning the parameter buffered_chunks of TopN
 BENCHMARK(BM_topn_buffered_chunks)->RangeMultiplier(4)->Ranges({{10, 10'000}, {100, 100'000}});
@@ -0,0 +1,98 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <random>
+#include <string>
+
+#include "column/column_helper.h"
+#include "column/fixed_length_column.h"
+#include "exprs/function_context.h"
+#include "exprs/geo_functions.h"
+#include "geo/geo_types.h"
+
+namespace starrocks {
+
+static constexpr size_t kNumRows = 4096;
+
+// Random coordinates in [0, 60) x [0, 60), so about 44% of them fall into the polygon below.
+static Columns gen_coord_columns() {
+    std::mt19937_64 rng(kNumRows);
+    std::uniform_real_distribution<double> dist(0, 60);
+    auto x_column = DoubleColumn::create();
+    auto y_column = DoubleColumn::create();
+    for (size_t i = 0; i < kNumRows; i++) {
+        x_column->append(dist(rng));
+        y_column->append(dist(rng));
+    }
+    return {std::move(x_column), std::move(y_column)};
+}
+
+static std::string encoded_polygon() {
+    std::string wkt = "POLYGON ((10 10, 50 10, 50 50, 10 50, 10 10))";
+    GeoParseStatus status;
+    std::unique_ptr<GeoShape> polygon(GeoShape::from_wkt(wkt.data(), wkt.size(), &status));
+    CHECK(polygon != nullptr);
+    std::string buf;
+    polygon->encode_to(&buf);
+    return buf;
+}
+
+static void BM_st_point(benchmark::State& state) {
+    std::unique_ptr<FunctionContext> ctx(FunctionContext::create_test_context());
+    auto columns = gen_coord_columns();
+    for (auto _ : state) {
+        auto points = GeoFunctions::st_point(ctx.get(), columns).value();
+        benchmark::DoNotOptimize(points);
+    }
+    state.SetItemsProcessed(state.iterations() * kNumRows);
+}
+
+// Args: whether the polygon is a constant column, which lets st_contains_prepare parse it once.
+static void BM_st_contains_polygon_point(benchmark::State& state) {
+    bool const_polygon = state.range(0);
+    std::unique_ptr<FunctionContext> ctx(FunctionContext::create_test_context());
+    auto points = GeoFunctions::st_point(ctx.get(), gen_coord_columns()).value();
+
+    std::string polygon = encoded_polygon();
+    ColumnPtr polygon_column;
+    if (const_polygon) {
+        polygon_column = ColumnHelper::create_const_column<TYPE_VARCHAR>(Slice(polygon), kNumRows);
+    } else {
+        auto column = BinaryColumn::create();
+        for (size_t i = 0; i < kNumRows; i++) {
+            column->append(Slice(polygon));
+        }
+        polygon_column = std::move(column);
+    }
+
+    Columns columns{polygon_column, points};
+    ctx->set_constant_columns({const_polygon ? polygon_column : nullptr, nullptr});
+    CHECK(GeoFunctions::st_contains_prepare(ctx.get(), FunctionContext::FRAGMENT_LOCAL).ok());
+    for (auto _ : state) {
+        auto result = GeoFunctions::st_contains(ctx.get(), columns).value();
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(state.iterations() * kNumRows);
+    CHECK(GeoFunctions::st_contains_close(ctx.get(), FunctionContext::FRAGMENT_LOCAL).ok());
+}
+
+BENCHMARK(BM_st_point);
+BENCHMARK(BM_st_contains_polygon_point)->Arg(0)->Arg(1);
+
+} // namespace starrocks
+
+BENCHMARK_MAIN();
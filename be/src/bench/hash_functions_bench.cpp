@@ -22,6 +22,7 @@
 
 #include "bench.h"
 #include "exprs/hash_functions.h"
+#include "util/crc32c.h"
 
 namespace starrocks {
 
@@ -85,6 +86,20 @@ static void BM_HashFunctions_Eval(benchmark::State& state) {
 
 BENCHMARK(BM_HashFunctions_Eval)->Apply(BM_HashFunctions_Eval_Arg);
 
+// Checksum throughput over one buffer, from page-sized blocks up to whole files.
+static void BM_Crc32c_Value(benchmark::State& state) {
+    std::string buffer(state.range(0), '\0');
+    for (size_t i = 0; i < buffer.size(); i++) {
+        buffer[i] = static_cast<char>(i * 131);
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(crc32c::Value(buffer.data(), buffer.size()));
+    }
+    state.SetBytesProcessed(state.iterations() * buffer.size());
+}
+
+BENCHMARK(BM_Crc32c_Value)->Arg(64)->Arg(4096)->Arg(64 * 1024)->Arg(1024 * 1024);
+
 } // namespace starrocks
 
 BENCHMARK_MAIN();
\ No newline at end of file
@@ -0,0 +1,230 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "column/binary_column.h"
+#include "column/chunk.h"
+#include "column/fixed_length_column.h"
+#include "column/nullable_column.h"
+#include "common/config.h"
+#include "common/object_pool.h"
+#include "exec/join_hash_map.h"
+#include "runtime/descriptor_helper.h"
+#include "runtime/descriptors.h"
+#include "runtime/runtime_state.h"
+#include "util/runtime_profile.h"
+
+namespace starrocks {
+
+static constexpr size_t kProbeChunks = 16;
+
+// Drives JoinHashTable build and probe of an inner join on a single key column. Build keys are unique, probe keys are
+// drawn from twice the build key range, so about half of the probe rows find a match.
+class HashJoinBenchSuite {
+public:
+    HashJoinBenchSuite(LogicalType key_type, size_t build_rows, int null_percent)
+            : _key_type(key_type), _nullable(null_percent > 0), _rng(build_rows) {
+        config::vector_chunk_size = 4096;
+        _key_type_desc = key_type == TYPE_VARCHAR ? TypeDescriptor::create_varchar_type(255)
+                                                  : TypeDescriptor::from_logical_type(key_type);
+        _runtime_state = _create_runtime_state();
+        _runtime_profile = std::make_shared<RuntimeProfile>("hash_join_bench");
+        _create_row_descs();
+
+        std::vector<int64_t> build_keys(build_rows);
+        std::iota(build_keys.begin(), build_keys.end(), 0);
+        std::shuffle(build_keys.begin(), build_keys.end(), _rng);
+        _build_chunk = std::make_shared<Chunk>();
+        _build_chunk->append_column(_make_key_column(build_keys, null_percent), 1);
+
+        std::uniform_int_distribution<int64_t> probe_dist(0, 2 * build_rows - 1);
+        for (size_t i = 0; i < kProbeChunks; i++) {
+            std::vector<int64_t> probe_keys(config::vector_chunk_size);
+            for (auto& key : probe_keys) {
+                key = probe_dist(_rng);
+            }
+            auto probe_chunk = std::make_shared<Chunk>();
+            probe_chunk->append_column(_make_key_column(probe_keys, null_percent), 0);
+            _probe_chunks.emplace_back(std::move(probe_chunk));
+        }
+    }
+
+    HashTableParam table_param() const {
+        HashTableParam param;
+        param.join_type = TJoinOp::INNER_JOIN;
+        param.row_desc = _row_desc.get();
+        param.probe_row_desc = _probe_row_desc.get();
+        param.build_row_desc = _build_row_desc.get();
+        // only output the build column, so probing never mutates the shared probe chunks.
+        param.build_output_slots.emplace(1);
+        param.join_keys.emplace_back(JoinKeyDesc{&_key_type_desc, false, nullptr});
+        param.search_ht_timer = ADD_TIMER(_runtime_profile, "SearchHashTableTime");
+        param.output_build_column_timer = ADD_TIMER(_runtime_profile, "OutputBuildColumnTime");
+        param.output_probe_column_timer = ADD_TIMER(_runtime_profile, "OutputProbeColumnTime");
+        return param;
+    }
+
+    void build(JoinHashTable* ht) {
+        ht->create(table_param());
+        Columns key_columns{_build_chunk->columns()[0]};
+        ht->append_chunk(_build_chunk, key_columns);
+        CHECK(ht->build(_runtime_state.get()).ok());
+    }
+
+    size_t probe(JoinHashTable* ht) {
+        size_t num_rows = 0;
+        for (auto& probe_chunk : _probe_chunks) {
+            Columns key_columns{probe_chunk->columns()[0]};
+            bool has_remain = true;
+            while (has_remain) {
+                auto result_chunk = std::make_shared<Chunk>();
+                CHECK(ht->probe(_runtime_state.get(), key_columns, &probe_chunk, &result_chunk, &has_remain).ok());
+                num_rows += result_chunk->num_rows();
+            }
+        }
+        return num_rows;
+    }
+
+    size_t probe_rows() const { return kProbeChunks * config::vector_chunk_size; }
+
+private:
+    ColumnPtr _make_key_column(const std::vector<int64_t>& keys, int null_percent) {
+        ColumnPtr data_column;
+        if (_key_type == TYPE_INT) {
+            auto column = Int32Column::create();
+            for (auto key : keys) {
+                column->append(static_cast<int32_t>(key));
+            }
+            data_column = std::move(column);
+        } else if (_key_type == TYPE_BIGINT) {
+            auto column = Int64Column::create();
+            for (auto key : keys) {
+                column->append(key);
+            }
+            data_column = std::move(column);
+        } else {
+            CHECK_EQ(TYPE_VARCHAR, _key_type);
+            auto column = BinaryColumn::create();
+            for (auto key : keys) {
+                std::string value = "join_key_" + std::to_string(key);
+                column->append(Slice(value));
+            }
+            data_column = std::move(column);
+        }
+        if (!_nullable) {
+            return data_column;
+        }
+        std::uniform_int_distribution<int> null_dist(0, 99);
+        auto null_column = NullColumn::create();
+        for (size_t i = 0; i < keys.size(); i++) {
+            null_column->append(null_dist(_rng) < null_percent);
+        }
+        return NullableColumn::create(std::move(data_column), std::move(null_column));
+    }
+
+    TSlotDescriptor _create_slot_descriptor(const std::string& name) const {
+        TSlotDescriptorBuilder slot_desc_builder;
+        return slot_desc_builder.type(_key_type_desc).column_name(name).column_pos(0).nullable(_nullable).build();
+    }
+
+    void _create_row_descs() {
+        TDescriptorTableBuilder desc_builder;
+        // tuple 0 is the probe side and holds slot 0, tuple 1 is the build side and holds slot 1.
+        for (const auto& name : {"probe_key", "build_key"}) {
+            TTupleDescriptorBuilder tuple_desc_builder;
+            tuple_desc_builder.add_slot(_create_slot_descriptor(name));
+            tuple_desc_builder.build(&desc_builder);
+        }
+        DescriptorTbl* tbl = nullptr;
+        CHECK(DescriptorTbl::create(_runtime_state.get(), &_object_pool, desc_builder.desc_tbl(), &tbl,
+                                    config::vector_chunk_size)
+                      .ok());
+        _row_desc = std::make_shared<RowDescriptor>(*tbl, std::vector<TTupleId>{0, 1},
+                                                    std::vector<bool>{_nullable, _nullable});
+        _probe_row_desc = std::make_shared<RowDescriptor>(*tbl, std::vector<TTupleId>{0}, std::vector<bool>{_nullable});
+        _build_row_desc = std::make_shared<RowDescriptor>(*tbl, std::vector<TTupleId>{1}, std::vector<bool>{_nullable});
+    }
+
+    static std::shared_ptr<RuntimeState> _create_runtime_state() {
+        TUniqueId fragment_id;
+        TQueryOptions query_options;
+        query_options.batch_size = config::vector_chunk_size;
+        TQueryGlobals query_globals;
+        auto runtime_state = std::make_shared<RuntimeState>(fragment_id, query_options, query_globals, nullptr);
+        runtime_state->init_instance_mem_tracker();
+        return runtime_state;
+    }
+
+    LogicalType _key_type;
+    TypeDescriptor _key_type_desc;
+    bool _nullable;
+    std::mt19937_64 _rng;
+    ObjectPool _object_pool;
+    std::shared_ptr<RuntimeState> _runtime_state;
+    std::shared_ptr<RuntimeProfile> _runtime_profile;
+    std::shared_ptr<RowDescriptor> _row_desc;
+    std::shared_ptr<RowDescriptor> _probe_row_desc;
+    std::shared_ptr<RowDescriptor> _build_row_desc;
+    ChunkPtr _build_chunk;
+    std::vector<ChunkPtr> _probe_chunks;
+};
+
+// Args: key type, number of build rows, percentage of null keys on both sides.
+static void BM_hash_join_build(benchmark::State& state) {
+    HashJoinBenchSuite suite(static_cast<LogicalType>(state.range(0)), state.range(1), state.range(2));
+    for (auto _ : state) {
+        JoinHashTable ht;
+        suite.build(&ht);
+        ht.close();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(1));
+}
+
+static void BM_hash_join_probe(benchmark::State& state) {
+    HashJoinBenchSuite suite(static_cast<LogicalType>(state.range(0)), state.range(1), state.range(2));
+    JoinHashTable ht;
+    suite.build(&ht);
+    size_t matched_rows = 0;
+    for (auto _ : state) {
+        matched_rows = suite.probe(&ht);
+        benchmark::DoNotOptimize(matched_rows);
+    }
+    state.SetItemsProcessed(state.iterations() * suite.probe_rows());
+    state.counters["matched_rows"] = matched_rows;
+    ht.close();
+}
+
+static void CustomArgs(benchmark::internal::Benchmark* b) {
+    for (int key_type : {TYPE_INT, TYPE_BIGINT, TYPE_VARCHAR}) {
+        for (int build_rows : {1 << 10, 1 << 16, 1 << 20}) {
+            for (int null_percent : {0, 10}) {
+                b->Args({key_type, build_rows, null_percent});
+            }
+        }
+    }
+}
+
+BENCHMARK(BM_hash_join_build)->Apply(CustomArgs);
+BENCHMARK(BM_hash_join_probe)->Apply(CustomArgs);
+
+} // namespace starrocks
+
+BENCHMARK_MAIN();
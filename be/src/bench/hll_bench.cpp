@@ -0,0 +1,77 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include "types/hll.h"
+#include "util/hash_util.hpp"
+
+namespace starrocks {
+
+static std::vector<uint64_t> gen_hash_values(size_t num_values) {
+    std::mt19937_64 rng(num_values);
+    std::vector<uint64_t> hash_values(num_values);
+    for (auto& value : hash_values) {
+        uint64_t v = rng();
+        value = HashUtil::murmur_hash64A(&v, sizeof(v), HashUtil::MURMUR_SEED);
+    }
+    return hash_values;
+}
+
+static void BM_HLL_Update(benchmark::State& state) {
+    size_t num_values = state.range(0);
+    bool batch = state.range(1);
+    auto hash_values = gen_hash_values(num_values);
+
+    for (auto _ : state) {
+        HyperLogLog hll;
+        if (batch) {
+            hll.update_batch(hash_values.data(), hash_values.size());
+        } else {
+            for (auto value : hash_values) {
+                if (value != 0) {
+                    hll.update(value);
+                }
+            }
+        }
+        benchmark::DoNotOptimize(hll.estimate_cardinality());
+    }
+}
+
+static void BM_HLL_Merge(benchmark::State& state) {
+    size_t num_hlls = state.range(0);
+    std::vector<HyperLogLog> hlls(num_hlls);
+    for (size_t i = 0; i < num_hlls; i++) {
+        auto hash_values = gen_hash_values(4096 + i);
+        hlls[i].update_batch(hash_values.data(), hash_values.size());
+    }
+
+    for (auto _ : state) {
+        HyperLogLog hll;
+        for (const auto& other : hlls) {
+            hll.merge(other);
+        }
+        benchmark::DoNotOptimize(hll.estimate_cardinality());
+    }
+}
+
+BENCHMARK(BM_HLL_Update)->Args({4096, false})->Args({4096, true})->Args({1 << 20, false})->Args({1 << 20, true});
+BENCHMARK(BM_HLL_Merge)->Arg(16)->Arg(256);
+
+} // namespace starrocks
+
+BENCHMARK_MAIN();
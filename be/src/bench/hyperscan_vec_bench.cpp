@@ -26,6 +26,7 @@
 #include "column/column_helper.h"
 #include "column/vectorized_fwd.h"
 #include "common/statusor.h"
+#include "exprs/like_predicate.h"
 #include "exprs/string_functions.h"
 
 namespace starrocks {
@@ -154,6 +155,85 @@ BENCHMARK(BM_HyperScan_Eval)->Apply(BM_HyperScan_Eval_Arg);
     BM_HyperScan_Eval/100/0/iterations:10000     100563 ns       100588 ns        10000
      */
 
+// `col LIKE p1 OR col LIKE p2 OR ...`: one hyperscan database per pattern against a single multi-pattern database.
+class MultiPatternBench {
+public:
+    MultiPatternBench(size_t num_patterns) : _num_patterns(num_patterns) {}
+
+    void SetUp();
+
+    StatusOr<ColumnPtr> do_bench(bool multi_pattern);
+
+private:
+    const TypeDescriptor type_desc = TypeDescriptor(TYPE_VARCHAR);
+    size_t _num_patterns = 0;
+    size_t _num_rows = 4096;
+    ColumnPtr _column;
+    std::vector<std::unique_ptr<LikePredicate::MultiPatternMatcher>> _single_matchers;
+    std::unique_ptr<LikePredicate::MultiPatternMatcher> _multi_matcher;
+};
+
+void MultiPatternBench::SetUp() {
+    _column = Bench::create_random_column(type_desc, _num_rows, false, false, 20);
+    std::vector<std::string> patterns;
+    for (size_t i = 0; i < _num_patterns; i++) {
+        patterns.emplace_back("%" + std::to_string(i) + "_" + std::to_string(i * 7) + "%");
+    }
+    std::vector<bool> is_like(patterns.size(), true);
+    for (size_t i = 0; i < patterns.size(); i++) {
+        auto matcher = std::make_unique<LikePredicate::MultiPatternMatcher>();
+        CHECK(matcher->init({patterns[i]}, {true}).ok());
+        _single_matchers.emplace_back(std::move(matcher));
+    }
+    _multi_matcher = std::make_unique<LikePredicate::MultiPatternMatcher>();
+    CHECK(_multi_matcher->init(patterns, is_like).ok());
+}
+
+StatusOr<ColumnPtr> MultiPatternBench::do_bench(bool multi_pattern) {
+    if (multi_pattern) {
+        return _multi_matcher->match(_column);
+    }
+    ColumnPtr result;
+    for (const auto& matcher : _single_matchers) {
+        ASSIGN_OR_RETURN(auto matched, matcher->match(_column));
+        if (result == nullptr) {
+            result = std::move(matched);
+            continue;
+        }
+        auto& data = ColumnHelper::as_raw_column<BooleanColumn>(result)->get_data();
+        const auto& matched_data = ColumnHelper::as_raw_column<BooleanColumn>(matched)->get_data();
+        for (size_t i = 0; i < data.size(); i++) {
+            data[i] |= matched_data[i];
+        }
+    }
+    return result;
+}
+
+static void BM_HyperScan_MultiPattern_Arg(benchmark::internal::Benchmark* b) {
+    for (int num_patterns : {2, 8, 32}) {
+        b->Args({num_patterns, false});
+        b->Args({num_patterns, true});
+    }
+    b->Iterations(1000);
+}
+
+static void BM_HyperScan_MultiPattern(benchmark::State& state) {
+    size_t num_patterns = state.range(0);
+    bool multi_pattern = state.range(1);
+
+    MultiPatternBench bench(num_patterns);
+    bench.SetUp();
+
+    for (auto _ : state) {
+        state.ResumeTiming();
+        auto st = bench.do_bench(multi_pattern);
+        state.PauseTiming();
+        ASSERT_TRUE(st.ok());
+    }
+}
+
+BENCHMARK(BM_HyperScan_MultiPattern)->Apply(BM_HyperScan_MultiPattern_Arg);
+
 } // namespace starrocks
 
 BENCHMARK_MAIN();
\ No newline at end of file
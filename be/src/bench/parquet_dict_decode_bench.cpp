@@ -98,6 +98,58 @@ static void BM_DictDecoder(benchmark::State& state) {
 
 BENCHMARK(BM_DictDecoder)->DenseRange(0, 100, 10)->Unit(benchmark::kMillisecond);
 
+// decode rle/bit-packed dict indexes and gather fixed length dict values.
+// state.range(0) is the dict size, random indexes make almost all runs literal runs.
+template <typename T, LogicalType LT>
+static void BM_DictDecoderFixedLength(benchmark::State& state) {
+    const int dict_size = state.range(0);
+    DictDecoder<T> dict_decoder;
+    Slice data;
+    DictEncoder<T> dict_encoder;
+    {
+        std::vector<T> dict_values;
+        for (int i = 0; i < dict_size; i++) {
+            dict_values.emplace_back(static_cast<T>(i * 7 + 1));
+        }
+        PlainEncoder<T> encoder;
+        encoder.append((const uint8_t*)dict_values.data(), dict_size);
+        Slice dict_data = encoder.build();
+        PlainDecoder<T> decoder;
+        decoder.set_data(dict_data);
+        dict_decoder.set_dict(kTestChunkSize, dict_size, &decoder);
+
+        std::mt19937 rng(0);
+        std::uniform_int_distribution<int> dist(0, dict_size - 1);
+        std::vector<T> values;
+        for (int i = 0; i < kTestChunkSize; i++) {
+            values.emplace_back(dict_values[dist(rng)]);
+        }
+        dict_encoder.append((const uint8_t*)values.data(), kTestChunkSize);
+        data = dict_encoder.build();
+    }
+
+    ColumnPtr column = ColumnHelper::create_column(TypeDescriptor{LT}, false);
+    for (auto _ : state) {
+        state.PauseTiming();
+        column->reset_column();
+        dict_decoder.set_data(data);
+        state.ResumeTiming();
+        Status st = dict_decoder.next_batch(kTestChunkSize, ColumnContentType::VALUE, column.get());
+        benchmark::DoNotOptimize(st);
+    }
+}
+
+static void BM_DictDecoderInt32(benchmark::State& state) {
+    BM_DictDecoderFixedLength<int32_t, TYPE_INT>(state);
+}
+
+static void BM_DictDecoderInt64(benchmark::State& state) {
+    BM_DictDecoderFixedLength<int64_t, TYPE_BIGINT>(state);
+}
+
+BENCHMARK(BM_DictDecoderInt32)->RangeMultiplier(16)->Range(16, 65536)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_DictDecoderInt64)->RangeMultiplier(16)->Range(16, 65536)->Unit(benchmark::kMicrosecond);
+
 } // namespace parquet
 } // namespace starrocks
 
@@ -116,6 +116,72 @@ static void process_args(benchmark::internal::Benchmark* b) {
 
 BENCHMARK(bench_func)->Apply(process_args);
 
+// Union `num_bitmaps` bitmaps of `value_count` values into one, like bitmap_union does for a group.
+static std::vector<BitmapValue> gen_union_bitmaps(size_t num_bitmaps, size_t value_count, size_t end) {
+    Random rand(0);
+    std::vector<BitmapValue> bitmaps(num_bitmaps);
+    for (auto& bitmap : bitmaps) {
+        for (size_t i = 0; i < value_count; i++) {
+            bitmap.add(rand.Next64() % end);
+        }
+    }
+    return bitmaps;
+}
+
+static void bench_union_pairwise(benchmark::State& state) {
+    auto bitmaps = gen_union_bitmaps(state.range(0), state.range(1), state.range(2));
+    for (auto _ : state) {
+        BitmapValue result;
+        for (const auto& bitmap : bitmaps) {
+            result |= bitmap;
+        }
+        benchmark::DoNotOptimize(result.cardinality());
+    }
+}
+
+static void bench_union_many(benchmark::State& state) {
+    auto bitmaps = gen_union_bitmaps(state.range(0), state.range(1), state.range(2));
+    std::vector<const BitmapValue*> values;
+    for (const auto& bitmap : bitmaps) {
+        values.push_back(&bitmap);
+    }
+    for (auto _ : state) {
+        BitmapValue result;
+        result.union_many(values.data(), values.size());
+        benchmark::DoNotOptimize(result.cardinality());
+    }
+}
+
+static void bench_union_serialize_size(benchmark::State& state) {
+    auto bitmaps = gen_union_bitmaps(state.range(0), state.range(1), state.range(2));
+    std::vector<const BitmapValue*> values;
+    for (const auto& bitmap : bitmaps) {
+        values.push_back(&bitmap);
+    }
+    size_t before = 0;
+    size_t after = 0;
+    for (auto _ : state) {
+        BitmapValue result;
+        result.union_many(values.data(), values.size());
+        before = result.serialize_size();
+        result.run_optimize();
+        after = result.serialize_size();
+    }
+    state.counters["size_before"] = before;
+    state.counters["size_after"] = after;
+}
+
+static void process_union_args(benchmark::internal::Benchmark* b) {
+    b->Args({1000, 1000, 10000000});
+    b->Args({1000, 10000, 10000000});
+    b->Args({100, 100000, 10000000});
+    b->Args({1000, 1000, 5000000000});
+}
+
+BENCHMARK(bench_union_pairwise)->Apply(process_union_args);
+BENCHMARK(bench_union_many)->Apply(process_union_args);
+BENCHMARK(bench_union_serialize_size)->Apply(process_union_args);
+
 } // namespace starrocks
 
 BENCHMARK_MAIN();
\ No newline at end of file
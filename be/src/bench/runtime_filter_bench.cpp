@@ -164,6 +164,53 @@ static void Benchmark_RuntimeFilter_Eval(benchmark::State& state) {
 
 BENCHMARK(Benchmark_RuntimeFilter_Eval)->Apply(RuntimeFilterArg1);
 
+// Benchmark the insert_hash/test_hash kernels of SimdBlockFilter alone, which are compiled to avx2, neon
+// or scalar code according to the target of the build.
+static std::vector<uint64_t> gen_random_hashes(size_t num_hashes) {
+    std::mt19937_64 rng(0);
+    std::vector<uint64_t> hashes(num_hashes);
+    for (auto& hash : hashes) {
+        hash = rng();
+    }
+    return hashes;
+}
+
+static void Benchmark_SimdBlockFilter_Insert(benchmark::State& state) {
+    const auto num_rows = state.range(0);
+    const auto hashes = gen_random_hashes(num_rows);
+    for (auto _ : state) {
+        SimdBlockFilter bf;
+        bf.init(num_rows);
+        for (auto hash : hashes) {
+            bf.insert_hash(hash);
+        }
+        benchmark::DoNotOptimize(bf.can_use());
+    }
+    state.SetItemsProcessed(state.iterations() * num_rows);
+}
+
+static void Benchmark_SimdBlockFilter_Test(benchmark::State& state) {
+    const auto num_rows = state.range(0);
+    const auto hashes = gen_random_hashes(num_rows * 2);
+    SimdBlockFilter bf;
+    bf.init(num_rows);
+    // only half of the tested hashes are inserted.
+    for (int64_t i = 0; i < num_rows; i++) {
+        bf.insert_hash(hashes[i * 2]);
+    }
+    for (auto _ : state) {
+        size_t hits = 0;
+        for (auto hash : hashes) {
+            hits += bf.test_hash(hash);
+        }
+        benchmark::DoNotOptimize(hits);
+    }
+    state.SetItemsProcessed(state.iterations() * num_rows * 2);
+}
+
+BENCHMARK(Benchmark_SimdBlockFilter_Insert)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 22);
+BENCHMARK(Benchmark_SimdBlockFilter_Test)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 22);
+
 } // namespace starrocks
 
 BENCHMARK_MAIN();
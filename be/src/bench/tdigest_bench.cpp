@@ -0,0 +1,81 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include "util/percentile_value.h"
+
+namespace starrocks {
+
+static std::vector<double> gen_values(size_t num_values) {
+    std::mt19937_64 rng(num_values);
+    std::uniform_real_distribution<double> dist(0.0, 1e6);
+    std::vector<double> values(num_values);
+    for (auto& value : values) {
+        value = dist(rng);
+    }
+    return values;
+}
+
+static void BM_TDigest_Add(benchmark::State& state) {
+    size_t num_values = state.range(0);
+    bool batch = state.range(1);
+    auto values = gen_values(num_values);
+
+    for (auto _ : state) {
+        PercentileValue percentile;
+        if (batch) {
+            percentile.add_batch(values.data(), values.size());
+        } else {
+            for (auto value : values) {
+                percentile.add(static_cast<float>(value));
+            }
+        }
+        benchmark::DoNotOptimize(percentile.quantile(0.5));
+    }
+}
+
+static void BM_TDigest_Merge(benchmark::State& state) {
+    size_t num_percentiles = state.range(0);
+    bool batch = state.range(1);
+    std::vector<PercentileValue> percentiles(num_percentiles);
+    std::vector<const PercentileValue*> ptrs;
+    for (size_t i = 0; i < num_percentiles; i++) {
+        auto values = gen_values(4096 + i);
+        percentiles[i].add_batch(values.data(), values.size());
+        ptrs.push_back(&percentiles[i]);
+    }
+
+    for (auto _ : state) {
+        PercentileValue percentile;
+        if (batch) {
+            percentile.merge(ptrs);
+        } else {
+            for (const auto* other : ptrs) {
+                percentile.merge(other);
+            }
+        }
+        benchmark::DoNotOptimize(percentile.quantile(0.5));
+    }
+}
+
+BENCHMARK(BM_TDigest_Add)->Args({4096, false})->Args({4096, true})->Args({1 << 20, false})->Args({1 << 20, true});
+BENCHMARK(BM_TDigest_Merge)->Args({16, false})->Args({16, true})->Args({256, false})->Args({256, true});
+
+} // namespace starrocks
+
+BENCHMARK_MAIN();
@@ -39,6 +39,8 @@ namespace fs = std::filesystem;
 // block_size may cause heavy read amplification. So, we also limit it to 2 MB as an empirical value.
 const size_t BlockCache::MAX_BLOCK_SIZE = 2 * 1024 * 1024;
 
+const size_t BlockCache::ACCESS_COUNTER_NUM = 1 << 20;
+
 BlockCache* BlockCache::instance() {
     static BlockCache cache;
     return &cache;
@@ -70,6 +72,7 @@ Status BlockCache::init(const CacheOptions& options) {
         return Status::NotSupported("unsupported block cache engine");
     }
     RETURN_IF_ERROR(_kv_cache->init(cache_options));
+    _access_counters = std::make_unique<std::atomic<uint8_t>[]>(ACCESS_COUNTER_NUM);
     _initialized.store(true, std::memory_order_relaxed);
     if (_disk_space_monitor) {
         _disk_space_monitor->start();
@@ -89,9 +92,33 @@ Status BlockCache::write_buffer(const CacheKey& cache_key, off_t offset, const I
 
     size_t index = offset / _block_size;
     std::string block_key = fmt::format("{}/{}", cache_key, index);
+    if ((options == nullptr || !options->overwrite) && !_admit(block_key)) {
+        return Status::Cancelled("block is not accessed frequently enough to be admitted");
+    }
     return _kv_cache->write_buffer(block_key, buffer, options);
 }
 
+bool BlockCache::_admit(const std::string& block_key) {
+    const int32_t min_access_count = config::datacache_admission_min_access_count;
+    if (min_access_count <= 1 || _access_counters == nullptr) {
+        return true;
+    }
+    // Counters saturate at UINT8_MAX and are halved every ACCESS_COUNTER_NUM attempts, so blocks that were
+    // popular long ago age out and the counters of different blocks colliding in the same slot stay small.
+    if ((_access_count.fetch_add(1, std::memory_order_relaxed) + 1) % ACCESS_COUNTER_NUM == 0) {
+        for (size_t i = 0; i < ACCESS_COUNTER_NUM; ++i) {
+            _access_counters[i].store(_access_counters[i].load(std::memory_order_relaxed) >> 1,
+                                      std::memory_order_relaxed);
+        }
+    }
+    auto& counter = _access_counters[std::hash<std::string>()(block_key) % ACCESS_COUNTER_NUM];
+    uint8_t count = counter.load(std::memory_order_relaxed);
+    while (count < UINT8_MAX &&
+           !counter.compare_exchange_weak(count, static_cast<uint8_t>(count + 1), std::memory_order_relaxed)) {
+    }
+    return count + 1 >= min_access_count;
+}
+
 static void empty_deleter(void*) {}
 
 Status BlockCache::write_buffer(const CacheKey& cache_key, off_t offset, size_t size, const char* data,
@@ -88,7 +88,14 @@ public:
 
     static const size_t MAX_BLOCK_SIZE;
 
+    // The number of counters used to estimate the access frequency of blocks for cache admission.
+    static const size_t ACCESS_COUNTER_NUM;
+
 private:
+    // Record an insertion attempt of the block and return whether it has been accessed often enough to be admitted.
+    // One-off blocks, such as these read by a large cold scan, are rejected so they don't evict the hot data.
+    bool _admit(const std::string& block_key);
+
 #ifndef BE_TEST
     BlockCache() = default;
 #endif
@@ -96,6 +103,8 @@ private:
     size_t _block_size = 0;
     std::unique_ptr<KvCache> _kv_cache;
     std::unique_ptr<DiskSpaceMonitor> _disk_space_monitor;
+    std::unique_ptr<std::atomic<uint8_t>[]> _access_counters;
+    std::atomic<uint64_t> _access_count = 0;
     std::atomic<bool> _initialized = false;
 };
 
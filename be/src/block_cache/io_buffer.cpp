@@ -41,4 +41,20 @@ size_t IOBuffer::copy_to(void* data, ssize_t size, size_t pos) const {
     return bytes_copied;
 }
 
+std::string_view IOBuffer::peek(size_t pos, size_t size) const {
+    size_t skip = pos;
+    for (size_t i = 0; i < _buf.backing_block_num(); ++i) {
+        auto sp = _buf.backing_block(i);
+        if (sp.size() <= skip) {
+            skip -= sp.size();
+            continue;
+        }
+        if (sp.size() - skip >= size) {
+            return {sp.data() + skip, size};
+        }
+        break;
+    }
+    return {};
+}
+
 } // namespace starrocks
@@ -16,6 +16,8 @@
 
 #include <butil/iobuf.h>
 
+#include <string_view>
+
 namespace starrocks {
 
 class IOBuffer {
@@ -35,6 +37,10 @@ public:
 
     size_t copy_to(void* data, ssize_t size = -1, size_t pos = 0) const;
 
+    // Return a view of [pos, pos + size) without copying if the range lies in a single backing block,
+    // otherwise return an empty view. The view is valid as long as this buffer holds the block.
+    std::string_view peek(size_t pos, size_t size) const;
+
     size_t size() const { return _buf.size(); }
 
     bool empty() const { return _buf.empty(); }
@@ -139,6 +139,8 @@ CONF_mInt32(report_workgroup_interval_seconds, "5");
 CONF_mInt32(report_resource_usage_interval_ms, "1000");
 // The max download speed(KB/s).
 CONF_mInt32(max_download_speed_kbps, "50000");
+// The number of files a clone task downloads concurrently, max_download_speed_kbps applies to each of them.
+CONF_mInt32(clone_download_file_parallelism, "4");
 // The download low speed limit(KB/s).
 CONF_mInt32(download_low_speed_limit_kbps, "50");
 // The download low speed time(seconds).
@@ -195,6 +197,9 @@ CONF_Bool(compress_rowbatches, "true");
 // Compress ratio when shuffle row_batches in network, not in storage engine.
 // If ratio is less than this value, use uncompressed data instead.
 CONF_mDouble(rpc_compress_ratio_threshold, "1.1");
+// If true, ExchangeSinkOperator serializes chunks into buffers which are handed over to the brpc attachment
+// without copy, instead of serializing into ChunkPB and then copying to the attachment.
+CONF_mBool(exchange_sink_enable_zero_copy_attachment, "false");
 // Serialize and deserialize each returned row batch.
 CONF_Bool(serialize_batch, "false");
 // Interval between profile reports; in seconds.
@@ -266,6 +271,9 @@ CONF_Int64(index_stream_cache_capacity, "10737418240");
 
 // data and index page size, default is 64k
 CONF_Int32(data_page_size, "65536");
+// max number of rows in a data page, 0 means only limited by data_page_size. Smaller pages make the page level
+// zone map index finer, e.g. for columns of small types whose 64k pages hold tens of thousands of rows.
+CONF_mInt32(data_page_max_rows, "0");
 
 // Cache for storage page size
 CONF_mString(storage_page_cache_limit, "20%");
@@ -277,6 +285,19 @@ CONF_mBool(enable_bitmap_index_memory_page_cache, "false");
 CONF_mBool(enable_zonemap_index_memory_page_cache, "false");
 // whether to enable the ordinal index memory cache
 CONF_mBool(enable_ordinal_index_memory_page_cache, "false");
+// whether to keep index, dictionary and short key pages in the durable part of the page cache, so that
+// they are evicted only after all the data pages
+CONF_mBool(storage_page_cache_protect_index_pages, "true");
+// data pages of a tablet whose data size exceeds this ratio of the page cache capacity are not inserted into the
+// page cache by query scans, so that one large scan cannot evict the whole cache. 0 means always insert.
+CONF_mDouble(storage_page_cache_scan_admission_ratio, "0");
+// whether to cache data pages as they are stored on disk instead of decompressed and decoded, which makes the
+// page cache hold more pages at the cost of decompressing them on every hit. Index and dictionary pages
+// are always cached decoded.
+CONF_Bool(storage_page_cache_keep_compressed_data_page, "false");
+// whether to keep the row id bitmaps of inverted index queries in the page cache, so that a repeated
+// MATCH predicate on the same segment does not search the CLucene index again
+CONF_mBool(enable_inverted_index_query_result_cache, "true");
 // whether to disable column pool
 CONF_Bool(disable_column_pool, "true");
 
@@ -303,6 +324,15 @@ CONF_Int32(cumulative_compaction_num_threads_per_disk, "1");
 // when candidate num reach this value, the condidate with lowest score will be dropped.
 CONF_mInt64(max_compaction_candidate_num, "40960");
 
+// Weight of query read heat in the compaction candidate score. When it is greater than 0, the score of a tablet
+// is scaled by (1 + weight * log2(1 + scans)), where scans is the number of query scans on the tablet since its
+// candidate was last refreshed, so frequently read tablets with many rowsets are compacted first.
+CONF_mDouble(compaction_read_heat_weight, "0");
+
+// Advise the kernel to drop compaction output segment files from the page cache after they are synced and
+// closed, so large compaction outputs do not evict hot data of queries. Spill files can use direct io instead.
+CONF_mBool(compaction_drop_page_cache_on_close, "false");
+
 // If true, SR will try no to merge delta column back to main segment
 CONF_mBool(enable_lazy_delta_column_compaction, "true");
 
@@ -379,6 +409,9 @@ CONF_Int64(load_data_reserve_hours, "4");
 CONF_mInt64(load_error_log_reserve_hours, "48");
 CONF_mInt32(number_tablet_writer_threads, "16");
 CONF_mInt64(max_queueing_memtable_per_tablet, "2");
+// If true, OlapTableSink sorts the rows sent to each tablet by key columns, so that receivers get ordered
+// input and can skip sorting memtables. It trades CPU of the sending BE for the receiving BEs.
+CONF_mBool(enable_load_presort, "false");
 // when memory limit exceed and memtable last update time exceed this time, memtable will be flushed
 CONF_mInt64(stale_memtable_flush_time_sec, "30");
 
@@ -493,7 +526,8 @@ CONF_String(scratch_dirs, "/tmp");
 // then only the first writable directory is used
 // CONF_Bool(allow_multiple_scratch_dirs_per_device, "false");
 
-// Linux transparent huge page.
+// Linux transparent huge page. If true, chunks of at least 2MB allocated by the chunk allocator
+// are advised (MADV_HUGEPAGE) to be backed by transparent huge pages.
 CONF_Bool(madvise_huge_pages, "false");
 
 // Whether use mmap to allocate memory.
@@ -515,6 +549,9 @@ CONF_mInt64(write_buffer_size, "104857600");
 // user should set these configs properly if necessary.
 CONF_Int32(query_max_memory_limit_percent, "90");
 CONF_Double(query_pool_spill_mem_limit_threshold, "1.0");
+// When the spill memory of a resource group or the query pool runs out, only the queries consuming at least
+// this ratio of the biggest query under it are asked to spill. 0 means all the spillable queries spill.
+CONF_mDouble(spill_arbitration_min_consumption_ratio, "0");
 CONF_Int64(load_process_max_memory_limit_bytes, "107374182400"); // 100GB
 CONF_Int32(load_process_max_memory_limit_percent, "30");         // 30%
 CONF_mBool(enable_new_load_on_memory_limit_exceeded, "true");
@@ -612,6 +649,9 @@ CONF_mDouble(storage_high_usage_disk_protect_ratio, "0.1"); // 10%
 
 // Number of thread for flushing memtable per store.
 CONF_mInt32(flush_thread_num_per_store, "2");
+// Whether the memtables of one duplicate-key tablet can be flushed concurrently into separate segments
+// when the load has no secondary replicas. Otherwise they are flushed one by one.
+CONF_mBool(enable_parallel_memtable_flush, "false");
 
 // Number of thread for flushing memtable per store in shared-data mode.
 // Default value is cpu cores * 2
@@ -743,6 +783,13 @@ CONF_Int64(pipeline_sink_io_thread_pool_queue_size, "102400");
 CONF_Int64(pipeline_sink_buffer_size, "64");
 // The degree of parallelism of brpc.
 CONF_Int64(pipeline_sink_brpc_dop, "64");
+// Whether to coalesce the small chunk requests of the fragment instances on the same destination BE into one rpc.
+CONF_mBool(pipeline_sink_enable_rpc_coalescing, "false");
+// The coalesced rpc is sent when the size of its chunks exceeds this value, and the chunk requests
+// larger than this value are not coalesced.
+CONF_mInt64(pipeline_sink_coalesce_max_bytes, "262144");
+// The max time that a chunk request waits for coalescing.
+CONF_mInt64(pipeline_sink_coalesce_max_delay_us, "1000");
 // Used to reject coming fragment instances, when the number of running drivers
 // exceeds it*pipeline_exec_thread_pool_thread_num.
 CONF_Int64(pipeline_max_num_drivers_per_exec_thread, "10240");
@@ -752,6 +799,23 @@ CONF_mBool(pipeline_print_profile, "false");
 // when the value of level_time_slice_base_ns is smaller and queue_ratio_of_adjacent_queue is larger.
 CONF_Int64(pipeline_driver_queue_level_time_slice_base_ns, "200000000");
 CONF_Double(pipeline_driver_queue_ratio_of_adjacent_queue, "1.2");
+// Whether to split the ready driver queue of each workgroup per NUMA node and pin the pipeline execution threads
+// to the cores of a NUMA node. A driver stays on the NUMA node where it first ran, and is only stolen by the
+// threads of the other nodes when the queue of their own node is empty.
+CONF_Bool(pipeline_enable_numa_aware_scheduling, "false");
+// Whether to give each pipeline execution thread a lock-free local queue. The driver yielded by an execution thread
+// is put back to its local queue, unless its workgroup should yield to the others, and the idle execution threads
+// steal drivers from the local queues of the others.
+CONF_Bool(pipeline_enable_driver_work_stealing, "false");
+// The capacity of the local queue of each pipeline execution thread, used when pipeline_enable_driver_work_stealing
+// is true. The driver is put back to the global queue, when the local queue is full.
+CONF_Int32(pipeline_driver_local_queue_capacity, "64");
+// Whether PipelineDriverPoller parks the drivers blocked by the operators which post readiness events
+// (exchange source and exchange sink), instead of polling them in every round.
+CONF_mBool(pipeline_poller_enable_event_scheduling, "false");
+// The interval to poll the drivers parked for events, which is used to check cancellation and expiration, and
+// as a safety net for the missed events.
+CONF_mInt64(pipeline_poller_event_fallback_interval_ms, "100");
 // 0 represents PriorityScanTaskQueue (by default), while 1 represents MultiLevelFeedScanTaskQueue.
 // - PriorityScanTaskQueue prioritizes scan tasks with lower committed times.
 // - MultiLevelFeedScanTaskQueue prioritizes scan tasks with shorter execution time.
@@ -766,7 +830,16 @@ CONF_Int32(pipeline_analytic_max_buffer_size, "128");
 CONF_Int32(pipeline_analytic_removable_chunk_num, "128");
 CONF_Bool(pipeline_analytic_enable_streaming_process, "true");
 CONF_Bool(pipeline_analytic_enable_removable_cumulative_process, "true");
+// Whether to spread the partitions of a single sorted analytic input stream over all the drivers of the fragment,
+// each partition is sent to one driver as a whole, so the analytic functions are evaluated in parallel.
+CONF_mBool(pipeline_analytic_enable_ordered_partition_exchange, "false");
 CONF_Int32(pipline_limit_max_delivery, "4096");
+// Whether to merge the sorted runs of all the drivers in parallel by merge path for ORDER BY without LIMIT,
+// even if the plan does not enable parallel merge.
+CONF_mBool(pipeline_enable_full_sort_parallel_merge, "false");
+// Whether to sort the leading integral ORDER BY columns by a memcomparable normalized key at first,
+// and only sort the rows with equal keys by the remaining columns.
+CONF_mBool(enable_sort_normalized_key, "false");
 /// For parallel scan on the single tablet.
 // These three configs are used to calculate the minimum number of rows picked up from a segment at one time.
 // It is `splitted_scan_bytes/scan_row_bytes` and restricted in the range [min_splitted_scan_rows, max_splitted_scan_rows].
@@ -843,14 +916,30 @@ CONF_Int32(orc_tiny_stripe_threshold_size, "8388608");
 // we'll read the whole file at once instead of reading a footer first.
 CONF_Int32(orc_loading_buffer_size, "8388608");
 
+// orc writer
+// String columns are dictionary encoded if the ratio of distinct values to rows in the first row group is not
+// greater than this threshold, otherwise they fall back to direct encoding. 0 disables dictionary encoding.
+CONF_mDouble(orc_writer_dictionary_key_size_threshold, "0.8");
+
 // parquet reader
 CONF_mBool(parquet_coalesce_read_enable, "true");
 CONF_Bool(parquet_late_materialization_enable, "true");
 CONF_Bool(parquet_page_index_enable, "true");
+// Capacity in bytes of the BE-wide in-memory cache of parsed parquet footers. It is only used when the
+// footer can not be cached in block cache (starcache disabled or unavailable), 0 means disabled.
+CONF_Int64(parquet_file_metadata_cache_size, "0");
+
+// parquet writer
+// If true, the async parquet file writer encodes and compresses the columns of each chunk concurrently
+// in its io executor pool, the last column and the ones the pool can not take are encoded in the writing thread.
+CONF_mBool(enable_parquet_writer_parallel_encode, "false");
 
 CONF_Int32(io_coalesce_read_max_buffer_size, "8388608");
 CONF_Int32(io_coalesce_read_max_distance_size, "1048576");
 CONF_mBool(io_coalesce_adaptive_lazy_active, "true");
+// If true, the max distance of coalesced ranges of external table scans is derived from the observed latency and
+// throughput of the storage (bounded by io_coalesce_read_max_buffer_size) instead of io_coalesce_read_max_distance_size.
+CONF_mBool(io_coalesce_adaptive_distance, "false");
 CONF_Int32(io_tasks_per_scan_operator, "4");
 CONF_Int32(connector_io_tasks_per_scan_operator, "16");
 CONF_Int32(connector_io_tasks_min_size, "2");
@@ -889,6 +978,11 @@ CONF_mBool(aws_sdk_enable_compliant_rfc3986_encoding, "false");
 CONF_mInt64(experimental_s3_max_single_part_size, "16777216");
 // default: 16MB
 CONF_mInt64(experimental_s3_min_upload_part_size, "16777216");
+// A read of S3InputStream that is at least twice of this size is split into parts fetched by concurrent
+// GetObject requests on the same client. 0 means disabled.
+CONF_mInt64(s3_read_parallel_part_size, "0");
+// Max number of concurrent GetObject requests of one read.
+CONF_mInt32(s3_read_max_parallel_parts, "8");
 
 CONF_Int64(max_load_dop, "16");
 
@@ -906,6 +1000,12 @@ CONF_Int64(send_rpc_runtime_filter_timeout_ms, "1000");
 // if runtime filter size is larger than send_runtime_filter_via_http_rpc_min_size, be will transmit runtime filter via http protocol.
 // this is a default value, maybe changed by global_runtime_filter_rpc_http_min_size in session variable.
 CONF_Int64(send_runtime_filter_via_http_rpc_min_size, "67108864");
+// Whether to publish an early local runtime filter when half of the partitioned hash join builders are finished.
+// The early filter only filters the rows of the finished partitions, and is replaced by the final one.
+CONF_mBool(enable_early_runtime_filter_publish, "false");
+// Whether to compress the bloom filters of the global runtime filters sent to other BEs with lz4.
+// Only turn it on when all the BEs of the cluster are able to read the compressed runtime filters.
+CONF_mBool(enable_runtime_filter_compression, "false");
 
 CONF_Int64(rpc_connect_timeout_ms, "30000");
 
@@ -967,6 +1067,8 @@ CONF_mBool(lake_print_delete_log, "false");
 CONF_mInt64(lake_compaction_stream_buffer_size_bytes, "1048576"); // 1MB
 // The interval to check whether lake compaction is valid. Set to <= 0 to disable the check.
 CONF_mInt32(lake_compaction_check_valid_interval_minutes, "30"); // 30 minutes
+// Whether to prefetch the metadata of all tablets of a lake compaction request when the request is received.
+CONF_mBool(lake_compaction_prefetch_tablet_metadata, "true");
 // Used to ensure service availability in extreme situations by sacrificing a certain degree of correctness
 CONF_mBool(experimental_lake_ignore_lost_segment, "false");
 CONF_mInt64(experimental_lake_wait_per_put_ms, "0");
@@ -975,6 +1077,11 @@ CONF_mInt64(experimental_lake_wait_per_delete_ms, "0");
 CONF_mBool(experimental_lake_ignore_pk_consistency_check, "false");
 CONF_mInt64(lake_publish_version_slow_log_ms, "1000");
 CONF_mBool(lake_enable_publish_version_trace_log, "false");
+// Whether to read the txn logs of a batch publish concurrently instead of one by one.
+CONF_mBool(lake_enable_publish_version_prefetch_txn_log, "true");
+// Whether to look up the combined metadata object of the partition when the metadata file of a tablet
+// version does not exist.
+CONF_mBool(lake_enable_combined_tablet_metadata, "false");
 CONF_mString(lake_vacuum_retry_pattern, "*request rate*");
 CONF_mInt64(lake_vacuum_retry_max_attempts, "5");
 CONF_mInt64(lake_vacuum_retry_min_delay_ms, "100");
@@ -987,6 +1094,12 @@ CONF_mInt64(lake_pk_compaction_min_input_segments, "5");
 CONF_mInt32(lake_pk_preload_memory_limit_percent, "30");
 CONF_mInt32(lake_pk_index_sst_min_compaction_versions, "2");
 CONF_mInt32(lake_pk_index_sst_max_compaction_bytes, /*1GB*/ "1073741824");
+// whether major compaction of the lake pk index merges runs of similar sized sstables instead of always
+// merging from the oldest sstable
+CONF_mBool(lake_pk_index_sst_size_tiered_compaction, "true");
+// in size tiered compaction, an older sstable joins a run only if it is at most this percent larger than
+// the total size of the run
+CONF_mInt32(lake_pk_index_sst_compaction_size_ratio, "100");
 CONF_Int32(lake_pk_index_block_cache_limit_percent, "10");
 
 CONF_mBool(dependency_librdkafka_debug_enable, "false");
@@ -1032,6 +1145,9 @@ CONF_Int64(spill_max_log_block_container_bytes, "10737418240"); // 10GB
 // be the same with storage path. Spill will return with error when used size has exceeded
 // the limit.
 CONF_mDouble(spill_max_dir_bytes_ratio, "0.8"); // 80%
+// The number of chunks each spilled input stream reads ahead in one restore io task,
+// so that the io of restoring overlaps with the computation on the restored chunks.
+CONF_mInt32(spill_read_ahead_chunks, "2");
 
 CONF_Int32(internal_service_query_rpc_thread_num, "-1");
 
@@ -1093,6 +1209,9 @@ CONF_Bool(datacache_tiered_cache_enable, "true");
 CONF_String(datacache_engine, "");
 // The interval time (millisecond) for agent report datacache metrics to FE.
 CONF_mInt32(report_datacache_metrics_interval_ms, "60000");
+// A block is only populated into datacache after it has missed the cache this many times recently, which keeps
+// large one-off scans from evicting the hot data. Values less than or equal to 1 admit every block.
+CONF_mInt32(datacache_admission_min_access_count, "1");
 // Whether enable automatically adjust cache space quota.
 // If true, the cache will choose an appropriate quota based on the current remaining space as the quota.
 // and the quota also will be changed dynamiclly.
@@ -1154,6 +1273,9 @@ CONF_mInt64(pindex_major_compaction_schedule_interval_seconds, "15");
 CONF_mInt64(pindex_shared_data_gc_evict_interval_seconds, "18000"); // 5 hour
 // enable use bloom filter for pindex or not
 CONF_mBool(enable_pindex_filter, "true");
+// number of rowsets of a tablet that are read in parallel when its persistent index is rebuilt from the
+// tablet data, e.g. the first time the tablet is written after a restart. 1 reads the rowsets one by one.
+CONF_mInt32(pindex_rebuild_parallelism, "4");
 // enable persistent index compression
 CONF_mBool(enable_pindex_compression, "true");
 // use bloom filter in pindex can reduce disk io, but in the following scenarios, we should skip the bloom filter
@@ -1201,10 +1323,33 @@ CONF_String(rocksdb_db_options_string, "create_if_missing=true;create_missing_co
 
 // limit local exchange buffer's memory size per driver
 CONF_Int64(local_exchange_buffer_mem_limit_per_driver, "134217728"); // 128MB
+// A partition key of local exchange is hot if it takes more than this ratio of the sampled rows,
+// and more than the share of two drivers. Non-positive value disables the detection.
+CONF_mDouble(local_exchange_hot_key_ratio, "0.1");
+// Whether to split the rows of hot keys to multiple drivers round-robin, it only takes effect when
+// the downstream operators are tolerant of that, e.g. connector sinks.
+CONF_mBool(local_exchange_enable_hot_key_split, "false");
 // only used for test. default: 128M
 CONF_mInt64(streaming_agg_limited_memory_size, "134217728");
 // pipeline streaming aggregate chunk buffer size
 CONF_mInt32(streaming_agg_chunk_buffer_size, "1024");
+// Whether to build the linear probing hash map for the unique int or bigint key of hash join.
+CONF_mBool(enable_hash_join_linear_probing, "true");
+// The hash table of hash join is built by several threads if it has at least this number of rows,
+// and a non-positive value disables the parallel build.
+CONF_mInt64(hash_join_parallel_build_min_rows, "4194304");
+// The max number of threads to build a hash table, and a non-positive value means the number of cpu cores.
+CONF_mInt32(hash_join_parallel_build_max_dop, "0");
+// The number of threads of the pool to build the hash tables of hash join, and a non-positive value means
+// the number of cpu cores.
+CONF_Int32(hash_join_build_thread_pool_thread_num, "0");
+// Whether to cluster the rows of a large join hash table by their buckets into cache-sized radix partitions,
+// and to look up the buckets for a probe chunk partition by partition.
+CONF_mBool(enable_hash_join_radix_partition, "false");
+// The min bytes of a join hash table to be radix partitioned, which should be larger than the L3 cache.
+CONF_mInt64(hash_join_radix_partition_min_ht_bytes, "67108864");
+// The expected bytes of each radix partition of a join hash table, which should fit in the L2 cache.
+CONF_mInt64(hash_join_radix_partition_bytes, "262144");
 CONF_mInt64(wait_apply_time, "6000"); // 6s
 
 // Max size of a binlog file. The default is 512MB.
@@ -1219,6 +1364,8 @@ CONF_mInt32(update_cache_evict_internal_sec, "11");
 CONF_mBool(enable_auto_evict_update_cache, "true");
 
 CONF_mInt64(load_tablet_timeout_seconds, "60");
+// Number of threads each data dir uses to load tablet metas when BE starts. 1 loads the tablets serially.
+CONF_Int32(load_tablet_meta_threads_per_data_dir, "4");
 
 CONF_mBool(enable_pk_value_column_zonemap, "true");
 
@@ -1266,6 +1413,10 @@ CONF_mInt32(desc_hint_split_range, "10");
 CONF_mInt64(lake_local_pk_index_unused_threshold_seconds, "86400"); // 1 day
 
 CONF_mBool(lake_enable_vertical_compaction_fill_data_cache, "false");
+// Whether to always fill the local data cache when reading the footer and short key index of a lake segment,
+// even if the reader asks to skip it. The metadata is small and needed by every reader of the segment, and the
+// local data cache survives restarts, so reopening a segment does not have to go to the object storage again.
+CONF_mBool(lake_segment_metadata_fill_data_cache, "true");
 
 CONF_mInt32(dictionary_cache_refresh_timeout_ms, "60000"); // 1 min
 CONF_mInt32(dictionary_cache_refresh_threadpool_size, "8");
@@ -1291,6 +1442,11 @@ CONF_mInt64(pk_dump_interval_seconds, "3600"); // 1 hour
 // Min data processed when scaling connector sink writers, default value is the same as Trino
 CONF_mInt64(writer_scaling_min_size_mb, "128");
 
+// Max number of partition file writers a single connector sink keeps open. Each open writer buffers its pending
+// row group, so writing into many partitions at once can take a lot of memory. When the limit is reached, the
+// writer with the most written bytes is committed before opening a new one. 0 means no limit.
+CONF_mInt32(connector_sink_max_open_partition_writers, "0");
+
 // whether enable query profile for queries initiated by spark or flink
 CONF_mBool(enable_profile_for_external_plan, "false");
 
@@ -1305,6 +1461,17 @@ CONF_mBool(enable_light_pk_compaction_publish, "true");
 // if mem_limit < 16 GB, disable JIT.
 // else it = min(mem_limit*0.01, 1GB)
 CONF_mInt64(jit_lru_cache_size, "0");
+// The directory to persist the JIT compiled object code, which is loaded instead of compiling the same expression
+// again, even after restarts. Empty means the object code is only cached in memory.
+CONF_String(jit_object_cache_dir, "");
+
+// OR-ed constant LIKE/REGEXP predicates on the same column are matched together by one multi-pattern hyperscan
+// database when there are at least this many of them. <= 1 disables it.
+CONF_mInt32(like_multi_pattern_min_num, "3");
+
+// A function call whose only non-constant argument is a string column is evaluated once per distinct value and
+// mapped back by code, when the chunk has less than 1/N distinct values. <= 0 disables it.
+CONF_mInt32(function_call_distinct_string_ratio, "8");
 
 CONF_mInt64(arrow_io_coalesce_read_max_buffer_size, "8388608");
 CONF_mInt64(arrow_io_coalesce_read_max_distance_size, "1048576");
@@ -14,8 +14,11 @@
 
 #include "utils.h"
 
+#include <algorithm>
+
 #include "column/column.h"
 #include "column/datum.h"
+#include "common/config.h"
 #include "exprs/expr.h"
 #include "formats/parquet/parquet_file_writer.h"
 #include "util/url_coding.h"
@@ -129,6 +132,18 @@ StatusOr<ConnectorChunkSink::Futures> HiveUtils::hive_style_partitioning_write_c
             futures.add_chunk_futures.push_back(writer->write(chunk));
         }
     } else {
+        const size_t max_open_writers = std::max(config::connector_sink_max_open_partition_writers, 0);
+        if (max_open_writers > 0 && partition_writers.size() >= max_open_writers) {
+            // bound the memory held by open writers: close the largest one, its partition gets a new file if more
+            // rows arrive later.
+            auto largest = std::max_element(partition_writers.begin(), partition_writers.end(),
+                                            [](const auto& lhs, const auto& rhs) {
+                                                return lhs.second->get_written_bytes() <
+                                                       rhs.second->get_written_bytes();
+                                            });
+            futures.commit_file_futures.push_back(largest->second->commit());
+            partition_writers.erase(largest);
+        }
         auto path = partitioned ? location_provider->get(partition) : location_provider->get();
         ASSIGN_OR_RETURN(auto new_writer, file_writer_factory->create(path));
         RETURN_IF_ERROR(new_writer->init());
@@ -45,8 +45,9 @@ using AggDataPtr = uint8_t*;
 // one level agg hash map
 template <PhmapSeed seed>
 using Int8AggHashMap = SmallFixedSizeHashMap<int8_t, AggDataPtr, seed>;
+// The whole int16 key domain fits in a direct-mapped array, so group ids are found without hashing.
 template <PhmapSeed seed>
-using Int16AggHashMap = phmap::flat_hash_map<int16_t, AggDataPtr, StdHashWithSeed<int16_t, seed>>;
+using Int16AggHashMap = SmallFixedSizeHashMap<int16_t, AggDataPtr, seed>;
 template <PhmapSeed seed>
 using Int32AggHashMap = phmap::flat_hash_map<int32_t, AggDataPtr, StdHashWithSeed<int32_t, seed>>;
 template <PhmapSeed seed>
@@ -74,6 +75,19 @@ using FixedSize16SliceAggHashMap =
 // two level agg hash map
 template <PhmapSeed seed>
 using Int32AggTwoLevelHashMap = phmap::parallel_flat_hash_map<int32_t, AggDataPtr, StdHashWithSeed<int32_t, seed>>;
+template <PhmapSeed seed>
+using Int64AggTwoLevelHashMap = phmap::parallel_flat_hash_map<int64_t, AggDataPtr, StdHashWithSeed<int64_t, seed>>;
+template <PhmapSeed seed>
+using Int128AggTwoLevelHashMap = phmap::parallel_flat_hash_map<int128_t, AggDataPtr, Hash128WithSeed<seed>>;
+template <PhmapSeed seed>
+using FixedSize4SliceAggTwoLevelHashMap =
+        phmap::parallel_flat_hash_map<SliceKey4, AggDataPtr, FixedSizeSliceKeyHash<SliceKey4, seed>>;
+template <PhmapSeed seed>
+using FixedSize8SliceAggTwoLevelHashMap =
+        phmap::parallel_flat_hash_map<SliceKey8, AggDataPtr, FixedSizeSliceKeyHash<SliceKey8, seed>>;
+template <PhmapSeed seed>
+using FixedSize16SliceAggTwoLevelHashMap =
+        phmap::parallel_flat_hash_map<SliceKey16, AggDataPtr, FixedSizeSliceKeyHash<SliceKey16, seed>>;
 
 // The SliceAggTwoLevelHashMap will have 2 ^ 4 = 16 sub map,
 // The 16 is same as PartitionedAggregationNode::PARTITION_FANOUT
@@ -32,7 +32,7 @@ namespace starrocks {
 template <PhmapSeed seed>
 using Int8AggHashSet = SmallFixedSizeHashSet<int8_t, seed>;
 template <PhmapSeed seed>
-using Int16AggHashSet = phmap::flat_hash_set<int16_t, StdHashWithSeed<int16_t, seed>>;
+using Int16AggHashSet = SmallFixedSizeHashSet<int16_t, seed>;
 template <PhmapSeed seed>
 using Int32AggHashSet = phmap::flat_hash_set<int32_t, StdHashWithSeed<int32_t, seed>>;
 template <PhmapSeed seed>
@@ -60,6 +60,19 @@ using FixedSize16SliceAggHashSet = phmap::flat_hash_set<SliceKey16, FixedSizeSli
 // two level agg hash set
 template <PhmapSeed seed>
 using Int32AggTwoLevelHashSet = phmap::parallel_flat_hash_set<int32_t, StdHashWithSeed<int32_t, seed>>;
+template <PhmapSeed seed>
+using Int64AggTwoLevelHashSet = phmap::parallel_flat_hash_set<int64_t, StdHashWithSeed<int64_t, seed>>;
+template <PhmapSeed seed>
+using Int128AggTwoLevelHashSet = phmap::parallel_flat_hash_set<int128_t, Hash128WithSeed<seed>>;
+template <PhmapSeed seed>
+using FixedSize4SliceAggTwoLevelHashSet =
+        phmap::parallel_flat_hash_set<SliceKey4, FixedSizeSliceKeyHash<SliceKey4, seed>>;
+template <PhmapSeed seed>
+using FixedSize8SliceAggTwoLevelHashSet =
+        phmap::parallel_flat_hash_set<SliceKey8, FixedSizeSliceKeyHash<SliceKey8, seed>>;
+template <PhmapSeed seed>
+using FixedSize16SliceAggTwoLevelHashSet =
+        phmap::parallel_flat_hash_set<SliceKey16, FixedSizeSliceKeyHash<SliceKey16, seed>>;
 
 template <PhmapSeed seed>
 using SliceAggTwoLevelHashSet =
@@ -91,6 +91,30 @@ DEFINE_MAP_TYPE(AggHashMapVariant::Type::phase2_int32_two_level, Int32TwoLevelAg
 DEFINE_MAP_TYPE(AggHashMapVariant::Type::phase2_slice_fx4, SerializedKeyFixedSize4AggHashMap<PhmapSeed2>);
 DEFINE_MAP_TYPE(AggHashMapVariant::Type::phase2_slice_fx8, SerializedKeyFixedSize8AggHashMap<PhmapSeed2>);
 DEFINE_MAP_TYPE(AggHashMapVariant::Type::phase2_slice_fx16, SerializedKeyFixedSize16AggHashMap<PhmapSeed2>);
+DEFINE_MAP_TYPE(AggHashMapVariant::Type::phase1_int64_two_level, Int64TwoLevelAggHashMapWithOneNumberKey<PhmapSeed1>);
+DEFINE_MAP_TYPE(AggHashMapVariant::Type::phase1_int128_two_level, Int128TwoLevelAggHashMapWithOneNumberKey<PhmapSeed1>);
+DEFINE_MAP_TYPE(AggHashMapVariant::Type::phase1_null_int64_two_level,
+                NullInt64TwoLevelAggHashMapWithOneNumberKey<PhmapSeed1>);
+DEFINE_MAP_TYPE(AggHashMapVariant::Type::phase1_null_int128_two_level,
+                NullInt128TwoLevelAggHashMapWithOneNumberKey<PhmapSeed1>);
+DEFINE_MAP_TYPE(AggHashMapVariant::Type::phase1_slice_fx4_two_level,
+                SerializedKeyFixedSize4TwoLevelAggHashMap<PhmapSeed1>);
+DEFINE_MAP_TYPE(AggHashMapVariant::Type::phase1_slice_fx8_two_level,
+                SerializedKeyFixedSize8TwoLevelAggHashMap<PhmapSeed1>);
+DEFINE_MAP_TYPE(AggHashMapVariant::Type::phase1_slice_fx16_two_level,
+                SerializedKeyFixedSize16TwoLevelAggHashMap<PhmapSeed1>);
+DEFINE_MAP_TYPE(AggHashMapVariant::Type::phase2_int64_two_level, Int64TwoLevelAggHashMapWithOneNumberKey<PhmapSeed2>);
+DEFINE_MAP_TYPE(AggHashMapVariant::Type::phase2_int128_two_level, Int128TwoLevelAggHashMapWithOneNumberKey<PhmapSeed2>);
+DEFINE_MAP_TYPE(AggHashMapVariant::Type::phase2_null_int64_two_level,
+                NullInt64TwoLevelAggHashMapWithOneNumberKey<PhmapSeed2>);
+DEFINE_MAP_TYPE(AggHashMapVariant::Type::phase2_null_int128_two_level,
+                NullInt128TwoLevelAggHashMapWithOneNumberKey<PhmapSeed2>);
+DEFINE_MAP_TYPE(AggHashMapVariant::Type::phase2_slice_fx4_two_level,
+                SerializedKeyFixedSize4TwoLevelAggHashMap<PhmapSeed2>);
+DEFINE_MAP_TYPE(AggHashMapVariant::Type::phase2_slice_fx8_two_level,
+                SerializedKeyFixedSize8TwoLevelAggHashMap<PhmapSeed2>);
+DEFINE_MAP_TYPE(AggHashMapVariant::Type::phase2_slice_fx16_two_level,
+                SerializedKeyFixedSize16TwoLevelAggHashMap<PhmapSeed2>);
 
 template <AggHashSetVariant::Type>
 struct AggHashSetVariantTypeTraits;
@@ -161,6 +185,30 @@ DEFINE_SET_TYPE(AggHashSetVariant::Type::phase1_slice_fx16, SerializedKeyAggHash
 DEFINE_SET_TYPE(AggHashSetVariant::Type::phase2_slice_fx4, SerializedKeyAggHashSetFixedSize4<PhmapSeed2>);
 DEFINE_SET_TYPE(AggHashSetVariant::Type::phase2_slice_fx8, SerializedKeyAggHashSetFixedSize8<PhmapSeed2>);
 DEFINE_SET_TYPE(AggHashSetVariant::Type::phase2_slice_fx16, SerializedKeyAggHashSetFixedSize16<PhmapSeed2>);
+DEFINE_SET_TYPE(AggHashSetVariant::Type::phase1_int64_two_level, Int64TwoLevelAggHashSetOfOneNumberKey<PhmapSeed1>);
+DEFINE_SET_TYPE(AggHashSetVariant::Type::phase1_int128_two_level, Int128TwoLevelAggHashSetOfOneNumberKey<PhmapSeed1>);
+DEFINE_SET_TYPE(AggHashSetVariant::Type::phase1_null_int64_two_level,
+                NullInt64TwoLevelAggHashSetOfOneNumberKey<PhmapSeed1>);
+DEFINE_SET_TYPE(AggHashSetVariant::Type::phase1_null_int128_two_level,
+                NullInt128TwoLevelAggHashSetOfOneNumberKey<PhmapSeed1>);
+DEFINE_SET_TYPE(AggHashSetVariant::Type::phase1_slice_fx4_two_level,
+                SerializedKeyTwoLevelAggHashSetFixedSize4<PhmapSeed1>);
+DEFINE_SET_TYPE(AggHashSetVariant::Type::phase1_slice_fx8_two_level,
+                SerializedKeyTwoLevelAggHashSetFixedSize8<PhmapSeed1>);
+DEFINE_SET_TYPE(AggHashSetVariant::Type::phase1_slice_fx16_two_level,
+                SerializedKeyTwoLevelAggHashSetFixedSize16<PhmapSeed1>);
+DEFINE_SET_TYPE(AggHashSetVariant::Type::phase2_int64_two_level, Int64TwoLevelAggHashSetOfOneNumberKey<PhmapSeed2>);
+DEFINE_SET_TYPE(AggHashSetVariant::Type::phase2_int128_two_level, Int128TwoLevelAggHashSetOfOneNumberKey<PhmapSeed2>);
+DEFINE_SET_TYPE(AggHashSetVariant::Type::phase2_null_int64_two_level,
+                NullInt64TwoLevelAggHashSetOfOneNumberKey<PhmapSeed2>);
+DEFINE_SET_TYPE(AggHashSetVariant::Type::phase2_null_int128_two_level,
+                NullInt128TwoLevelAggHashSetOfOneNumberKey<PhmapSeed2>);
+DEFINE_SET_TYPE(AggHashSetVariant::Type::phase2_slice_fx4_two_level,
+                SerializedKeyTwoLevelAggHashSetFixedSize4<PhmapSeed2>);
+DEFINE_SET_TYPE(AggHashSetVariant::Type::phase2_slice_fx8_two_level,
+                SerializedKeyTwoLevelAggHashSetFixedSize8<PhmapSeed2>);
+DEFINE_SET_TYPE(AggHashSetVariant::Type::phase2_slice_fx16_two_level,
+                SerializedKeyTwoLevelAggHashSetFixedSize16<PhmapSeed2>);
 
 } // namespace detail
 void AggHashMapVariant::init(RuntimeState* state, Type type, AggStatistics* agg_stat) {
@@ -177,28 +225,72 @@ void AggHashMapVariant::init(RuntimeState* state, Type type, AggStatistics* agg_
     }
 }
 
-#define CONVERT_TO_TWO_LEVEL_MAP(DST, SRC)                                                                            \
-    if (_type == AggHashMapVariant::Type::SRC) {                                                                      \
-        auto dst = std::make_unique<detail::AggHashMapVariantTypeTraits<Type::DST>::HashMapWithKeyType>(              \
-                state->chunk_size(), _agg_stat);                                                                      \
-        std::visit(                                                                                                   \
-                [&](auto& hash_map_with_key) {                                                                        \
-                    if constexpr (std::is_same_v<typename decltype(hash_map_with_key->hash_map)::key_type,            \
-                                                 typename decltype(dst->hash_map)::key_type>) {                       \
-                        dst->hash_map.reserve(hash_map_with_key->hash_map.capacity());                                \
-                        dst->hash_map.insert(hash_map_with_key->hash_map.begin(), hash_map_with_key->hash_map.end()); \
-                    }                                                                                                 \
-                },                                                                                                    \
-                hash_map_with_key);                                                                                   \
-                                                                                                                      \
-        _type = AggHashMapVariant::Type::DST;                                                                         \
-        hash_map_with_key = std::move(dst);                                                                           \
-        return;                                                                                                       \
+namespace detail {
+// move the keys and the states in the one level hash map/set `src` to the two level one `dst`.
+template <typename Dst, typename Src>
+void move_to_two_level_map(Dst* dst, Src* src) {
+    dst->hash_map.reserve(src->hash_map.capacity());
+    dst->hash_map.insert(src->hash_map.begin(), src->hash_map.end());
+    if constexpr (Src::has_single_null_key && Dst::has_single_null_key) {
+        dst->null_key_data = src->null_key_data;
+    }
+    if constexpr (is_combined_fixed_size_key<Src> && is_combined_fixed_size_key<Dst>) {
+        dst->has_null_column = src->has_null_column;
+        dst->fixed_byte_size = src->fixed_byte_size;
+    }
+}
+
+template <typename Dst, typename Src>
+void move_to_two_level_set(Dst* dst, Src* src) {
+    dst->hash_set.reserve(src->hash_set.capacity());
+    dst->hash_set.insert(src->hash_set.begin(), src->hash_set.end());
+    if constexpr (Src::has_single_null_key && Dst::has_single_null_key) {
+        dst->has_null_key = src->has_null_key;
+    }
+    if constexpr (is_combined_fixed_size_key<Src> && is_combined_fixed_size_key<Dst>) {
+        dst->has_null_column = src->has_null_column;
+        dst->fixed_byte_size = src->fixed_byte_size;
+    }
+}
+} // namespace detail
+
+#define CONVERT_TO_TWO_LEVEL_MAP(DST, SRC)                                                                 \
+    if (_type == AggHashMapVariant::Type::SRC) {                                                           \
+        auto dst = std::make_unique<detail::AggHashMapVariantTypeTraits<Type::DST>::HashMapWithKeyType>(   \
+                state->chunk_size(), _agg_stat);                                                           \
+        std::visit(                                                                                        \
+                [&](auto& hash_map_with_key) {                                                             \
+                    if constexpr (std::is_same_v<typename decltype(hash_map_with_key->hash_map)::key_type, \
+                                                 typename decltype(dst->hash_map)::key_type>) {            \
+                        detail::move_to_two_level_map(dst.get(), hash_map_with_key.get());                 \
+                    }                                                                                      \
+                },                                                                                         \
+                hash_map_with_key);                                                                        \
+                                                                                                           \
+        _type = AggHashMapVariant::Type::DST;                                                              \
+        hash_map_with_key = std::move(dst);                                                                \
+        return;                                                                                            \
     }
 
 void AggHashMapVariant::convert_to_two_level(RuntimeState* state) {
     CONVERT_TO_TWO_LEVEL_MAP(phase1_slice_two_level, phase1_slice);
     CONVERT_TO_TWO_LEVEL_MAP(phase2_slice_two_level, phase2_slice);
+    CONVERT_TO_TWO_LEVEL_MAP(phase1_int32_two_level, phase1_int32);
+    CONVERT_TO_TWO_LEVEL_MAP(phase2_int32_two_level, phase2_int32);
+    CONVERT_TO_TWO_LEVEL_MAP(phase1_int64_two_level, phase1_int64);
+    CONVERT_TO_TWO_LEVEL_MAP(phase2_int64_two_level, phase2_int64);
+    CONVERT_TO_TWO_LEVEL_MAP(phase1_int128_two_level, phase1_int128);
+    CONVERT_TO_TWO_LEVEL_MAP(phase2_int128_two_level, phase2_int128);
+    CONVERT_TO_TWO_LEVEL_MAP(phase1_null_int64_two_level, phase1_null_int64);
+    CONVERT_TO_TWO_LEVEL_MAP(phase2_null_int64_two_level, phase2_null_int64);
+    CONVERT_TO_TWO_LEVEL_MAP(phase1_null_int128_two_level, phase1_null_int128);
+    CONVERT_TO_TWO_LEVEL_MAP(phase2_null_int128_two_level, phase2_null_int128);
+    CONVERT_TO_TWO_LEVEL_MAP(phase1_slice_fx4_two_level, phase1_slice_fx4);
+    CONVERT_TO_TWO_LEVEL_MAP(phase2_slice_fx4_two_level, phase2_slice_fx4);
+    CONVERT_TO_TWO_LEVEL_MAP(phase1_slice_fx8_two_level, phase1_slice_fx8);
+    CONVERT_TO_TWO_LEVEL_MAP(phase2_slice_fx8_two_level, phase2_slice_fx8);
+    CONVERT_TO_TWO_LEVEL_MAP(phase1_slice_fx16_two_level, phase1_slice_fx16);
+    CONVERT_TO_TWO_LEVEL_MAP(phase2_slice_fx16_two_level, phase2_slice_fx16);
 }
 
 void AggHashMapVariant::reset() {
@@ -252,27 +344,42 @@ void AggHashSetVariant::init(RuntimeState* state, Type type, AggStatistics* agg_
     }
 }
 
-#define CONVERT_TO_TWO_LEVEL_SET(DST, SRC)                                                                            \
-    if (_type == AggHashSetVariant::Type::SRC) {                                                                      \
-        auto dst = std::make_unique<detail::AggHashSetVariantTypeTraits<Type::DST>::HashSetWithKeyType>(              \
-                state->chunk_size());                                                                                 \
-        std::visit(                                                                                                   \
-                [&](auto& hash_set_with_key) {                                                                        \
-                    if constexpr (std::is_same_v<typename decltype(hash_set_with_key->hash_set)::key_type,            \
-                                                 typename decltype(dst->hash_set)::key_type>) {                       \
-                        dst->hash_set.reserve(hash_set_with_key->hash_set.capacity());                                \
-                        dst->hash_set.insert(hash_set_with_key->hash_set.begin(), hash_set_with_key->hash_set.end()); \
-                    }                                                                                                 \
-                },                                                                                                    \
-                hash_set_with_key);                                                                                   \
-        _type = AggHashSetVariant::Type::DST;                                                                         \
-        hash_set_with_key = std::move(dst);                                                                           \
-        return;                                                                                                       \
+#define CONVERT_TO_TWO_LEVEL_SET(DST, SRC)                                                                 \
+    if (_type == AggHashSetVariant::Type::SRC) {                                                           \
+        auto dst = std::make_unique<detail::AggHashSetVariantTypeTraits<Type::DST>::HashSetWithKeyType>(   \
+                state->chunk_size());                                                                      \
+        std::visit(                                                                                        \
+                [&](auto& hash_set_with_key) {                                                             \
+                    if constexpr (std::is_same_v<typename decltype(hash_set_with_key->hash_set)::key_type, \
+                                                 typename decltype(dst->hash_set)::key_type>) {            \
+                        detail::move_to_two_level_set(dst.get(), hash_set_with_key.get());                 \
+                    }                                                                                      \
+                },                                                                                         \
+                hash_set_with_key);                                                                        \
+        _type = AggHashSetVariant::Type::DST;                                                              \
+        hash_set_with_key = std::move(dst);                                                                \
+        return;                                                                                            \
     }
 
 void AggHashSetVariant::convert_to_two_level(RuntimeState* state) {
     CONVERT_TO_TWO_LEVEL_SET(phase1_slice_two_level, phase1_slice);
     CONVERT_TO_TWO_LEVEL_SET(phase2_slice_two_level, phase2_slice);
+    CONVERT_TO_TWO_LEVEL_SET(phase1_int32_two_level, phase1_int32);
+    CONVERT_TO_TWO_LEVEL_SET(phase2_int32_two_level, phase2_int32);
+    CONVERT_TO_TWO_LEVEL_SET(phase1_int64_two_level, phase1_int64);
+    CONVERT_TO_TWO_LEVEL_SET(phase2_int64_two_level, phase2_int64);
+    CONVERT_TO_TWO_LEVEL_SET(phase1_int128_two_level, phase1_int128);
+    CONVERT_TO_TWO_LEVEL_SET(phase2_int128_two_level, phase2_int128);
+    CONVERT_TO_TWO_LEVEL_SET(phase1_null_int64_two_level, phase1_null_int64);
+    CONVERT_TO_TWO_LEVEL_SET(phase2_null_int64_two_level, phase2_null_int64);
+    CONVERT_TO_TWO_LEVEL_SET(phase1_null_int128_two_level, phase1_null_int128);
+    CONVERT_TO_TWO_LEVEL_SET(phase2_null_int128_two_level, phase2_null_int128);
+    CONVERT_TO_TWO_LEVEL_SET(phase1_slice_fx4_two_level, phase1_slice_fx4);
+    CONVERT_TO_TWO_LEVEL_SET(phase2_slice_fx4_two_level, phase2_slice_fx4);
+    CONVERT_TO_TWO_LEVEL_SET(phase1_slice_fx8_two_level, phase1_slice_fx8);
+    CONVERT_TO_TWO_LEVEL_SET(phase2_slice_fx8_two_level, phase2_slice_fx8);
+    CONVERT_TO_TWO_LEVEL_SET(phase1_slice_fx16_two_level, phase1_slice_fx16);
+    CONVERT_TO_TWO_LEVEL_SET(phase2_slice_fx16_two_level, phase2_slice_fx16);
 }
 
 void AggHashSetVariant::reset() {
@@ -89,7 +89,21 @@ namespace starrocks {
     M(phase1_slice_fx16)             \
     M(phase2_slice_fx4)              \
     M(phase2_slice_fx8)              \
-    M(phase2_slice_fx16)
+    M(phase2_slice_fx16)             \
+    M(phase1_int64_two_level)        \
+    M(phase1_int128_two_level)       \
+    M(phase1_null_int64_two_level)   \
+    M(phase1_null_int128_two_level)  \
+    M(phase1_slice_fx4_two_level)    \
+    M(phase1_slice_fx8_two_level)    \
+    M(phase1_slice_fx16_two_level)   \
+    M(phase2_int64_two_level)        \
+    M(phase2_int128_two_level)       \
+    M(phase2_null_int64_two_level)   \
+    M(phase2_null_int128_two_level)  \
+    M(phase2_slice_fx4_two_level)    \
+    M(phase2_slice_fx8_two_level)    \
+    M(phase2_slice_fx16_two_level)
 
 // Aggregate Hash maps
 
@@ -156,6 +170,17 @@ template <PhmapSeed seed>
 using SerializedKeyTwoLevelAggHashMap = AggHashMapWithSerializedKey<SliceAggTwoLevelHashMap<seed>>;
 template <PhmapSeed seed>
 using Int32TwoLevelAggHashMapWithOneNumberKey = AggHashMapWithOneNumberKey<TYPE_INT, Int32AggTwoLevelHashMap<seed>>;
+template <PhmapSeed seed>
+using Int64TwoLevelAggHashMapWithOneNumberKey = AggHashMapWithOneNumberKey<TYPE_BIGINT, Int64AggTwoLevelHashMap<seed>>;
+template <PhmapSeed seed>
+using Int128TwoLevelAggHashMapWithOneNumberKey =
+        AggHashMapWithOneNumberKey<TYPE_LARGEINT, Int128AggTwoLevelHashMap<seed>>;
+template <PhmapSeed seed>
+using NullInt64TwoLevelAggHashMapWithOneNumberKey =
+        AggHashMapWithOneNullableNumberKey<TYPE_BIGINT, Int64AggTwoLevelHashMap<seed>>;
+template <PhmapSeed seed>
+using NullInt128TwoLevelAggHashMapWithOneNumberKey =
+        AggHashMapWithOneNullableNumberKey<TYPE_LARGEINT, Int128AggTwoLevelHashMap<seed>>;
 
 // fixed slice key type.
 template <PhmapSeed seed>
@@ -164,6 +189,15 @@ template <PhmapSeed seed>
 using SerializedKeyFixedSize8AggHashMap = AggHashMapWithSerializedKeyFixedSize<FixedSize8SliceAggHashMap<seed>>;
 template <PhmapSeed seed>
 using SerializedKeyFixedSize16AggHashMap = AggHashMapWithSerializedKeyFixedSize<FixedSize16SliceAggHashMap<seed>>;
+template <PhmapSeed seed>
+using SerializedKeyFixedSize4TwoLevelAggHashMap =
+        AggHashMapWithSerializedKeyFixedSize<FixedSize4SliceAggTwoLevelHashMap<seed>>;
+template <PhmapSeed seed>
+using SerializedKeyFixedSize8TwoLevelAggHashMap =
+        AggHashMapWithSerializedKeyFixedSize<FixedSize8SliceAggTwoLevelHashMap<seed>>;
+template <PhmapSeed seed>
+using SerializedKeyFixedSize16TwoLevelAggHashMap =
+        AggHashMapWithSerializedKeyFixedSize<FixedSize16SliceAggTwoLevelHashMap<seed>>;
 
 // Hash sets
 //
@@ -228,6 +262,16 @@ template <PhmapSeed seed>
 using SerializedTwoLevelKeyAggHashSet = AggHashSetOfSerializedKey<SliceAggTwoLevelHashSet<seed>>;
 template <PhmapSeed seed>
 using Int32TwoLevelAggHashSetOfOneNumberKey = AggHashSetOfOneNumberKey<TYPE_INT, Int32AggTwoLevelHashSet<seed>>;
+template <PhmapSeed seed>
+using Int64TwoLevelAggHashSetOfOneNumberKey = AggHashSetOfOneNumberKey<TYPE_BIGINT, Int64AggTwoLevelHashSet<seed>>;
+template <PhmapSeed seed>
+using Int128TwoLevelAggHashSetOfOneNumberKey = AggHashSetOfOneNumberKey<TYPE_LARGEINT, Int128AggTwoLevelHashSet<seed>>;
+template <PhmapSeed seed>
+using NullInt64TwoLevelAggHashSetOfOneNumberKey =
+        AggHashSetOfOneNullableNumberKey<TYPE_BIGINT, Int64AggTwoLevelHashSet<seed>>;
+template <PhmapSeed seed>
+using NullInt128TwoLevelAggHashSetOfOneNumberKey =
+        AggHashSetOfOneNullableNumberKey<TYPE_LARGEINT, Int128AggTwoLevelHashSet<seed>>;
 
 // For fixed slice type.
 template <PhmapSeed seed>
@@ -239,6 +283,18 @@ using SerializedKeyAggHashSetFixedSize8 = AggHashSetOfSerializedKeyFixedSize<Fix
 template <PhmapSeed seed>
 using SerializedKeyAggHashSetFixedSize16 = AggHashSetOfSerializedKeyFixedSize<FixedSize16SliceAggHashSet<seed>>;
 
+template <PhmapSeed seed>
+using SerializedKeyTwoLevelAggHashSetFixedSize4 =
+        AggHashSetOfSerializedKeyFixedSize<FixedSize4SliceAggTwoLevelHashSet<seed>>;
+
+template <PhmapSeed seed>
+using SerializedKeyTwoLevelAggHashSetFixedSize8 =
+        AggHashSetOfSerializedKeyFixedSize<FixedSize8SliceAggTwoLevelHashSet<seed>>;
+
+template <PhmapSeed seed>
+using SerializedKeyTwoLevelAggHashSetFixedSize16 =
+        AggHashSetOfSerializedKeyFixedSize<FixedSize16SliceAggTwoLevelHashSet<seed>>;
+
 // aggregate key
 template <class HashMapWithKey>
 struct CombinedFixedSizeKey {
@@ -262,6 +318,8 @@ static_assert(is_combined_fixed_size_key<SerializedKeyFixedSize4AggHashMap<Phmap
 static_assert(!is_combined_fixed_size_key<Int32TwoLevelAggHashSetOfOneNumberKey<PhmapSeed1>>);
 static_assert(is_combined_fixed_size_key<SerializedKeyAggHashSetFixedSize4<PhmapSeed1>>);
 static_assert(!is_combined_fixed_size_key<Int32TwoLevelAggHashMapWithOneNumberKey<PhmapSeed1>>);
+static_assert(is_combined_fixed_size_key<SerializedKeyFixedSize4TwoLevelAggHashMap<PhmapSeed1>>);
+static_assert(is_combined_fixed_size_key<SerializedKeyTwoLevelAggHashSetFixedSize4<PhmapSeed1>>);
 
 // 1) For different group by columns type, size, cardinality, volume, we should choose different
 // hash functions and different hashmaps.
@@ -334,7 +392,21 @@ using AggHashMapWithKeyPtr = std::variant<
         std::unique_ptr<Int32TwoLevelAggHashMapWithOneNumberKey<PhmapSeed2>>,
         std::unique_ptr<SerializedKeyFixedSize4AggHashMap<PhmapSeed2>>,
         std::unique_ptr<SerializedKeyFixedSize8AggHashMap<PhmapSeed2>>,
-        std::unique_ptr<SerializedKeyFixedSize16AggHashMap<PhmapSeed2>>>;
+        std::unique_ptr<SerializedKeyFixedSize16AggHashMap<PhmapSeed2>>,
+        std::unique_ptr<Int64TwoLevelAggHashMapWithOneNumberKey<PhmapSeed1>>,
+        std::unique_ptr<Int128TwoLevelAggHashMapWithOneNumberKey<PhmapSeed1>>,
+        std::unique_ptr<NullInt64TwoLevelAggHashMapWithOneNumberKey<PhmapSeed1>>,
+        std::unique_ptr<NullInt128TwoLevelAggHashMapWithOneNumberKey<PhmapSeed1>>,
+        std::unique_ptr<SerializedKeyFixedSize4TwoLevelAggHashMap<PhmapSeed1>>,
+        std::unique_ptr<SerializedKeyFixedSize8TwoLevelAggHashMap<PhmapSeed1>>,
+        std::unique_ptr<SerializedKeyFixedSize16TwoLevelAggHashMap<PhmapSeed1>>,
+        std::unique_ptr<Int64TwoLevelAggHashMapWithOneNumberKey<PhmapSeed2>>,
+        std::unique_ptr<Int128TwoLevelAggHashMapWithOneNumberKey<PhmapSeed2>>,
+        std::unique_ptr<NullInt64TwoLevelAggHashMapWithOneNumberKey<PhmapSeed2>>,
+        std::unique_ptr<NullInt128TwoLevelAggHashMapWithOneNumberKey<PhmapSeed2>>,
+        std::unique_ptr<SerializedKeyFixedSize4TwoLevelAggHashMap<PhmapSeed2>>,
+        std::unique_ptr<SerializedKeyFixedSize8TwoLevelAggHashMap<PhmapSeed2>>,
+        std::unique_ptr<SerializedKeyFixedSize16TwoLevelAggHashMap<PhmapSeed2>>>;
 
 using AggHashSetWithKeyPtr = std::variant<
         std::unique_ptr<UInt8AggHashSetOfOneNumberKey<PhmapSeed1>>,
@@ -394,7 +466,21 @@ using AggHashSetWithKeyPtr = std::variant<
         std::unique_ptr<SerializedKeyAggHashSetFixedSize16<PhmapSeed1>>,
         std::unique_ptr<SerializedKeyAggHashSetFixedSize4<PhmapSeed2>>,
         std::unique_ptr<SerializedKeyAggHashSetFixedSize8<PhmapSeed2>>,
-        std::unique_ptr<SerializedKeyAggHashSetFixedSize16<PhmapSeed2>>>;
+        std::unique_ptr<SerializedKeyAggHashSetFixedSize16<PhmapSeed2>>,
+        std::unique_ptr<Int64TwoLevelAggHashSetOfOneNumberKey<PhmapSeed1>>,
+        std::unique_ptr<Int128TwoLevelAggHashSetOfOneNumberKey<PhmapSeed1>>,
+        std::unique_ptr<NullInt64TwoLevelAggHashSetOfOneNumberKey<PhmapSeed1>>,
+        std::unique_ptr<NullInt128TwoLevelAggHashSetOfOneNumberKey<PhmapSeed1>>,
+        std::unique_ptr<SerializedKeyTwoLevelAggHashSetFixedSize4<PhmapSeed1>>,
+        std::unique_ptr<SerializedKeyTwoLevelAggHashSetFixedSize8<PhmapSeed1>>,
+        std::unique_ptr<SerializedKeyTwoLevelAggHashSetFixedSize16<PhmapSeed1>>,
+        std::unique_ptr<Int64TwoLevelAggHashSetOfOneNumberKey<PhmapSeed2>>,
+        std::unique_ptr<Int128TwoLevelAggHashSetOfOneNumberKey<PhmapSeed2>>,
+        std::unique_ptr<NullInt64TwoLevelAggHashSetOfOneNumberKey<PhmapSeed2>>,
+        std::unique_ptr<NullInt128TwoLevelAggHashSetOfOneNumberKey<PhmapSeed2>>,
+        std::unique_ptr<SerializedKeyTwoLevelAggHashSetFixedSize4<PhmapSeed2>>,
+        std::unique_ptr<SerializedKeyTwoLevelAggHashSetFixedSize8<PhmapSeed2>>,
+        std::unique_ptr<SerializedKeyTwoLevelAggHashSetFixedSize16<PhmapSeed2>>>;
 } // namespace detail
 struct AggHashMapVariant {
     enum class Type {
@@ -461,6 +547,22 @@ struct AggHashMapVariant {
         phase2_slice_fx4,
         phase2_slice_fx8,
         phase2_slice_fx16,
+
+        phase1_int64_two_level,
+        phase1_int128_two_level,
+        phase1_null_int64_two_level,
+        phase1_null_int128_two_level,
+        phase1_slice_fx4_two_level,
+        phase1_slice_fx8_two_level,
+        phase1_slice_fx16_two_level,
+
+        phase2_int64_two_level,
+        phase2_int128_two_level,
+        phase2_null_int64_two_level,
+        phase2_null_int128_two_level,
+        phase2_slice_fx4_two_level,
+        phase2_slice_fx8_two_level,
+        phase2_slice_fx16_two_level,
     };
 
     detail::AggHashMapWithKeyPtr hash_map_with_key;
@@ -564,6 +666,22 @@ struct AggHashSetVariant {
         phase2_slice_fx4,
         phase2_slice_fx8,
         phase2_slice_fx16,
+
+        phase1_int64_two_level,
+        phase1_int128_two_level,
+        phase1_null_int64_two_level,
+        phase1_null_int128_two_level,
+        phase1_slice_fx4_two_level,
+        phase1_slice_fx8_two_level,
+        phase1_slice_fx16_two_level,
+
+        phase2_int64_two_level,
+        phase2_int128_two_level,
+        phase2_null_int64_two_level,
+        phase2_null_int128_two_level,
+        phase2_slice_fx4_two_level,
+        phase2_slice_fx8_two_level,
+        phase2_slice_fx16_two_level,
     };
 
     detail::AggHashSetWithKeyPtr hash_set_with_key;
@@ -31,6 +31,7 @@ struct AggStatistics {
         input_row_count = ADD_COUNTER(runtime_profile, "InputRowCount", TUnit::UNIT);
         hash_table_size = ADD_COUNTER(runtime_profile, "HashTableSize", TUnit::UNIT);
         pass_through_row_count = ADD_COUNTER(runtime_profile, "PassThroughRowCount", TUnit::UNIT);
+        auto_state_switch_count = ADD_COUNTER(runtime_profile, "AutoStateSwitchCount", TUnit::UNIT);
         rows_returned_counter = ADD_COUNTER(runtime_profile, "RowsReturned", TUnit::UNIT);
         state_destroy_timer = ADD_TIMER(runtime_profile, "StateDestroy");
         allocate_state_timer = ADD_TIMER(runtime_profile, "StateAllocate");
@@ -61,6 +62,8 @@ struct AggStatistics {
     RuntimeProfile::Counter* group_by_append_timer{};
     // hash streaming aggregate pass through rows
     RuntimeProfile::Counter* pass_through_row_count{};
+    // times the auto streaming aggregate switches between preaggregation modes
+    RuntimeProfile::Counter* auto_state_switch_count{};
     // timer for get input from hash table
     RuntimeProfile::Counter* expr_compute_timer{};
     // timer for result input from hash table
@@ -267,6 +267,9 @@ pipeline::OpFactories AggregateBlockingNode::decompose_to_pipeline(pipeline::Pip
         // 2. Non-finalize aggregation:
         //   - Without group by clause, it can be parallelized and needn't local shuffle.
         //   - With group by clause, it can be parallelized and need local shuffle when could_local_shuffle is true.
+        // With group by clause, the input of each driver is partitioned by the group by keys, either by the local
+        // shuffle or by the upstream (could_local_shuffle is false), so each group lives in the hash map of exactly
+        // one driver, and the drivers build and output their disjoint partitions in parallel without any lock.
         if (agg_node.need_finalize) {
             if (!has_group_by_keys) {
                 ops_with_sink =
@@ -15,6 +15,7 @@
 #include "aggregator.h"
 
 #include <algorithm>
+#include <array>
 #include <memory>
 #include <type_traits>
 #include <variant>
@@ -33,6 +34,7 @@
 #include "runtime/descriptors.h"
 #include "types/logical_type.h"
 #include "udf/java/utils.h"
+#include "util/cpu_info.h"
 #include "util/runtime_profile.h"
 
 namespace starrocks {
@@ -676,6 +678,27 @@ bool Aggregator::is_chunk_buffer_full() {
     return _buffer_mem_manager->is_full();
 }
 
+static_assert(STREAMING_HT_MIN_REDUCTION_SIZE == 3);
+
+// STREAMING_HT_MIN_REDUCTION with the memory thresholds adjusted to the cache sizes of this machine.
+static const std::array<StreamingHtMinReductionEntry, STREAMING_HT_MIN_REDUCTION_SIZE>& streaming_ht_min_reduction() {
+    static const auto table = [] {
+        std::array<StreamingHtMinReductionEntry, STREAMING_HT_MIN_REDUCTION_SIZE> res;
+        std::copy(std::begin(STREAMING_HT_MIN_REDUCTION), std::end(STREAMING_HT_MIN_REDUCTION), res.begin());
+        const long l2_size = CpuInfo::get_cache_size(CpuInfo::L2_CACHE);
+        const long l3_size = CpuInfo::get_cache_size(CpuInfo::L3_CACHE);
+        if (l2_size > 0) {
+            res[1].min_ht_mem = static_cast<int>(l2_size);
+        }
+        if (l3_size > 0) {
+            res[2].min_ht_mem = static_cast<int>(l3_size / std::max(CpuInfo::num_cores(), 1));
+        }
+        res[2].min_ht_mem = std::max(res[2].min_ht_mem, res[1].min_ht_mem);
+        return res;
+    }();
+    return table;
+}
+
 bool Aggregator::should_expand_preagg_hash_tables(size_t prev_row_returned, size_t input_chunk_size, int64_t ht_mem,
                                                   int64_t ht_rows) const {
     // Need some rows in tables to have valid statistics.
@@ -684,9 +707,9 @@ bool Aggregator::should_expand_preagg_hash_tables(size_t prev_row_returned, size
     }
 
     // Find the appropriate reduction factor in our table for the current hash table sizes.
+    const auto& reduction_table = streaming_ht_min_reduction();
     int cache_level = 0;
-    while (cache_level + 1 < STREAMING_HT_MIN_REDUCTION_SIZE &&
-           ht_mem >= STREAMING_HT_MIN_REDUCTION[cache_level + 1].min_ht_mem) {
+    while (cache_level + 1 < STREAMING_HT_MIN_REDUCTION_SIZE && ht_mem >= reduction_table[cache_level + 1].min_ht_mem) {
         cache_level++;
     }
 
@@ -706,7 +729,7 @@ bool Aggregator::should_expand_preagg_hash_tables(size_t prev_row_returned, size
     // set, N is the number of input rows, excluding passed-through rows, and n is the
     // number of rows inserted or merged into the hash tables. This is a very rough
     // approximation but is good enough to be useful.
-    double min_reduction = STREAMING_HT_MIN_REDUCTION[cache_level].streaming_ht_min_reduction;
+    double min_reduction = reduction_table[cache_level].streaming_ht_min_reduction;
     return current_reduction > min_reduction;
 }
 
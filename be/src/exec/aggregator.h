@@ -188,6 +188,8 @@ struct StreamingHtMinReductionEntry {
     double streaming_ht_min_reduction;
 };
 
+// Default thresholds, roughly the L2 cache and the per-core share of the L3 cache. They are replaced by the sizes
+// reported by CpuInfo when available, see Aggregator::should_expand_preagg_hash_tables.
 static const StreamingHtMinReductionEntry STREAMING_HT_MIN_REDUCTION[] = {
         {0, 0.0},
         {256 * 1024, 1.1},
@@ -313,6 +315,7 @@ public:
     RuntimeProfile::Counter* rows_returned_counter() { return _agg_stat->rows_returned_counter; }
     RuntimeProfile::Counter* hash_table_size() { return _agg_stat->hash_table_size; }
     RuntimeProfile::Counter* pass_through_row_count() { return _agg_stat->pass_through_row_count; }
+    RuntimeProfile::Counter* auto_state_switch_count() { return _agg_stat->auto_state_switch_count; }
 
     void sink_complete() { _is_sink_complete.store(true, std::memory_order_release); }
 
@@ -19,6 +19,7 @@
 #include <memory>
 
 #include "column/chunk.h"
+#include "common/config.h"
 #include "exec/pipeline/analysis/analytic_sink_operator.h"
 #include "exec/pipeline/analysis/analytic_source_operator.h"
 #include "exec/pipeline/hash_partition_context.h"
@@ -97,6 +98,13 @@ pipeline::OpFactories AnalyticNode::decompose_to_pipeline(pipeline::PipelineBuil
     OpFactories ops_with_sink = _children[0]->decompose_to_pipeline(context);
     auto* upstream_source_op = context->source_operator(ops_with_sink);
     bool is_skewed = _tnode.analytic_node.__isset.is_skewed && _tnode.analytic_node.is_skewed;
+    // A single sorted stream, e.g. the output of a merging sort, could only be evaluated by one driver,
+    // so split it at partition boundaries as the skewed plan does.
+    if (!_tnode.analytic_node.partition_exprs.empty() && !_use_hash_based_partition &&
+        config::pipeline_analytic_enable_ordered_partition_exchange &&
+        upstream_source_op->degree_of_parallelism() == 1 && context->degree_of_parallelism() > 1) {
+        is_skewed = true;
+    }
 
     if (_tnode.analytic_node.partition_exprs.empty()) {
         // analytic's dop must be 1 if with no partition clause
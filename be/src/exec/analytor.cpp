@@ -166,10 +166,6 @@ Status Analytor::prepare(RuntimeState* state, ObjectPool* pool, RuntimeProfile*
             _need_partition_materializing = true;
         }
 
-        if (!(fn.name.function_name == "sum" || fn.name.function_name == "avg" || fn.name.function_name == "count")) {
-            _use_removable_cumulative_process = false;
-        }
-
         bool is_input_nullable = false;
         if (fn.name.function_name == "count" || fn.name.function_name == "row_number" ||
             fn.name.function_name == "rank" || fn.name.function_name == "dense_rank" ||
@@ -240,6 +236,14 @@ Status Analytor::prepare(RuntimeState* state, ObjectPool* pool, RuntimeProfile*
 
         DCHECK(_agg_functions[i] != nullptr);
         _is_lead_lag_functions[i] = (_agg_functions[i]->get_name() == "lead-lag");
+
+        // sum/avg/count subtract the row leaving the frame, while max/min re-evaluate the frame only when
+        // the row leaving the frame may hold the extremum.
+        const bool is_max_min = fn.name.function_name == "max" || fn.name.function_name == "min";
+        if (!(fn.name.function_name == "sum" || fn.name.function_name == "avg" || fn.name.function_name == "count" ||
+              (is_max_min && _agg_functions[i]->is_removable_by_reevaluation()))) {
+            _use_removable_cumulative_process = false;
+        }
     }
 
     // Compute agg state total size and offsets.
@@ -336,17 +336,8 @@ Status AvroScanner::_construct_row_without_jsonpath(const avro_value_t& avro_val
     size_t element_count = _data_idx_to_fieldname.size();
     avro_value_t element_value;
     for (size_t i = 0; i < element_count; i++) {
-        if (UNLIKELY(avro_value_get_by_index(&avro_value, i, &element_value, NULL) != 0)) {
-            auto err_msg = "Cannot get value by index: " + std::string(avro_strerror());
-            return Status::InternalError(err_msg);
-        }
         SlotInfo& slot_info = _data_idx_to_slot[i];
-        if (slot_info.id > -1) {
-            int column_index = chunk->get_index_by_slot_id(slot_info.id);
-            _found_columns[column_index] = true;
-        } else if (slot_info.id == -1) {
-            continue;
-        } else if (UNLIKELY(slot_info.id < -1)) {
+        if (UNLIKELY(slot_info.id < -1)) {
             const std::string& key = _data_idx_to_fieldname[i];
             // look up key in the slot dict.
             auto itr = _slot_desc_dict.find(key);
@@ -358,11 +349,19 @@ Status AvroScanner::_construct_row_without_jsonpath(const avro_value_t& avro_val
             slot_info.id = slot_desc->id();
             slot_info.type = slot_desc->type();
             slot_info.key = key;
-            int column_index = chunk->get_index_by_slot_id(slot_info.id);
-            _found_columns[column_index] = true;
+            slot_info.column_index = chunk->get_index_by_slot_id(slot_info.id);
         }
+        // fields that are not loaded are skipped without being read.
+        if (slot_info.id == -1) {
+            continue;
+        }
+        _found_columns[slot_info.column_index] = true;
 
-        auto& column = chunk->get_column_by_slot_id(slot_info.id);
+        if (UNLIKELY(avro_value_get_by_index(&avro_value, i, &element_value, NULL) != 0)) {
+            auto err_msg = "Cannot get value by index: " + std::string(avro_strerror());
+            return Status::InternalError(err_msg);
+        }
+        auto& column = chunk->get_column_by_index(slot_info.column_index);
         // We should expand the union type.
         avro_value_t* cur_value = &element_value;
         if (UNLIKELY(avro_value_get_type(cur_value) == AVRO_UNION)) {
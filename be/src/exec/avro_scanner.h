@@ -64,6 +64,8 @@ public:
         SlotId id;
         TypeDescriptor type;
         std::string key;
+        // index of the column in the source chunk, whose layout is the same for every chunk.
+        int column_index = -1;
     };
 
 private:
@@ -16,6 +16,7 @@
 
 #include "column/column_helper.h"
 #include "column/type_traits.h"
+#include "common/config.h"
 #include "exec/sorting/merge.h"
 #include "exec/sorting/sort_permute.h"
 #include "exec/sorting/sorting.h"
@@ -55,6 +56,10 @@ void ChunksSorterTopn::setup_runtime(RuntimeState* state, RuntimeProfile* profil
 
 // Cumulative chunks into _raw_chunks for sorting.
 Status ChunksSorterTopn::update(RuntimeState* state, const ChunkPtr& chunk) {
+    if (_filter_by_merged_segment(chunk) == 0) {
+        return Status::OK();
+    }
+
     auto& raw_chunks = _raw_chunks.chunks;
     size_t chunk_number = raw_chunks.size();
     if (chunk_number <= 0) {
@@ -84,6 +89,43 @@ Status ChunksSorterTopn::update(RuntimeState* state, const ChunkPtr& chunk) {
     return Status::OK();
 }
 
+size_t ChunksSorterTopn::_filter_by_merged_segment(const ChunkPtr& chunk) {
+    const size_t rows_to_sort = _get_number_of_rows_to_sort();
+    if (!_init_merged_segment || _merged_segment.chunk->num_rows() < rows_to_sort || chunk->is_empty()) {
+        return chunk->num_rows();
+    }
+
+    SCOPED_TIMER(_sort_filter_timer);
+    // The `rows_to_sort - 1` row of merged segment is the current boundary of top-n, rows that succeed it
+    // could never be output for either ROW_NUMBER or RANK, so drop them before buffering, which makes
+    // buffered chunks fill up slower and saves the sort work on rows that would be discarded anyway.
+    DataSegment segment(_sort_exprs, chunk);
+    std::vector<Datum> rhs_values;
+    rhs_values.reserve(_merged_segment.order_by_columns.size());
+    for (const auto& column : _merged_segment.order_by_columns) {
+        if (column->is_null(rows_to_sort - 1)) {
+            return chunk->num_rows();
+        }
+        rhs_values.emplace_back(column->get(rows_to_sort - 1));
+    }
+    std::vector<int8_t> cmp_result(chunk->num_rows(), 0);
+    compare_columns(segment.order_by_columns, cmp_result, rhs_values, _sort_desc);
+
+    Filter filter(cmp_result.size());
+    size_t selected = 0;
+    for (size_t i = 0; i < cmp_result.size(); ++i) {
+        filter[i] = cmp_result[i] <= 0;
+        selected += filter[i];
+    }
+    if (_sort_filter_rows) {
+        COUNTER_UPDATE(_sort_filter_rows, cmp_result.size() - selected);
+    }
+    if (selected > 0 && selected < cmp_result.size()) {
+        chunk->filter(filter);
+    }
+    return selected;
+}
+
 Status ChunksSorterTopn::do_done(RuntimeState* state) {
     auto& raw_chunks = _raw_chunks.chunks;
     if (!raw_chunks.empty()) {
@@ -346,7 +388,7 @@ Status ChunksSorterTopn::_partial_sort_col_wise(RuntimeState* state, std::pair<P
     }
     auto do_sort = [&](Permutation& perm, size_t limit) {
         return sort_vertical_chunks(state->cancelled_ref(), vertical_chunks, _sort_desc, perm, limit,
-                                    _topn_type == TTopNType::RANK);
+                                    _topn_type == TTopNType::RANK, config::enable_sort_normalized_key);
     };
 
     size_t first_size = std::min(permutations.first.size(), rows_to_sort);
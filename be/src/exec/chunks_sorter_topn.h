@@ -85,6 +85,10 @@ private:
 
     [[nodiscard]] Status _sort_chunks(RuntimeState* state);
 
+    // Drop rows of an incoming chunk that succeed the current top-n boundary in _merged_segment.
+    // Return the number of remaining rows.
+    size_t _filter_by_merged_segment(const ChunkPtr& chunk);
+
     // build data for top-n
     [[nodiscard]] Status _build_sorting_data(RuntimeState* state, Permutation& permutation_second,
                                              DataSegments& segments);
@@ -187,7 +187,17 @@ Status ScrollParser::fill_chunk(RuntimeState* state, ChunkPtr* chunk, bool* line
         (*chunk)->append_column(std::move(column), slot_desc->id());
     }
 
-    auto slots = _tuple_desc->slots();
+    // resolve the doc_values field name of each slot once for the whole batch rather than per document.
+    std::vector<const std::string*> doc_value_col_names(slot_descs.size(), nullptr);
+    if (_doc_value_context != nullptr) {
+        for (size_t col_idx = 0; col_idx < slot_descs.size(); ++col_idx) {
+            auto iter = _doc_value_context->find(slot_descs[col_idx]->col_name());
+            if (iter != _doc_value_context->end()) {
+                doc_value_col_names[col_idx] = &iter->second;
+            }
+        }
+    }
+
     // TODO: we could fill chunk by column rather than row
     for (size_t i = 0; i < fill_sz; ++i) {
         const rapidjson::Value& obj = _inner_hits_node[_cur_line + i];
@@ -196,9 +206,9 @@ Status ScrollParser::fill_chunk(RuntimeState* state, ChunkPtr* chunk, bool* line
         bool has_fields = obj.HasMember(FIELD_FIELDS);
 
         if (!has_source && !has_fields) {
-            for (size_t col_idx = 0; col_idx < slots.size(); ++col_idx) {
+            for (size_t col_idx = 0; col_idx < slot_descs.size(); ++col_idx) {
                 SlotDescriptor* slot_desc = slot_descs[col_idx];
-                ColumnPtr& column = (*chunk)->get_column_by_slot_id(slot_desc->id());
+                ColumnPtr& column = (*chunk)->get_column_by_index(col_idx);
                 if (slot_desc->is_nullable()) {
                     column->append_default();
                 } else {
@@ -211,9 +221,10 @@ Status ScrollParser::fill_chunk(RuntimeState* state, ChunkPtr* chunk, bool* line
         DCHECK(has_source ^ has_fields);
         const rapidjson::Value& line = has_source ? obj[FIELD_SOURCE] : obj[FIELD_FIELDS];
 
-        for (size_t col_idx = 0; col_idx < slots.size(); ++col_idx) {
+        for (size_t col_idx = 0; col_idx < slot_descs.size(); ++col_idx) {
             SlotDescriptor* slot_desc = slot_descs[col_idx];
-            ColumnPtr& column = (*chunk)->get_column_by_slot_id(slot_desc->id());
+            // columns are appended in the order of slot_descs above.
+            ColumnPtr& column = (*chunk)->get_column_by_index(col_idx);
 
             // _id field must exists in every document, this is guaranteed by ES
             // if _id was found in tuple, we would get `_id` value from inner-hit node
@@ -244,14 +255,19 @@ Status ScrollParser::fill_chunk(RuntimeState* state, ChunkPtr* chunk, bool* line
             }
 
             // if pure_doc_value enabled, docvalue_context must contains the key
-            // todo: need move all `pure_docvalue` for every tuple outside fill_tuple
-            //  should check pure_docvalue for one table scan not every tuple
-            const char* col_name = pure_doc_value ? _doc_value_context->at(slot_desc->col_name()).c_str()
-                                                  : slot_desc->col_name().c_str();
-
-            auto has_col = line.HasMember(col_name);
-            if (has_col) {
-                const rapidjson::Value& col = line[col_name];
+            const std::string* col_name = &slot_desc->col_name();
+            if (pure_doc_value) {
+                col_name = doc_value_col_names[col_idx];
+                if (UNLIKELY(col_name == nullptr)) {
+                    return Status::InternalError(
+                            fmt::format("col `{}` is not found in doc_values context", slot_desc->col_name()));
+                }
+            }
+
+            // look up the member once, HasMember followed by operator[] would scan the members twice.
+            auto member = line.FindMember(rapidjson::StringRef(col_name->data(), col_name->size()));
+            if (member != line.MemberEnd()) {
+                const rapidjson::Value& col = member->value;
                 // doc value
                 bool is_null = col.IsNull() || (pure_doc_value && col.IsArray() && (col.Empty() || col[0].IsNull()));
                 if (!is_null) {
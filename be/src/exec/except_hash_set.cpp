@@ -35,14 +35,16 @@ void ExceptHashSet<HashSet>::build_set(RuntimeState* state, const ChunkPtr& chun
     size_t chunk_size = chunk->num_rows();
     buffer_state->slice_sizes.assign(state->chunk_size(), 0);
 
-    size_t cur_max_one_row_size = _get_max_serialize_size(chunk, exprs);
+    _evaluate_key_columns(chunk, exprs, &buffer_state->key_columns);
+    size_t cur_max_one_row_size = _get_max_serialize_size(buffer_state->key_columns);
     if (UNLIKELY(cur_max_one_row_size > buffer_state->max_one_row_size)) {
         buffer_state->max_one_row_size = cur_max_one_row_size;
         buffer_state->mem_pool.clear();
         buffer_state->buffer = buffer_state->mem_pool.allocate(buffer_state->max_one_row_size * state->chunk_size());
     }
 
-    _serialize_columns(chunk, exprs, chunk_size, buffer_state);
+    _serialize_columns(buffer_state->key_columns, chunk_size, buffer_state);
+    buffer_state->key_columns.clear();
 
     for (size_t i = 0; i < chunk_size; ++i) {
         ExceptSliceFlag key(buffer_state->buffer + i * buffer_state->max_one_row_size, buffer_state->slice_sizes[i]);
@@ -66,7 +68,8 @@ Status ExceptHashSet<HashSet>::erase_duplicate_row(RuntimeState* state, const Ch
     size_t chunk_size = chunk->num_rows();
     buffer_state->slice_sizes.assign(state->chunk_size(), 0);
 
-    size_t cur_max_one_row_size = _get_max_serialize_size(chunk, exprs);
+    _evaluate_key_columns(chunk, exprs, &buffer_state->key_columns);
+    size_t cur_max_one_row_size = _get_max_serialize_size(buffer_state->key_columns);
     if (UNLIKELY(cur_max_one_row_size > buffer_state->max_one_row_size)) {
         buffer_state->max_one_row_size = cur_max_one_row_size;
         buffer_state->mem_pool.clear();
@@ -77,7 +80,8 @@ Status ExceptHashSet<HashSet>::erase_duplicate_row(RuntimeState* state, const Ch
         RETURN_IF_LIMIT_EXCEEDED(state, "Except, while probe hash table.");
     }
 
-    _serialize_columns(chunk, exprs, chunk_size, buffer_state);
+    _serialize_columns(buffer_state->key_columns, chunk_size, buffer_state);
+    buffer_state->key_columns.clear();
 
     for (size_t i = 0; i < chunk_size; ++i) {
         ExceptSliceFlag key(buffer_state->buffer + i * buffer_state->max_one_row_size, buffer_state->slice_sizes[i]);
@@ -120,10 +124,18 @@ int64_t ExceptHashSet<HashSet>::mem_usage(BufferState* buffer_state) {
 }
 
 template <typename HashSet>
-size_t ExceptHashSet<HashSet>::_get_max_serialize_size(const ChunkPtr& chunk, const std::vector<ExprContext*>& exprs) {
-    size_t max_size = 0;
+void ExceptHashSet<HashSet>::_evaluate_key_columns(const ChunkPtr& chunk, const std::vector<ExprContext*>& exprs,
+                                                   Columns* key_columns) {
+    key_columns->clear();
     for (auto expr : exprs) {
-        ColumnPtr key_column = EVALUATE_NULL_IF_ERROR(expr, expr->root(), chunk.get());
+        key_columns->emplace_back(EVALUATE_NULL_IF_ERROR(expr, expr->root(), chunk.get()));
+    }
+}
+
+template <typename HashSet>
+size_t ExceptHashSet<HashSet>::_get_max_serialize_size(const Columns& key_columns) {
+    size_t max_size = 0;
+    for (const auto& key_column : key_columns) {
         max_size += key_column->max_one_element_serialize_size();
         if (!key_column->is_nullable()) {
             max_size += sizeof(bool);
@@ -133,11 +145,9 @@ size_t ExceptHashSet<HashSet>::_get_max_serialize_size(const ChunkPtr& chunk, co
 }
 
 template <typename HashSet>
-void ExceptHashSet<HashSet>::_serialize_columns(const ChunkPtr& chunk, const std::vector<ExprContext*>& exprs,
-                                                size_t chunk_size, BufferState* buffer_state) {
-    for (auto expr : exprs) {
-        ColumnPtr key_column = EVALUATE_NULL_IF_ERROR(expr, expr->root(), chunk.get());
-
+void ExceptHashSet<HashSet>::_serialize_columns(const Columns& key_columns, size_t chunk_size,
+                                                BufferState* buffer_state) {
+    for (const auto& key_column : key_columns) {
         // The serialized buffer is always nullable.
         if (key_column->is_nullable()) {
             key_column->serialize_batch(buffer_state->buffer, buffer_state->slice_sizes, chunk_size,
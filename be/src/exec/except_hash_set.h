@@ -64,6 +64,7 @@ public:
     public:
         size_t max_one_row_size{8};
         Buffer<uint32_t> slice_sizes;
+        Columns key_columns;
 
         MemPool mem_pool;
         uint8_t* buffer{nullptr};
@@ -89,9 +90,10 @@ public:
     int64_t mem_usage(BufferState* buffer_state);
 
 private:
-    size_t _get_max_serialize_size(const ChunkPtr& chunk, const std::vector<ExprContext*>& exprs);
-    void _serialize_columns(const ChunkPtr& chunk, const std::vector<ExprContext*>& exprs, size_t chunk_size,
-                            BufferState* buffer_state);
+    // The key exprs are evaluated once per chunk, both the serialize size and the serialization use the result.
+    void _evaluate_key_columns(const ChunkPtr& chunk, const std::vector<ExprContext*>& exprs, Columns* key_columns);
+    size_t _get_max_serialize_size(const Columns& key_columns);
+    void _serialize_columns(const Columns& key_columns, size_t chunk_size, BufferState* buffer_state);
 
 private:
     std::unique_ptr<HashSet> _hash_set;
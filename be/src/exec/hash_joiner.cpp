@@ -49,6 +49,12 @@ void HashJoinBuildMetrics::prepare(RuntimeProfile* runtime_profile) {
     build_buckets_counter = ADD_COUNTER(runtime_profile, "BuildBuckets", TUnit::UNIT);
     runtime_filter_num = ADD_COUNTER(runtime_profile, "RuntimeFilterNum", TUnit::UNIT);
     build_keys_per_bucket = ADD_COUNTER(runtime_profile, "BuildKeysPerBucket%", TUnit::UNIT);
+    build_unique_keys = ADD_COUNTER(runtime_profile, "BuildUniqueKeys", TUnit::UNIT);
+    build_ht_dop = ADD_COUNTER(runtime_profile, "BuildHashTableDop", TUnit::UNIT);
+    build_ht_partitions = ADD_COUNTER(runtime_profile, "BuildHashTablePartitions", TUnit::UNIT);
+    build_ht_partition_rows_max = ADD_COUNTER(runtime_profile, "BuildHashTablePartitionRowsMax", TUnit::UNIT);
+    build_ht_partition_rows_min = ADD_COUNTER(runtime_profile, "BuildHashTablePartitionRowsMin", TUnit::UNIT);
+    build_radix_partitions = ADD_COUNTER(runtime_profile, "BuildRadixPartitions", TUnit::UNIT);
     hash_table_memory_usage = ADD_COUNTER(runtime_profile, "HashTableMemoryUsage", TUnit::BYTES);
 }
 
@@ -207,6 +213,19 @@ Status HashJoiner::build_ht(RuntimeState* state) {
         size_t bucket_size = _hash_join_builder->hash_table().get_bucket_size();
         COUNTER_SET(build_metrics().build_buckets_counter, static_cast<int64_t>(bucket_size));
         COUNTER_SET(build_metrics().build_keys_per_bucket, static_cast<int64_t>(100 * avg_keys_per_bucket()));
+        COUNTER_SET(build_metrics().build_unique_keys,
+                    static_cast<int64_t>(_hash_join_builder->hash_table().is_linear_probing()));
+        COUNTER_SET(build_metrics().build_radix_partitions,
+                    static_cast<int64_t>(_hash_join_builder->hash_table().radix_partitions()));
+        const auto& build_info = _hash_join_builder->hash_table().build_info();
+        COUNTER_SET(build_metrics().build_ht_dop, static_cast<int64_t>(build_info.dop));
+        if (build_info.dop > 1) {
+            COUNTER_SET(build_metrics().build_ht_partitions, static_cast<int64_t>(build_info.num_partitions));
+            COUNTER_SET(build_metrics().build_ht_partition_rows_max,
+                        static_cast<int64_t>(build_info.max_partition_rows));
+            COUNTER_SET(build_metrics().build_ht_partition_rows_min,
+                        static_cast<int64_t>(build_info.min_partition_rows));
+        }
     }
 
     return Status::OK();
@@ -159,6 +159,12 @@ struct HashJoinBuildMetrics {
     RuntimeProfile::Counter* build_buckets_counter = nullptr;
     RuntimeProfile::Counter* runtime_filter_num = nullptr;
     RuntimeProfile::Counter* build_keys_per_bucket = nullptr;
+    RuntimeProfile::Counter* build_unique_keys = nullptr;
+    RuntimeProfile::Counter* build_ht_dop = nullptr;
+    RuntimeProfile::Counter* build_ht_partitions = nullptr;
+    RuntimeProfile::Counter* build_ht_partition_rows_max = nullptr;
+    RuntimeProfile::Counter* build_ht_partition_rows_min = nullptr;
+    RuntimeProfile::Counter* build_radix_partitions = nullptr;
     RuntimeProfile::Counter* hash_table_memory_usage = nullptr;
 
     void prepare(RuntimeProfile* runtime_profile);
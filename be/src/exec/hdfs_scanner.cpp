@@ -223,7 +223,8 @@ Status HdfsScanner::open_random_access_file() {
     _shared_buffered_input_stream = std::make_shared<io::SharedBufferedInputStream>(input_stream, filename, file_size);
     const io::SharedBufferedInputStream::CoalesceOptions options = {
             .max_dist_size = config::io_coalesce_read_max_distance_size,
-            .max_buffer_size = config::io_coalesce_read_max_buffer_size};
+            .max_buffer_size = config::io_coalesce_read_max_buffer_size,
+            .adaptive_dist_size = config::io_coalesce_adaptive_distance};
     _shared_buffered_input_stream->set_coalesce_options(options);
     input_stream = _shared_buffered_input_stream;
 
@@ -362,6 +363,8 @@ void HdfsScanner::update_counter() {
         COUNTER_UPDATE(profile->datacache_write_timer, stats.write_cache_ns);
         COUNTER_UPDATE(profile->datacache_write_fail_counter, stats.write_cache_fail_count);
         COUNTER_UPDATE(profile->datacache_write_fail_bytes, stats.write_cache_fail_bytes);
+        COUNTER_UPDATE(profile->datacache_skip_write_counter, stats.skip_write_cache_count);
+        COUNTER_UPDATE(profile->datacache_skip_write_bytes, stats.skip_write_cache_bytes);
         COUNTER_UPDATE(profile->datacache_read_block_buffer_counter, stats.read_block_buffer_count);
         COUNTER_UPDATE(profile->datacache_read_block_buffer_bytes, stats.read_block_buffer_bytes);
 
@@ -380,6 +383,8 @@ void HdfsScanner::update_counter() {
         COUNTER_UPDATE(profile->shared_buffered_shared_io_bytes, _shared_buffered_input_stream->shared_io_bytes());
         COUNTER_UPDATE(profile->shared_buffered_shared_align_io_bytes,
                        _shared_buffered_input_stream->shared_align_io_bytes());
+        COUNTER_UPDATE(profile->shared_buffered_shared_request_io_bytes,
+                       _shared_buffered_input_stream->shared_request_io_bytes());
         COUNTER_UPDATE(profile->shared_buffered_shared_io_timer, _shared_buffered_input_stream->shared_io_timer());
         COUNTER_UPDATE(profile->shared_buffered_direct_io_count, _shared_buffered_input_stream->direct_io_count());
         COUNTER_UPDATE(profile->shared_buffered_direct_io_bytes, _shared_buffered_input_stream->direct_io_bytes());
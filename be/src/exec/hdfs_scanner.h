@@ -81,6 +81,9 @@ struct HdfsScanStats {
     // page index
     int64_t rows_before_page_index = 0;
     int64_t page_index_ns = 0;
+    // runtime filter
+    int64_t runtime_filter_skip_groups = 0;
+    int64_t runtime_filter_skip_pages = 0;
 
     // late materialize round-by-round
     int64_t group_min_round_cost = 0;
@@ -127,12 +130,15 @@ struct HdfsScanProfile {
     RuntimeProfile::Counter* datacache_write_timer = nullptr;
     RuntimeProfile::Counter* datacache_write_fail_counter = nullptr;
     RuntimeProfile::Counter* datacache_write_fail_bytes = nullptr;
+    RuntimeProfile::Counter* datacache_skip_write_counter = nullptr;
+    RuntimeProfile::Counter* datacache_skip_write_bytes = nullptr;
     RuntimeProfile::Counter* datacache_read_block_buffer_counter = nullptr;
     RuntimeProfile::Counter* datacache_read_block_buffer_bytes = nullptr;
 
     RuntimeProfile::Counter* shared_buffered_shared_io_count = nullptr;
     RuntimeProfile::Counter* shared_buffered_shared_io_bytes = nullptr;
     RuntimeProfile::Counter* shared_buffered_shared_align_io_bytes = nullptr;
+    RuntimeProfile::Counter* shared_buffered_shared_request_io_bytes = nullptr;
     RuntimeProfile::Counter* shared_buffered_shared_io_timer = nullptr;
     RuntimeProfile::Counter* shared_buffered_direct_io_count = nullptr;
     RuntimeProfile::Counter* shared_buffered_direct_io_bytes = nullptr;
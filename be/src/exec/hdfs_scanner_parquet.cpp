@@ -80,6 +80,9 @@ void HdfsParquetScanner::do_update_counter(HdfsScanProfile* profile) {
     // page index
     RuntimeProfile::Counter* rows_before_page_index = nullptr;
     RuntimeProfile::Counter* page_index_timer = nullptr;
+    // runtime filter
+    RuntimeProfile::Counter* runtime_filter_skip_groups = nullptr;
+    RuntimeProfile::Counter* runtime_filter_skip_pages = nullptr;
 
     RuntimeProfile* root = profile->runtime_profile;
     ADD_COUNTER(root, kParquetProfileSectionPrefix, TUnit::NONE);
@@ -118,6 +121,10 @@ void HdfsParquetScanner::do_update_counter(HdfsScanProfile* profile) {
             kParquetProfileSectionPrefix);
     rows_before_page_index = ADD_CHILD_COUNTER(root, "RowsBeforePageIndex", TUnit::UNIT, kParquetProfileSectionPrefix);
     page_index_timer = ADD_CHILD_TIMER(root, "PageIndexTime", kParquetProfileSectionPrefix);
+    runtime_filter_skip_groups =
+            ADD_CHILD_COUNTER(root, "RuntimeFilterSkipGroups", TUnit::UNIT, kParquetProfileSectionPrefix);
+    runtime_filter_skip_pages =
+            ADD_CHILD_COUNTER(root, "RuntimeFilterSkipPages", TUnit::UNIT, kParquetProfileSectionPrefix);
 
     COUNTER_UPDATE(request_bytes_read, _app_stats.request_bytes_read);
     COUNTER_UPDATE(request_bytes_read_uncompressed, _app_stats.request_bytes_read_uncompressed);
@@ -142,6 +149,8 @@ void HdfsParquetScanner::do_update_counter(HdfsScanProfile* profile) {
     do_update_iceberg_v2_counter(root, kParquetProfileSectionPrefix);
     COUNTER_UPDATE(rows_before_page_index, _app_stats.rows_before_page_index);
     COUNTER_UPDATE(page_index_timer, _app_stats.page_index_ns);
+    COUNTER_UPDATE(runtime_filter_skip_groups, _app_stats.runtime_filter_skip_groups);
+    COUNTER_UPDATE(runtime_filter_skip_pages, _app_stats.runtime_filter_skip_pages);
 }
 
 Status HdfsParquetScanner::do_open(RuntimeState* runtime_state) {
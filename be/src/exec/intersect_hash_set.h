@@ -75,12 +75,16 @@ public:
     int64_t mem_usage() const;
 
 private:
-    void _serialize_columns(const ChunkPtr& chunkPtr, const std::vector<ExprContext*>& exprs, size_t chunk_size);
+    // The key exprs are evaluated once per chunk into _key_columns, which the two methods below consume.
+    void _evaluate_key_columns(const ChunkPtr& chunkPtr, const std::vector<ExprContext*>& exprs);
 
-    size_t _get_max_serialize_size(const ChunkPtr& chunkPtr, const std::vector<ExprContext*>& exprs);
+    void _serialize_columns(size_t chunk_size);
+
+    size_t _get_max_serialize_size();
 
     std::unique_ptr<HashSet> _hash_set;
 
+    Columns _key_columns;
     Buffer<uint32_t> _slice_sizes;
     size_t _max_one_row_size = 8;
     std::unique_ptr<MemPool> _mem_pool;
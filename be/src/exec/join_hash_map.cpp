@@ -17,13 +17,20 @@
 #include <column/chunk.h>
 #include <runtime/descriptors.h>
 
+#include <atomic>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
 
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
 #include "common/statusor.h"
 #include "exec/hash_join_node.h"
+#include "runtime/exec_env.h"
 #include "serde/column_array_serde.h"
 #include "simd/simd.h"
+#include "util/cpu_info.h"
+#include "util/threadpool.h"
 
 namespace starrocks {
 
@@ -176,6 +183,148 @@ void SerializedJoinBuildFunc::_build_nullable_columns(JoinHashTableItems* table_
     }
 }
 
+namespace {
+// Run task(0), ..., task(num_tasks - 1) by the calling thread and at most dop - 1 threads of pool.
+// A thread of the pool which starts after all the tasks are taken returns without touching task, so the calling
+// thread only waits for the tasks being run, and it still finishes all the tasks by itself if the pool is busy.
+void run_parallel_tasks(ThreadPool* pool, uint32_t dop, uint32_t num_tasks,
+                        const std::function<void(uint32_t)>& task) {
+    struct SharedState {
+        std::atomic<uint32_t> next_task{0};
+        std::mutex mutex;
+        std::condition_variable cv;
+        uint32_t finished_tasks = 0;
+    };
+    auto state = std::make_shared<SharedState>();
+    auto worker = [state, num_tasks, task_ptr = &task]() {
+        uint32_t finished_tasks = 0;
+        for (uint32_t i = state->next_task.fetch_add(1); i < num_tasks; i = state->next_task.fetch_add(1)) {
+            (*task_ptr)(i);
+            ++finished_tasks;
+        }
+        if (finished_tasks > 0) {
+            std::lock_guard<std::mutex> l(state->mutex);
+            state->finished_tasks += finished_tasks;
+            if (state->finished_tasks == num_tasks) {
+                state->cv.notify_all();
+            }
+        }
+    };
+
+    for (uint32_t i = 1; pool != nullptr && i < std::min(dop, num_tasks); i++) {
+        if (!pool->submit_func(worker).ok()) {
+            break;
+        }
+    }
+    worker();
+
+    std::unique_lock<std::mutex> l(state->mutex);
+    state->cv.wait(l, [&state, num_tasks] { return state->finished_tasks == num_tasks; });
+}
+} // namespace
+
+uint32_t ParallelJoinHashTableBuilder::calc_build_dop(uint32_t row_count) {
+    if (config::hash_join_parallel_build_min_rows <= 0 || row_count < config::hash_join_parallel_build_min_rows) {
+        return 1;
+    }
+    int32_t max_dop = config::hash_join_parallel_build_max_dop;
+    if (max_dop <= 0) {
+        max_dop = CpuInfo::num_cores();
+    }
+    return std::max<uint32_t>(1, std::min<uint32_t>(max_dop, row_count / MIN_ROWS_PER_THREAD));
+}
+
+void ParallelJoinHashTableBuilder::build(JoinHashTableItems* table_items, const CalcBucketsFunc& calc_buckets,
+                                         const uint8_t* is_nulls, uint32_t dop) {
+    build(table_items, calc_buckets, is_nulls, dop, ExecEnv::GetInstance()->hash_join_build_pool());
+}
+
+void ParallelJoinHashTableBuilder::build(JoinHashTableItems* table_items, const CalcBucketsFunc& calc_buckets,
+                                         const uint8_t* is_nulls, uint32_t dop, ThreadPool* pool) {
+    const uint32_t row_count = table_items->row_count;
+    const uint32_t bucket_size = table_items->bucket_size;
+    DCHECK_EQ(0, bucket_size & (bucket_size - 1));
+    dop = std::max<uint32_t>(1, std::min(dop, row_count));
+
+    // The partition of a bucket is its high bits.
+    uint32_t num_partitions = 1;
+    while (num_partitions < dop * PARTITIONS_PER_THREAD && num_partitions < bucket_size) {
+        num_partitions <<= 1;
+    }
+    const uint32_t partition_shift = __builtin_ctz(bucket_size) - __builtin_ctz(num_partitions);
+
+    // The rows [1, row_count] are divided into dop ranges.
+    const uint32_t rows_per_range = (row_count + dop - 1) / dop;
+    auto range_start = [rows_per_range](uint32_t range) { return 1 + range * rows_per_range; };
+    auto range_count = [rows_per_range, row_count](uint32_t range) {
+        const uint32_t skipped_rows = std::min(row_count, range * rows_per_range);
+        return std::min(rows_per_range, row_count - skipped_rows);
+    };
+
+    // 1. Calculate the buckets and the number of rows of each partition in each range.
+    Buffer<uint32_t> buckets(row_count + 1);
+    std::vector<uint32_t> offsets(dop * num_partitions, 0);
+    run_parallel_tasks(pool, dop, dop, [&](uint32_t range) {
+        const uint32_t start = range_start(range);
+        const uint32_t end = start + range_count(range);
+        calc_buckets(start, end - start, buckets.data());
+        uint32_t* counts = offsets.data() + range * num_partitions;
+        for (uint32_t i = start; i < end; i++) {
+            if (is_nulls == nullptr || is_nulls[i] == 0) {
+                counts[buckets[i] >> partition_shift]++;
+            }
+        }
+    });
+
+    // 2. Turn the counts into the offsets of each range in partition_rows, where the rows of a partition are
+    // in the order of the ranges.
+    std::vector<uint32_t> partition_offsets(num_partitions + 1, 0);
+    for (uint32_t p = 0; p < num_partitions; p++) {
+        uint32_t offset = partition_offsets[p];
+        for (uint32_t range = 0; range < dop; range++) {
+            const uint32_t count = offsets[range * num_partitions + p];
+            offsets[range * num_partitions + p] = offset;
+            offset += count;
+        }
+        partition_offsets[p + 1] = offset;
+    }
+
+    // 3. Scatter the rows to their partitions.
+    Buffer<uint32_t> partition_rows(partition_offsets[num_partitions]);
+    run_parallel_tasks(pool, dop, dop, [&](uint32_t range) {
+        const uint32_t start = range_start(range);
+        const uint32_t end = start + range_count(range);
+        uint32_t* range_offsets = offsets.data() + range * num_partitions;
+        for (uint32_t i = start; i < end; i++) {
+            if (is_nulls == nullptr || is_nulls[i] == 0) {
+                partition_rows[range_offsets[buckets[i] >> partition_shift]++] = i;
+            }
+        }
+    });
+
+    // 4. Link the rows of each partition.
+    uint32_t* first = table_items->first.data();
+    uint32_t* next = table_items->next.data();
+    run_parallel_tasks(pool, dop, num_partitions, [&](uint32_t p) {
+        for (uint32_t k = partition_offsets[p]; k < partition_offsets[p + 1]; k++) {
+            const uint32_t i = partition_rows[k];
+            next[i] = first[buckets[i]];
+            first[buckets[i]] = i;
+        }
+    });
+
+    auto& build_info = table_items->build_info;
+    build_info.dop = dop;
+    build_info.num_partitions = num_partitions;
+    build_info.max_partition_rows = 0;
+    build_info.min_partition_rows = std::numeric_limits<uint32_t>::max();
+    for (uint32_t p = 0; p < num_partitions; p++) {
+        const uint32_t rows = partition_offsets[p + 1] - partition_offsets[p];
+        build_info.max_partition_rows = std::max(build_info.max_partition_rows, rows);
+        build_info.min_partition_rows = std::min(build_info.min_partition_rows, rows);
+    }
+}
+
 void SerializedJoinProbeFunc::lookup_init(const JoinHashTableItems& table_items, HashTableProbeState* probe_state) {
     probe_state->probe_pool->clear();
 
@@ -224,9 +373,7 @@ void SerializedJoinProbeFunc::_probe_column(const JoinHashTableItems& table_item
         ptr += probe_state->probe_slice[i].size;
     }
 
-    for (uint32_t i = 0; i < row_count; i++) {
-        probe_state->next[i] = table_items.first[probe_state->buckets[i]];
-    }
+    JoinHashMapHelper::lookup_bucket_heads(table_items, probe_state, row_count);
 }
 
 void SerializedJoinProbeFunc::_probe_nullable_column(const JoinHashTableItems& table_items,
@@ -255,11 +402,9 @@ void SerializedJoinProbeFunc::_probe_nullable_column(const JoinHashTableItems& t
         if (probe_state->is_nulls[i] == 0) {
             probe_state->buckets[i] =
                     JoinHashMapHelper::calc_bucket_num<Slice>(probe_state->probe_slice[i], table_items.bucket_size);
-            probe_state->next[i] = table_items.first[probe_state->buckets[i]];
-        } else {
-            probe_state->next[i] = 0;
         }
     }
+    JoinHashMapHelper::lookup_bucket_heads(table_items, probe_state, row_count, probe_state->is_nulls.data());
 }
 
 JoinHashTable JoinHashTable::clone_readable_table() {
@@ -424,6 +569,7 @@ int64_t JoinHashTable::mem_usage() const {
     }
     usage += _table_items->first.capacity() * sizeof(uint32_t);
     usage += _table_items->next.capacity() * sizeof(uint32_t);
+    usage += _table_items->linear_buckets.capacity() * sizeof(UniqueKeyBucket);
     if (_table_items->build_pool != nullptr) {
         usage += _table_items->build_pool->total_reserved_bytes();
     }
@@ -452,8 +598,126 @@ Status JoinHashTable::build(RuntimeState* state) {
 
     RETURN_IF_ERROR(_upgrade_key_columns_if_overflow());
 
+    // Try the linear probing hash map for one int or bigint key at first, and it gives up once a duplicated key
+    // is found, then fall back to the bucket-chained one.
+    _table_items->linear_probing = false;
     _hash_map_type = _choose_join_hash_map();
+    if (config::enable_hash_join_linear_probing &&
+        (_hash_map_type == JoinHashMapType::key32 || _hash_map_type == JoinHashMapType::key64)) {
+        _table_items->linear_probing = true;
+        _hash_map_type = _choose_join_hash_map();
+        _build_hash_map(state);
+        if (_table_items->linear_probing) {
+            return Status::OK();
+        }
+        _linear32.reset();
+        _linear64.reset();
+        _hash_map_type = _choose_join_hash_map();
+    }
+    _build_hash_map(state);
 
+    if (uint32_t partition_buckets = _calc_radix_partition_buckets(); partition_buckets > 0) {
+        _cluster_build_rows(partition_buckets);
+    }
+
+    return Status::OK();
+}
+
+uint32_t JoinHashTable::_calc_radix_partition_buckets() const {
+    const auto& items = *_table_items;
+    if (!config::enable_hash_join_radix_partition || items.mor_reader_mode || items.linear_probing ||
+        _hash_map_type == JoinHashMapType::empty || items.row_count == 0 || items.first.empty()) {
+        return 0;
+    }
+
+    size_t ht_bytes = (items.first.size() + items.next.size()) * sizeof(uint32_t);
+    if (items.build_key_column != nullptr) {
+        ht_bytes += items.build_key_column->byte_size();
+    } else if (!items.build_slice.empty() && items.build_pool != nullptr) {
+        ht_bytes += items.build_pool->total_allocated_bytes();
+    } else {
+        for (const auto& key_column : items.key_columns) {
+            ht_bytes += key_column->byte_size();
+        }
+    }
+    if (static_cast<int64_t>(ht_bytes) < config::hash_join_radix_partition_min_ht_bytes) {
+        return 0;
+    }
+
+    // The largest power of 2 buckets whose rows are expected to fit in the partition bytes.
+    const size_t partition_bytes = std::max<int64_t>(config::hash_join_radix_partition_bytes, 1);
+    const size_t expected_buckets = std::max<size_t>(1, items.bucket_size * partition_bytes / ht_bytes);
+    const uint32_t partition_buckets = 1U << (63 - __builtin_clzll(expected_buckets));
+    return partition_buckets < items.bucket_size ? partition_buckets : 0;
+}
+
+void JoinHashTable::_cluster_build_rows(uint32_t partition_buckets) {
+    auto& items = *_table_items;
+    const uint32_t row_count = items.row_count;
+    const uint32_t bucket_size = items.bucket_size;
+
+    // new_to_old[new index] is the old index of a build row, and the row 0 keeps unchanged.
+    Buffer<uint32_t> new_to_old(row_count + 1, 0);
+    Buffer<uint32_t> first(bucket_size, 0);
+    Buffer<uint32_t> next(row_count + 1, 0);
+    Filter linked(row_count + 1, 0);
+    uint32_t new_index = 1;
+    for (uint32_t bucket = 0; bucket < bucket_size; bucket++) {
+        uint32_t old_index = items.first[bucket];
+        if (old_index == 0) {
+            continue;
+        }
+        first[bucket] = new_index;
+        while (old_index != 0) {
+            new_to_old[new_index] = old_index;
+            linked[old_index] = 1;
+            old_index = items.next[old_index];
+            next[new_index] = old_index == 0 ? 0 : new_index + 1;
+            new_index++;
+        }
+    }
+    // The rows with null keys are not in any chain, but they are output by right and full outer joins.
+    for (uint32_t i = 1; i <= row_count; i++) {
+        if (linked[i] == 0) {
+            new_to_old[new_index++] = i;
+        }
+    }
+    DCHECK_EQ(row_count + 1, new_index);
+
+    auto permute = [&new_to_old, row_count](const ColumnPtr& column) -> ColumnPtr {
+        auto new_column = column->clone_empty();
+        new_column->append_selective(*column, new_to_old.data(), 0, row_count + 1);
+        return new_column;
+    };
+    // Permute the columns one by one to bound the extra memory by the largest column.
+    for (auto& column : items.build_chunk->columns()) {
+        column = permute(column);
+    }
+    for (size_t i = 0; i < items.key_columns.size(); i++) {
+        if (items.join_keys[i].col_ref != nullptr) {
+            items.key_columns[i] = items.build_chunk->get_column_by_slot_id(items.join_keys[i].col_ref->slot_id());
+        } else {
+            items.key_columns[i] = permute(items.key_columns[i]);
+        }
+    }
+    if (items.build_key_column != nullptr) {
+        items.build_key_column = permute(items.build_key_column);
+    }
+    if (!items.build_slice.empty()) {
+        Buffer<Slice> build_slice(row_count + 1);
+        for (uint32_t i = 0; i <= row_count; i++) {
+            build_slice[i] = items.build_slice[new_to_old[i]];
+        }
+        items.build_slice = std::move(build_slice);
+    }
+
+    items.first = std::move(first);
+    items.next = std::move(next);
+    items.radix_partition_shift = __builtin_ctz(partition_buckets);
+    items.radix_partitions = bucket_size / partition_buckets;
+}
+
+void JoinHashTable::_build_hash_map(RuntimeState* state) {
     switch (_hash_map_type) {
 #define M(NAME)                                                                                                       \
     case JoinHashMapType::NAME:                                                                                       \
@@ -467,8 +731,6 @@ Status JoinHashTable::build(RuntimeState* state) {
     default:
         assert(false);
     }
-
-    return Status::OK();
 }
 
 void JoinHashTable::reset_probe_state(starrocks::RuntimeState* state) {
@@ -652,9 +914,9 @@ JoinHashMapType JoinHashTable::_choose_join_hash_map() {
         case LogicalType::TYPE_SMALLINT:
             return JoinHashMapType::key16;
         case LogicalType::TYPE_INT:
-            return JoinHashMapType::key32;
+            return _table_items->linear_probing ? JoinHashMapType::linear32 : JoinHashMapType::key32;
         case LogicalType::TYPE_BIGINT:
-            return JoinHashMapType::key64;
+            return _table_items->linear_probing ? JoinHashMapType::linear64 : JoinHashMapType::key64;
         case LogicalType::TYPE_LARGEINT:
             return JoinHashMapType::key128;
         case LogicalType::TYPE_FLOAT:
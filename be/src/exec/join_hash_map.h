@@ -22,6 +22,7 @@
 
 #include <coroutine>
 #include <cstdint>
+#include <functional>
 #include <set>
 
 #include "column/chunk.h"
@@ -58,7 +59,9 @@ class ColumnRef;
     M(slice)                       \
     M(fixed32)                     \
     M(fixed64)                     \
-    M(fixed128)
+    M(fixed128)                    \
+    M(linear32)                    \
+    M(linear64)
 
 enum class JoinHashMapType {
     empty,
@@ -79,12 +82,34 @@ enum class JoinHashMapType {
     keydecimal128,
     slice,
     fixed32, // 4 bytes
-    fixed64, // 8 bytes
-    fixed128 // 16 bytes
+    fixed64,  // 8 bytes
+    fixed128, // 16 bytes
+    linear32, // unique one key of 4 bytes
+    linear64  // unique one key of 8 bytes
 };
 
 enum class JoinMatchFlag { NORMAL, ALL_NOT_MATCH, ALL_MATCH_ONE, MOST_MATCH_ONE };
 
+// UniqueKeyBucket is a cache line of the linear probing hash map for the unique build keys.
+// A slot of the bucket holds a key and its build row index, and the tag of the slot is the high bits of the hash
+// value of the key, so a probe matches the tags of all the slots of a bucket at once, and only compares the keys
+// whose tags are matched. See LinearProbingJoinBuildFunc.
+struct alignas(64) UniqueKeyBucket {
+    // 0 means the slot is empty, and the slots are always used in order.
+    uint8_t tags[8];
+    // The keys of the slots, followed by the build row indexes of the slots.
+    uint8_t slots[56];
+};
+
+// How the first and next of the hash table are built in parallel, see ParallelJoinHashTableBuilder.
+struct JoinHashTableBuildInfo {
+    // The number of threads building the hash table, and 1 means it is built serially.
+    uint32_t dop = 1;
+    uint32_t num_partitions = 0;
+    uint32_t max_partition_rows = 0;
+    uint32_t min_partition_rows = 0;
+};
+
 struct JoinKeyDesc {
     const TypeDescriptor* type = nullptr;
     bool is_null_safe_equal;
@@ -126,6 +151,17 @@ struct JoinHashTableItems {
     float keys_per_bucket = 0;
     size_t used_buckets = 0;
     bool cache_miss_serious = false;
+    // Prefetch the buckets and the build rows when probing, if the ht can't fit in the cache.
+    bool enable_prefetch = false;
+    // The build keys are unique, and the linear probing hash map is used instead of first and next.
+    bool linear_probing = false;
+    Buffer<UniqueKeyBucket> linear_buckets;
+    JoinHashTableBuildInfo build_info;
+    // If radix_partitions > 0, the build rows are clustered by their buckets, so the rows of each chain are
+    // contiguous, and the buckets [p << radix_partition_shift, (p + 1) << radix_partition_shift) and their rows
+    // form the cache-sized radix partition p.
+    uint32_t radix_partitions = 0;
+    uint32_t radix_partition_shift = 0;
     bool mor_reader_mode = false;
 
     float get_keys_per_bucket() const { return keys_per_bucket; }
@@ -142,8 +178,12 @@ struct JoinHashTableItems {
             cache_miss_serious = row_count > (1UL << 18) &&
                                  ((probe_bytes > (1UL << 25) && keys_per_bucket > 2) ||
                                   (probe_bytes > (1UL << 26) && keys_per_bucket > 1.5) || probe_bytes > (1UL << 27));
+            // Random accesses on the buckets and the keys mostly miss the cache when they are much larger than the L2 cache,
+            // and each miss stalls the probe loop, since the chain can't be followed until the bucket is loaded.
+            enable_prefetch = probe_bytes + first.size() * sizeof(uint32_t) > (1UL << 22);
             VLOG_QUERY << "ht cache miss serious = " << cache_miss_serious << " row# = " << row_count
-                       << " , bytes = " << probe_bytes << " , depth = " << keys_per_bucket;
+                       << " , bytes = " << probe_bytes << " , depth = " << keys_per_bucket
+                       << " , prefetch = " << enable_prefetch;
         }
     }
 
@@ -162,6 +202,9 @@ struct HashTableProbeState {
     Buffer<uint32_t> next;
     Buffer<Slice> probe_slice;
     Buffer<uint8_t>* null_array = nullptr;
+    // The probe rows ordered by the radix partitions of their buckets, and the offsets of each partition.
+    Buffer<uint32_t> radix_order;
+    Buffer<uint32_t> radix_offsets;
     ColumnPtr probe_key_column;
     const Columns* key_columns = nullptr;
 
@@ -338,6 +381,36 @@ public:
         }
     }
 
+    // The number of probe rows to prefetch ahead, which should cover the latency of a memory access.
+    static constexpr size_t PROBE_PREFETCH_DISTANCE = 16;
+
+    // Load the first build row of the bucket of each probe row into probe_state->next, and set it to 0 for the
+    // probe rows whose is_nulls is not 0. The buckets must be calculated for all the not null probe rows.
+    // If table_items.enable_prefetch, the buckets are prefetched PROBE_PREFETCH_DISTANCE rows ahead.
+    static void lookup_bucket_heads(const JoinHashTableItems& table_items, HashTableProbeState* probe_state,
+                                    uint32_t row_count, const uint8_t* is_nulls = nullptr) {
+        if (table_items.radix_partitions > 0) {
+            _lookup_bucket_heads_by_partition(table_items, probe_state, row_count, is_nulls);
+            return;
+        }
+        const uint32_t* first = table_items.first.data();
+        const uint32_t* buckets = probe_state->buckets.data();
+        uint32_t* next = probe_state->next.data();
+        if (is_nulls == nullptr) {
+            if (table_items.enable_prefetch) {
+                _lookup_bucket_heads<true, false>(first, buckets, is_nulls, next, row_count);
+            } else {
+                _lookup_bucket_heads<false, false>(first, buckets, is_nulls, next, row_count);
+            }
+        } else {
+            if (table_items.enable_prefetch) {
+                _lookup_bucket_heads<true, true>(first, buckets, is_nulls, next, row_count);
+            } else {
+                _lookup_bucket_heads<false, true>(first, buckets, is_nulls, next, row_count);
+            }
+        }
+    }
+
     static Slice get_hash_key(const Columns& key_columns, size_t row_idx, uint8_t* buffer) {
         size_t byte_size = 0;
         for (const auto& key_column : key_columns) {
@@ -363,6 +436,189 @@ public:
             byte_offset += offset;
         }
     }
+
+private:
+    template <bool prefetch, bool has_null>
+    static void _lookup_bucket_heads(const uint32_t* first, const uint32_t* buckets, const uint8_t* is_nulls,
+                                     uint32_t* next, uint32_t row_count) {
+        for (uint32_t i = 0; i < row_count; i++) {
+            if constexpr (prefetch) {
+                const uint32_t ahead = i + PROBE_PREFETCH_DISTANCE;
+                // The buckets of the null rows may be not calculated.
+                if (ahead < row_count && (!has_null || is_nulls[ahead] == 0)) {
+                    __builtin_prefetch(first + buckets[ahead]);
+                }
+            }
+            if constexpr (has_null) {
+                next[i] = is_nulls[i] == 0 ? first[buckets[i]] : 0;
+            } else {
+                next[i] = first[buckets[i]];
+            }
+        }
+    }
+
+    // Visit the buckets radix partition by partition, so the accesses to the hash table stay in one cache-sized
+    // partition for a while instead of jumping around the whole table.
+    static void _lookup_bucket_heads_by_partition(const JoinHashTableItems& table_items,
+                                                  HashTableProbeState* probe_state, uint32_t row_count,
+                                                  const uint8_t* is_nulls) {
+        const uint32_t* first = table_items.first.data();
+        const uint32_t* buckets = probe_state->buckets.data();
+        uint32_t* next = probe_state->next.data();
+        const uint32_t shift = table_items.radix_partition_shift;
+
+        auto& offsets = probe_state->radix_offsets;
+        offsets.assign(table_items.radix_partitions + 1, 0);
+        uint32_t num_rows = 0;
+        for (uint32_t i = 0; i < row_count; i++) {
+            if (is_nulls == nullptr || is_nulls[i] == 0) {
+                offsets[(buckets[i] >> shift) + 1]++;
+                num_rows++;
+            } else {
+                next[i] = 0;
+            }
+        }
+        for (uint32_t p = 1; p <= table_items.radix_partitions; p++) {
+            offsets[p] += offsets[p - 1];
+        }
+
+        auto& order = probe_state->radix_order;
+        order.resize(num_rows);
+        for (uint32_t i = 0; i < row_count; i++) {
+            if (is_nulls == nullptr || is_nulls[i] == 0) {
+                order[offsets[buckets[i] >> shift]++] = i;
+            }
+        }
+
+        for (uint32_t k = 0; k < num_rows; k++) {
+            if (table_items.enable_prefetch && k + PROBE_PREFETCH_DISTANCE < num_rows) {
+                __builtin_prefetch(first + buckets[order[k + PROBE_PREFETCH_DISTANCE]]);
+            }
+            next[order[k]] = first[buckets[order[k]]];
+        }
+    }
+};
+
+class ThreadPool;
+
+// ParallelJoinHashTableBuilder links the build rows into JoinHashTableItems.first and next by several threads.
+// The rows are radix partitioned by the high bits of their buckets, so each partition owns a disjoint range
+// of first and is linked without any synchronization. The rows of a partition are linked in the row order,
+// so the chains are the same as those built serially.
+class ParallelJoinHashTableBuilder {
+public:
+    // Calculate the buckets of the rows [start, start + count) into buckets[start, start + count).
+    using CalcBucketsFunc = std::function<void(uint32_t start, uint32_t count, uint32_t* buckets)>;
+
+    // Return the number of threads to build a hash table of row_count rows, and 1 means building it serially.
+    static uint32_t calc_build_dop(uint32_t row_count);
+
+    // Build first and next of table_items, whose bucket_size must be a power of 2.
+    // The rows whose is_nulls[row] is not 0 are not linked, and is_nulls can be nullptr if there is no null row.
+    // The calling thread takes part in the build, and the other dop - 1 threads are taken from pool, which can
+    // be nullptr. The calling thread never waits for a task which is still in the queue of the pool.
+    static void build(JoinHashTableItems* table_items, const CalcBucketsFunc& calc_buckets, const uint8_t* is_nulls,
+                      uint32_t dop, ThreadPool* pool);
+    // Take the threads from the hash join build pool of ExecEnv.
+    static void build(JoinHashTableItems* table_items, const CalcBucketsFunc& calc_buckets, const uint8_t* is_nulls,
+                      uint32_t dop);
+
+private:
+    // Each thread takes about this number of rows at least.
+    static constexpr uint32_t MIN_ROWS_PER_THREAD = 1 << 20;
+    // The partitions are more than the threads to balance the skewed buckets.
+    static constexpr uint32_t PARTITIONS_PER_THREAD = 4;
+};
+
+// The helper of the slots of UniqueKeyBucket for the keys of CppType.
+template <typename CppType>
+class UniqueKeyBucketHelper {
+public:
+    static constexpr uint32_t NUM_SLOTS = sizeof(UniqueKeyBucket::slots) / (sizeof(CppType) + sizeof(uint32_t));
+    static_assert(NUM_SLOTS >= 2 && NUM_SLOTS <= sizeof(UniqueKeyBucket::tags));
+
+    // The number of buckets is a power of two, and keeps the load factor under 0.75.
+    static uint32_t calc_bucket_size(uint32_t num_keys) {
+        size_t expect_bucket_size = static_cast<size_t>(num_keys) * 4 / 3 / NUM_SLOTS + 1;
+        return phmap::priv::NormalizeCapacity(expect_bucket_size) + 1;
+    }
+
+    static uint32_t hash(const CppType& key) { return JoinKeyHash<CppType>()(key); }
+
+    // Return the build row index of the key, and 0 if not found.
+    static uint32_t find(const UniqueKeyBucket* buckets, uint32_t bucket_size, const CppType& key, uint32_t hash) {
+        const uint8_t tag = _tag(hash);
+        for (uint32_t i = hash & (bucket_size - 1);; i = (i + 1) & (bucket_size - 1)) {
+            const UniqueKeyBucket& bucket = buckets[i];
+            const uint64_t tags = _load_tags(bucket);
+            for (uint64_t matches = _match_tag(tags, tag); matches != 0; matches &= matches - 1) {
+                const uint32_t slot = __builtin_ctzll(matches) >> 3;
+                if (_key(bucket, slot) == key) {
+                    return _row(bucket, slot);
+                }
+            }
+            // The key would be in this bucket if it had been inserted.
+            if (_match_tag(tags, 0) != 0) {
+                return 0;
+            }
+        }
+    }
+
+    // Return false if the key already exists.
+    static bool insert(UniqueKeyBucket* buckets, uint32_t bucket_size, const CppType& key, uint32_t hash,
+                       uint32_t row) {
+        const uint8_t tag = _tag(hash);
+        for (uint32_t i = hash & (bucket_size - 1);; i = (i + 1) & (bucket_size - 1)) {
+            UniqueKeyBucket& bucket = buckets[i];
+            const uint64_t tags = _load_tags(bucket);
+            for (uint64_t matches = _match_tag(tags, tag); matches != 0; matches &= matches - 1) {
+                if (_key(bucket, __builtin_ctzll(matches) >> 3) == key) {
+                    return false;
+                }
+            }
+            const uint64_t empty_slots = _match_tag(tags, 0);
+            if (empty_slots != 0) {
+                const uint32_t slot = __builtin_ctzll(empty_slots) >> 3;
+                bucket.tags[slot] = tag;
+                memcpy(bucket.slots + slot * sizeof(CppType), &key, sizeof(CppType));
+                memcpy(bucket.slots + NUM_SLOTS * sizeof(CppType) + slot * sizeof(uint32_t), &row, sizeof(uint32_t));
+                return true;
+            }
+        }
+    }
+
+private:
+    // The high bit of each tag byte is set only if the tag of the slot is used.
+    static constexpr uint64_t SLOT_HIGH_BITS =
+            0x8080808080808080ULL >> ((sizeof(UniqueKeyBucket::tags) - NUM_SLOTS) * 8);
+
+    static uint8_t _tag(uint32_t hash) { return static_cast<uint8_t>((hash >> 25) | 0x80); }
+
+    static uint64_t _load_tags(const UniqueKeyBucket& bucket) {
+        uint64_t tags;
+        memcpy(&tags, bucket.tags, sizeof(tags));
+        return tags;
+    }
+
+    // Match the tag with the tags of all the slots by SWAR, the high bit of the byte of each matched slot is set.
+    static uint64_t _match_tag(uint64_t tags, uint8_t tag) {
+        constexpr uint64_t LOW_BITS = 0x7F7F7F7F7F7F7F7FULL;
+        const uint64_t x = tags ^ (0x0101010101010101ULL * tag);
+        // The high bit of a byte is set if and only if the byte of x is zero.
+        return ~(((x & LOW_BITS) + LOW_BITS) | x | LOW_BITS) & SLOT_HIGH_BITS;
+    }
+
+    static CppType _key(const UniqueKeyBucket& bucket, uint32_t slot) {
+        CppType key;
+        memcpy(&key, bucket.slots + slot * sizeof(CppType), sizeof(CppType));
+        return key;
+    }
+
+    static uint32_t _row(const UniqueKeyBucket& bucket, uint32_t slot) {
+        uint32_t row;
+        memcpy(&row, bucket.slots + NUM_SLOTS * sizeof(CppType) + slot * sizeof(uint32_t), sizeof(uint32_t));
+        return row;
+    }
 };
 
 template <LogicalType LT>
@@ -410,6 +666,36 @@ private:
     static void _build_nullable_columns(JoinHashTableItems* table_items, HashTableProbeState* probe_state,
                                         const Columns& data_columns, const NullColumns& null_columns, uint32_t start,
                                         uint32_t count);
+
+    static void _build_columns_parallel(JoinHashTableItems* table_items, const Columns& data_columns,
+                                        const NullColumns& null_columns, uint32_t dop);
+};
+
+// Build the linear probing hash map of UniqueKeyBucket for the unique keys of one column, and every probe row
+// matches at most one build row. The next of each build row is always 0, so `next` is not used at all.
+// construct_hash_table() gives up and sets table_items->linear_probing to false once a duplicated key is found.
+template <LogicalType LT>
+class LinearProbingJoinBuildFunc {
+public:
+    using CppType = typename RunTimeTypeTraits<LT>::CppType;
+    using ColumnType = typename RunTimeTypeTraits<LT>::ColumnType;
+
+    static void prepare(RuntimeState* runtime, JoinHashTableItems* table_items);
+    static const Buffer<CppType>& get_key_data(const JoinHashTableItems& table_items) {
+        return JoinBuildFunc<LT>::get_key_data(table_items);
+    }
+    static void construct_hash_table(RuntimeState* state, JoinHashTableItems* table_items,
+                                     HashTableProbeState* probe_state);
+};
+
+template <class BuildFunc>
+struct JoinBuildFuncTraits {
+    static constexpr bool unique_keys = false;
+};
+
+template <LogicalType LT>
+struct JoinBuildFuncTraits<LinearProbingJoinBuildFunc<LT>> {
+    static constexpr bool unique_keys = true;
 };
 
 class SerializedJoinBuildFunc {
@@ -479,6 +765,21 @@ private:
                                        const Columns& data_columns, const NullColumns& null_columns);
 };
 
+template <LogicalType LT>
+class LinearProbingJoinProbeFunc {
+public:
+    using CppType = typename RunTimeTypeTraits<LT>::CppType;
+    using ColumnType = typename RunTimeTypeTraits<LT>::ColumnType;
+
+    static void prepare(RuntimeState* state, HashTableProbeState* probe_state) {}
+    // Find the matched build row of each probe row, the keys are compared here already.
+    static void lookup_init(const JoinHashTableItems& table_items, HashTableProbeState* probe_state);
+    static const Buffer<CppType>& get_key_data(const HashTableProbeState& probe_state) {
+        return JoinProbeFunc<LT>::get_key_data(probe_state);
+    }
+    static bool equal(const CppType& x, const CppType& y) { return true; }
+};
+
 class SerializedJoinProbeFunc {
 public:
     static const Buffer<Slice>& get_key_data(const HashTableProbeState& probe_state) { return probe_state.probe_slice; }
@@ -632,6 +933,19 @@ private:
     template <bool first_probe, bool init_match = false>
     void _probe_coroutine(RuntimeState* state, const Buffer<CppType>& build_data, const Buffer<CppType>& probe_data);
 
+    // Prefetch the key and the chain of the first build row of the probe row PROBE_PREFETCH_DISTANCE ahead,
+    // so they are likely in the cache when the probe loop reaches it.
+    void _prefetch_build_row(const Buffer<CppType>& build_data, size_t probe_index, size_t probe_row_count);
+
+    // The next build row in the same bucket, and the chain always ends at once for the unique keys.
+    uint32_t _next_build_index(uint32_t build_index) const {
+        if constexpr (JoinBuildFuncTraits<BuildFunc>::unique_keys) {
+            return 0;
+        } else {
+            return _table_items->next[build_index];
+        }
+    }
+
     // for one key left outer join
     template <bool first_probe>
     void _probe_from_ht_for_left_outer_join(RuntimeState* state, const Buffer<CppType>& build_data,
@@ -725,6 +1039,8 @@ private:
 #define JoinHashMapForDirectMapping(LT) JoinHashMap<LT, DirectMappingJoinBuildFunc<LT>, DirectMappingJoinProbeFunc<LT>>
 #define JoinHashMapForFixedSizeKey(LT) JoinHashMap<LT, FixedSizeJoinBuildFunc<LT>, FixedSizeJoinProbeFunc<LT>>
 #define JoinHashMapForSerializedKey(LT) JoinHashMap<LT, SerializedJoinBuildFunc, SerializedJoinProbeFunc>
+#define JoinHashMapForLinearProbing(LT) \
+    JoinHashMap<LT, LinearProbingJoinBuildFunc<LT>, LinearProbingJoinProbeFunc<LT>>
 
 class JoinHashTable {
 public:
@@ -766,12 +1082,23 @@ public:
     size_t get_output_build_column_count() const { return _table_items->output_build_column_count; }
     size_t get_bucket_size() const { return _table_items->bucket_size; }
     float get_keys_per_bucket() const;
+    // Whether the build keys are unique and the linear probing hash map is used.
+    bool is_linear_probing() const { return _table_items->linear_probing; }
+    const JoinHashTableBuildInfo& build_info() const { return _table_items->build_info; }
+    // The number of the radix partitions of the hash table, and 0 means it isn't radix partitioned.
+    uint32_t radix_partitions() const { return _table_items->radix_partitions; }
     void remove_duplicate_index(Filter* filter);
 
     int64_t mem_usage() const;
 
 private:
     JoinHashMapType _choose_join_hash_map();
+    void _build_hash_map(RuntimeState* state);
+    // Return the number of buckets of each radix partition, or 0 if the hash table shouldn't be radix partitioned.
+    uint32_t _calc_radix_partition_buckets() const;
+    // Renumber the build rows in the order of the buckets and their chains, and split the buckets into
+    // radix partitions.
+    void _cluster_build_rows(uint32_t partition_buckets);
     static size_t _get_size_of_fixed_and_contiguous_type(LogicalType data_type);
 
     [[nodiscard]] Status _upgrade_key_columns_if_overflow();
@@ -804,6 +1131,8 @@ private:
     std::unique_ptr<JoinHashMapForFixedSizeKey(TYPE_INT)> _fixed32 = nullptr;
     std::unique_ptr<JoinHashMapForFixedSizeKey(TYPE_BIGINT)> _fixed64 = nullptr;
     std::unique_ptr<JoinHashMapForFixedSizeKey(TYPE_LARGEINT)> _fixed128 = nullptr;
+    std::unique_ptr<JoinHashMapForLinearProbing(TYPE_INT)> _linear32 = nullptr;
+    std::unique_ptr<JoinHashMapForLinearProbing(TYPE_BIGINT)> _linear64 = nullptr;
 
     JoinHashMapType _hash_map_type = JoinHashMapType::empty;
 
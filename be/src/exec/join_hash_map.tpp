@@ -54,7 +54,20 @@ template <LogicalType LT>
 void JoinBuildFunc<LT>::construct_hash_table(RuntimeState* state, JoinHashTableItems* table_items,
                                              HashTableProbeState* probe_state) {
     auto& data = get_key_data(*table_items);
-    if (table_items->key_columns[0]->is_nullable()) {
+    if (uint32_t dop = ParallelJoinHashTableBuilder::calc_build_dop(table_items->row_count); dop > 1) {
+        const uint8_t* is_nulls = nullptr;
+        if (table_items->key_columns[0]->is_nullable()) {
+            auto* nullable_column = ColumnHelper::as_raw_column<NullableColumn>(table_items->key_columns[0]);
+            is_nulls = nullable_column->null_column()->get_data().data();
+        }
+        const uint32_t bucket_size = table_items->bucket_size;
+        auto calc_buckets = [&data, bucket_size](uint32_t start, uint32_t count, uint32_t* buckets) {
+            for (uint32_t i = start; i < start + count; i++) {
+                buckets[i] = JoinHashMapHelper::calc_bucket_num<CppType>(data[i], bucket_size);
+            }
+        };
+        ParallelJoinHashTableBuilder::build(table_items, calc_buckets, is_nulls, dop);
+    } else if (table_items->key_columns[0]->is_nullable()) {
         auto* nullable_column = ColumnHelper::as_raw_column<NullableColumn>(table_items->key_columns[0]);
         auto& null_array = nullable_column->null_column()->get_data();
         for (size_t i = 1; i < table_items->row_count + 1; i++) {
@@ -74,6 +87,42 @@ void JoinBuildFunc<LT>::construct_hash_table(RuntimeState* state, JoinHashTableI
     table_items->calculate_ht_info(table_items->key_columns[0]->byte_size());
 }
 
+template <LogicalType LT>
+void LinearProbingJoinBuildFunc<LT>::prepare(RuntimeState* runtime, JoinHashTableItems* table_items) {
+    table_items->bucket_size = UniqueKeyBucketHelper<CppType>::calc_bucket_size(table_items->row_count);
+    table_items->linear_buckets.assign(table_items->bucket_size, UniqueKeyBucket{});
+}
+
+template <LogicalType LT>
+void LinearProbingJoinBuildFunc<LT>::construct_hash_table(RuntimeState* state, JoinHashTableItems* table_items,
+                                                          HashTableProbeState* probe_state) {
+    using Helper = UniqueKeyBucketHelper<CppType>;
+
+    auto& data = get_key_data(*table_items);
+    const uint8_t* is_nulls = nullptr;
+    if (table_items->key_columns[0]->is_nullable()) {
+        auto* nullable_column = ColumnHelper::as_raw_column<NullableColumn>(table_items->key_columns[0]);
+        is_nulls = nullable_column->null_column()->get_data().data();
+    }
+
+    UniqueKeyBucket* buckets = table_items->linear_buckets.data();
+    const uint32_t bucket_size = table_items->bucket_size;
+    for (uint32_t i = 1; i < table_items->row_count + 1; i++) {
+        if (is_nulls != nullptr && is_nulls[i] != 0) {
+            continue;
+        }
+        if (!Helper::insert(buckets, bucket_size, data[i], Helper::hash(data[i]), i)) {
+            table_items->linear_probing = false;
+            Buffer<UniqueKeyBucket>().swap(table_items->linear_buckets);
+            return;
+        }
+    }
+
+    table_items->used_buckets = bucket_size;
+    table_items->keys_per_bucket = table_items->row_count * 1.0 / bucket_size;
+    table_items->enable_prefetch = bucket_size * sizeof(UniqueKeyBucket) > (1UL << 22);
+}
+
 template <LogicalType LT>
 void DirectMappingJoinBuildFunc<LT>::prepare(RuntimeState* runtime, JoinHashTableItems* table_items) {
     static constexpr size_t BUCKET_SIZE =
@@ -150,6 +199,12 @@ void FixedSizeJoinBuildFunc<LT>::construct_hash_table(RuntimeState* state, JoinH
         }
     }
 
+    if (uint32_t dop = ParallelJoinHashTableBuilder::calc_build_dop(row_count); dop > 1) {
+        _build_columns_parallel(table_items, data_columns, null_columns, dop);
+        table_items->calculate_ht_info(table_items->build_key_column->byte_size());
+        return;
+    }
+
     // serialize and build hash table
     uint32_t quo = row_count / state->chunk_size();
     uint32_t rem = row_count % state->chunk_size();
@@ -185,6 +240,35 @@ void FixedSizeJoinBuildFunc<LT>::_build_columns(JoinHashTableItems* table_items,
     }
 }
 
+template <LogicalType LT>
+void FixedSizeJoinBuildFunc<LT>::_build_columns_parallel(JoinHashTableItems* table_items, const Columns& data_columns,
+                                                         const NullColumns& null_columns, uint32_t dop) {
+    const uint32_t row_count = table_items->row_count;
+    JoinHashMapHelper::serialize_fixed_size_key_column<LT>(data_columns, table_items->build_key_column.get(), 1,
+                                                           row_count);
+
+    Buffer<uint8_t> is_nulls;
+    if (!null_columns.empty()) {
+        is_nulls.assign(null_columns[0]->get_data().begin(), null_columns[0]->get_data().begin() + row_count + 1);
+        for (uint32_t i = 1; i < null_columns.size(); i++) {
+            const auto& null_data = null_columns[i]->get_data();
+            for (uint32_t j = 1; j < row_count + 1; j++) {
+                is_nulls[j] |= null_data[j];
+            }
+        }
+    }
+
+    const auto& data = get_key_data(*table_items);
+    const uint32_t bucket_size = table_items->bucket_size;
+    auto calc_buckets = [&data, bucket_size](uint32_t start, uint32_t count, uint32_t* buckets) {
+        for (uint32_t i = start; i < start + count; i++) {
+            buckets[i] = JoinHashMapHelper::calc_bucket_num<CppType>(data[i], bucket_size);
+        }
+    };
+    ParallelJoinHashTableBuilder::build(table_items, calc_buckets, is_nulls.empty() ? nullptr : is_nulls.data(),
+                                        dop);
+}
+
 template <LogicalType LT>
 void FixedSizeJoinBuildFunc<LT>::_build_nullable_columns(JoinHashTableItems* table_items,
                                                          HashTableProbeState* probe_state, const Columns& data_columns,
@@ -270,27 +354,17 @@ void JoinProbeFunc<LT>::lookup_init(const JoinHashTableItems& table_items, HashT
 
         if (nullable_column->has_null()) {
             auto& null_array = nullable_column->null_column()->get_data();
-            for (size_t i = 0; i < probe_row_count; i++) {
-                if (null_array[i] == 0) {
-                    probe_state->next[i] = table_items.first[probe_state->buckets[i]];
-                } else {
-                    probe_state->next[i] = 0;
-                }
-            }
+            JoinHashMapHelper::lookup_bucket_heads(table_items, probe_state, probe_row_count, null_array.data());
             probe_state->null_array = &nullable_column->null_column()->get_data();
         } else {
-            for (size_t i = 0; i < probe_row_count; i++) {
-                probe_state->next[i] = table_items.first[probe_state->buckets[i]];
-            }
+            JoinHashMapHelper::lookup_bucket_heads(table_items, probe_state, probe_row_count);
             probe_state->null_array = nullptr;
         }
         probe_state->consider_probe_time_locality();
         return;
     }
 
-    for (size_t i = 0; i < probe_row_count; i++) {
-        probe_state->next[i] = table_items.first[probe_state->buckets[i]];
-    }
+    JoinHashMapHelper::lookup_bucket_heads(table_items, probe_state, probe_row_count);
     probe_state->consider_probe_time_locality();
     probe_state->null_array = nullptr;
 }
@@ -306,6 +380,46 @@ const Buffer<typename JoinProbeFunc<LT>::CppType>& JoinProbeFunc<LT>::get_key_da
     return ColumnHelper::as_raw_column<ColumnType>((*probe_state.key_columns)[0])->get_data();
 }
 
+template <LogicalType LT>
+void LinearProbingJoinProbeFunc<LT>::lookup_init(const JoinHashTableItems& table_items,
+                                                 HashTableProbeState* probe_state) {
+    using Helper = UniqueKeyBucketHelper<CppType>;
+    static constexpr size_t DISTANCE = JoinHashMapHelper::PROBE_PREFETCH_DISTANCE;
+
+    const size_t probe_row_count = probe_state->probe_row_count;
+    auto& data = get_key_data(*probe_state);
+    // Most probes only access one bucket, so don't interleave them by coroutines.
+    probe_state->active_coroutines = 0;
+
+    const uint8_t* is_nulls = nullptr;
+    probe_state->null_array = nullptr;
+    if ((*probe_state->key_columns)[0]->is_nullable()) {
+        auto* nullable_column = ColumnHelper::as_raw_column<NullableColumn>((*probe_state->key_columns)[0]);
+        if (nullable_column->has_null()) {
+            probe_state->null_array = &nullable_column->null_column()->get_data();
+            is_nulls = probe_state->null_array->data();
+        }
+    }
+
+    // Reuse buckets to save the hash values.
+    for (size_t i = 0; i < probe_row_count; i++) {
+        probe_state->buckets[i] = Helper::hash(data[i]);
+    }
+
+    const UniqueKeyBucket* buckets = table_items.linear_buckets.data();
+    const uint32_t bucket_size = table_items.bucket_size;
+    for (size_t i = 0; i < probe_row_count; i++) {
+        if (table_items.enable_prefetch && i + DISTANCE < probe_row_count) {
+            __builtin_prefetch(buckets + (probe_state->buckets[i + DISTANCE] & (bucket_size - 1)));
+        }
+        if (is_nulls != nullptr && is_nulls[i] != 0) {
+            probe_state->next[i] = 0;
+        } else {
+            probe_state->next[i] = Helper::find(buckets, bucket_size, data[i], probe_state->buckets[i]);
+        }
+    }
+}
+
 template <LogicalType LT>
 void FixedSizeJoinProbeFunc<LT>::lookup_init(const JoinHashTableItems& table_items, HashTableProbeState* probe_state) {
     // prepare columns
@@ -350,10 +464,7 @@ void FixedSizeJoinProbeFunc<LT>::_probe_column(const JoinHashTableItems& table_i
                                                            row_count);
     const auto& data = get_key_data(*probe_state);
     JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items.bucket_size, &probe_state->buckets, 0, row_count);
-
-    for (uint32_t i = 0; i < row_count; i++) {
-        probe_state->next[i] = table_items.first[probe_state->buckets[i]];
-    }
+    JoinHashMapHelper::lookup_bucket_heads(table_items, probe_state, row_count);
 }
 
 template <LogicalType LT>
@@ -376,14 +487,7 @@ void FixedSizeJoinProbeFunc<LT>::_probe_nullable_column(const JoinHashTableItems
                                                            row_count);
     const auto& data = get_key_data(*probe_state);
     JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items.bucket_size, &probe_state->buckets, 0, row_count);
-
-    for (uint32_t i = 0; i < row_count; i++) {
-        if (probe_state->is_nulls[i] == 0) {
-            probe_state->next[i] = table_items.first[probe_state->buckets[i]];
-        } else {
-            probe_state->next[i] = 0;
-        }
-    }
+    JoinHashMapHelper::lookup_bucket_heads(table_items, probe_state, row_count, probe_state->is_nulls.data());
 }
 
 template <LogicalType LT, class BuildFunc, class ProbeFunc>
@@ -818,7 +922,7 @@ void JoinHashMap<LT, BuildFunc, ProbeFunc>::_search_ht_impl(RuntimeState* state,
 
 #define RETURN_IF_CHUNK_FULL()                                   \
     if (match_count > state->chunk_size()) {                     \
-        _probe_state->next[i] = _table_items->next[build_index]; \
+        _probe_state->next[i] = _next_build_index(build_index); \
         _probe_state->cur_probe_index = i;                       \
         _probe_state->has_remain = true;                         \
         _probe_state->count = state->chunk_size();               \
@@ -935,6 +1039,31 @@ void JoinHashMap<LT, BuildFunc, ProbeFunc>::_probe_coroutine(RuntimeState* state
     }
 }
 
+template <LogicalType LT, class BuildFunc, class ProbeFunc>
+void JoinHashMap<LT, BuildFunc, ProbeFunc>::_prefetch_build_row(const Buffer<CppType>& build_data, size_t probe_index,
+                                                                size_t probe_row_count) {
+    static constexpr size_t DISTANCE = JoinHashMapHelper::PROBE_PREFETCH_DISTANCE;
+    if constexpr (JoinBuildFuncTraits<BuildFunc>::unique_keys) {
+        // Neither the build keys nor the chains are accessed when probing the unique keys.
+        return;
+    }
+    if (!_table_items->enable_prefetch || probe_index + DISTANCE >= probe_row_count) {
+        return;
+    }
+    const uint32_t build_index = _probe_state->next[probe_index + DISTANCE];
+    if constexpr (std::is_same_v<CppType, Slice>) {
+        // The bytes of a slice key is one more dependent access, so prefetch the slice at the double distance,
+        // and its bytes at the distance.
+        if (probe_index + 2 * DISTANCE < probe_row_count) {
+            XXH_PREFETCH(build_data.data() + _probe_state->next[probe_index + 2 * DISTANCE]);
+        }
+        XXH_PREFETCH(build_data[build_index].data);
+    } else {
+        XXH_PREFETCH(build_data.data() + build_index);
+    }
+    XXH_PREFETCH(_table_items->next.data() + build_index);
+}
+
 template <LogicalType LT, class BuildFunc, class ProbeFunc>
 template <bool first_probe>
 void JoinHashMap<LT, BuildFunc, ProbeFunc>::_probe_from_ht(RuntimeState* state, const Buffer<CppType>& build_data,
@@ -956,6 +1085,7 @@ void JoinHashMap<LT, BuildFunc, ProbeFunc>::_probe_from_ht(RuntimeState* state,
 
     size_t probe_row_count = _probe_state->probe_row_count;
     for (; i < probe_row_count; i++) {
+        _prefetch_build_row(build_data, i, probe_row_count);
         if constexpr (first_probe) {
             _probe_state->probe_match_filter[i] = 0;
         }
@@ -973,7 +1103,7 @@ void JoinHashMap<LT, BuildFunc, ProbeFunc>::_probe_from_ht(RuntimeState* state,
                     }
                     RETURN_IF_CHUNK_FULL()
                 }
-                build_index = _table_items->next[build_index];
+                build_index = _next_build_index(build_index);
             } while (build_index != 0);
 
             if constexpr (first_probe) {
@@ -1013,7 +1143,7 @@ HashTableProbeState::ProbeCoroutine JoinHashMap<LT, BuildFunc, ProbeFunc>::_prob
                     cur_row_match_count++;
                     _probe_state->probe_match_filter[i] = 1;
                 }
-                build_index = _table_items->next[build_index];
+                build_index = _next_build_index(build_index);
             } while (build_index != 0);
 
             if (cur_row_match_count > 1) {
@@ -1051,7 +1181,7 @@ HashTableProbeState::ProbeCoroutine JoinHashMap<LT, BuildFunc, ProbeFunc>::_prob
                 _probe_state->match_count++;
                 cur_row_match_count++;
             }
-            build_index = _table_items->next[build_index];
+            build_index = _next_build_index(build_index);
         }
         if (cur_row_match_count <= 0) {
             COWAIT_IF_CHUNK_FULL()
@@ -1100,6 +1230,7 @@ void JoinHashMap<LT, BuildFunc, ProbeFunc>::_probe_from_ht_for_left_outer_join(R
 
     size_t probe_row_count = _probe_state->probe_row_count;
     for (; i < probe_row_count; i++) {
+        _prefetch_build_row(build_data, i, probe_row_count);
         size_t build_index = _probe_state->next[i];
         if (build_index == 0) {
             _probe_state->probe_index[match_count] = i;
@@ -1117,7 +1248,7 @@ void JoinHashMap<LT, BuildFunc, ProbeFunc>::_probe_from_ht_for_left_outer_join(R
 
                     RETURN_IF_CHUNK_FULL()
                 }
-                build_index = _table_items->next[build_index];
+                build_index = _next_build_index(build_index);
             }
             if (_probe_state->cur_row_match_count <= 0) {
                 // one key of left table match none key of right table
@@ -1158,7 +1289,7 @@ HashTableProbeState::ProbeCoroutine JoinHashMap<LT, BuildFunc, ProbeFunc>::_prob
                 _probe_state->match_count++;
                 break;
             }
-            build_index = _table_items->next[build_index];
+            build_index = _next_build_index(build_index);
         }
     }
 
@@ -1178,6 +1309,7 @@ void JoinHashMap<LT, BuildFunc, ProbeFunc>::_probe_from_ht_for_left_semi_join(Ru
     size_t match_count = 0;
     size_t probe_row_count = _probe_state->probe_row_count;
     for (size_t i = 0; i < probe_row_count; i++) {
+        _prefetch_build_row(build_data, i, probe_row_count);
         size_t index = _probe_state->next[i];
         if (index == 0) {
             continue;
@@ -1189,7 +1321,7 @@ void JoinHashMap<LT, BuildFunc, ProbeFunc>::_probe_from_ht_for_left_semi_join(Ru
                 match_count++;
                 break;
             }
-            index = _table_items->next[index];
+            index = _next_build_index(index);
         }
     }
 
@@ -1208,6 +1340,7 @@ void JoinHashMap<LT, BuildFunc, ProbeFunc>::_probe_from_ht_for_left_anti_join(Ru
     if (_table_items->join_type == TJoinOp::NULL_AWARE_LEFT_ANTI_JOIN && _probe_state->null_array != nullptr) {
         // process left anti join from not in
         for (size_t i = 0; i < probe_row_count; i++) {
+            _prefetch_build_row(build_data, i, probe_row_count);
             size_t index = _probe_state->next[i];
             if ((*_probe_state->null_array)[i] == 1) {
                 continue;
@@ -1225,7 +1358,7 @@ void JoinHashMap<LT, BuildFunc, ProbeFunc>::_probe_from_ht_for_left_anti_join(Ru
                     found = true;
                     break;
                 }
-                index = _table_items->next[index];
+                index = _next_build_index(index);
             }
             if (!found) {
                 _probe_state->probe_index[match_count] = i;
@@ -1234,6 +1367,7 @@ void JoinHashMap<LT, BuildFunc, ProbeFunc>::_probe_from_ht_for_left_anti_join(Ru
         }
     } else {
         for (size_t i = 0; i < probe_row_count; i++) {
+            _prefetch_build_row(build_data, i, probe_row_count);
             size_t index = _probe_state->next[i];
             if (index == 0) {
                 _probe_state->probe_index[match_count] = i;
@@ -1246,7 +1380,7 @@ void JoinHashMap<LT, BuildFunc, ProbeFunc>::_probe_from_ht_for_left_anti_join(Ru
                     found = true;
                     break;
                 }
-                index = _table_items->next[index];
+                index = _next_build_index(index);
             }
             if (!found) {
                 _probe_state->probe_index[match_count] = i;
@@ -1284,7 +1418,7 @@ HashTableProbeState::ProbeCoroutine JoinHashMap<LT, BuildFunc, ProbeFunc>::_prob
                     found = true;
                     break;
                 }
-                build_index = _table_items->next[build_index];
+                build_index = _next_build_index(build_index);
             }
             if (!found) {
                 _probe_state->probe_index[_probe_state->match_count] = i;
@@ -1307,7 +1441,7 @@ HashTableProbeState::ProbeCoroutine JoinHashMap<LT, BuildFunc, ProbeFunc>::_prob
                     found = true;
                     break;
                 }
-                build_index = _table_items->next[build_index];
+                build_index = _next_build_index(build_index);
             }
             if (!found) {
                 _probe_state->probe_index[_probe_state->match_count] = i;
@@ -1343,6 +1477,7 @@ void JoinHashMap<LT, BuildFunc, ProbeFunc>::_probe_from_ht_for_right_outer_join(
 
     size_t probe_row_count = _probe_state->probe_row_count;
     for (; i < probe_row_count; i++) {
+        _prefetch_build_row(build_data, i, probe_row_count);
         size_t build_index = _probe_state->next[i];
         if (build_index == 0) {
             continue;
@@ -1357,7 +1492,7 @@ void JoinHashMap<LT, BuildFunc, ProbeFunc>::_probe_from_ht_for_right_outer_join(
 
                 RETURN_IF_CHUNK_FULL()
             }
-            build_index = _table_items->next[build_index];
+            build_index = _next_build_index(build_index);
         }
     }
 
@@ -1384,7 +1519,7 @@ HashTableProbeState::ProbeCoroutine JoinHashMap<LT, BuildFunc, ProbeFunc>::_prob
                 _probe_state->build_match_index[build_index] = 1;
                 _probe_state->match_count++;
             }
-            build_index = _table_items->next[build_index];
+            build_index = _next_build_index(build_index);
         }
     }
 
@@ -1412,6 +1547,7 @@ void JoinHashMap<LT, BuildFunc, ProbeFunc>::_probe_from_ht_for_right_semi_join(R
 
     size_t probe_row_count = _probe_state->probe_row_count;
     for (; i < probe_row_count; i++) {
+        _prefetch_build_row(build_data, i, probe_row_count);
         size_t build_index = _probe_state->next[i];
         if (build_index == 0) {
             continue;
@@ -1427,7 +1563,7 @@ void JoinHashMap<LT, BuildFunc, ProbeFunc>::_probe_from_ht_for_right_semi_join(R
                     RETURN_IF_CHUNK_FULL()
                 }
             }
-            build_index = _table_items->next[build_index];
+            build_index = _next_build_index(build_index);
         }
     }
 
@@ -1454,7 +1590,7 @@ HashTableProbeState::ProbeCoroutine JoinHashMap<LT, BuildFunc, ProbeFunc>::_prob
                     _probe_state->match_count++;
                 }
             }
-            build_index = _table_items->next[build_index];
+            build_index = _next_build_index(build_index);
         }
     }
 
@@ -1473,6 +1609,7 @@ void JoinHashMap<LT, BuildFunc, ProbeFunc>::_probe_from_ht_for_right_anti_join(R
                                                                                const Buffer<CppType>& probe_data) {
     size_t probe_row_count = _probe_state->probe_row_count;
     for (size_t i = 0; i < probe_row_count; i++) {
+        _prefetch_build_row(build_data, i, probe_row_count);
         size_t index = _probe_state->next[i];
         if (index == 0) {
             continue;
@@ -1482,7 +1619,7 @@ void JoinHashMap<LT, BuildFunc, ProbeFunc>::_probe_from_ht_for_right_anti_join(R
             if (ProbeFunc().equal(build_data[index], probe_data[i])) {
                 _probe_state->build_match_index[index] = 1;
             }
-            index = _table_items->next[index];
+            index = _next_build_index(index);
         }
     }
     _probe_state->count = 0;
@@ -1503,7 +1640,7 @@ HashTableProbeState::ProbeCoroutine JoinHashMap<LT, BuildFunc, ProbeFunc>::_prob
             if (ProbeFunc().equal(build_data[build_index], probe_data[i])) {
                 _probe_state->build_match_index[build_index] = 1;
             }
-            build_index = _table_items->next[build_index];
+            build_index = _next_build_index(build_index);
         }
     }
     _probe_state->count = 0;
@@ -1531,6 +1668,7 @@ void JoinHashMap<LT, BuildFunc, ProbeFunc>::_probe_from_ht_for_full_outer_join(R
 
     size_t probe_row_count = _probe_state->probe_row_count;
     for (; i < probe_row_count; i++) {
+        _prefetch_build_row(build_data, i, probe_row_count);
         size_t build_index = _probe_state->next[i];
         if (build_index == 0) {
             _probe_state->probe_index[match_count] = i;
@@ -1549,7 +1687,7 @@ void JoinHashMap<LT, BuildFunc, ProbeFunc>::_probe_from_ht_for_full_outer_join(R
 
                     RETURN_IF_CHUNK_FULL()
                 }
-                build_index = _table_items->next[build_index];
+                build_index = _next_build_index(build_index);
             }
             if (_probe_state->cur_row_match_count <= 0) {
                 _probe_state->probe_index[match_count] = i;
@@ -1582,7 +1720,7 @@ HashTableProbeState::ProbeCoroutine JoinHashMap<LT, BuildFunc, ProbeFunc>::_prob
                 _probe_state->match_count++;
                 cur_row_match_count++;
             }
-            build_index = _table_items->next[build_index];
+            build_index = _next_build_index(build_index);
         }
         if (cur_row_match_count <= 0) {
             COWAIT_IF_CHUNK_FULL()
@@ -1623,6 +1761,7 @@ void JoinHashMap<LT, BuildFunc, ProbeFunc>::_probe_from_ht_for_left_semi_join_wi
 
     size_t probe_row_count = _probe_state->probe_row_count;
     for (; i < probe_row_count; i++) {
+        _prefetch_build_row(build_data, i, probe_row_count);
         size_t build_index = _probe_state->next[i];
         if (build_index == 0) {
             continue;
@@ -1636,7 +1775,7 @@ void JoinHashMap<LT, BuildFunc, ProbeFunc>::_probe_from_ht_for_left_semi_join_wi
 
                 RETURN_IF_CHUNK_FULL()
             }
-            build_index = _table_items->next[build_index];
+            build_index = _next_build_index(build_index);
         }
     }
 
@@ -1662,7 +1801,7 @@ JoinHashMap<LT, BuildFunc, ProbeFunc>::_probe_from_ht_for_left_semi_join_with_ot
                 _probe_state->build_index[_probe_state->match_count] = build_index;
                 _probe_state->match_count++;
             }
-            build_index = _table_items->next[build_index];
+            build_index = _next_build_index(build_index);
         }
     }
 
@@ -1698,6 +1837,7 @@ void JoinHashMap<LT, BuildFunc, ProbeFunc>::_probe_from_ht_for_null_aware_anti_j
 
     size_t probe_row_count = _probe_state->probe_row_count;
     for (; i < probe_row_count; i++) {
+        _prefetch_build_row(build_data, i, probe_row_count);
         _probe_state->cur_row_match_count = 0;
         size_t build_index = _probe_state->next[i];
         if (build_index == 0) {
@@ -1753,7 +1893,7 @@ void JoinHashMap<LT, BuildFunc, ProbeFunc>::_probe_from_ht_for_null_aware_anti_j
 
                 RETURN_IF_CHUNK_FULL()
             }
-            build_index = _table_items->next[build_index];
+            build_index = _next_build_index(build_index);
         }
 
         if (_probe_state->cur_row_match_count <= 0) {
@@ -1828,7 +1968,7 @@ JoinHashMap<LT, BuildFunc, ProbeFunc>::_probe_from_ht_for_null_aware_anti_join_w
                 _probe_state->match_count++;
                 cur_row_match_count++;
             }
-            build_index = _table_items->next[build_index];
+            build_index = _next_build_index(build_index);
         }
 
         if (cur_row_match_count <= 0) {
@@ -1859,6 +1999,7 @@ void JoinHashMap<LT, BuildFunc, ProbeFunc>::
 
     size_t probe_row_count = _probe_state->probe_row_count;
     for (; i < probe_row_count; i++) {
+        _prefetch_build_row(build_data, i, probe_row_count);
         size_t build_index = _probe_state->next[i];
         if (build_index == 0) {
             continue;
@@ -1872,7 +2013,7 @@ void JoinHashMap<LT, BuildFunc, ProbeFunc>::
 
                 RETURN_IF_CHUNK_FULL()
             }
-            build_index = _table_items->next[build_index];
+            build_index = _next_build_index(build_index);
         }
     }
 
@@ -1898,7 +2039,7 @@ JoinHashMap<LT, BuildFunc, ProbeFunc>::_probe_from_ht_for_right_outer_right_semi
                 _probe_state->build_index[_probe_state->match_count] = build_index;
                 _probe_state->match_count++;
             }
-            build_index = _table_items->next[build_index];
+            build_index = _next_build_index(build_index);
         }
     }
 
@@ -1934,6 +2075,7 @@ void JoinHashMap<LT, BuildFunc, ProbeFunc>::_probe_from_ht_for_left_outer_left_a
 
     size_t probe_row_count = _probe_state->probe_row_count;
     for (; i < probe_row_count; i++) {
+        _prefetch_build_row(build_data, i, probe_row_count);
         size_t build_index = _probe_state->next[i];
         if (build_index == 0) {
             _probe_state->probe_index[match_count] = i;
@@ -1952,7 +2094,7 @@ void JoinHashMap<LT, BuildFunc, ProbeFunc>::_probe_from_ht_for_left_outer_left_a
 
                     RETURN_IF_CHUNK_FULL()
                 }
-                build_index = _table_items->next[build_index];
+                build_index = _next_build_index(build_index);
             }
             if (_probe_state->cur_row_match_count <= 0) {
                 _probe_state->probe_index[match_count] = i;
@@ -1987,7 +2129,7 @@ JoinHashMap<LT, BuildFunc, ProbeFunc>::_probe_from_ht_for_left_outer_left_anti_f
                 _probe_state->match_count++;
                 cur_row_match_count++;
             }
-            build_index = _table_items->next[build_index];
+            build_index = _next_build_index(build_index);
         }
         if (cur_row_match_count <= 0) {
             COWAIT_IF_CHUNK_FULL()
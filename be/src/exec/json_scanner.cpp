@@ -521,7 +521,7 @@ Status JsonReader::_construct_row_without_jsonpath(simdjson::ondemand::object* r
         uint32_t key_index = 0;
         for (auto field : *row) {
             int column_index;
-            std::string_view key = field.unescaped_key();
+            simdjson::ondemand::raw_json_string raw_key = field.key();
 
             // _prev_parsed_position records the chunk column index for each key of previous parsed json object.
             // For example, if previous json object is
@@ -541,7 +541,10 @@ Status JsonReader::_construct_row_without_jsonpath(simdjson::ondemand::object* r
             // index for 'b' is 2. Since previous parsed json object doesn't contain 'c', key 'c' 's column index
             // needs to be searched from the _slot_desc_dict, and if the key 'c' refers to the 3rd column of chunk,
             // then we will update the _prev_parsed_position to be [{'a', 1, int}, {'b', 2, int}, {'c', 3, int}].
-            if (LIKELY(_prev_parsed_position.size() > key_index && _prev_parsed_position[key_index].key == key)) {
+            // The key is compared with the raw json string of the field first, so that documents with the same
+            // field order as the previous one neither unescape the keys nor look them up in _slot_desc_dict.
+            if (LIKELY(_prev_parsed_position.size() > key_index &&
+                       raw_key.is_equal(_prev_parsed_position[key_index].key))) {
                 // obtain column_index from previous parsed position
                 column_index = _prev_parsed_position[key_index].column_index;
                 if (column_index < 0) {
@@ -550,6 +553,7 @@ Status JsonReader::_construct_row_without_jsonpath(simdjson::ondemand::object* r
                     continue;
                 }
             } else {
+                std::string_view key = field.unescaped_key();
                 // look up key in the slot dict.
                 auto itr = _slot_desc_dict.find(key);
                 if (itr == _slot_desc_dict.end()) {
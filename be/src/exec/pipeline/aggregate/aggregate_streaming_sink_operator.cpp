@@ -167,6 +167,7 @@ Status AggregateStreamingSinkOperator::_push_chunk_by_selective_preaggregation(c
 Status AggregateStreamingSinkOperator::_push_chunk_by_auto(const ChunkPtr& chunk, const size_t chunk_size) {
     size_t allocated_bytes = _aggregator->hash_map_variant().allocated_memory_usage(_aggregator->mem_pool());
     const size_t continuous_limit = _auto_context.get_continuous_limit();
+    const AggrAutoState prev_state = _auto_state;
     switch (_auto_state) {
     case AggrAutoState::INIT_PREAGG: {
         bool ht_needs_expansion = _aggregator->hash_map_variant().need_expand(chunk_size);
@@ -293,6 +294,9 @@ Status AggregateStreamingSinkOperator::_push_chunk_by_auto(const ChunkPtr& chunk
         break;
     }
     }
+    if (_auto_state != prev_state) {
+        COUNTER_UPDATE(_aggregator->auto_state_switch_count(), 1);
+    }
     return Status::OK();
 }
 
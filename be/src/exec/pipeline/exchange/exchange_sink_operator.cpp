@@ -104,6 +104,9 @@ private:
 
     bool _check_use_pass_through();
     void _prepare_pass_through();
+    ZeroCopyAttachment* _zero_copy_attachment_or_null() {
+        return _parent->enable_zero_copy_attachment() ? &_zero_copy_attachment : nullptr;
+    }
 
     ExchangeSinkOperator* _parent;
 
@@ -126,6 +129,7 @@ private:
     // always be 1
     std::vector<std::unique_ptr<Chunk>> _chunks;
     PTransmitChunkParamsPtr _chunk_request;
+    ZeroCopyAttachment _zero_copy_attachment;
     size_t _current_request_bytes = 0;
 
     bool _is_inited = false;
@@ -248,8 +252,9 @@ Status ExchangeSinkOperator::Channel::send_one_chunk(RuntimeState* state, const
                 _chunk_request->add_driver_sequences(driver_sequence);
             }
             auto pchunk = _chunk_request->add_chunks();
-            TRY_CATCH_BAD_ALLOC(RETURN_IF_ERROR(_parent->serialize_chunk(chunk, pchunk, &_is_first_chunk)));
-            _current_request_bytes += pchunk->data().size();
+            TRY_CATCH_BAD_ALLOC(RETURN_IF_ERROR(
+                    _parent->serialize_chunk(chunk, pchunk, &_is_first_chunk, 1, _zero_copy_attachment_or_null())));
+            _current_request_bytes += pchunk->data_size();
         }
     }
 
@@ -259,7 +264,8 @@ Status ExchangeSinkOperator::Channel::send_one_chunk(RuntimeState* state, const
         _chunk_request->set_eos(eos);
         _chunk_request->set_use_pass_through(_use_pass_through);
         butil::IOBuf attachment;
-        int64_t attachment_physical_bytes = _parent->construct_brpc_attachment(_chunk_request, attachment);
+        int64_t attachment_physical_bytes =
+                _parent->construct_brpc_attachment(_chunk_request, attachment, _zero_copy_attachment_or_null());
         TransmitChunkInfo info = {this->_fragment_instance_id, _brpc_stub,     std::move(_chunk_request), attachment,
                                   attachment_physical_bytes,   _brpc_dest_addr};
         RETURN_IF_ERROR(_parent->_buffer->add_request(info));
@@ -393,6 +399,7 @@ Status ExchangeSinkOperator::prepare(RuntimeState* state) {
     _buffer->incr_sinker(state);
 
     _be_number = state->be_number();
+    _enable_zero_copy_attachment = config::exchange_sink_enable_zero_copy_attachment;
     if (state->query_options().__isset.transmission_encode_level) {
         _encode_level = state->query_options().transmission_encode_level;
     }
@@ -457,6 +464,8 @@ Status ExchangeSinkOperator::prepare(RuntimeState* state) {
     _shuffle_channel_ids.resize(state->chunk_size());
     _row_indexes.resize(state->chunk_size());
 
+    _buffer->attach_observer(_observer);
+
     return Status::OK();
 }
 
@@ -519,13 +528,15 @@ Status ExchangeSinkOperator::push_chunk(RuntimeState* state, const ChunkPtr& chu
             // 1. create a new chunk PB to serialize
             ChunkPB* pchunk = _chunk_request->add_chunks();
             // 2. serialize input chunk to pchunk
-            TRY_CATCH_BAD_ALLOC(
-                    RETURN_IF_ERROR(serialize_chunk(send_chunk, pchunk, &_is_first_chunk, _channels.size())));
-            _current_request_bytes += pchunk->data().size();
+            auto* zero_copy_attachment = _enable_zero_copy_attachment ? &_zero_copy_attachment : nullptr;
+            TRY_CATCH_BAD_ALLOC(RETURN_IF_ERROR(serialize_chunk(send_chunk, pchunk, &_is_first_chunk,
+                                                                _channels.size(), zero_copy_attachment)));
+            _current_request_bytes += pchunk->data_size();
             // 3. if request bytes exceede the threshold, send current request
             if (_current_request_bytes > config::max_transmit_batched_bytes) {
                 butil::IOBuf attachment;
-                int64_t attachment_physical_bytes = construct_brpc_attachment(_chunk_request, attachment);
+                int64_t attachment_physical_bytes =
+                        construct_brpc_attachment(_chunk_request, attachment, zero_copy_attachment);
                 for (auto idx : _channel_indices) {
                     if (!_channels[idx]->use_pass_through()) {
                         PTransmitChunkParamsPtr copy = std::make_shared<PTransmitChunkParams>(*_chunk_request);
@@ -638,7 +649,8 @@ Status ExchangeSinkOperator::set_finishing(RuntimeState* state) {
 
     if (_chunk_request != nullptr) {
         butil::IOBuf attachment;
-        int64_t attachment_physical_bytes = construct_brpc_attachment(_chunk_request, attachment);
+        int64_t attachment_physical_bytes = construct_brpc_attachment(
+                _chunk_request, attachment, _enable_zero_copy_attachment ? &_zero_copy_attachment : nullptr);
         for (const auto& [_, channel] : _instance_id2channel) {
             PTransmitChunkParamsPtr copy = std::make_shared<PTransmitChunkParams>(*_chunk_request);
             RETURN_IF_ERROR(channel->send_chunk_request(state, copy, attachment, attachment_physical_bytes));
@@ -659,40 +671,50 @@ Status ExchangeSinkOperator::set_finishing(RuntimeState* state) {
 }
 
 void ExchangeSinkOperator::close(RuntimeState* state) {
+    _buffer->detach_observer(_observer);
     if (_driver_sequence == 0) {
         _buffer->update_profile(_unique_metrics.get());
     }
     Operator::close(state);
 }
 
-Status ExchangeSinkOperator::serialize_chunk(const Chunk* src, ChunkPB* dst, bool* is_first_chunk, int num_receivers) {
+Status ExchangeSinkOperator::serialize_chunk(const Chunk* src, ChunkPB* dst, bool* is_first_chunk, int num_receivers,
+                                             ZeroCopyAttachment* zero_copy_attachment) {
     VLOG_ROW << "[ExchangeSinkOperator] serializing " << src->num_rows() << " rows";
     auto send_input_bytes = serde::ProtobufChunkSerde::max_serialized_size(*src, nullptr);
     COUNTER_UPDATE(_sender_input_bytes_counter, send_input_bytes * num_receivers);
+    // Only used when zero_copy_attachment is not nullptr.
+    std::unique_ptr<uint8_t[]> data;
+    int64_t data_physical_bytes = 0;
     {
         SCOPED_TIMER(_serialize_chunk_timer);
         // We only serialize chunk meta for first chunk
         if (*is_first_chunk) {
             _encode_context = serde::EncodeContext::get_encode_context_shared_ptr(src->columns().size(), _encode_level);
-            StatusOr<ChunkPB> res = Status::OK();
-            TRY_CATCH_BAD_ALLOC(res = serde::ProtobufChunkSerde::serialize(*src, _encode_context));
-            RETURN_IF_ERROR(res);
-            res->Swap(dst);
-            *is_first_chunk = false;
+        }
+        StatusOr<ChunkPB> res = Status::OK();
+        if (zero_copy_attachment != nullptr) {
+            int64_t before_bytes = CurrentThread::current().get_consumed_bytes();
+            TRY_CATCH_BAD_ALLOC(res = serde::ProtobufChunkSerde::serialize_without_meta(*src, _encode_context, &data));
+            data_physical_bytes = CurrentThread::current().get_consumed_bytes() - before_bytes;
         } else {
-            StatusOr<ChunkPB> res = Status::OK();
             TRY_CATCH_BAD_ALLOC(res = serde::ProtobufChunkSerde::serialize_without_meta(*src, _encode_context));
-            RETURN_IF_ERROR(res);
-            res->Swap(dst);
         }
+        RETURN_IF_ERROR(res);
+        if (*is_first_chunk) {
+            RETURN_IF_ERROR(serde::ProtobufChunkSerde::serialize_meta(*src, &res.value()));
+            *is_first_chunk = false;
+        }
+        res->Swap(dst);
     }
     if (_encode_context) {
         _encode_context->set_encode_levels_in_pb(dst);
     }
     DCHECK(dst->has_uncompressed_size());
-    DCHECK_EQ(dst->uncompressed_size(), dst->data().size());
     const size_t serialized_size = dst->uncompressed_size();
+    DCHECK(zero_copy_attachment != nullptr || serialized_size == dst->data().size());
     COUNTER_UPDATE(_serialized_bytes_counter, serialized_size * num_receivers);
+    Slice input = zero_copy_attachment != nullptr ? Slice(data.get(), serialized_size) : Slice(dst->data());
 
     if (_compress_codec != nullptr && _compress_codec->exceed_max_input_size(serialized_size)) {
         return Status::InternalError(strings::Substitute("The input size for compression should be less than $0",
@@ -700,12 +722,12 @@ Status ExchangeSinkOperator::serialize_chunk(const Chunk* src, ChunkPB* dst, boo
     }
 
     // try compress the ChunkPB data
+    bool is_compressed = false;
     if (_compress_codec != nullptr && serialized_size > 0) {
         SCOPED_TIMER(_compress_timer);
 
         if (use_compression_pool(_compress_codec->type())) {
             Slice compressed_slice;
-            Slice input(dst->data());
             RETURN_IF_ERROR(_compress_codec->compress(input, &compressed_slice, true, serialized_size, nullptr,
                                                       &_compression_scratch));
         } else {
@@ -717,24 +739,50 @@ Status ExchangeSinkOperator::serialize_chunk(const Chunk* src, ChunkPB* dst, boo
 
             Slice compressed_slice{_compression_scratch.data(), _compression_scratch.size()};
 
-            Slice input(dst->data());
             RETURN_IF_ERROR(_compress_codec->compress(input, &compressed_slice));
             _compression_scratch.resize(compressed_slice.size);
         }
 
         double compress_ratio = (static_cast<double>(serialized_size)) / _compression_scratch.size();
         if (LIKELY(compress_ratio > config::rpc_compress_ratio_threshold)) {
-            dst->mutable_data()->swap(reinterpret_cast<std::string&>(_compression_scratch));
+            is_compressed = true;
+            if (zero_copy_attachment != nullptr) {
+                // The compressed data is usually much smaller, so it's copied to the attachment.
+                int64_t before_bytes = CurrentThread::current().get_consumed_bytes();
+                zero_copy_attachment->buf.append(_compression_scratch.data(), _compression_scratch.size());
+                zero_copy_attachment->physical_bytes += CurrentThread::current().get_consumed_bytes() - before_bytes;
+                dst->set_data_size(_compression_scratch.size());
+            } else {
+                dst->mutable_data()->swap(reinterpret_cast<std::string&>(_compression_scratch));
+            }
             dst->set_compress_type(_compress_type);
         }
         COUNTER_UPDATE(_compressed_bytes_counter, _compression_scratch.size() * num_receivers);
         VLOG_ROW << "uncompressed size: " << serialized_size << ", compressed size: " << _compression_scratch.size();
     }
+
+    if (zero_copy_attachment != nullptr) {
+        if (!is_compressed) {
+            // Hand over the serialized buffer to the attachment without copy.
+            zero_copy_attachment->buf.append_user_data(data.release(), serialized_size,
+                                                       [](void* buf) { delete[] static_cast<uint8_t*>(buf); });
+            zero_copy_attachment->physical_bytes += data_physical_bytes;
+        }
+    } else {
+        dst->set_data_size(dst->data().size());
+    }
     return Status::OK();
 }
 
 int64_t ExchangeSinkOperator::construct_brpc_attachment(const PTransmitChunkParamsPtr& chunk_request,
-                                                        butil::IOBuf& attachment) {
+                                                        butil::IOBuf& attachment,
+                                                        ZeroCopyAttachment* zero_copy_attachment) {
+    if (zero_copy_attachment != nullptr) {
+        // The data of chunks has been placed in the attachment by serialize_chunk, and data_size has been set.
+        attachment.swap(zero_copy_attachment->buf);
+        zero_copy_attachment->buf.clear();
+        return std::exchange(zero_copy_attachment->physical_bytes, 0);
+    }
     int64_t attachment_physical_bytes = 0;
     for (int i = 0; i < chunk_request->chunks().size(); ++i) {
         auto chunk = chunk_request->mutable_chunks(i);
@@ -43,6 +43,14 @@ class ExprContext;
 
 namespace pipeline {
 class SinkBuffer;
+
+// When zero-copy attachment is enabled, the serialized chunk data is handed over to the attachment at once,
+// instead of being kept in ChunkPB::data and copied to the attachment when the request is sent.
+struct ZeroCopyAttachment {
+    butil::IOBuf buf;
+    int64_t physical_bytes = 0;
+};
+
 class ExchangeSinkOperator final : public Operator {
 public:
     ExchangeSinkOperator(OperatorFactory* factory, int32_t id, int32_t plan_node_id, int32_t driver_sequence,
@@ -67,6 +75,9 @@ public:
 
     bool pending_finish() const override;
 
+    // SinkBuffer notifies the observer when the rpc responses free the buffer.
+    bool support_event_scheduling() const override { return true; }
+
     Status set_finishing(RuntimeState* state) override;
 
     Status set_cancelled(RuntimeState* state) override;
@@ -79,10 +90,16 @@ public:
 
     // For the first chunk , serialize the chunk data and meta to ChunkPB both.
     // For other chunk, only serialize the chunk data to ChunkPB.
-    Status serialize_chunk(const Chunk* chunk, ChunkPB* dst, bool* is_first_chunk, int num_receivers = 1);
+    // If zero_copy_attachment is not nullptr, the chunk data is appended to it instead of ChunkPB::data.
+    Status serialize_chunk(const Chunk* chunk, ChunkPB* dst, bool* is_first_chunk, int num_receivers = 1,
+                           ZeroCopyAttachment* zero_copy_attachment = nullptr);
 
     // Return the physical bytes of attachment.
-    int64_t construct_brpc_attachment(const PTransmitChunkParamsPtr& _chunk_request, butil::IOBuf& attachment);
+    // zero_copy_attachment must be the one used to serialize the chunks of _chunk_request.
+    int64_t construct_brpc_attachment(const PTransmitChunkParamsPtr& _chunk_request, butil::IOBuf& attachment,
+                                      ZeroCopyAttachment* zero_copy_attachment = nullptr);
+
+    bool enable_zero_copy_attachment() const { return _enable_zero_copy_attachment; }
 
 private:
     bool _is_large_chunk(size_t sz) const {
@@ -159,8 +176,12 @@ private:
 
     // Only used when broadcast
     PTransmitChunkParamsPtr _chunk_request;
+    ZeroCopyAttachment _zero_copy_attachment;
     size_t _current_request_bytes = 0;
 
+    // Will set in prepare
+    bool _enable_zero_copy_attachment = false;
+
     bool _is_first_chunk = true;
 
     // String to write compressed chunk data in serialize().
@@ -30,6 +30,7 @@ public:
     virtual ~ExchangeSourceOperator() = default;
 
     Status prepare(RuntimeState* state) override;
+    void close(RuntimeState* state) override;
 
     bool has_output() const override;
 
@@ -39,6 +40,9 @@ public:
 
     StatusOr<ChunkPtr> pull_chunk(RuntimeState* state) override;
 
+    // The receiver notifies the observer when chunks arrive or the senders are done.
+    bool support_event_scheduling() const override { return true; }
+
 private:
     std::shared_ptr<DataStreamRecvr> _stream_recvr = nullptr;
     std::atomic<bool> _is_finishing = false;
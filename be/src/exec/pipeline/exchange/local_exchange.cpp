@@ -14,14 +14,52 @@
 
 #include "exec/pipeline/exchange/local_exchange.h"
 
+#include <fmt/format.h>
+
 #include <memory>
 
 #include "column/chunk.h"
+#include "common/config.h"
 #include "exec/pipeline/exchange/shuffler.h"
 #include "exprs/expr_context.h"
 #include "util/runtime_profile.h"
 
 namespace starrocks::pipeline {
+void HotKeyDetector::try_detect(int32_t num_partitions) {
+    if (_num_sampled_rows < kWindowRows) {
+        return;
+    }
+
+    _hot_keys.clear();
+    const double hot_key_ratio = config::local_exchange_hot_key_ratio;
+    if (hot_key_ratio > 0 && num_partitions > 1) {
+        // A key no more than the share of two drivers can't make a driver much slower than the others.
+        const double threshold = _num_sampled_rows * std::max(hot_key_ratio, 2.0 / num_partitions);
+        for (const auto& [hash, num_rows] : _sampled_rows) {
+            if (num_rows > threshold) {
+                _hot_keys.insert(hash);
+            }
+        }
+        _max_num_hot_keys = std::max(_max_num_hot_keys, _hot_keys.size());
+    }
+
+    _sampled_rows.clear();
+    _num_sampled_rows = 0;
+}
+
+void PartitionDistribution::update_profile(RuntimeProfile* profile) const {
+    if (partition_rows.empty()) {
+        return;
+    }
+    auto [min_rows, max_rows] = std::minmax_element(partition_rows.begin(), partition_rows.end());
+    profile->add_info_string("PartitionRowDistribution", fmt::format("[{}]", fmt::join(partition_rows, ",")));
+    COUNTER_SET(ADD_COUNTER(profile, "PartitionRowsMax", TUnit::UNIT), *max_rows);
+    COUNTER_SET(ADD_COUNTER(profile, "PartitionRowsMin", TUnit::UNIT), *min_rows);
+    COUNTER_SET(ADD_COUNTER(profile, "HotKeyNum", TUnit::UNIT),
+                static_cast<int64_t>(hot_key_detector.max_num_hot_keys()));
+    COUNTER_SET(ADD_COUNTER(profile, "HotKeySplitRows", TUnit::UNIT), num_split_rows);
+}
+
 Status Partitioner::partition_chunk(const ChunkPtr& chunk, int32_t num_partitions,
                                     std::vector<uint32_t>& partition_row_indexes) {
     size_t num_rows = chunk->num_rows();
@@ -37,6 +75,9 @@ Status Partitioner::partition_chunk(const ChunkPtr& chunk, int32_t num_partition
             _partition_row_indexes_start_points[_shuffle_channel_id[i]]++;
             _partition_memory_usage[_shuffle_channel_id[i]] += chunk->bytes_usage(i, 1);
         }
+        for (int32_t i = 0; i < num_partitions; ++i) {
+            _distribution.add_rows(i, _partition_row_indexes_start_points[i]);
+        }
         // We make the last item equal with number of rows of this chunk.
         for (int32_t i = 1; i <= num_partitions; ++i) {
             _partition_row_indexes_start_points[i] += _partition_row_indexes_start_points[i - 1];
@@ -97,9 +138,35 @@ Status ShufflePartitioner::shuffle_channel_ids(const ChunkPtr& chunk, int32_t nu
     _shuffle_channel_id.resize(num_rows);
 
     _shuffler->local_exchange_shuffle(_shuffle_channel_id, _hash_values, num_rows);
+    _detect_and_split_hot_keys(num_rows, num_partitions);
     return Status::OK();
 }
 
+void ShufflePartitioner::_detect_and_split_hot_keys(size_t num_rows, int32_t num_partitions) {
+    if (config::local_exchange_hot_key_ratio <= 0 || num_partitions <= 1) {
+        return;
+    }
+
+    auto& detector = _distribution.hot_key_detector;
+    size_t i = _sample_offset;
+    for (; i < num_rows; i += kSampleStride) {
+        detector.add(_hash_values[i], 1);
+    }
+    // The offset of the first sampled row in the next chunk.
+    _sample_offset = i - num_rows;
+    detector.try_detect(num_partitions);
+
+    if (!_split_hot_keys || !detector.has_hot_keys()) {
+        return;
+    }
+    for (size_t row = 0; row < num_rows; ++row) {
+        if (detector.is_hot(_hash_values[row])) {
+            _shuffle_channel_id[row] = _distribution.next_split_partition(num_partitions);
+            _distribution.num_split_rows++;
+        }
+    }
+}
+
 Status RandomPartitioner::shuffle_channel_ids(const ChunkPtr& chunk, int32_t num_partitions) {
     size_t num_rows = chunk->num_rows();
     _shuffle_channel_id.resize(num_rows, 0);
@@ -121,14 +188,16 @@ Status RandomPartitioner::shuffle_channel_ids(const ChunkPtr& chunk, int32_t num
 
 PartitionExchanger::PartitionExchanger(const std::shared_ptr<ChunkBufferMemoryManager>& memory_manager,
                                        LocalExchangeSourceOperatorFactory* source, const TPartitionType::type part_type,
-                                       std::vector<ExprContext*> partition_expr_ctxs)
+                                       std::vector<ExprContext*> partition_expr_ctxs, bool allow_split_hot_keys)
         : LocalExchanger(strings::Substitute("Partition($0)", to_string(part_type)), memory_manager, source),
           _part_type(part_type),
-          _partition_exprs(std::move(partition_expr_ctxs)) {}
+          _partition_exprs(std::move(partition_expr_ctxs)),
+          _split_hot_keys(allow_split_hot_keys && config::local_exchange_enable_hot_key_split) {}
 
 void PartitionExchanger::incr_sinker() {
     LocalExchanger::incr_sinker();
-    _partitioners.emplace_back(std::make_unique<ShufflePartitioner>(_source, _part_type, _partition_exprs));
+    _partitioners.emplace_back(
+            std::make_unique<ShufflePartitioner>(_source, _part_type, _partition_exprs, _split_hot_keys));
 }
 
 Status PartitionExchanger::prepare(RuntimeState* state) {
@@ -162,6 +231,12 @@ Status PartitionExchanger::accept(const ChunkPtr& chunk, const int32_t sink_driv
     return Status::OK();
 }
 
+void PartitionExchanger::update_sink_profile(int32_t sink_driver_sequence, RuntimeProfile* profile) {
+    if (static_cast<size_t>(sink_driver_sequence) < _partitioners.size()) {
+        _partitioners[sink_driver_sequence]->distribution().update_profile(profile);
+    }
+}
+
 OrderedPartitionExchanger::OrderedPartitionExchanger(const std::shared_ptr<ChunkBufferMemoryManager>& memory_manager,
                                                      LocalExchangeSourceOperatorFactory* source,
                                                      std::vector<ExprContext*> partition_expr_ctxs)
@@ -266,7 +341,9 @@ KeyPartitionExchanger::KeyPartitionExchanger(const std::shared_ptr<ChunkBufferMe
                                              std::vector<ExprContext*> partition_expr_ctxs, const size_t num_sinks)
         : LocalExchanger(strings::Substitute("KeyPartition"), memory_manager, source),
           _source(source),
-          _partition_expr_ctxs(std::move(partition_expr_ctxs)) {
+          _partition_expr_ctxs(std::move(partition_expr_ctxs)),
+          _channel_distributions(num_sinks),
+          _split_hot_keys(config::local_exchange_enable_hot_key_split) {
     _channel_partitions_columns.reserve(num_sinks);
     for (int i = 0; i < num_sinks; ++i) {
         _channel_partitions_columns.emplace_back(_partition_expr_ctxs.size());
@@ -311,14 +388,32 @@ Status KeyPartitionExchanger::accept(const ChunkPtr& chunk, const int32_t sink_d
         }
     }
 
+    auto& distribution = _channel_distributions[sink_driver_sequence];
+    if (distribution.partition_rows.empty()) {
+        distribution.partition_rows.resize(source_op_cnt, 0);
+    }
+    const bool detect_hot_keys = config::local_exchange_hot_key_ratio > 0 && source_op_cnt > 1;
+
     std::vector<uint32_t> hash_values(chunk->num_rows());
     for (auto& [_, indexes] : partition_row_indexes) {
-        hash_values[(*indexes)[0]] = HashUtil::FNV_SEED;
+        const uint32_t hash_value_idx = (*indexes)[0];
+        const size_t num_partition_rows = indexes->size();
+        hash_values[hash_value_idx] = HashUtil::FNV_SEED;
         for (const ColumnPtr& column : partitions_columns) {
-            column->fnv_hash(&hash_values[0], (*indexes)[0], (*indexes)[0] + 1);
+            column->fnv_hash(&hash_values[0], hash_value_idx, hash_value_idx + 1);
         }
 
-        uint32_t shuffle_channel_id = hash_values[(*indexes)[0]] % source_op_cnt;
+        const uint32_t hash_value = hash_values[hash_value_idx];
+        uint32_t shuffle_channel_id = hash_value % source_op_cnt;
+        if (detect_hot_keys) {
+            distribution.hot_key_detector.add(hash_value, num_partition_rows);
+            // The rows of a partition in one chunk are always sent to the same source together.
+            if (_split_hot_keys && distribution.hot_key_detector.is_hot(hash_value)) {
+                shuffle_channel_id = distribution.next_split_partition(source_op_cnt);
+                distribution.num_split_rows += num_partition_rows;
+            }
+        }
+        distribution.add_rows(shuffle_channel_id, num_partition_rows);
 
         size_t memory_usage = 0;
         for (unsigned int row_index : *indexes) {
@@ -326,12 +421,22 @@ Status KeyPartitionExchanger::accept(const ChunkPtr& chunk, const int32_t sink_d
         }
 
         RETURN_IF_ERROR(_source->get_sources()[shuffle_channel_id]->add_chunk(
-                chunk, std::move(indexes), 0, indexes->size(), partitions_columns, _partition_expr_ctxs, memory_usage));
+                chunk, std::move(indexes), 0, num_partition_rows, partitions_columns, _partition_expr_ctxs,
+                memory_usage));
+    }
+    if (detect_hot_keys) {
+        distribution.hot_key_detector.try_detect(source_op_cnt);
     }
 
     return Status::OK();
 }
 
+void KeyPartitionExchanger::update_sink_profile(int32_t sink_driver_sequence, RuntimeProfile* profile) {
+    if (static_cast<size_t>(sink_driver_sequence) < _channel_distributions.size()) {
+        _channel_distributions[sink_driver_sequence].update_profile(profile);
+    }
+}
+
 Status BroadcastExchanger::accept(const ChunkPtr& chunk, const int32_t sink_driver_sequence) {
     for (auto* source : _source->get_sources()) {
         source->add_chunk(chunk);
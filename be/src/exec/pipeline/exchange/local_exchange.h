@@ -22,6 +22,7 @@
 #include "exec/pipeline/exchange/local_exchange_source_operator.h"
 #include "exec/pipeline/exchange/shuffler.h"
 #include "exprs/expr_context.h"
+#include "util/phmap/phmap.h"
 #include "util/runtime_profile.h"
 
 namespace starrocks {
@@ -30,6 +31,57 @@ class RuntimeState;
 
 namespace pipeline {
 
+// HotKeyDetector detects the hot partition keys of a single local exchange sink driver.
+// The hash values of the partition keys are sampled in a window, and a key is hot if it takes more than
+// config::local_exchange_hot_key_ratio of the sampled rows and more than the share of two drivers.
+// The hot keys are re-detected at the end of each window, so a key which is no longer hot will be dropped.
+class HotKeyDetector {
+public:
+    void add(uint32_t hash, size_t num_rows) {
+        _sampled_rows[hash] += num_rows;
+        _num_sampled_rows += num_rows;
+    }
+
+    // Re-detect the hot keys if there are enough sampled rows in the current window.
+    void try_detect(int32_t num_partitions);
+
+    bool is_hot(uint32_t hash) const { return !_hot_keys.empty() && _hot_keys.contains(hash); }
+    bool has_hot_keys() const { return !_hot_keys.empty(); }
+    // The maximum number of hot keys of all the windows.
+    size_t max_num_hot_keys() const { return _max_num_hot_keys; }
+
+private:
+    static constexpr size_t kWindowRows = 4096;
+
+    phmap::flat_hash_map<uint32_t, size_t> _sampled_rows;
+    size_t _num_sampled_rows = 0;
+    phmap::flat_hash_set<uint32_t> _hot_keys;
+    size_t _max_num_hot_keys = 0;
+};
+
+// PartitionDistribution records how a single local exchange sink driver distributes rows to the sources,
+// and splits the rows of the hot keys to the sources round-robin.
+struct PartitionDistribution {
+    void add_rows(size_t partition_id, size_t num_rows) {
+        if (partition_rows.size() <= partition_id) {
+            partition_rows.resize(partition_id + 1, 0);
+        }
+        partition_rows[partition_id] += num_rows;
+    }
+
+    size_t next_split_partition(int32_t num_partitions) { return (_next_split_partition++) % num_partitions; }
+
+    // Add PartitionRowDistribution, PartitionRowsMax/Min, HotKeyNum and HotKeySplitRows to the profile.
+    void update_profile(RuntimeProfile* profile) const;
+
+    std::vector<int64_t> partition_rows;
+    HotKeyDetector hot_key_detector;
+    int64_t num_split_rows = 0;
+
+private:
+    size_t _next_split_partition = 0;
+};
+
 class Partitioner {
 public:
     Partitioner(LocalExchangeSourceOperatorFactory* source) : _source(source) {}
@@ -61,8 +113,11 @@ public:
         }
     }
 
+    const PartitionDistribution& distribution() const { return _distribution; }
+
 protected:
     LocalExchangeSourceOperatorFactory* _source;
+    PartitionDistribution _distribution;
 
     // This array record the channel start point in _row_indexes
     // And the last item is the number of rows of the current shuffle chunk.
@@ -74,11 +129,15 @@ protected:
 };
 
 // Shuffle by partition columns and partition type.
+// If split_hot_keys is true, the rows of the hot keys are sprayed to all the sources round-robin.
 class ShufflePartitioner final : public Partitioner {
 public:
     ShufflePartitioner(LocalExchangeSourceOperatorFactory* source, const TPartitionType::type part_type,
-                       const std::vector<ExprContext*>& partition_expr_ctxs)
-            : Partitioner(source), _part_type(part_type), _partition_expr_ctxs(partition_expr_ctxs) {
+                       const std::vector<ExprContext*>& partition_expr_ctxs, bool split_hot_keys = false)
+            : Partitioner(source),
+              _part_type(part_type),
+              _partition_expr_ctxs(partition_expr_ctxs),
+              _split_hot_keys(split_hot_keys) {
         _partitions_columns.resize(partition_expr_ctxs.size());
         _hash_values.reserve(source->runtime_state()->chunk_size());
     }
@@ -87,12 +146,20 @@ public:
     Status shuffle_channel_ids(const ChunkPtr& chunk, int32_t num_partitions) override;
 
 private:
+    // Sample one row out of every kSampleStride rows to detect the hot keys.
+    static constexpr size_t kSampleStride = 16;
+
+    void _detect_and_split_hot_keys(size_t num_rows, int32_t num_partitions);
+
     const TPartitionType::type _part_type;
     // Compute per-row partition values.
     const std::vector<ExprContext*>& _partition_expr_ctxs;
+    const bool _split_hot_keys;
     Columns _partitions_columns;
     std::vector<uint32_t> _hash_values;
     std::unique_ptr<Shuffler> _shuffler;
+    // The number of rows skipped since the last sampled row, carried across chunks.
+    size_t _sample_offset = 0;
 };
 
 // Random shuffle row-by-row for each chunk of source.
@@ -122,6 +189,9 @@ public:
 
     virtual Status accept(const ChunkPtr& chunk, int32_t sink_driver_sequence) = 0;
 
+    // Add the statistics of the rows distributed by the sink_driver_sequence-th sink operator to its profile.
+    virtual void update_sink_profile(int32_t sink_driver_sequence, RuntimeProfile* profile) {}
+
     virtual void finish(RuntimeState* state) {
         if (decr_sinker() == 1) {
             for (auto* source : _source->get_sources()) {
@@ -174,11 +244,14 @@ protected:
 };
 
 // Exchange the local data for shuffle
+// allow_split_hot_keys means that the downstream operators produce the same result no matter which source
+// a row is sent to, e.g. the probe side of a hash join whose build side is replicated to each driver.
+// Only then the rows of the hot keys can be split to multiple sources, if local_exchange_enable_hot_key_split is on.
 class PartitionExchanger final : public LocalExchanger {
 public:
     PartitionExchanger(const std::shared_ptr<ChunkBufferMemoryManager>& memory_manager,
                        LocalExchangeSourceOperatorFactory* source, const TPartitionType::type part_type,
-                       std::vector<ExprContext*> _partition_expr_ctxs);
+                       std::vector<ExprContext*> _partition_expr_ctxs, bool allow_split_hot_keys = false);
 
     ~PartitionExchanger() override = default;
 
@@ -187,6 +260,8 @@ public:
 
     Status accept(const ChunkPtr& chunk, int32_t sink_driver_sequence) override;
 
+    void update_sink_profile(int32_t sink_driver_sequence, RuntimeProfile* profile) override;
+
     void incr_sinker() override;
 
 private:
@@ -195,6 +270,7 @@ private:
     // TODO(lzh): limit the size of _partitioners, because it will cost too much memory when dop is high.
     TPartitionType::type _part_type;
     std::vector<ExprContext*> _partition_exprs;
+    const bool _split_hot_keys;
     std::vector<std::unique_ptr<ShufflePartitioner>> _partitioners;
 };
 
@@ -227,6 +303,8 @@ private:
 // key partition mainly means that the column value of each partition is the same.
 // For external table sinks, the chunk received by operators after exchange need to ensure that
 // the values of the partition columns are the same.
+// A partition can be written by multiple writers, so the hot partitions are split to the sources round-robin
+// by chunk if local_exchange_enable_hot_key_split is on, which only produces more files for them.
 class KeyPartitionExchanger final : public LocalExchanger {
     using RowIndexPtr = std::shared_ptr<std::vector<uint32_t>>;
     using Partition2RowIndexes = std::map<PartitionKeyPtr, RowIndexPtr, PartitionKeyComparator>;
@@ -241,10 +319,15 @@ public:
 
     Status accept(const ChunkPtr& chunk, int32_t sink_driver_sequence) override;
 
+    void update_sink_profile(int32_t sink_driver_sequence, RuntimeProfile* profile) override;
+
 private:
     LocalExchangeSourceOperatorFactory* _source;
     const std::vector<ExprContext*> _partition_expr_ctxs;
     std::vector<Columns> _channel_partitions_columns;
+    // The sink_driver_sequence-th local sink operator exclusively uses the sink_driver_sequence-th element.
+    std::vector<PartitionDistribution> _channel_distributions;
+    bool _split_hot_keys = false;
 };
 
 // Exchange the local data for broadcast
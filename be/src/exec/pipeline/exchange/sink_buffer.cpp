@@ -15,6 +15,8 @@
 #include "exec/pipeline/exchange/sink_buffer.h"
 
 #include <bthread/bthread.h>
+#include <bthread/unstable.h>
+#include <butil/time.h>
 
 #include <chrono>
 #include <string_view>
@@ -35,6 +37,7 @@ SinkBuffer::SinkBuffer(FragmentContext* fragment_ctx, const std::vector<TPlanFra
           _rpc_http_min_size(fragment_ctx->runtime_state()->get_rpc_http_min_size()),
           _sent_audit_stats_frequency_upper_limit(
                   std::max((int64_t)64, BitUtil::RoundUpToPowerOfTwo(fragment_ctx->total_dop() * 4))) {
+    phmap::flat_hash_map<std::string, CoalescedBatch*> addr2batch;
     for (const auto& dest : destinations) {
         const auto& instance_id = dest.fragment_instance_id;
         // instance_id.lo == -1 indicates that the destination is pseudo for bucket shuffle join.
@@ -55,6 +58,14 @@ SinkBuffer::SinkBuffer(FragmentContext* fragment_ctx, const std::vector<TPlanFra
             _mutexes[instance_id.lo] = std::make_unique<Mutex>();
             _dest_addrs[instance_id.lo] = dest.brpc_server;
 
+            const auto addr = fmt::format("{}:{}", dest.brpc_server.hostname, dest.brpc_server.port);
+            auto batch_it = addr2batch.find(addr);
+            if (batch_it == addr2batch.end()) {
+                _coalesced_batches.emplace_back(std::make_unique<CoalescedBatch>());
+                batch_it = addr2batch.emplace(addr, _coalesced_batches.back().get()).first;
+            }
+            _instance_id2batch[instance_id.lo] = batch_it->second;
+
             PUniqueId finst_id;
             finst_id.set_hi(instance_id.hi);
             finst_id.set_lo(instance_id.lo);
@@ -174,6 +185,13 @@ void SinkBuffer::update_profile(RuntimeProfile* profile) {
     COUNTER_SET(bytes_sent_counter, _bytes_sent);
     COUNTER_SET(request_sent_counter, _request_sent);
 
+    auto* transmit_rpc_counter = ADD_COUNTER(profile, "TransmitRpcCount", TUnit::UNIT);
+    auto* request_coalesced_counter = ADD_COUNTER(profile, "RequestCoalesced", TUnit::UNIT);
+    auto* bytes_per_rpc_counter = ADD_COUNTER(profile, "BytesPerRpc", TUnit::BYTES);
+    COUNTER_SET(transmit_rpc_counter, _transmit_rpc_sent);
+    COUNTER_SET(request_coalesced_counter, _request_coalesced);
+    COUNTER_SET(bytes_per_rpc_counter, _bytes_sent / std::max(_transmit_rpc_sent.load(), static_cast<int64_t>(1)));
+
     auto* bytes_unsent_counter = ADD_COUNTER(profile, "BytesUnsent", TUnit::BYTES);
     auto* request_unsent_counter = ADD_COUNTER(profile, "RequestUnsent", TUnit::UNIT);
     COUNTER_SET(bytes_unsent_counter, _bytes_enqueued - _bytes_sent);
@@ -191,6 +209,12 @@ void SinkBuffer::update_profile(RuntimeProfile* profile) {
                 return RuntimeProfile::units_per_second(bytes_sent_counter, overall_timer);
             },
             "");
+    profile->add_derived_counter(
+            "RpcsPerSecond", TUnit::UNIT_PER_SECOND,
+            [transmit_rpc_counter, overall_timer] {
+                return RuntimeProfile::units_per_second(transmit_rpc_counter, overall_timer);
+            },
+            "");
 }
 
 int64_t SinkBuffer::_network_time() {
@@ -273,6 +297,42 @@ void SinkBuffer::_process_send_window(const TUniqueId& instance_id, const int64_
     }
 }
 
+template <typename Closure>
+Status SinkBuffer::_send_rpc(Closure* closure, const TransmitChunkInfo& request) {
+    auto expected_iobuf_size = request.attachment.size() + request.params->ByteSizeLong() + sizeof(size_t) * 2;
+    if (UNLIKELY(expected_iobuf_size > _rpc_http_min_size)) {
+        butil::IOBuf iobuf;
+        butil::IOBufAsZeroCopyOutputStream wrapper(&iobuf);
+        request.params->SerializeToZeroCopyStream(&wrapper);
+        // append params to iobuf
+        size_t params_size = iobuf.size();
+        closure->cntl.request_attachment().append(&params_size, sizeof(params_size));
+        closure->cntl.request_attachment().append(iobuf);
+        // append attachment
+        size_t attachment_size = request.attachment.size();
+        closure->cntl.request_attachment().append(&attachment_size, sizeof(attachment_size));
+        closure->cntl.request_attachment().append(request.attachment);
+        VLOG_ROW << "issue a http rpc, attachment's size = " << attachment_size
+                 << " , total size = " << closure->cntl.request_attachment().size();
+
+        if (UNLIKELY(expected_iobuf_size != closure->cntl.request_attachment().size())) {
+            LOG(WARNING) << "http rpc expected iobuf size " << expected_iobuf_size << " != "
+                         << " real iobuf size " << closure->cntl.request_attachment().size();
+        }
+        closure->cntl.http_request().set_content_type("application/proto");
+        // create http_stub as needed
+        auto res = HttpBrpcStubCache::getInstance()->get_http_stub(request.brpc_addr);
+        if (!res.ok()) {
+            return res.status();
+        }
+        res.value()->transmit_chunk_via_http(&closure->cntl, nullptr, &closure->result, closure);
+    } else {
+        closure->cntl.request_attachment().append(request.attachment);
+        request.brpc_stub->transmit_chunk(&closure->cntl, request.params.get(), &closure->result, closure);
+    }
+    return Status::OK();
+}
+
 Status SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, const std::function<void()>& pre_works) {
     std::lock_guard<Mutex> l(*_mutexes[instance_id.lo]);
     pre_works();
@@ -298,9 +358,20 @@ Status SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, const std::fun
         } else {
             too_much_brpc_process = _num_in_flight_rpcs[instance_id.lo] >= config::pipeline_sink_brpc_dop;
         }
-        if (buffer.empty() || too_much_brpc_process) {
+        if (buffer.empty()) {
             return Status::OK();
         }
+        // The coalesced requests of this instance are accounted as in-flight rpcs, send them out at once
+        // if waiting for them, otherwise the wait is prolonged by the coalescing delay.
+        auto flush_coalesced_requests = [this, &instance_id]() {
+            if (!config::pipeline_sink_enable_rpc_coalescing) {
+                return Status::OK();
+            }
+            return _flush_coalesced_batch(_instance_id2batch[instance_id.lo], -1);
+        };
+        if (too_much_brpc_process) {
+            return flush_coalesced_requests();
+        }
 
         TransmitChunkInfo& request = buffer.front();
         bool need_wait = false;
@@ -321,7 +392,7 @@ Status SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, const std::fun
         // But we must guarantee that first packet must be received first
         if (_num_finished_rpcs[instance_id.lo] == 0 && _num_in_flight_rpcs[instance_id.lo] > 0) {
             need_wait = true;
-            return Status::OK();
+            return flush_coalesced_requests();
         }
         if (request.params->eos()) {
             DeferOp eos_defer([this, &instance_id, &need_wait]() {
@@ -348,7 +419,7 @@ Status SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, const std::fun
                 // But we must guarantee that eos packent must be the last packet
                 if (_num_in_flight_rpcs[instance_id.lo] > 0) {
                     need_wait = true;
-                    return Status::OK();
+                    return flush_coalesced_requests();
                 }
                 // this is the last eos query, set query stats
                 if (auto final_stats = _fragment_ctx->runtime_state()->query_ctx()->intermediate_query_statistic()) {
@@ -365,6 +436,16 @@ Status SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, const std::fun
             _request_sent++;
         }
 
+        if (_should_coalesce(request)) {
+            ++_total_in_flight_rpc;
+            ++_num_in_flight_rpcs[instance_id.lo];
+            _mem_tracker->release(request.attachment_physical_bytes);
+            GlobalEnv::GetInstance()->process_mem_tracker()->consume(request.attachment_physical_bytes);
+            RETURN_IF_ERROR(_coalesce_request(instance_id, request));
+            // Keep on coalescing the following requests of this instance.
+            continue;
+        }
+
         auto* closure = new DisposableClosure<PTransmitChunkResult, ClosureContext>(
                 {instance_id, request.params->sequence(), MonotonicNanos()});
         if (_first_send_time == -1) {
@@ -373,6 +454,7 @@ Status SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, const std::fun
 
         closure->addFailedHandler([this](const ClosureContext& ctx, std::string_view rpc_error_msg) noexcept {
             auto defer = DeferOp([this]() { --_total_in_flight_rpc; });
+            auto notify_defer = DeferOp([this]() { _observable.notify_observers(); });
             _is_finishing = true;
             {
                 std::lock_guard<Mutex> l(*_mutexes[ctx.instance_id.lo]);
@@ -391,6 +473,7 @@ Status SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, const std::fun
         closure->addSuccessHandler([this](const ClosureContext& ctx, const PTransmitChunkResult& result) noexcept {
             // when _total_in_flight_rpc desc to 0, _fragment_ctx may be destructed
             auto defer = DeferOp([this]() { --_total_in_flight_rpc; });
+            auto notify_defer = DeferOp([this]() { _observable.notify_observers(); });
             Status status(result.status());
             {
                 std::lock_guard<Mutex> l(*_mutexes[ctx.instance_id.lo]);
@@ -423,6 +506,7 @@ Status SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, const std::fun
 
         closure->cntl.Reset();
         closure->cntl.set_timeout_ms(_brpc_timeout_ms);
+        _transmit_rpc_sent++;
 
         Status st;
         if (bthread_self()) {
@@ -439,40 +523,160 @@ Status SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, const std::fun
     return Status::OK();
 }
 
-Status SinkBuffer::_send_rpc(DisposableClosure<PTransmitChunkResult, ClosureContext>* closure,
-                             const TransmitChunkInfo& request) {
-    auto expected_iobuf_size = request.attachment.size() + request.params->ByteSizeLong() + sizeof(size_t) * 2;
-    if (UNLIKELY(expected_iobuf_size > _rpc_http_min_size)) {
-        butil::IOBuf iobuf;
-        butil::IOBufAsZeroCopyOutputStream wrapper(&iobuf);
-        request.params->SerializeToZeroCopyStream(&wrapper);
-        // append params to iobuf
-        size_t params_size = iobuf.size();
-        closure->cntl.request_attachment().append(&params_size, sizeof(params_size));
-        closure->cntl.request_attachment().append(iobuf);
-        // append attachment
-        size_t attachment_size = request.attachment.size();
-        closure->cntl.request_attachment().append(&attachment_size, sizeof(attachment_size));
-        closure->cntl.request_attachment().append(request.attachment);
-        VLOG_ROW << "issue a http rpc, attachment's size = " << attachment_size
-                 << " , total size = " << closure->cntl.request_attachment().size();
 
-        if (UNLIKELY(expected_iobuf_size != closure->cntl.request_attachment().size())) {
-            LOG(WARNING) << "http rpc expected iobuf size " << expected_iobuf_size << " != "
-                         << " real iobuf size " << closure->cntl.request_attachment().size();
+
+bool SinkBuffer::_should_coalesce(const TransmitChunkInfo& request) const {
+    // The requests to ExchangeMergeSortSourceOperator are not coalesced to keep the send window simple,
+    // and eos requests must be the last packet of the instance, so they are sent alone.
+    return config::pipeline_sink_enable_rpc_coalescing && !_is_dest_merge && !request.params->eos() &&
+           !request.params->use_pass_through() &&
+           static_cast<int64_t>(request.attachment.size()) < config::pipeline_sink_coalesce_max_bytes;
+}
+
+namespace {
+struct CoalesceTimerArg {
+    SinkBuffer* buffer;
+    CoalescedBatch* batch;
+    int64_t generation;
+};
+} // namespace
+
+Status SinkBuffer::_coalesce_request(const TUniqueId& instance_id, TransmitChunkInfo& request) {
+    auto* batch = _instance_id2batch[instance_id.lo];
+    bool is_first_request = false;
+    bool need_flush = false;
+    int64_t generation = 0;
+    {
+        std::lock_guard<Mutex> l(batch->mutex);
+        if (batch->params == nullptr) {
+            batch->params = std::make_shared<PTransmitChunkParams>();
+            batch->brpc_stub = request.brpc_stub;
+            batch->brpc_addr = request.brpc_addr;
+            is_first_request = true;
         }
-        closure->cntl.http_request().set_content_type("application/proto");
-        // create http_stub as needed
-        auto res = HttpBrpcStubCache::getInstance()->get_http_stub(request.brpc_addr);
-        if (!res.ok()) {
-            return res.status();
+        batch->params->add_batched_requests()->CopyFrom(*request.params);
+        batch->attachment.append(request.attachment);
+        batch->contexts.push_back({instance_id, request.params->sequence(), 0});
+        generation = batch->generation;
+        need_flush = static_cast<int64_t>(batch->attachment.size()) >= config::pipeline_sink_coalesce_max_bytes;
+    }
+    _request_coalesced++;
+
+    if (need_flush) {
+        return _flush_coalesced_batch(batch, generation);
+    }
+    if (is_first_request) {
+        // The timer is accounted as an in-flight rpc, to keep SinkBuffer alive until it is triggered.
+        ++_total_in_flight_rpc;
+        auto* arg = new CoalesceTimerArg{this, batch, generation};
+        bthread_timer_t timer;
+        if (bthread_timer_add(&timer, butil::microseconds_from_now(config::pipeline_sink_coalesce_max_delay_us),
+                              _on_coalesce_timer, arg) != 0) {
+            delete arg;
+            --_total_in_flight_rpc;
+            return _flush_coalesced_batch(batch, generation);
         }
-        res.value()->transmit_chunk_via_http(&closure->cntl, nullptr, &closure->result, closure);
-    } else {
-        closure->cntl.request_attachment().append(request.attachment);
-        request.brpc_stub->transmit_chunk(&closure->cntl, request.params.get(), &closure->result, closure);
     }
     return Status::OK();
 }
 
+void SinkBuffer::_on_coalesce_timer(void* arg) {
+    std::unique_ptr<CoalesceTimerArg> timer_arg(static_cast<CoalesceTimerArg*>(arg));
+    auto* buffer = timer_arg->buffer;
+    auto st = buffer->_flush_coalesced_batch(timer_arg->batch, timer_arg->generation);
+    if (!st.ok()) {
+        LOG(WARNING) << "failed to flush coalesced transmit chunk requests: " << st;
+        buffer->_fragment_ctx->cancel(st);
+    }
+    // SinkBuffer may be destructed after this.
+    --buffer->_total_in_flight_rpc;
+}
+
+Status SinkBuffer::_flush_coalesced_batch(CoalescedBatch* batch, int64_t generation) {
+    PTransmitChunkParamsPtr params;
+    butil::IOBuf attachment;
+    std::vector<ClosureContext> contexts;
+    PInternalService_Stub* brpc_stub = nullptr;
+    TNetworkAddress brpc_addr;
+    {
+        std::lock_guard<Mutex> l(batch->mutex);
+        if (batch->params == nullptr || (generation != -1 && generation != batch->generation)) {
+            return Status::OK();
+        }
+        params.swap(batch->params);
+        attachment.swap(batch->attachment);
+        contexts.swap(batch->contexts);
+        brpc_stub = batch->brpc_stub;
+        brpc_addr = batch->brpc_addr;
+        ++batch->generation;
+    }
+
+    const int64_t send_timestamp = MonotonicNanos();
+    for (auto& ctx : contexts) {
+        ctx.send_timestamp = send_timestamp;
+    }
+    const size_t num_requests = contexts.size();
+
+    auto* closure = new DisposableClosure<PTransmitChunkResult, std::vector<ClosureContext>>(contexts);
+    closure->addFailedHandler([this, num_requests](const std::vector<ClosureContext>& ctxs,
+                                                    std::string_view rpc_error_msg) noexcept {
+        auto defer = DeferOp([this, num_requests]() { _total_in_flight_rpc -= num_requests; });
+        auto notify_defer = DeferOp([this]() { _observable.notify_observers(); });
+        _is_finishing = true;
+        for (const auto& ctx : ctxs) {
+            std::lock_guard<Mutex> l(*_mutexes[ctx.instance_id.lo]);
+            ++_num_finished_rpcs[ctx.instance_id.lo];
+            --_num_in_flight_rpcs[ctx.instance_id.lo];
+        }
+
+        const auto& dest_addr = _dest_addrs[ctxs.front().instance_id.lo];
+        std::string err_msg = fmt::format("transmit coalesced chunk rpc failed [num_requests={}] [dest={}:{}] detail:{}",
+                                          ctxs.size(), dest_addr.hostname, dest_addr.port, rpc_error_msg);
+
+        _fragment_ctx->cancel(Status::ThriftRpcError(err_msg));
+        LOG(WARNING) << err_msg;
+    });
+    closure->addSuccessHandler([this, num_requests](const std::vector<ClosureContext>& ctxs,
+                                                     const PTransmitChunkResult& result) noexcept {
+        // when _total_in_flight_rpc desc to 0, _fragment_ctx may be destructed
+        auto defer = DeferOp([this, num_requests]() { _total_in_flight_rpc -= num_requests; });
+        auto notify_defer = DeferOp([this]() { _observable.notify_observers(); });
+        Status status(result.status());
+        for (const auto& ctx : ctxs) {
+            std::lock_guard<Mutex> l(*_mutexes[ctx.instance_id.lo]);
+            ++_num_finished_rpcs[ctx.instance_id.lo];
+            --_num_in_flight_rpcs[ctx.instance_id.lo];
+        }
+        if (!status.ok()) {
+            _is_finishing = true;
+            _fragment_ctx->cancel(status);
+
+            const auto& dest_addr = _dest_addrs[ctxs.front().instance_id.lo];
+            LOG(WARNING) << fmt::format("transmit coalesced chunk rpc failed [num_requests={}] [dest={}:{}] [msg={}]",
+                                        ctxs.size(), dest_addr.hostname, dest_addr.port, status.message());
+        } else {
+            for (const auto& ctx : ctxs) {
+                static_cast<void>(_try_to_send_rpc(ctx.instance_id, [&]() {
+                    _update_network_time(ctx.instance_id, ctx.send_timestamp, result.receiver_post_process_time());
+                    _process_send_window(ctx.instance_id, ctx.sequence);
+                }));
+            }
+        }
+    });
+
+    if (_first_send_time == -1) {
+        _first_send_time = send_timestamp;
+    }
+    closure->cntl.Reset();
+    closure->cntl.set_timeout_ms(_brpc_timeout_ms);
+    _transmit_rpc_sent++;
+
+    TransmitChunkInfo request{TUniqueId(), brpc_stub, std::move(params), std::move(attachment), 0, brpc_addr};
+    if (bthread_self()) {
+        return _send_rpc(closure, request);
+    }
+    SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(nullptr);
+    return _send_rpc(closure, request);
+}
+
 } // namespace starrocks::pipeline
@@ -26,6 +26,7 @@
 #include "column/chunk.h"
 #include "common/compiler_util.h"
 #include "exec/pipeline/fragment_context.h"
+#include "exec/pipeline/pipeline_observer.h"
 #include "gen_cpp/BackendService.h"
 #include "runtime/current_thread.h"
 #include "runtime/query_statistics.h"
@@ -56,6 +57,21 @@ struct TransmitChunkInfo {
     const TNetworkAddress brpc_addr;
 };
 
+// CoalescedBatch collects the small chunk requests of different fragment instances located on the same
+// destination BE, and sends them in one transmit_chunk rpc whose batched_requests carry the original requests.
+// The batch is flushed when its size exceeds pipeline_sink_coalesce_max_bytes, or after
+// pipeline_sink_coalesce_max_delay_us since the first request is added.
+struct CoalescedBatch {
+    bthread::Mutex mutex;
+    PTransmitChunkParamsPtr params;
+    butil::IOBuf attachment;
+    std::vector<ClosureContext> contexts;
+    PInternalService_Stub* brpc_stub = nullptr;
+    TNetworkAddress brpc_addr;
+    // Increased on every flush, used by the delay timer to recognize whether its batch has been flushed.
+    int64_t generation = 0;
+};
+
 // TimeTrace is introduced to estimate time more accurately.
 // For every update
 // 1. times will be increased by 1.
@@ -98,6 +114,10 @@ public:
 
     void incr_sinker(RuntimeState* state);
 
+    // The observers are notified when a rpc response arrives, which may make the buffer not full.
+    void attach_observer(PipelineObserver* observer) { _observable.add_observer(observer); }
+    void detach_observer(PipelineObserver* observer) { _observable.remove_observer(observer); }
+
 private:
     using Mutex = bthread::Mutex;
 
@@ -114,7 +134,16 @@ private:
     [[nodiscard]] Status _try_to_send_rpc(const TUniqueId& instance_id, const std::function<void()>& pre_works);
 
     // send by rpc or http
-    Status _send_rpc(DisposableClosure<PTransmitChunkResult, ClosureContext>* closure, const TransmitChunkInfo& req);
+    template <typename Closure>
+    Status _send_rpc(Closure* closure, const TransmitChunkInfo& req);
+
+    bool _should_coalesce(const TransmitChunkInfo& request) const;
+    // Add the request to the batch of its destination BE, and flush the batch if it is large enough.
+    // The request has been accounted as an in-flight rpc.
+    Status _coalesce_request(const TUniqueId& instance_id, TransmitChunkInfo& request);
+    // Send the batch if it hasn't been flushed since the given generation. generation == -1 means flushing anyway.
+    Status _flush_coalesced_batch(CoalescedBatch* batch, int64_t generation);
+    static void _on_coalesce_timer(void* arg);
 
     // Roughly estimate network time which is defined as the time between sending a and receiving a packet,
     // and the processing time of both sides are excluded
@@ -126,6 +155,8 @@ private:
 
     FragmentContext* _fragment_ctx;
     MemTracker* const _mem_tracker;
+    // Observers of the pipeline drivers blocked on this buffer.
+    Observable _observable;
     const int32_t _brpc_timeout_ms;
     const bool _is_dest_merge;
 
@@ -157,6 +188,9 @@ private:
     phmap::flat_hash_map<int64_t, TimeTrace> _network_times;
     phmap::flat_hash_map<int64_t, std::unique_ptr<Mutex>> _mutexes;
     phmap::flat_hash_map<int64_t, TNetworkAddress> _dest_addrs;
+    // The batches are created in the constructor for each destination BE, and shared by its fragment instances.
+    std::vector<std::unique_ptr<CoalescedBatch>> _coalesced_batches;
+    phmap::flat_hash_map<int64_t, CoalescedBatch*> _instance_id2batch;
 
     // True means that SinkBuffer needn't input chunk and send chunk anymore,
     // but there may be still in-flight RPC running.
@@ -179,6 +213,9 @@ private:
     std::atomic<int64_t> _request_enqueued = 0;
     std::atomic<int64_t> _bytes_sent = 0;
     std::atomic<int64_t> _request_sent = 0;
+    // The number of transmit_chunk rpcs actually issued, a coalesced rpc carries multiple requests.
+    std::atomic<int64_t> _transmit_rpc_sent = 0;
+    std::atomic<int64_t> _request_coalesced = 0;
 
     int64_t _pending_timestamp = -1;
     mutable std::atomic<int64_t> _last_full_timestamp = -1;
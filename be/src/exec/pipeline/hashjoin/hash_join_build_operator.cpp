@@ -147,6 +147,11 @@ Status HashJoinBuildOperator::set_finishing(RuntimeState* state) {
             // move runtime filters into RuntimeFilterHub.
             runtime_filter_hub()->set_collector(_plan_node_id,
                                                 std::make_unique<RuntimeFilterCollector>(std::move(in_filters)));
+        } else {
+            // publish early runtime bloom-filters to the local consumers, they are replaced by the final ones.
+            for (const auto& [filter_id, filter] : _partial_rf_merger->take_early_bloom_filters()) {
+                state->runtime_filter_port()->receive_runtime_filter(filter_id, filter);
+            }
         }
     }
 
@@ -250,6 +250,8 @@ void Operator::_init_rf_counters(bool init_bloom) {
                 ADD_COUNTER(_common_metrics, "JoinRuntimeFilterOutputRows", TUnit::UNIT);
         _bloom_filter_eval_context.join_runtime_filter_eval_counter =
                 ADD_COUNTER(_common_metrics, "JoinRuntimeFilterEvaluate", TUnit::UNIT);
+        _bloom_filter_eval_context.join_runtime_filter_early_filtered_counter =
+                ADD_COUNTER(_common_metrics, "JoinRuntimeFilterEarlyFilteredRows", TUnit::UNIT);
         _bloom_filter_eval_context.driver_sequence = _driver_sequence;
     }
 }
@@ -35,6 +35,7 @@ using RuntimeFilterProbeCollector = starrocks::RuntimeFilterProbeCollector;
 namespace pipeline {
 class Operator;
 class OperatorFactory;
+class PipelineObserver;
 using OperatorPtr = std::shared_ptr<Operator>;
 using Operators = std::vector<OperatorPtr>;
 using LocalRFWaitingSet = std::set<TPlanNodeId>;
@@ -258,6 +259,14 @@ public:
     // memory to be reserved before executing set_finishing
     virtual size_t estimated_memory_reserved() { return 0; }
 
+    // Whether the operator posts readiness events through its observer, when it may become unblocked.
+    // - For a source operator, the event means has_output() or is_finished() may become true.
+    // - For a sink operator, the event means need_input() may become true.
+    // The driver blocked by such an operator needn't be polled by PipelineDriverPoller.
+    virtual bool support_event_scheduling() const { return false; }
+    void set_observer(PipelineObserver* observer) { _observer = observer; }
+    PipelineObserver* observer() const { return _observer; }
+
     // if return true it means the operator has child operators
     virtual bool is_combinatorial_operator() const { return false; }
     // apply operation for each child operator
@@ -290,6 +299,9 @@ protected:
     // the memory that can be released by this operator
     size_t _revocable_mem_bytes = 0;
 
+    // The observer of the driver which this operator belongs to.
+    PipelineObserver* _observer = nullptr;
+
     // Common metrics
     RuntimeProfile::Counter* _total_timer = nullptr;
     RuntimeProfile::Counter* _push_timer = nullptr;
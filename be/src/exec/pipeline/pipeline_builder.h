@@ -95,13 +95,19 @@ public:
     /// partition_exprs
     /// - If the source operator has a partition exprs, use it as partition_exprs.
     /// - Otherwise, use self_partition_exprs or self_partition_exprs_generator().
+    /// allow_split_hot_keys
+    /// - Whether the post operators produce the same result no matter which driver a row is sent to, e.g. the
+    ///   post operators only probe a build side replicated to each driver. If so, the rows of the hot keys
+    ///   could be split to multiple drivers.
     OpFactories maybe_interpolate_local_shuffle_exchange(RuntimeState* state, int32_t plan_node_id,
                                                          OpFactories& pred_operators,
-                                                         const std::vector<ExprContext*>& self_partition_exprs);
+                                                         const std::vector<ExprContext*>& self_partition_exprs,
+                                                         bool allow_split_hot_keys = false);
     using PartitionExprsGenerator = std::function<std::vector<ExprContext*>()>;
     OpFactories maybe_interpolate_local_shuffle_exchange(RuntimeState* state, int32_t plan_node_id,
                                                          OpFactories& pred_operators,
-                                                         const PartitionExprsGenerator& self_partition_exprs_generator);
+                                                         const PartitionExprsGenerator& self_partition_exprs_generator,
+                                                         bool allow_split_hot_keys = false);
 
     // The intput data is already ordered by partition_exprs. Then we can use a simply approach to split them into different channels
     // as long as the data of the same partition_exprs are in the same channel.
@@ -186,7 +192,8 @@ private:
     OpFactories _do_maybe_interpolate_local_shuffle_exchange(
             RuntimeState* state, int32_t plan_node_id, OpFactories& pred_operators,
             const std::vector<ExprContext*>& partition_expr_ctxs,
-            const TPartitionType::type part_type = TPartitionType::type::HASH_PARTITIONED);
+            const TPartitionType::type part_type = TPartitionType::type::HASH_PARTITIONED,
+            bool allow_split_hot_keys = false);
 
     static constexpr int kLocalExchangeBufferChunks = 8;
 
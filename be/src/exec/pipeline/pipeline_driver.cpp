@@ -18,6 +18,7 @@
 #include <sstream>
 
 #include "column/chunk.h"
+#include "common/config.h"
 #include "common/statusor.h"
 #include "exec/pipeline/adaptive/event.h"
 #include "exec/pipeline/exchange/exchange_sink_operator.h"
@@ -96,6 +97,8 @@ Status PipelineDriver::prepare(RuntimeState* runtime_state) {
     _followup_input_empty_timer = ADD_CHILD_TIMER(_runtime_profile, "FollowupInputEmptyTime", "InputEmptyTime");
     _output_full_timer = ADD_CHILD_TIMER(_runtime_profile, "OutputFullTime", "PendingTime");
     _pending_finish_timer = ADD_CHILD_TIMER(_runtime_profile, "PendingFinishTime", "PendingTime");
+    _event_wakeup_counter = ADD_COUNTER(_runtime_profile, "EventWakeupCount", TUnit::UNIT);
+    _event_wakeup_latency_timer = ADD_TIMER(_runtime_profile, "EventWakeupLatency");
 
     _peak_driver_queue_size_counter = _runtime_profile->AddHighWaterMarkCounter(
             "PeakDriverQueueSize", TUnit::UNIT, RuntimeProfile::Counter::create_strategy(TUnit::UNIT));
@@ -119,6 +122,12 @@ Status PipelineDriver::prepare(RuntimeState* runtime_state) {
     }
 
     source_op->add_morsel_queue(_morsel_queue);
+    if (runtime_state->exec_env() != nullptr) {
+        _observer.set_executor(runtime_state->exec_env()->wg_driver_executor());
+    }
+    for (auto& op : _operators) {
+        op->set_observer(&_observer);
+    }
     // fill OperatorWithDependency instances into _dependencies from _operators.
     DCHECK(_dependencies.empty());
     _dependencies.reserve(_operators.size());
@@ -603,11 +612,38 @@ void PipelineDriver::_adjust_memory_usage(RuntimeState* state, MemTracker* track
         request_reserved += state->spill_mem_table_num() * state->spill_mem_table_size();
 
         if (!tls_thread_status.try_mem_reserve(request_reserved)) {
-            mem_resource_mgr.to_low_memory_mode();
+            if (_should_spill_for_reserve_failure(tracker, request_reserved, op->revocable_mem_bytes())) {
+                mem_resource_mgr.to_low_memory_mode();
+            }
         }
     }
 }
 
+bool PipelineDriver::_should_spill_for_reserve_failure(MemTracker* query_tracker, int64_t request_reserved,
+                                                       int64_t revocable_bytes) {
+    const double min_consumption_ratio = config::spill_arbitration_min_consumption_ratio;
+    if (min_consumption_ratio <= 0 || query_tracker == nullptr || query_tracker->parent() == nullptr) {
+        return true;
+    }
+    // The query itself runs out of memory.
+    const int64_t query_limit =
+            query_tracker->has_reserve_limit() ? query_tracker->reserve_limit() : query_tracker->limit();
+    const int64_t query_consumption = query_tracker->consumption();
+    if (query_limit >= 0 && query_consumption + request_reserved > query_limit) {
+        return true;
+    }
+    // The memory is shared with other queries in the same resource group or the query pool, ask the biggest
+    // queries to spill first instead of making all of them spill.
+    const int64_t max_consumption = query_tracker->parent()->max_child_consumption();
+    if (query_consumption >= max_consumption * min_consumption_ratio) {
+        StarRocksMetrics::instance()->spill_arbitration_spilled_operators_total.increment(1);
+        StarRocksMetrics::instance()->spill_arbitration_revocable_bytes.increment(revocable_bytes);
+        return true;
+    }
+    StarRocksMetrics::instance()->spill_arbitration_skipped_operators_total.increment(1);
+    return false;
+}
+
 const double release_buffer_mem_ratio = 0.8;
 
 void PipelineDriver::_try_to_release_buffer(RuntimeState* state, OperatorPtr& op) {
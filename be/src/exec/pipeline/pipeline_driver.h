@@ -25,6 +25,7 @@
 #include "exec/pipeline/operator.h"
 #include "exec/pipeline/operator_with_dependency.h"
 #include "exec/pipeline/pipeline_fwd.h"
+#include "exec/pipeline/pipeline_observer.h"
 #include "exec/pipeline/query_context.h"
 #include "exec/pipeline/runtime_filter_types.h"
 #include "exec/pipeline/scan/morsel.h"
@@ -282,6 +283,28 @@ public:
         _state = state;
     }
 
+    // Time spent so far in the current blocked state, or 0 if the driver is not blocked.
+    int64_t blocked_time_ns() const {
+        MonotonicStopWatch* sw = nullptr;
+        switch (_state) {
+        case DriverState::INPUT_EMPTY:
+            sw = _input_empty_timer_sw;
+            break;
+        case DriverState::OUTPUT_FULL:
+            sw = _output_full_timer_sw;
+            break;
+        case DriverState::PRECONDITION_BLOCK:
+            sw = _precondition_block_timer_sw;
+            break;
+        case DriverState::PENDING_FINISH:
+            sw = _pending_finish_timer_sw;
+            break;
+        default:
+            break;
+        }
+        return sw == nullptr ? 0 : sw->elapsed_time();
+    }
+
     Operators& operators() { return _operators; }
     ScanOperator* source_scan_operator() {
         return _operators.empty() ? nullptr : dynamic_cast<ScanOperator*>(_operators.front().get());
@@ -441,6 +464,22 @@ public:
     inline bool is_in_ready_queue() const { return _in_ready_queue.load(std::memory_order_acquire); }
     void set_in_ready_queue(bool v) { _in_ready_queue.store(v, std::memory_order_release); }
 
+    PipelineObserver* observer() { return &_observer; }
+    // Whether the driver is parked in PipelineDriverPoller to wait for the readiness events of its operators.
+    bool is_waiting_for_event() const { return _waiting_for_event.load(std::memory_order_relaxed); }
+    void set_waiting_for_event(bool v) { _waiting_for_event.store(v, std::memory_order_relaxed); }
+    int64_t last_event_ns() const { return _last_event_ns.load(std::memory_order_relaxed); }
+    void set_last_event_ns(int64_t ns) { _last_event_ns.store(ns, std::memory_order_relaxed); }
+    // Whether the driver is blocked by an operator which posts readiness events.
+    bool is_blocked_by_event_operator() {
+        return (_state == DriverState::INPUT_EMPTY && source_operator()->support_event_scheduling()) ||
+               (_state == DriverState::OUTPUT_FULL && sink_operator()->support_event_scheduling());
+    }
+
+    // The home NUMA node of the driver used by NumaAwareDriverQueue, -1 means it hasn't been assigned yet.
+    int numa_node() const { return _numa_node; }
+    void set_numa_node(int numa_node) { _numa_node = numa_node; }
+
     inline std::string get_name() const { return strings::Substitute("PipelineDriver (id=$0)", _driver_id); }
 
     // Whether the query can be expirable or not.
@@ -482,6 +521,9 @@ protected:
 
     void _adjust_memory_usage(RuntimeState* state, MemTracker* tracker, OperatorPtr& op, const ChunkPtr& chunk);
     void _try_to_release_buffer(RuntimeState* state, OperatorPtr& op);
+    // Whether the operator should spill when failing to reserve memory for it.
+    static bool _should_spill_for_reserve_failure(MemTracker* query_tracker, int64_t request_reserved,
+                                                  int64_t revocable_bytes);
 
     // Update metrics when the driver yields.
     void _update_driver_acct(size_t total_chunks_moved, size_t total_rows_moved, size_t time_spent);
@@ -525,6 +567,13 @@ protected:
     // The index of QuerySharedDriverQueue._queues which this driver belongs to.
     size_t _driver_queue_level = 0;
     std::atomic<bool> _in_ready_queue{false};
+    int _numa_node = -1;
+
+    PipelineObserver _observer{this};
+    std::atomic<bool> _waiting_for_event{false};
+    std::atomic<int64_t> _last_event_ns{0};
+    // Only accessed by PipelineDriverPoller, whether the driver is moved out of the event waiting set by an event.
+    bool _woken_by_event = false;
 
     // metrics
     RuntimeProfile::Counter* _total_timer = nullptr;
@@ -549,6 +598,9 @@ protected:
     RuntimeProfile::Counter* _followup_input_empty_timer = nullptr;
     RuntimeProfile::Counter* _output_full_timer = nullptr;
     RuntimeProfile::Counter* _pending_finish_timer = nullptr;
+    RuntimeProfile::Counter* _event_wakeup_counter = nullptr;
+    // The latency from a readiness event is posted to the driver is put to the ready queue.
+    RuntimeProfile::Counter* _event_wakeup_latency_timer = nullptr;
 
     MonotonicStopWatch* _total_timer_sw = nullptr;
     MonotonicStopWatch* _pending_timer_sw = nullptr;
@@ -20,6 +20,7 @@
 #include "exec/workgroup/work_group.h"
 #include "gutil/strings/substitute.h"
 #include "runtime/current_thread.h"
+#include "util/cpu_info.h"
 #include "util/debug/query_trace.h"
 #include "util/defer_op.h"
 #include "util/failpoint/fail_point.h"
@@ -31,8 +32,7 @@ namespace starrocks::pipeline {
 GlobalDriverExecutor::GlobalDriverExecutor(const std::string& name, std::unique_ptr<ThreadPool> thread_pool,
                                            bool enable_resource_group)
         : Base(name),
-          _driver_queue(enable_resource_group ? std::unique_ptr<DriverQueue>(std::make_unique<WorkGroupDriverQueue>())
-                                              : std::make_unique<QuerySharedDriverQueue>()),
+          _driver_queue(create_driver_queue(enable_resource_group)),
           _thread_pool(std::move(thread_pool)),
           _blocked_driver_poller(new PipelineDriverPoller(_driver_queue.get())),
           _exec_state_reporter(new ExecStateReporter()),
@@ -42,6 +42,47 @@ GlobalDriverExecutor::GlobalDriverExecutor(const std::string& name, std::unique_
     REGISTER_GAUGE_STARROCKS_METRIC(pipe_driver_queue_len, [this]() { return _driver_queue->size(); });
     REGISTER_GAUGE_STARROCKS_METRIC(pipe_poller_block_queue_len,
                                     [this]() { return _blocked_driver_poller->blocked_driver_queue_len(); });
+    if (config::pipeline_enable_numa_aware_scheduling) {
+        _register_numa_metrics();
+    }
+}
+
+void GlobalDriverExecutor::_register_numa_metrics() {
+    auto* metrics = StarRocksMetrics::instance()->metrics();
+    const int num_nodes = std::clamp(CpuInfo::get_max_num_numa_nodes(), 1, NumaAwareDriverQueue::MAX_NUM_NODES);
+    for (int node = 0; node < num_nodes; ++node) {
+        auto labels = MetricLabels().add("node", std::to_string(node));
+        auto& queue_len = _numa_driver_queue_len.emplace_back(std::make_unique<IntGauge>(MetricUnit::NOUNIT));
+        metrics->register_metric("pipe_numa_driver_queue_len", labels, queue_len.get());
+        auto& steal_count = _numa_driver_steal_count.emplace_back(std::make_unique<IntGauge>(MetricUnit::NOUNIT));
+        metrics->register_metric("pipe_numa_driver_steal_count", labels, steal_count.get());
+    }
+    metrics->register_hook("pipe_numa_driver_metrics", [this]() {
+        for (int node = 0; node < _numa_driver_queue_len.size(); ++node) {
+            _numa_driver_queue_len[node]->set_value(NumaAwareDriverQueue::num_queued_drivers_of_node(node));
+            _numa_driver_steal_count[node]->set_value(NumaAwareDriverQueue::num_steals_of_node(node));
+        }
+    });
+}
+
+void GlobalDriverExecutor::_bind_worker_to_numa_node(int worker_id) {
+    const int num_nodes = std::clamp(CpuInfo::get_max_num_numa_nodes(), 1, NumaAwareDriverQueue::MAX_NUM_NODES);
+    const int node = worker_id % num_nodes;
+    const auto& cores = CpuInfo::get_cores_of_numa_node(node);
+    if (cores.empty()) {
+        return;
+    }
+
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    for (int core : cores) {
+        CPU_SET(core, &cpuset);
+    }
+    if (int ret = pthread_setaffinity_np(pthread_self(), sizeof(cpuset), &cpuset); ret != 0) {
+        LOG(WARNING) << "[Driver] Fail to bind executor thread to NUMA node " << node << ", error=" << ret;
+        return;
+    }
+    NumaAwareDriverQueue::set_current_numa_node(node);
 }
 
 void GlobalDriverExecutor::close() {
@@ -77,6 +118,11 @@ void GlobalDriverExecutor::_worker_thread() {
     auto current_thread = Thread::current_thread();
     const int worker_id = _next_id++;
     std::queue<DriverRawPtr> local_driver_queue;
+    if (config::pipeline_enable_numa_aware_scheduling) {
+        _bind_worker_to_numa_node(worker_id);
+    }
+    _driver_queue->bind_executor_thread();
+    DeferOp unbind_queue([this]() { _driver_queue->unbind_executor_thread(); });
     while (true) {
         if (_num_threads_setter.should_shrink()) {
             break;
@@ -107,6 +153,10 @@ void GlobalDriverExecutor::_worker_thread() {
 
         driver->increment_schedule_times();
         _schedule_count++;
+        // Keep the driver on the NUMA node where it first runs, so that the memory allocated by it stays local.
+        if (driver->driver_acct().get_schedule_times() == 1 && NumaAwareDriverQueue::current_numa_node() >= 0) {
+            driver->set_numa_node(NumaAwareDriverQueue::current_numa_node());
+        }
 
         SCOPED_SET_TRACE_INFO(driver->driver_id(), query_ctx->query_id(), fragment_ctx->fragment_instance_id());
 
@@ -449,6 +499,10 @@ void GlobalDriverExecutor::iterate_immutable_blocking_driver(const IterateImmuta
     _blocked_driver_poller->iterate_immutable_driver(call);
 }
 
+void GlobalDriverExecutor::notify_event(DriverRawPtr driver) {
+    _blocked_driver_poller->notify_event(driver);
+}
+
 RuntimeProfile* GlobalDriverExecutor::_build_merged_instance_profile(QueryContext* query_ctx,
                                                                      FragmentContext* fragment_ctx,
                                                                      ObjectPool* obj_pool) {
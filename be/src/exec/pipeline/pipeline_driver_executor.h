@@ -63,6 +63,9 @@ public:
 
     virtual size_t calculate_parked_driver(const ImmutableDriverPredicateFunc& predicate_func) const = 0;
 
+    // Wake up the driver waiting for the readiness events of its operators.
+    virtual void notify_event(DriverRawPtr driver) {}
+
 protected:
     std::string _name;
 };
@@ -87,6 +90,8 @@ public:
 
     void report_epoch(ExecEnv* exec_env, QueryContext* query_ctx, std::vector<FragmentContext*> fragment_ctxs) override;
 
+    void notify_event(DriverRawPtr driver) override;
+
 private:
     using Base = FactoryMethod<DriverExecutor, GlobalDriverExecutor>;
     void _worker_thread();
@@ -97,6 +102,10 @@ private:
 
     void _finalize_epoch(DriverRawPtr driver, RuntimeState* runtime_state, DriverState state);
 
+    void _register_numa_metrics();
+    // Pin the worker thread to the cores of a NUMA node, which is chosen by worker_id in round-robin order.
+    void _bind_worker_to_numa_node(int worker_id);
+
 private:
     // The maximum duration that a driver could stay in local_driver_queue
     static constexpr int64_t LOCAL_MAX_WAIT_TIME_SPENT_NS = 1'000'000L;
@@ -116,6 +125,8 @@ private:
     // metrics
     std::unique_ptr<UIntGauge> _driver_queue_len;
     std::unique_ptr<UIntGauge> _driver_poller_block_queue_len;
+    std::vector<std::unique_ptr<IntGauge>> _numa_driver_queue_len;
+    std::vector<std::unique_ptr<IntGauge>> _numa_driver_steal_count;
 };
 
 } // namespace starrocks::pipeline
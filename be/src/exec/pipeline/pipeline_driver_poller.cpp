@@ -15,6 +15,10 @@
 #include "pipeline_driver_poller.h"
 
 #include <chrono>
+
+#include "common/config.h"
+#include "util/time.h"
+
 namespace starrocks::pipeline {
 
 void PipelineDriverPoller::start() {
@@ -40,16 +44,27 @@ void PipelineDriverPoller::shutdown() {
 void PipelineDriverPoller::run_internal() {
     this->_is_polling_thread_initialized.store(true, std::memory_order_release);
     DriverList tmp_blocked_drivers;
+    std::vector<DriverRawPtr> tmp_event_drivers;
+    int64_t last_fallback_ms = MonotonicMillis();
     int spin_count = 0;
     std::vector<DriverRawPtr> ready_drivers;
     while (!_is_shutdown.load(std::memory_order_acquire)) {
         {
             std::unique_lock<std::mutex> lock(_global_mutex);
             tmp_blocked_drivers.splice(tmp_blocked_drivers.end(), _blocked_drivers);
-            if (_local_blocked_drivers.empty() && tmp_blocked_drivers.empty() && _blocked_drivers.empty()) {
+            tmp_event_drivers.swap(_event_drivers);
+            if (_local_blocked_drivers.empty() && tmp_blocked_drivers.empty() && tmp_event_drivers.empty()) {
                 std::cv_status cv_status = std::cv_status::no_timeout;
-                while (!_is_shutdown.load(std::memory_order_acquire) && this->_blocked_drivers.empty()) {
+                while (!_is_shutdown.load(std::memory_order_acquire) && this->_blocked_drivers.empty() &&
+                       this->_event_drivers.empty()) {
                     cv_status = _cond.wait_for(lock, std::chrono::milliseconds(10));
+                    // The drivers waiting for events still need to be polled periodically to check cancellation
+                    // and expiration.
+                    if (!_event_waiting_drivers.empty() &&
+                        MonotonicMillis() - last_fallback_ms >= config::pipeline_poller_event_fallback_interval_ms) {
+                        cv_status = std::cv_status::no_timeout;
+                        break;
+                    }
                 }
                 if (cv_status == std::cv_status::timeout) {
                     continue;
@@ -58,15 +73,18 @@ void PipelineDriverPoller::run_internal() {
                     break;
                 }
                 tmp_blocked_drivers.splice(tmp_blocked_drivers.end(), _blocked_drivers);
+                tmp_event_drivers.swap(_event_drivers);
             }
         }
 
+        const bool enable_event_scheduling = config::pipeline_poller_enable_event_scheduling;
         {
             std::unique_lock write_lock(_local_mutex);
 
             if (!tmp_blocked_drivers.empty()) {
                 _local_blocked_drivers.splice(_local_blocked_drivers.end(), tmp_blocked_drivers);
             }
+            _wake_up_event_waiting_drivers(tmp_event_drivers, last_fallback_ms);
 
             auto driver_it = _local_blocked_drivers.begin();
             while (driver_it != _local_blocked_drivers.end()) {
@@ -128,17 +146,36 @@ void PipelineDriverPoller::run_internal() {
                     remove_blocked_driver(_local_blocked_drivers, driver_it);
                     ready_drivers.emplace_back(driver);
                 } else {
+                    if (enable_event_scheduling) {
+                        // Pairs with the fence in PipelineObserver::notify, either the observer sees the waiting flag
+                        // and posts the event, or is_not_blocked() below sees the new state of the operator.
+                        driver->set_waiting_for_event(true);
+                        std::atomic_thread_fence(std::memory_order_seq_cst);
+                    }
                     auto status_or_is_not_blocked = driver->is_not_blocked();
                     if (!status_or_is_not_blocked.ok()) {
+                        driver->set_waiting_for_event(false);
                         driver->fragment_ctx()->cancel(status_or_is_not_blocked.status());
                         on_cancel(driver, ready_drivers, _local_blocked_drivers, driver_it);
                     } else if (status_or_is_not_blocked.value()) {
+                        driver->set_waiting_for_event(false);
+                        if (driver->_woken_by_event) {
+                            COUNTER_UPDATE(driver->_event_wakeup_counter, 1);
+                            COUNTER_UPDATE(driver->_event_wakeup_latency_timer,
+                                           MonotonicNanos() - driver->last_event_ns());
+                        }
                         driver->set_driver_state(DriverState::READY);
                         remove_blocked_driver(_local_blocked_drivers, driver_it);
                         ready_drivers.emplace_back(driver);
+                    } else if (enable_event_scheduling && driver->is_blocked_by_event_operator()) {
+                        // Park the driver until its operator posts an event, it is still counted as a blocked driver.
+                        _event_waiting_drivers.insert(driver);
+                        driver_it = _local_blocked_drivers.erase(driver_it);
                     } else {
+                        driver->set_waiting_for_event(false);
                         ++driver_it;
                     }
+                    driver->_woken_by_event = false;
                 }
             }
         }
@@ -184,6 +221,40 @@ void PipelineDriverPoller::add_blocked_driver(const DriverRawPtr driver) {
     _cond.notify_one();
 }
 
+void PipelineDriverPoller::notify_event(DriverRawPtr driver) {
+    std::unique_lock<std::mutex> lock(_global_mutex);
+    _event_drivers.push_back(driver);
+    _cond.notify_one();
+}
+
+void PipelineDriverPoller::_wake_up_event_waiting_drivers(std::vector<DriverRawPtr>& event_drivers,
+                                                          int64_t& last_fallback_ms) {
+    // A driver in event_drivers may be stale, e.g. the observer is notified multiple times, so only the drivers
+    // still in _event_waiting_drivers are moved back, and the others are never dereferenced.
+    for (auto* driver : event_drivers) {
+        if (_event_waiting_drivers.erase(driver) > 0) {
+            driver->set_waiting_for_event(false);
+            driver->_woken_by_event = true;
+            _local_blocked_drivers.push_front(driver);
+        }
+    }
+    event_drivers.clear();
+
+    if (_event_waiting_drivers.empty()) {
+        last_fallback_ms = MonotonicMillis();
+        return;
+    }
+    const int64_t now_ms = MonotonicMillis();
+    if (now_ms - last_fallback_ms >= config::pipeline_poller_event_fallback_interval_ms) {
+        for (auto* driver : _event_waiting_drivers) {
+            driver->set_waiting_for_event(false);
+            _local_blocked_drivers.push_back(driver);
+        }
+        _event_waiting_drivers.clear();
+        last_fallback_ms = now_ms;
+    }
+}
+
 void PipelineDriverPoller::park_driver(const DriverRawPtr driver) {
     std::unique_lock<std::mutex> lock(_global_parked_mutex);
     VLOG_ROW << "Add to parked driver:" << driver->to_readable_string();
@@ -251,6 +322,9 @@ void PipelineDriverPoller::iterate_immutable_driver(const IterateImmutableDriver
     for (auto* driver : _local_blocked_drivers) {
         call(driver);
     }
+    for (auto* driver : _event_waiting_drivers) {
+        call(driver);
+    }
 }
 
 } // namespace starrocks::pipeline
@@ -19,6 +19,7 @@
 #include <list>
 #include <memory>
 #include <mutex>
+#include <unordered_set>
 
 #include "pipeline_driver.h"
 #include "pipeline_driver_queue.h"
@@ -61,8 +62,13 @@ public:
 
     void iterate_immutable_driver(const IterateImmutableDriverFunc& call) const;
 
+    // Called by PipelineObserver when an operator of the driver waiting for event becomes ready.
+    void notify_event(DriverRawPtr driver);
+
 private:
     void run_internal();
+    // Move the drivers notified by events and, if necessary, all the waiting drivers back to _local_blocked_drivers.
+    void _wake_up_event_waiting_drivers(std::vector<DriverRawPtr>& event_drivers, int64_t& last_fallback_ms);
     PipelineDriverPoller(const PipelineDriverPoller&) = delete;
     PipelineDriverPoller& operator=(const PipelineDriverPoller&) = delete;
 
@@ -70,8 +76,14 @@ private:
     std::condition_variable _cond;
     DriverList _blocked_drivers;
 
+    // Drivers notified by PipelineObserver, guarded by _global_mutex.
+    std::vector<DriverRawPtr> _event_drivers;
+
     mutable std::shared_mutex _local_mutex;
     DriverList _local_blocked_drivers;
+    // Drivers blocked by the operators which post readiness events, they are not polled until notified or
+    // pipeline_poller_event_fallback_interval_ms elapses. Guarded by _local_mutex.
+    std::unordered_set<DriverRawPtr> _event_waiting_drivers;
 
     DriverQueue* _driver_queue;
     scoped_refptr<Thread> _polling_thread;
@@ -17,6 +17,7 @@
 #include "exec/pipeline/source_operator.h"
 #include "exec/workgroup/work_group.h"
 #include "gutil/strings/substitute.h"
+#include "util/cpu_info.h"
 
 namespace starrocks::pipeline {
 
@@ -204,6 +205,325 @@ DriverRawPtr SubQuerySharedDriverQueue::take(const bool block) {
     return nullptr;
 }
 
+/// NumaAwareDriverQueue.
+namespace {
+thread_local int tls_numa_node = -1;
+
+std::atomic<int64_t> g_num_queued_drivers_per_node[NumaAwareDriverQueue::MAX_NUM_NODES];
+std::atomic<int64_t> g_num_steals_per_node[NumaAwareDriverQueue::MAX_NUM_NODES];
+} // namespace
+
+NumaAwareDriverQueue::NumaAwareDriverQueue() : NumaAwareDriverQueue(CpuInfo::get_max_num_numa_nodes()) {}
+
+NumaAwareDriverQueue::NumaAwareDriverQueue(int num_nodes) {
+    num_nodes = std::clamp(num_nodes, 1, MAX_NUM_NODES);
+    _node_queues.reserve(num_nodes);
+    for (int i = 0; i < num_nodes; ++i) {
+        _node_queues.emplace_back(std::make_unique<QuerySharedDriverQueue>());
+    }
+    _num_drivers_per_node.resize(num_nodes, 0);
+}
+
+int NumaAwareDriverQueue::current_numa_node() {
+    return tls_numa_node;
+}
+
+void NumaAwareDriverQueue::set_current_numa_node(int node) {
+    tls_numa_node = node;
+}
+
+int64_t NumaAwareDriverQueue::num_queued_drivers_of_node(int node) {
+    DCHECK(node >= 0 && node < MAX_NUM_NODES);
+    return g_num_queued_drivers_per_node[node].load(std::memory_order_relaxed);
+}
+
+int64_t NumaAwareDriverQueue::num_steals_of_node(int node) {
+    DCHECK(node >= 0 && node < MAX_NUM_NODES);
+    return g_num_steals_per_node[node].load(std::memory_order_relaxed);
+}
+
+void NumaAwareDriverQueue::close() {
+    std::lock_guard<std::mutex> lock(_global_mutex);
+    _is_closed = true;
+    for (auto& queue : _node_queues) {
+        queue->close();
+    }
+    _cv.notify_all();
+}
+
+void NumaAwareDriverQueue::put_back(const DriverRawPtr driver) {
+    std::lock_guard<std::mutex> lock(_global_mutex);
+    _put_back_unlocked(driver);
+    _cv.notify_one();
+}
+
+void NumaAwareDriverQueue::put_back(const std::vector<DriverRawPtr>& drivers) {
+    std::lock_guard<std::mutex> lock(_global_mutex);
+    for (const auto driver : drivers) {
+        _put_back_unlocked(driver);
+        _cv.notify_one();
+    }
+}
+
+void NumaAwareDriverQueue::put_back_from_executor(const DriverRawPtr driver) {
+    // NumaAwareDriverQueue::put_back_from_executor is identical to put_back.
+    put_back(driver);
+}
+
+StatusOr<DriverRawPtr> NumaAwareDriverQueue::take(const bool block) {
+    const int num_nodes = _node_queues.size();
+    const int cur_node = current_numa_node();
+    const int local_node = (cur_node >= 0 && cur_node < num_nodes) ? cur_node : 0;
+
+    std::unique_lock<std::mutex> lock(_global_mutex);
+    while (true) {
+        if (_is_closed) {
+            return Status::Cancelled("Shutdown");
+        }
+
+        // Look at the local node first, and then steal from the other nodes one by one.
+        for (int i = 0; i < num_nodes; ++i) {
+            const int node = (local_node + i) % num_nodes;
+            if (_num_drivers_per_node[node] == 0) {
+                continue;
+            }
+            ASSIGN_OR_RETURN(auto* driver, _node_queues[node]->take(false));
+            if (driver == nullptr) {
+                continue;
+            }
+
+            --_num_drivers_per_node[node];
+            --_num_drivers;
+            g_num_queued_drivers_per_node[node].fetch_sub(1, std::memory_order_relaxed);
+            if (node != local_node) {
+                g_num_steals_per_node[local_node].fetch_add(1, std::memory_order_relaxed);
+            }
+            return driver;
+        }
+
+        if (!block) {
+            return nullptr;
+        }
+        _cv.wait(lock);
+    }
+}
+
+void NumaAwareDriverQueue::cancel(DriverRawPtr driver) {
+    std::lock_guard<std::mutex> lock(_global_mutex);
+    if (_is_closed) {
+        return;
+    }
+    if (!driver->is_in_ready_queue()) {
+        return;
+    }
+    _node_queues[driver->numa_node()]->cancel(driver);
+    _cv.notify_one();
+}
+
+void NumaAwareDriverQueue::update_statistics(const DriverRawPtr driver) {
+    const int node = driver->numa_node();
+    if (node >= 0 && node < _node_queues.size()) {
+        _node_queues[node]->update_statistics(driver);
+    }
+}
+
+size_t NumaAwareDriverQueue::size() const {
+    std::lock_guard<std::mutex> lock(_global_mutex);
+    return _num_drivers;
+}
+
+size_t NumaAwareDriverQueue::size_of_node(int node) const {
+    std::lock_guard<std::mutex> lock(_global_mutex);
+    return _num_drivers_per_node[node];
+}
+
+int NumaAwareDriverQueue::_node_to_put(const DriverRawPtr driver) {
+    const int num_nodes = _node_queues.size();
+    if (const int home_node = driver->numa_node(); home_node >= 0 && home_node < num_nodes) {
+        return home_node;
+    }
+
+    int node = current_numa_node();
+    if (node < 0 || node >= num_nodes) {
+        node = _next_node_to_put++ % num_nodes;
+    }
+    driver->set_numa_node(node);
+    return node;
+}
+
+void NumaAwareDriverQueue::_put_back_unlocked(const DriverRawPtr driver) {
+    const int node = _node_to_put(driver);
+    _node_queues[node]->put_back(driver);
+    driver->set_in_queue(this);
+
+    ++_num_drivers_per_node[node];
+    ++_num_drivers;
+    g_num_queued_drivers_per_node[node].fetch_add(1, std::memory_order_relaxed);
+}
+
+/// WorkStealingDriverQueue.
+namespace {
+// The local queue bound to the current executor thread, and the WorkStealingDriverQueue owning it.
+thread_local const void* tls_work_stealing_owner = nullptr;
+thread_local void* tls_work_stealing_local_queue = nullptr;
+} // namespace
+
+WorkStealingDriverQueue::WorkStealingDriverQueue(DriverQueuePtr global_queue, size_t max_num_local_queues,
+                                                 size_t local_queue_capacity)
+        : _global_queue(std::move(global_queue)) {
+    _local_queues.reserve(max_num_local_queues);
+    _free_local_queue_indexes.reserve(max_num_local_queues);
+    for (size_t i = 0; i < max_num_local_queues; ++i) {
+        _local_queues.emplace_back(std::make_unique<LocalQueue>(local_queue_capacity));
+        _free_local_queue_indexes.emplace_back(max_num_local_queues - 1 - i);
+    }
+}
+
+void WorkStealingDriverQueue::close() {
+    _global_queue->close();
+}
+
+void WorkStealingDriverQueue::put_back(const DriverRawPtr driver) {
+    _global_queue->put_back(driver);
+}
+
+void WorkStealingDriverQueue::put_back(const std::vector<DriverRawPtr>& drivers) {
+    _global_queue->put_back(drivers);
+}
+
+void WorkStealingDriverQueue::put_back_from_executor(const DriverRawPtr driver) {
+    auto* local_queue = _current_local_queue();
+    if (local_queue != nullptr && driver->driver_state() != DriverState::CANCELED &&
+        !_global_queue->should_yield(driver, 0) && local_queue->drivers.push(driver)) {
+        _num_local_drivers.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    _global_queue->put_back_from_executor(driver);
+}
+
+void WorkStealingDriverQueue::update_statistics(const DriverRawPtr driver) {
+    _global_queue->update_statistics(driver);
+}
+
+StatusOr<DriverRawPtr> WorkStealingDriverQueue::take(const bool block) {
+    auto* local_queue = _current_local_queue();
+    if (local_queue != nullptr) {
+        if (++local_queue->num_takes % GLOBAL_QUEUE_CHECK_INTERVAL == 0) {
+            ASSIGN_OR_RETURN(auto* driver, _global_queue->take(false));
+            if (driver != nullptr) {
+                return driver;
+            }
+        }
+
+        // The owner also takes from the top of its local queue, so that the drivers in it run in FIFO order.
+        if (auto* driver = local_queue->drivers.steal(); driver != nullptr) {
+            _num_local_drivers.fetch_sub(1, std::memory_order_relaxed);
+            _num_local_takes.fetch_add(1, std::memory_order_relaxed);
+            return driver;
+        }
+    }
+
+    if (auto* driver = _steal(local_queue); driver != nullptr) {
+        return driver;
+    }
+    return _global_queue->take(block);
+}
+
+void WorkStealingDriverQueue::cancel(DriverRawPtr driver) {
+    _global_queue->cancel(driver);
+}
+
+size_t WorkStealingDriverQueue::size() const {
+    return _global_queue->size() + _num_local_drivers.load(std::memory_order_relaxed);
+}
+
+bool WorkStealingDriverQueue::should_yield(const DriverRawPtr driver, int64_t unaccounted_runtime_ns) const {
+    return _global_queue->should_yield(driver, unaccounted_runtime_ns);
+}
+
+void WorkStealingDriverQueue::bind_executor_thread() {
+    std::lock_guard<std::mutex> lock(_local_queues_mutex);
+    if (_free_local_queue_indexes.empty()) {
+        return;
+    }
+    const size_t index = _free_local_queue_indexes.back();
+    _free_local_queue_indexes.pop_back();
+    tls_work_stealing_owner = this;
+    tls_work_stealing_local_queue = _local_queues[index].get();
+}
+
+void WorkStealingDriverQueue::unbind_executor_thread() {
+    auto* local_queue = _current_local_queue();
+    if (local_queue == nullptr) {
+        return;
+    }
+
+    while (auto* driver = local_queue->drivers.steal()) {
+        _num_local_drivers.fetch_sub(1, std::memory_order_relaxed);
+        _global_queue->put_back_from_executor(driver);
+    }
+    local_queue->num_takes = 0;
+
+    std::lock_guard<std::mutex> lock(_local_queues_mutex);
+    for (size_t i = 0; i < _local_queues.size(); ++i) {
+        if (_local_queues[i].get() == local_queue) {
+            _free_local_queue_indexes.emplace_back(i);
+            break;
+        }
+    }
+    tls_work_stealing_owner = nullptr;
+    tls_work_stealing_local_queue = nullptr;
+}
+
+WorkStealingDriverQueue::LocalQueue* WorkStealingDriverQueue::_current_local_queue() const {
+    if (tls_work_stealing_owner != this) {
+        return nullptr;
+    }
+    return static_cast<LocalQueue*>(tls_work_stealing_local_queue);
+}
+
+DriverRawPtr WorkStealingDriverQueue::_steal(const LocalQueue* self) {
+    if (_num_local_drivers.load(std::memory_order_relaxed) == 0) {
+        return nullptr;
+    }
+
+    const size_t num_local_queues = _local_queues.size();
+    const size_t start = _next_steal_index.fetch_add(1, std::memory_order_relaxed);
+    for (size_t i = 0; i < num_local_queues; ++i) {
+        auto* victim = _local_queues[(start + i) % num_local_queues].get();
+        if (victim == self || victim->drivers.empty()) {
+            continue;
+        }
+        if (auto* driver = victim->drivers.steal(); driver != nullptr) {
+            _num_local_drivers.fetch_sub(1, std::memory_order_relaxed);
+            _num_steals.fetch_add(1, std::memory_order_relaxed);
+            return driver;
+        }
+    }
+    return nullptr;
+}
+
+DriverQueuePtr create_driver_queue(bool enable_resource_group) {
+    DriverQueuePtr queue;
+    if (enable_resource_group) {
+        queue = std::make_unique<WorkGroupDriverQueue>();
+    } else if (config::pipeline_enable_numa_aware_scheduling) {
+        queue = std::make_unique<NumaAwareDriverQueue>();
+    } else {
+        queue = std::make_unique<QuerySharedDriverQueue>();
+    }
+
+    if (config::pipeline_enable_driver_work_stealing) {
+        int64_t max_num_threads = CpuInfo::num_cores();
+        if (config::pipeline_exec_thread_pool_thread_num > 0) {
+            max_num_threads = config::pipeline_exec_thread_pool_thread_num;
+        }
+        queue = std::make_unique<WorkStealingDriverQueue>(std::move(queue), std::max<int64_t>(1, max_num_threads),
+                                                          config::pipeline_driver_local_queue_capacity);
+    }
+    return queue;
+}
+
 /// WorkGroupDriverQueue.
 bool WorkGroupDriverQueue::WorkGroupDriverSchedEntityComparator::operator()(
         const WorkGroupDriverSchedEntityPtr& lhs_ptr, const WorkGroupDriverSchedEntityPtr& rhs_ptr) const {
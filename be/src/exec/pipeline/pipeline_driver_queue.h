@@ -19,6 +19,7 @@
 #include "exec/pipeline/pipeline_driver.h"
 #include "exec/workgroup/work_group_fwd.h"
 #include "util/factory_method.h"
+#include "util/work_stealing_deque.h"
 
 namespace starrocks::pipeline {
 
@@ -46,8 +47,16 @@ public:
     bool empty() const { return size() == 0; }
 
     virtual bool should_yield(const DriverRawPtr driver, int64_t unaccounted_runtime_ns) const = 0;
+
+    // Invoked by the executor thread when it starts and before it exits,
+    // so that the queue can set up and clean up the thread-local resources.
+    virtual void bind_executor_thread() {}
+    virtual void unbind_executor_thread() {}
 };
 
+// Create the driver queue used by the executor, according to the configurations.
+DriverQueuePtr create_driver_queue(bool enable_resource_group);
+
 // SubQuerySharedDriverQueue is used to store the driver waiting to be executed.
 // It guarantees the following characteristics:
 // 1. the running drivers are executed in FIFO order.
@@ -143,6 +152,133 @@ private:
     bool _is_closed = false;
 };
 
+// NumaAwareDriverQueue splits the ready drivers into one QuerySharedDriverQueue per NUMA node.
+// - A driver is put back to the sub queue of its home node, which is the node where it first ran.
+//   The home node of a driver that has never run is the node of the thread putting it back,
+//   or chosen in round-robin order if this thread isn't pinned to any node.
+// - An executor thread takes a driver from the sub queue of its own node first, and only steals
+//   a driver from the sub queues of the other nodes when the sub queue of its own node is empty.
+class NumaAwareDriverQueue : public FactoryMethod<DriverQueue, NumaAwareDriverQueue> {
+    friend class FactoryMethod<DriverQueue, NumaAwareDriverQueue>;
+
+public:
+    NumaAwareDriverQueue();
+    explicit NumaAwareDriverQueue(int num_nodes);
+    ~NumaAwareDriverQueue() override = default;
+    void close() override;
+    void put_back(const DriverRawPtr driver) override;
+    void put_back(const std::vector<DriverRawPtr>& drivers) override;
+    void put_back_from_executor(const DriverRawPtr driver) override;
+
+    void update_statistics(const DriverRawPtr driver) override;
+
+    // Return cancelled status, if the queue is closed.
+    StatusOr<DriverRawPtr> take(const bool block) override;
+
+    void cancel(DriverRawPtr driver) override;
+
+    size_t size() const override;
+    size_t size_of_node(int node) const;
+
+    bool should_yield(const DriverRawPtr driver, int64_t unaccounted_runtime_ns) const override { return false; }
+
+    int num_nodes() const { return _node_queues.size(); }
+
+    // The NUMA node which the current thread is pinned to, -1 means not pinned to any node.
+    static int current_numa_node();
+    static void set_current_numa_node(int node);
+
+    // The statistics are accumulated across all the NumaAwareDriverQueue instances.
+    static constexpr int MAX_NUM_NODES = 64;
+    static int64_t num_queued_drivers_of_node(int node);
+    static int64_t num_steals_of_node(int node);
+
+private:
+    int _node_to_put(const DriverRawPtr driver);
+    void _put_back_unlocked(const DriverRawPtr driver);
+
+private:
+    std::vector<std::unique_ptr<QuerySharedDriverQueue>> _node_queues;
+    std::vector<size_t> _num_drivers_per_node;
+    size_t _num_drivers = 0;
+    size_t _next_node_to_put = 0;
+
+    mutable std::mutex _global_mutex;
+    std::condition_variable _cv;
+    bool _is_closed = false;
+};
+
+// WorkStealingDriverQueue adds a lock-free local queue for each executor thread in front of a global queue.
+// - The driver yielded by an executor thread is put back to the local queue of this thread, unless
+//   the global queue thinks that it should yield to the other drivers (e.g. its workgroup isn't the one with
+//   the minimum vruntime anymore or is throttled), so that the fairness among workgroups is still kept by the
+//   global queue. The time spent by the drivers is always accounted to the global queue by update_statistics().
+// - The new drivers and the drivers from the poller are always put back to the global queue.
+// - An executor thread takes the driver from its local queue first, then steals from the local queues of the other
+//   threads, and finally takes from the global queue. The global queue is also checked first once every
+//   GLOBAL_QUEUE_CHECK_INTERVAL times, to prevent the drivers in it from starving.
+// The drivers in the local queues are not marked as in ready queue, so cancel() only takes effect on the drivers in
+// the global queue. A cancelled driver in a local queue is finalized by the executor thread when it is taken.
+class WorkStealingDriverQueue : public FactoryMethod<DriverQueue, WorkStealingDriverQueue> {
+    friend class FactoryMethod<DriverQueue, WorkStealingDriverQueue>;
+
+public:
+    WorkStealingDriverQueue(DriverQueuePtr global_queue, size_t max_num_local_queues, size_t local_queue_capacity);
+    ~WorkStealingDriverQueue() override = default;
+    void close() override;
+
+    void put_back(const DriverRawPtr driver) override;
+    void put_back(const std::vector<DriverRawPtr>& drivers) override;
+    void put_back_from_executor(const DriverRawPtr driver) override;
+
+    void update_statistics(const DriverRawPtr driver) override;
+
+    // Return cancelled status, if the queue is closed.
+    StatusOr<DriverRawPtr> take(const bool block) override;
+
+    void cancel(DriverRawPtr driver) override;
+
+    size_t size() const override;
+
+    bool should_yield(const DriverRawPtr driver, int64_t unaccounted_runtime_ns) const override;
+
+    // Bind a free local queue to the current thread. If all the local queues are in use,
+    // the thread works without a local queue.
+    void bind_executor_thread() override;
+    // Move the remaining drivers in the local queue of the current thread to the global queue, and release it.
+    void unbind_executor_thread() override;
+
+    int64_t num_local_takes() const { return _num_local_takes.load(std::memory_order_relaxed); }
+    int64_t num_steals() const { return _num_steals.load(std::memory_order_relaxed); }
+
+    static constexpr int64_t GLOBAL_QUEUE_CHECK_INTERVAL = 61;
+
+private:
+    struct LocalQueue {
+        explicit LocalQueue(size_t capacity) : drivers(capacity) {}
+
+        WorkStealingDeque<DriverRawPtr> drivers;
+        // Only accessed by the owner thread.
+        int64_t num_takes = 0;
+    };
+
+    LocalQueue* _current_local_queue() const;
+    DriverRawPtr _steal(const LocalQueue* self);
+
+private:
+    DriverQueuePtr _global_queue;
+
+    std::vector<std::unique_ptr<LocalQueue>> _local_queues;
+    std::mutex _local_queues_mutex;
+    std::vector<size_t> _free_local_queue_indexes;
+
+    std::atomic<size_t> _num_local_drivers = 0;
+    std::atomic<size_t> _next_steal_index = 0;
+
+    std::atomic<int64_t> _num_local_takes = 0;
+    std::atomic<int64_t> _num_steals = 0;
+};
+
 // WorkGroupDriverQueue contains two levels of queues.
 // The first level is the work group queue, and the second level is the driver queue in a work group.
 class WorkGroupDriverQueue : public FactoryMethod<DriverQueue, WorkGroupDriverQueue> {
@@ -0,0 +1,37 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/pipeline_observer.h"
+
+#include <atomic>
+
+#include "exec/pipeline/pipeline_driver.h"
+#include "exec/pipeline/pipeline_driver_executor.h"
+#include "util/time.h"
+
+namespace starrocks::pipeline {
+
+void PipelineObserver::notify() {
+    // Pair with the fence in PipelineDriverPoller, which marks the driver waiting for events before checking
+    // whether it is blocked. Either the poller observes the new state of the operator, or this observer
+    // observes that the driver is waiting for events, so the event cannot be lost.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (_executor == nullptr || !_driver->is_waiting_for_event()) {
+        return;
+    }
+    _driver->set_last_event_ns(MonotonicNanos());
+    _executor->notify_event(_driver);
+}
+
+} // namespace starrocks::pipeline
@@ -0,0 +1,86 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <mutex>
+#include <vector>
+
+#include "exec/pipeline/pipeline_fwd.h"
+
+namespace starrocks::pipeline {
+
+// PipelineObserver is owned by a driver. It is attached to the Observable objects which the operators of the driver
+// are blocked on, and posts a readiness event to PipelineDriverPoller when the state of the Observable changes,
+// so that the blocked driver is checked and moved to the ready queue at once instead of being polled periodically.
+class PipelineObserver {
+public:
+    explicit PipelineObserver(DriverRawPtr driver) : _driver(driver) {}
+
+    void set_executor(DriverExecutor* executor) { _executor = executor; }
+
+    // Post a readiness event, if the driver is waiting for events in the poller.
+    // It MUST be invoked after the state which makes the driver unblocked has been changed.
+    void notify();
+
+    DriverRawPtr driver() const { return _driver; }
+
+private:
+    DriverRawPtr _driver;
+    DriverExecutor* _executor = nullptr;
+};
+
+// Observable is held by the objects which operators wait on, such as the sender queue of DataStreamRecvr and
+// SinkBuffer. The operator attaches the observer of its driver in prepare() and detaches it in close(), so that
+// the observers are always alive when being notified.
+class Observable {
+public:
+    void add_observer(PipelineObserver* observer) {
+        if (observer == nullptr) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(_mutex);
+        _observers.emplace_back(observer);
+    }
+
+    void remove_observer(PipelineObserver* observer) {
+        if (observer == nullptr) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto it = std::find(_observers.begin(), _observers.end(), observer);
+        if (it != _observers.end()) {
+            _observers.erase(it);
+        }
+    }
+
+    void notify_observers() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (auto* observer : _observers) {
+            observer->notify();
+        }
+    }
+
+    size_t num_observers() const {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _observers.size();
+    }
+
+private:
+    mutable std::mutex _mutex;
+    std::vector<PipelineObserver*> _observers;
+};
+
+} // namespace starrocks::pipeline
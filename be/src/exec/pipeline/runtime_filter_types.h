@@ -17,6 +17,7 @@
 #include <mutex>
 #include <utility>
 
+#include "common/config.h"
 #include "common/statusor.h"
 #include "exec/hash_join_node.h"
 #include "exprs/expr_context.h"
@@ -264,6 +265,7 @@ public:
         _ht_row_counts.emplace_back(0);
         _partial_in_filters.emplace_back();
         _partial_bloom_filter_build_params.emplace_back();
+        _partial_ready.emplace_back(false);
         _num_active_builders++;
     }
 
@@ -283,13 +285,29 @@ public:
         // both _ht_row_counts, _partial_in_filters, _partial_bloom_filter_build_params are reserved beforehand,
         // each HashJoinBuildOperator mutates its corresponding slot indexed by driver_sequence, so concurrent
         // access need mutex to guard.
-        _ht_row_counts[idx] = ht_row_count;
-        _partial_in_filters[idx] = std::move(partial_in_filters);
-        _partial_bloom_filter_build_params[idx] = std::move(partial_bloom_filter_build_params);
+        {
+            // the early bloom filters read the partial filters of the other builders.
+            std::lock_guard guard(_mutex);
+            _ht_row_counts[idx] = ht_row_count;
+            _partial_in_filters[idx] = std::move(partial_in_filters);
+            _partial_bloom_filter_build_params[idx] = std::move(partial_bloom_filter_build_params);
+            _partial_ready[idx] = true;
+            _num_ready_builders++;
+            if (config::enable_early_runtime_filter_publish) {
+                _try_build_early_bloom_filters(bloom_filter_descriptors);
+            }
+        }
 
         return _try_do_merge(std::move(bloom_filter_descriptors));
     }
 
+    // The early bloom filters are published to the local consumers before all the partial filters are ready,
+    // see JoinRuntimeFilter::is_early. Returns the (filter_id, early filter) pairs built but not published yet.
+    std::vector<std::pair<int32_t, const JoinRuntimeFilter*>> take_early_bloom_filters() {
+        std::lock_guard guard(_mutex);
+        return std::move(_early_bloom_filters);
+    }
+
     RuntimeInFilterList get_total_in_filters() {
         // _partial_in_filters is empty means RF _is_always_true
         if (_partial_in_filters.empty()) return {};
@@ -528,8 +546,65 @@ public:
     }
 
 private:
+    // Only multi-partitioned bloom filters can be published early, because the partial filter of a builder covers all
+    // the rows of its partition, and the rows of the other partitions pass the early filter.
+    void _try_build_early_bloom_filters(const RuntimeBloomFilters& bloom_filter_descriptors) {
+        const size_t num_builders = _partial_ready.size();
+        if (_early_built || _always_true || bloom_filter_descriptors.empty() ||
+            _num_ready_builders * 2 < num_builders || _num_ready_builders == num_builders) {
+            return;
+        }
+        if (!bloom_filter_descriptors[0]->layout().pipeline_level_multi_partitioned()) {
+            return;
+        }
+        _early_built = true;
+
+        size_t row_count = 0;
+        for (size_t i = 0; i < num_builders; ++i) {
+            row_count += _partial_ready[i] ? _ht_row_counts[i] : 0;
+        }
+        if (row_count > _local_rf_limit) {
+            return;
+        }
+
+        for (size_t i = 0; i < bloom_filter_descriptors.size(); ++i) {
+            auto* desc = bloom_filter_descriptors[i];
+            if (!desc->has_consumer()) continue;
+            JoinRuntimeFilter* filter = RuntimeFilterHelper::create_runtime_bloom_filter(_pool, desc->build_expr_type());
+            if (filter == nullptr) continue;
+            filter->init_early();
+            filter->set_join_mode(desc->join_mode());
+
+            bool can_publish = true;
+            for (size_t k = 0; k < num_builders && can_publish; ++k) {
+                const auto& opt_params = _partial_bloom_filter_build_params[k];
+                // not ready, or finished in short-circuit style
+                if (!_partial_ready[k] || opt_params.empty()) {
+                    filter->concat_pass_all();
+                    continue;
+                }
+                if (opt_params.size() != bloom_filter_descriptors.size() || !opt_params[i].has_value()) {
+                    can_publish = false;
+                    continue;
+                }
+                const auto& param = opt_params[i].value();
+                if (param.column == nullptr || param.column->empty() || param.runtime_filter == nullptr) {
+                    filter->concat_pass_all();
+                } else if (!param.runtime_filter->can_use_bf()) {
+                    can_publish = false;
+                } else {
+                    filter->concat_early(param.runtime_filter.get());
+                }
+            }
+            if (can_publish) {
+                _early_bloom_filters.emplace_back(desc->filter_id(), filter);
+            }
+        }
+    }
+
     StatusOr<bool> _try_do_merge(RuntimeBloomFilters&& bloom_filter_descriptors) {
         if (1 == _num_active_builders--) {
+            std::lock_guard guard(_mutex);
             if (_always_true) {
                 _partial_in_filters.clear();
                 _bloom_filter_descriptors.clear();
@@ -553,6 +628,13 @@ private:
     std::vector<RuntimeInFilters> _partial_in_filters;
     std::vector<OptRuntimeBloomFilterBuildParams> _partial_bloom_filter_build_params;
     RuntimeBloomFilters _bloom_filter_descriptors;
+
+    // guard the partial filters, since they are read by the builder which builds the early bloom filters.
+    std::mutex _mutex;
+    std::vector<bool> _partial_ready;
+    size_t _num_ready_builders = 0;
+    bool _early_built = false;
+    std::vector<std::pair<int32_t, const JoinRuntimeFilter*>> _early_bloom_filters;
 };
 
 } // namespace starrocks::pipeline
@@ -24,15 +24,20 @@ void DynamicChunkBufferLimiter::update_avg_row_bytes(size_t added_sum_row_bytes,
 
     _sum_row_bytes += added_sum_row_bytes;
     _num_rows += added_num_rows;
+    _max_chunk_rows = max_chunk_rows;
+    _update_capacity_unlocked();
+}
+
+void DynamicChunkBufferLimiter::_update_capacity_unlocked() {
     size_t avg_row_bytes = 0;
     if (_num_rows > 0) {
         avg_row_bytes = _sum_row_bytes / _num_rows;
     }
-    if (avg_row_bytes == 0) {
+    if (avg_row_bytes == 0 || _max_chunk_rows == 0) {
         return;
     }
 
-    size_t chunk_mem_usage = avg_row_bytes * max_chunk_rows;
+    size_t chunk_mem_usage = avg_row_bytes * _max_chunk_rows;
     size_t new_capacity = std::max<size_t>(_mem_limit.load() / chunk_mem_usage, 1);
     _capacity = std::min(new_capacity, _max_capacity);
 }
@@ -52,8 +57,11 @@ void DynamicChunkBufferLimiter::_unpin(int num_chunks) {
 }
 
 void DynamicChunkBufferLimiter::update_mem_limit(int64_t value) {
+    std::lock_guard<std::mutex> lock(_mutex);
     _mem_limit.store(value);
-    // No need to update capacity now, capacity will be updated in next `update_avg_row_bytes` call.
+    // The memory share arbitrator changes the limit when other scan operators of the query start or finish, apply it
+    // now instead of waiting for the next `update_avg_row_bytes` call, which does not come while the buffer is full.
+    _update_capacity_unlocked();
 }
 
 } // namespace starrocks::pipeline
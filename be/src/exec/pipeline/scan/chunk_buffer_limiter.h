@@ -133,13 +133,16 @@ public:
 
 private:
     void _unpin(int num_chunks);
+    void _update_capacity_unlocked();
 
 private:
     std::mutex _mutex;
     size_t _sum_row_bytes = 0;
     size_t _num_rows = 0;
+    size_t _max_chunk_rows = 0;
 
-    size_t _capacity;
+    // Written under _mutex, read without it by pin() and is_full().
+    std::atomic<size_t> _capacity;
     const size_t _max_capacity;
     const size_t _default_capacity;
 
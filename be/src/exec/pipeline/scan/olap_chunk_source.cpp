@@ -21,6 +21,7 @@
 #include "column/column.h"
 #include "column/column_access_path.h"
 #include "column/field.h"
+#include "common/config.h"
 #include "common/status.h"
 #include "exec/olap_scan_node.h"
 #include "exec/olap_scan_prepare.h"
@@ -37,6 +38,7 @@
 #include "storage/chunk_helper.h"
 #include "storage/column_predicate_rewriter.h"
 #include "storage/olap_runtime_range_pruner.hpp"
+#include "storage/page_cache.h"
 #include "storage/predicate_parser.h"
 #include "storage/projection_iterator.h"
 #include "storage/storage_engine.h"
@@ -206,6 +208,12 @@ Status OlapChunkSource::_init_reader_params(const std::vector<std::unique_ptr<Ol
     _params.profile = _runtime_profile;
     _params.runtime_state = _runtime_state;
     _params.use_page_cache = _runtime_state->use_page_cache();
+    if (_params.use_page_cache && config::storage_page_cache_scan_admission_ratio > 0) {
+        // scanning a tablet larger than a part of the page cache would only evict the pages of other queries.
+        auto page_cache_capacity = StoragePageCache::instance()->get_capacity();
+        _params.fill_data_page_cache =
+                _tablet->data_size() <= page_cache_capacity * config::storage_page_cache_scan_admission_ratio;
+    }
     _params.use_pk_index = thrift_olap_scan_node.use_pk_index;
     if (thrift_olap_scan_node.__isset.enable_prune_column_after_index_filter) {
         _params.prune_column_after_index_filter = thrift_olap_scan_node.enable_prune_column_after_index_filter;
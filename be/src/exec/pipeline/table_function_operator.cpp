@@ -209,16 +209,12 @@ void TableFunctionOperator::_copy_result(const std::vector<ColumnPtr>& columns,
                 << " _input_index_of_first_result=" << _input_index_of_first_result;
 
         if (copy_rows > 0) {
-            // Build outer data, repeat multiple times
+            // Build outer data, repeat multiple times. Copy from the input column directly, going through a Datum
+            // would materialize every value of an array/map/struct row once more.
+            uint32_t outer_row = _input_index_of_first_result + _next_output_row_offset;
             for (size_t i = 0; i < _outer_slots.size(); ++i) {
-                ColumnPtr& input_column_ptr = _input_chunk->get_column_by_slot_id(_outer_slots[i]);
-                Datum value = input_column_ptr->get(_input_index_of_first_result + _next_output_row_offset);
-                if (value.is_null()) {
-                    DCHECK(columns[i]->is_nullable());
-                    down_cast<NullableColumn*>(columns[i].get())->append_nulls(copy_rows);
-                } else {
-                    columns[i]->append_value_multiple_times(&value, copy_rows);
-                }
+                const ColumnPtr& input_column_ptr = _input_chunk->get_column_by_slot_id(_outer_slots[i]);
+                columns[i]->append_value_multiple_times(*input_column_ptr, outer_row, copy_rows);
             }
 
             // Build table function result
@@ -25,8 +25,11 @@ static void delete_cache_entry(const CacheKey& key, void* value) {
 
 void CacheManager::populate(const std::string& key, const CacheValue& value) {
     auto* cache_value = new CacheValue(value);
-    auto* handle = _cache.insert(key, cache_value, cache_value->size(), &delete_cache_entry, CachePriority::NORMAL);
+    const size_t value_size = cache_value->size();
+    auto* handle = _cache.insert(key, cache_value, value_size, &delete_cache_entry, CachePriority::NORMAL);
     _cache.release(handle);
+    _populate_count.fetch_add(1, std::memory_order_relaxed);
+    _populate_bytes.fetch_add(value_size, std::memory_order_relaxed);
 }
 
 StatusOr<CacheValue> CacheManager::probe(const std::string& key) {
@@ -36,6 +39,7 @@ StatusOr<CacheValue> CacheManager::probe(const std::string& key) {
     }
     DeferOp defer([this, handle]() { _cache.release(handle); });
     CacheValue cache_value(*reinterpret_cast<CacheValue*>(_cache.value(handle)));
+    _hit_bytes.fetch_add(cache_value.size(), std::memory_order_relaxed);
     return cache_value;
 }
 
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <vector>
@@ -70,10 +71,17 @@ public:
     size_t capacity();
     size_t lookup_count();
     size_t hit_count();
+    // bytes of the cache values returned by successful probes
+    size_t hit_bytes() const { return _hit_bytes.load(std::memory_order_relaxed); }
+    size_t populate_count() const { return _populate_count.load(std::memory_order_relaxed); }
+    size_t populate_bytes() const { return _populate_bytes.load(std::memory_order_relaxed); }
     // vacuum cache by invalidate all cache entries
     void invalidate_all();
 
 private:
     ShardedLRUCache _cache;
+    std::atomic<size_t> _hit_bytes{0};
+    std::atomic<size_t> _populate_count{0};
+    std::atomic<size_t> _populate_bytes{0};
 };
 } // namespace starrocks::query_cache
@@ -30,10 +30,38 @@
 #include "exec/sorting/sort_helper.h"
 #include "exec/sorting/sort_permute.h"
 #include "exec/sorting/sorting.h"
+#include "gutil/endian.h"
 #include "util/orlp/pdqsort.h"
 
 namespace starrocks {
 
+// A string inlined into the permutation together with its first 8 bytes as a big-endian integer.
+// The zero-padded prefixes order the same way as the strings, so only strings sharing the
+// first 8 bytes need to touch the string data when they are compared.
+struct PrefixedSlicePermuteItem {
+    uint64_t prefix;
+    Slice inline_value;
+    uint32_t index_in_chunk;
+};
+
+template <class Container>
+static std::vector<PrefixedSlicePermuteItem> create_prefixed_slice_permutation(const SmallPermutation& other,
+                                                                               const Container& container) {
+    std::vector<PrefixedSlicePermuteItem> inlined(other.size());
+    for (size_t i = 0; i < other.size(); i++) {
+        uint32_t index = other[i].index_in_chunk;
+        const Slice value = container[index];
+        uint64_t prefix = 0;
+        if (value.size > 0) {
+            memcpy(&prefix, value.data, std::min(value.size, sizeof(prefix)));
+        }
+        inlined[i].prefix = BigEndian::FromHost64(prefix);
+        inlined[i].inline_value = value;
+        inlined[i].index_in_chunk = index;
+    }
+    return inlined;
+}
+
 // Sort a column by permtuation
 class ColumnSorter final : public ColumnVisitorAdapter<ColumnSorter> {
 public:
@@ -101,15 +129,20 @@ public:
     template <typename T>
     Status do_visit(const BinaryColumnBase<T>& column) {
         DCHECK_GE(column.size(), _permutation.size());
-        using ItemType = InlinePermuteItem<Slice>;
+        using ItemType = PrefixedSlicePermuteItem;
         auto cmp = [&](const ItemType& lhs, const ItemType& rhs) -> int {
+            if (lhs.prefix != rhs.prefix) {
+                return lhs.prefix < rhs.prefix ? -1 : 1;
+            }
             return lhs.inline_value.compare(rhs.inline_value);
         };
 
-        auto inlined = create_inline_permutation<Slice>(_permutation, column.get_proxy_data());
+        auto inlined = create_prefixed_slice_permutation(_permutation, column.get_proxy_data());
         RETURN_IF_ERROR(
                 sort_and_tie_helper(_cancel, &column, _sort_desc.asc_order(), inlined, _tie, cmp, _range, _build_tie));
-        restore_inline_permutation(inlined, _permutation);
+        for (size_t i = 0; i < inlined.size(); i++) {
+            _permutation[i].index_in_chunk = inlined[i].index_in_chunk;
+        }
 
         return Status::OK();
     }
@@ -397,6 +430,122 @@ private:
     size_t _pruned_limit; // The pruned limit during partial sorting
 };
 
+// Normalized key: the leading sort columns of a row are encoded into a memcomparable unsigned integer, so rows
+// could be sorted by comparing a single inlined value, and only the rows with equal keys need to be sorted by the
+// remaining columns. Only integral columns (including boolean/date/datetime/decimal32/decimal64) are encoded,
+// with one extra bit for the null flag of nullable columns.
+using NormalizedKey = unsigned __int128;
+static constexpr int kNormalizedKeyBits = sizeof(NormalizedKey) * 8;
+// It's not worth building the keys for a single column, which is already sorted on inlined values.
+static constexpr size_t kMinNormalizedKeyColumns = 2;
+
+template <class T>
+constexpr bool is_normalizable_type = (std::is_integral_v<T> && sizeof(T) <= sizeof(uint64_t)) ||
+                                      std::is_same_v<T, DateValue> || std::is_same_v<T, TimestampValue>;
+
+template <class ColumnType, class = void>
+constexpr bool is_normalizable_column = false;
+template <class ColumnType>
+constexpr bool is_normalizable_column<ColumnType, std::void_t<typename ColumnType::ValueType>> =
+        std::is_base_of_v<FixedLengthColumnBase<typename ColumnType::ValueType>, ColumnType> &&
+        is_normalizable_type<typename ColumnType::ValueType>;
+
+template <class T>
+static inline uint64_t normalize_value(T value) {
+    if constexpr (std::is_same_v<T, DateValue>) {
+        return normalize_value(value.julian());
+    } else if constexpr (std::is_same_v<T, TimestampValue>) {
+        return normalize_value(value.timestamp());
+    } else if constexpr (std::is_signed_v<T>) {
+        // flip the sign bit so that negative values are ordered before positive values
+        using UnsignedType = std::make_unsigned_t<T>;
+        return static_cast<UnsignedType>(value) ^ (UnsignedType(1) << (sizeof(T) * 8 - 1));
+    } else {
+        return value;
+    }
+}
+
+// Compute the bits of a column in the normalized key, and append the encoded column to the keys if they are provided
+class NormalizedKeyEncoder final : public ColumnVisitorAdapter<NormalizedKeyEncoder> {
+public:
+    NormalizedKeyEncoder(const SortDesc& sort_desc, NormalizedKey* keys)
+            : ColumnVisitorAdapter(this), _sort_desc(sort_desc), _keys(keys) {}
+
+    int bits() const { return _bits; }
+
+    Status do_visit(const NullableColumn& column) {
+        _bits += 1;
+        if (_keys != nullptr) {
+            const NullData& null_data = column.immutable_null_column_data();
+            // nulls are placed by the null flag, regardless of the sort order
+            const uint8_t null_flag = _sort_desc.is_null_first() ? 0 : 1;
+            for (size_t i = 0; i < null_data.size(); i++) {
+                _keys[i] = (_keys[i] << 1) | (null_data[i] ? null_flag : 1 - null_flag);
+            }
+            _null_data = &null_data;
+        }
+        return column.data_column_ref().accept(this);
+    }
+
+    Status do_visit(const ConstColumn& column) {
+        // noop, all the rows are equal
+        return Status::OK();
+    }
+
+    template <typename ColumnType>
+    Status do_visit(const ColumnType& column) {
+        if constexpr (is_normalizable_column<ColumnType>) {
+            using T = typename ColumnType::ValueType;
+            constexpr int bits = sizeof(T) * 8;
+            _bits += bits;
+            if (_keys != nullptr) {
+                const uint64_t mask = bits == 64 ? ~uint64_t(0) : (uint64_t(1) << bits) - 1;
+                const bool is_asc = _sort_desc.asc_order();
+                const auto& data = column.get_data();
+                for (size_t i = 0; i < data.size(); i++) {
+                    // null rows are encoded as the same value, their data is undefined.
+                    uint64_t value = (_null_data != nullptr && (*_null_data)[i]) ? 0 : normalize_value(data[i]);
+                    value = is_asc ? value : (~value & mask);
+                    _keys[i] = (_keys[i] << bits) | value;
+                }
+            }
+            return Status::OK();
+        } else {
+            return Status::NotSupported("column could not be normalized");
+        }
+    }
+
+private:
+    const SortDesc& _sort_desc;
+    NormalizedKey* _keys;
+    const NullData* _null_data = nullptr;
+    int _bits = 0;
+};
+
+// Return the number of leading columns could be encoded into the normalized key.
+static size_t normalized_key_columns(const Columns& columns, const SortDescs& sort_desc) {
+    int total_bits = 0;
+    size_t num_columns = 0;
+    for (; num_columns < columns.size(); num_columns++) {
+        NormalizedKeyEncoder encoder(sort_desc.descs[num_columns], nullptr);
+        if (!columns[num_columns]->accept(&encoder).ok() || total_bits + encoder.bits() > kNormalizedKeyBits) {
+            break;
+        }
+        total_bits += encoder.bits();
+    }
+    return num_columns;
+}
+
+static void build_normalized_keys(const Columns& columns, size_t num_columns, const SortDescs& sort_desc,
+                                  std::vector<NormalizedKey>* keys) {
+    keys->assign(columns[0]->size(), 0);
+    for (size_t i = 0; i < num_columns; i++) {
+        NormalizedKeyEncoder encoder(sort_desc.descs[i], keys->data());
+        auto st = columns[i]->accept(&encoder);
+        DCHECK(st.ok());
+    }
+}
+
 Status sort_and_tie_column(const std::atomic<bool>& cancel, const ColumnPtr& column, const SortDesc& sort_desc,
                            SmallPermutation& permutation, Tie& tie, std::pair<int, int> range, bool build_tie) {
     ColumnSorter column_sorter(cancel, sort_desc, permutation, tie, range, build_tie);
@@ -413,7 +562,7 @@ Status sort_and_tie_column(const std::atomic<bool>& cancel, ColumnPtr& column, c
 }
 
 Status sort_and_tie_columns(const std::atomic<bool>& cancel, const Columns& columns, const SortDescs& sort_desc,
-                            Permutation* permutation) {
+                            Permutation* permutation, bool use_normalized_key) {
     if (columns.size() < 1) {
         return Status::OK();
     }
@@ -422,7 +571,24 @@ Status sort_and_tie_columns(const std::atomic<bool>& cancel, const Columns& colu
     std::pair<int, int> range{0, num_rows};
     SmallPermutation small_perm = create_small_permutation(num_rows);
 
-    for (int col_index = 0; col_index < columns.size(); col_index++) {
+    size_t start_col = 0;
+    size_t key_columns = use_normalized_key ? normalized_key_columns(columns, sort_desc) : 0;
+    if (key_columns >= kMinNormalizedKeyColumns) {
+        std::vector<NormalizedKey> keys;
+        build_normalized_keys(columns, key_columns, sort_desc, &keys);
+
+        using ItemType = InlinePermuteItem<NormalizedKey>;
+        auto cmp = [](const ItemType& lhs, const ItemType& rhs) {
+            return SorterComparator<NormalizedKey>::compare(lhs.inline_value, rhs.inline_value);
+        };
+        auto inlined = create_inline_permutation<NormalizedKey>(small_perm, keys);
+        RETURN_IF_ERROR(sort_and_tie_helper(cancel, columns[0].get(), true, inlined, tie, cmp, range,
+                                            key_columns != columns.size()));
+        restore_inline_permutation(inlined, small_perm);
+        start_col = key_columns;
+    }
+
+    for (int col_index = start_col; col_index < columns.size(); col_index++) {
         ColumnPtr column = columns[col_index];
         bool build_tie = col_index != columns.size() - 1;
         RETURN_IF_ERROR(sort_and_tie_column(cancel, column, sort_desc.get_column_desc(col_index), small_perm, tie,
@@ -484,9 +650,51 @@ Status sort_vertical_columns(const std::atomic<bool>& cancel, const std::vector<
     return Status::OK();
 }
 
+// Sort the permutation of vertical chunks by the normalized keys of their leading `key_columns` columns
+static Status sort_vertical_chunks_by_normalized_key(const std::atomic<bool>& cancel,
+                                                     const std::vector<Columns>& vertical_chunks, size_t key_columns,
+                                                     const SortDescs& sort_desc, Permutation& perm, Tie& tie,
+                                                     const size_t limit) {
+    std::vector<std::vector<NormalizedKey>> keys(vertical_chunks.size());
+    for (size_t i = 0; i < vertical_chunks.size(); i++) {
+        build_normalized_keys(vertical_chunks[i], key_columns, sort_desc, &keys[i]);
+    }
+
+    struct ItemType {
+        uint32_t chunk_index;
+        uint32_t index_in_chunk;
+        NormalizedKey inline_value;
+    };
+    std::vector<ItemType> inlined(perm.size());
+    for (size_t i = 0; i < perm.size(); i++) {
+        inlined[i].chunk_index = perm[i].chunk_index;
+        inlined[i].index_in_chunk = perm[i].index_in_chunk;
+        inlined[i].inline_value = keys[perm[i].chunk_index][perm[i].index_in_chunk];
+    }
+    auto cmp = [](const ItemType& lhs, const ItemType& rhs) {
+        return SorterComparator<NormalizedKey>::compare(lhs.inline_value, rhs.inline_value);
+    };
+
+    size_t pruned_limit = perm.size();
+    std::pair<int, int> range(0, perm.size());
+    RETURN_IF_ERROR(sort_and_tie_helper(cancel, vertical_chunks[0][0].get(), true, inlined, tie, cmp, range, true,
+                                        limit, &pruned_limit));
+
+    size_t n = std::min(inlined.size(), pruned_limit);
+    for (size_t i = 0; i < n; i++) {
+        perm[i].chunk_index = inlined[i].chunk_index;
+        perm[i].index_in_chunk = inlined[i].index_in_chunk;
+    }
+    if (pruned_limit < perm.size()) {
+        perm.resize(pruned_limit);
+        tie.resize(pruned_limit);
+    }
+    return Status::OK();
+}
+
 Status sort_vertical_chunks(const std::atomic<bool>& cancel, const std::vector<Columns>& vertical_chunks,
                             const SortDescs& sort_desc, Permutation& perm, const size_t limit,
-                            const bool is_limit_by_rank) {
+                            const bool is_limit_by_rank, const bool use_normalized_key) {
     if (vertical_chunks.empty() || perm.empty()) {
         return Status::OK();
     }
@@ -497,7 +705,15 @@ Status sort_vertical_chunks(const std::atomic<bool>& cancel, const std::vector<C
 
     DCHECK_EQ(num_columns, sort_desc.num_columns());
 
-    for (int col = 0; col < num_columns; col++) {
+    size_t start_col = 0;
+    size_t key_columns = use_normalized_key ? normalized_key_columns(vertical_chunks[0], sort_desc) : 0;
+    if (key_columns >= kMinNormalizedKeyColumns) {
+        RETURN_IF_ERROR(sort_vertical_chunks_by_normalized_key(cancel, vertical_chunks, key_columns, sort_desc, perm,
+                                                               tie, limit));
+        start_col = key_columns;
+    }
+
+    for (int col = start_col; col < num_columns; col++) {
         // TODO: use the flag directly
         bool build_tie = col != num_columns - 1;
         std::pair<int, int> range(0, perm.size());
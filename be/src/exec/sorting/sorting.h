@@ -38,8 +38,9 @@ Status sort_and_tie_column(const std::atomic<bool>& cancel, const ColumnPtr& col
                            SmallPermutation& permutation, Tie& tie, std::pair<int, int> range, const bool build_tie);
 
 // Sort multiple columns using column-wise algorithm, output the order in permutation array
+// @param use_normalized_key sort the leading integral columns by their memcomparable normalized keys at first
 Status sort_and_tie_columns(const std::atomic<bool>& cancel, const Columns& columns, const SortDescs& sort_desc,
-                            Permutation* permutation);
+                            Permutation* permutation, bool use_normalized_key = false);
 
 // Sort multiple columns, and stable
 Status stable_sort_and_tie_columns(const std::atomic<bool>& cancel, const Columns& columns, const SortDescs& sort_desc,
@@ -53,7 +54,7 @@ Status sort_vertical_columns(const std::atomic<bool>& cancel, const std::vector<
 // Sort multiple chunks in column-wise style
 Status sort_vertical_chunks(const std::atomic<bool>& cancel, const std::vector<Columns>& vertical_chunks,
                             const SortDescs& sort_desc, Permutation& perm, const size_t limit,
-                            const bool is_limit_by_rank = false);
+                            const bool is_limit_by_rank = false, const bool use_normalized_key = false);
 
 // Compare the column with the `rhs_value`, which must have the some type with column.
 // @param cmp_result compare result is written into this array, value must within -1,0,1
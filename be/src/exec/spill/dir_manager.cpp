@@ -101,6 +101,20 @@ Status DirManager::init(const std::string& spill_dirs) {
     return Status::OK();
 }
 
+bool DirManager::_has_available_space(const DirPtr& dir, size_t data_size) {
+    if (dir->is_remote()) {
+        return true;
+    }
+    // The max size of a local dir is derived from the disk capacity, but the disk may be shared with other data.
+    // Refuse the dir if the disk really runs out of space, so that the block could be allocated from remote storage
+    // instead of failing the query when writing.
+    auto space_info = dir->fs()->space(dir->dir());
+    if (!space_info.ok()) {
+        return true;
+    }
+    return space_info.value().available >= static_cast<int64_t>(data_size);
+}
+
 StatusOr<DirPtr> DirManager::acquire_writable_dir(const AcquireDirOptions& opts) {
     // for the case of multiple dirs, we randomly select one as the start
     // and then try one by one until we find the first one that meets the capacity requirements.
@@ -111,6 +125,9 @@ StatusOr<DirPtr> DirManager::acquire_writable_dir(const AcquireDirOptions& opts)
     }
     for (size_t i = 0; i < _dirs.size(); i++) {
         size_t idx = (start_idx + i) % _dirs.size();
+        if (!_has_available_space(_dirs[idx], opts.data_size)) {
+            continue;
+        }
         if (_dirs[idx]->inc_size(opts.data_size)) {
             return _dirs[idx];
         }
@@ -97,6 +97,8 @@ public:
     StatusOr<DirPtr> acquire_writable_dir(const AcquireDirOptions& opts);
 
 private:
+    static bool _has_available_space(const DirPtr& dir, size_t data_size);
+
     bool is_same_disk(const std::string& path1, const std::string& path2) {
         struct statfs stat1, stat2;
         statfs(path1.c_str(), &stat1);
@@ -18,6 +18,7 @@
 #include <memory>
 #include <utility>
 
+#include "common/config.h"
 #include "common/status.h"
 #include "exec/spill/block_manager.h"
 #include "exec/spill/serde.h"
@@ -29,7 +30,9 @@
 
 namespace starrocks::spill {
 
-static const int chunk_buffer_max_size = 2;
+static int chunk_buffer_max_size() {
+    return std::max(1, config::spill_read_ahead_chunks);
+}
 
 Status YieldableRestoreTask::do_read(workgroup::YieldContext& yield_ctx, SerdeContext& context) {
     size_t num_eos = 0;
@@ -229,16 +232,21 @@ Status BufferedInputStream::prefetch(workgroup::YieldContext& yield_ctx, SerdeCo
     }
     DeferOp defer([this]() { _release(); });
 
-    auto res = _input_stream->get_next(yield_ctx, ctx);
-    if (res.ok()) {
-        COUNTER_ADD(_spiller->metrics().input_stream_peak_memory_usage, res.value()->memory_usage());
-        _chunk_buffer.put(std::move(res.value()));
-        return Status::OK();
-    } else if (res.status().is_end_of_file()) {
-        mark_is_eof();
-        return Status::OK();
+    // read ahead until the buffer is full, so the consumer could process the buffered chunks
+    // while the next restore task is running.
+    while (!is_buffer_full()) {
+        auto res = _input_stream->get_next(yield_ctx, ctx);
+        if (res.ok()) {
+            COUNTER_ADD(_spiller->metrics().input_stream_peak_memory_usage, res.value()->memory_usage());
+            _chunk_buffer.put(std::move(res.value()));
+        } else if (res.status().is_end_of_file()) {
+            mark_is_eof();
+            return Status::OK();
+        } else {
+            return res.status();
+        }
     }
-    return res.status();
+    return Status::OK();
 }
 
 class UnorderedInputStream : public SpillInputStream {
@@ -341,7 +349,7 @@ Status OrderedInputStream::init(const SerdePtr& serde, const SortExecExprs* sort
     for (auto& block : _input_blocks) {
         std::vector<BlockPtr> blocks{block};
         auto stream = std::make_shared<BufferedInputStream>(
-                chunk_buffer_max_size, std::make_shared<UnorderedInputStream>(blocks, serde), spiller);
+                chunk_buffer_max_size(), std::make_shared<UnorderedInputStream>(blocks, serde), spiller);
         _input_streams.emplace_back(std::move(stream));
         auto input_stream = _input_streams.back();
         auto chunk_provider = [input_stream, this](ChunkUniquePtr* output, bool* eos) {
@@ -388,7 +396,7 @@ StatusOr<ChunkUniquePtr> OrderedInputStream::get_next(workgroup::YieldContext& y
 
 StatusOr<InputStreamPtr> BlockGroup::as_unordered_stream(const SerdePtr& serde, Spiller* spiller) {
     auto stream = std::make_shared<UnorderedInputStream>(_blocks, serde);
-    return std::make_shared<BufferedInputStream>(chunk_buffer_max_size, std::move(stream), spiller);
+    return std::make_shared<BufferedInputStream>(chunk_buffer_max_size(), std::move(stream), spiller);
 }
 
 StatusOr<InputStreamPtr> BlockGroup::as_ordered_stream(RuntimeState* state, const SerdePtr& serde, Spiller* spiller,
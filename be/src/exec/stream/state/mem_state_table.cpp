@@ -134,22 +134,23 @@ bool MemStateTable::_equal_keys(const DatumKeyRow& m_k, const DatumKeyRow& keys)
 ChunkIteratorPtrOr MemStateTable::prefix_scan(const Columns& keys, size_t row_idx) const {
     auto key_row = _convert_columns_to_key(keys, row_idx);
     DCHECK_LE(key_row.size(), _k_num);
-    // prefix scan
+    // prefix scan: keys are ordered lexicographically, so all rows sharing the prefix are
+    // contiguous and start at the first key not less than the prefix itself.
     std::vector<DatumRow> rows;
-    for (auto iter = _kv_mapping.begin(); iter != _kv_mapping.end(); iter++) {
-        // if equal
-        auto m_k = iter->first;
-        if (_equal_keys(m_k, key_row)) {
-            DatumRow row;
-            // add extra key cols + value cols
-            for (int32_t s = key_row.size(); s < m_k.size(); s++) {
-                row.push_back(Datum(m_k[s]));
-            }
-            for (auto& datum : iter->second) {
-                row.push_back(datum);
-            }
-            rows.push_back(std::move(row));
+    for (auto iter = _kv_mapping.lower_bound(key_row); iter != _kv_mapping.end(); iter++) {
+        const auto& m_k = iter->first;
+        if (!_equal_keys(m_k, key_row)) {
+            break;
+        }
+        DatumRow row;
+        // add extra key cols + value cols
+        for (int32_t s = key_row.size(); s < m_k.size(); s++) {
+            row.push_back(Datum(m_k[s]));
+        }
+        for (auto& datum : iter->second) {
+            row.push_back(datum);
         }
+        rows.push_back(std::move(row));
     }
     if (rows.empty()) {
         return Status::EndOfFile("");
@@ -145,6 +145,8 @@ Status OlapTableSink::init(const TDataSink& t_sink, RuntimeState* state) {
     _ts_profile->client_rpc_timer = ADD_TIMER(_profile, "RpcClientSideTime");
     _ts_profile->server_rpc_timer = ADD_TIMER(_profile, "RpcServerSideTime");
     _ts_profile->server_wait_flush_timer = ADD_TIMER(_profile, "RpcServerWaitFlushTime");
+    _ts_profile->rpc_request_bytes_counter = ADD_COUNTER(_profile, "RpcRequestBytes", TUnit::BYTES);
+    _ts_profile->compress_skipped_counter = ADD_COUNTER(_profile, "CompressSkippedChunks", TUnit::UNIT);
 
     _schema = std::make_shared<OlapTableSchemaParam>();
     RETURN_IF_ERROR(_schema->init(table_sink.schema, state));
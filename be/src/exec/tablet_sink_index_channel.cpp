@@ -366,8 +366,22 @@ Status NodeChannel::_serialize_chunk(const Chunk* src, ChunkPB* dst) {
         return _err_st;
     }
 
-    // try compress the ChunkPB data
+    bool is_sampled = false;
     if (_compress_codec != nullptr && uncompressed_size > 0) {
+        uint64_t seq = _compress_times++ % kCompressSamplingFrequency;
+        if (seq == 0) {
+            _sampled_raw_bytes = 0;
+            _sampled_compressed_bytes = 0;
+            _skip_compress = false;
+        }
+        is_sampled = seq < kCompressSamplingNum;
+        if (!is_sampled && _skip_compress) {
+            COUNTER_UPDATE(_ts_profile->compress_skipped_counter, 1);
+        }
+    }
+
+    // try compress the ChunkPB data
+    if (_compress_codec != nullptr && uncompressed_size > 0 && (is_sampled || !_skip_compress)) {
         SCOPED_TIMER(_ts_profile->compress_timer);
 
         if (use_compression_pool(_compress_codec->type())) {
@@ -390,6 +404,12 @@ Status NodeChannel::_serialize_chunk(const Chunk* src, ChunkPB* dst) {
         }
 
         double compress_ratio = (static_cast<double>(uncompressed_size)) / _compression_scratch.size();
+        if (is_sampled) {
+            _sampled_raw_bytes += uncompressed_size;
+            _sampled_compressed_bytes += _compression_scratch.size();
+            double sampled_ratio = static_cast<double>(_sampled_raw_bytes) / _sampled_compressed_bytes;
+            _skip_compress = sampled_ratio <= config::rpc_compress_ratio_threshold;
+        }
         if (LIKELY(compress_ratio > config::rpc_compress_ratio_threshold)) {
             dst->mutable_data()->swap(reinterpret_cast<std::string&>(_compression_scratch));
             dst->set_compress_type(_compress_type);
@@ -614,6 +634,7 @@ Status NodeChannel::_send_request(bool eos, bool finished) {
     _add_batch_closures[_current_request_index]->request_size = request.ByteSizeLong();
 
     _mem_tracker->consume(_add_batch_closures[_current_request_index]->request_size);
+    COUNTER_UPDATE(_ts_profile->rpc_request_bytes_counter, _add_batch_closures[_current_request_index]->request_size);
 
     if (_enable_colocate_mv_index) {
         request.set_is_repeated_chunk(true);
@@ -95,6 +95,8 @@ struct TabletSinkProfile {
     RuntimeProfile::Counter* server_rpc_timer = nullptr;
     RuntimeProfile::Counter* alloc_auto_increment_timer = nullptr;
     RuntimeProfile::Counter* server_wait_flush_timer = nullptr;
+    RuntimeProfile::Counter* rpc_request_bytes_counter = nullptr;
+    RuntimeProfile::Counter* compress_skipped_counter = nullptr;
 };
 
 // map index_id to TabletBEMap(map tablet_id to backend id)
@@ -197,6 +199,15 @@ private:
     CompressionTypePB _compress_type = CompressionTypePB::NO_COMPRESSION;
     const BlockCompressionCodec* _compress_codec = nullptr;
     raw::RawString _compression_scratch;
+    // Like serde::EncodeContext, for every kCompressSamplingFrequency chunks, the first kCompressSamplingNum
+    // chunks are compressed, and the rest are compressed only if the sampled ratio exceeds
+    // config::rpc_compress_ratio_threshold, so incompressible data does not pay the compression cost.
+    static constexpr uint32_t kCompressSamplingFrequency = 64;
+    static constexpr uint32_t kCompressSamplingNum = 5;
+    uint64_t _compress_times = 0;
+    uint64_t _sampled_raw_bytes = 0;
+    uint64_t _sampled_compressed_bytes = 0;
+    bool _skip_compress = false;
 
     // this should be set in init() using config
     int _rpc_timeout_ms = 60000;
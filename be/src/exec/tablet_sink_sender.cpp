@@ -14,9 +14,11 @@
 
 #include "exec/tablet_sink_sender.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "column/chunk.h"
+#include "common/config.h"
 #include "common/statusor.h"
 #include "exec/write_combined_txn_log.h"
 #include "exprs/expr.h"
@@ -61,7 +63,8 @@ Status TabletSinkSender::send_chunk(const OlapTableSchemaParam* schema,
                 index_id_partition_id[index->index_id].emplace(partitions[selection]->id);
                 _tablet_ids[selection] = partitions[selection]->indexes[i].tablets[tablet_indexes[selection]];
             }
-            RETURN_IF_ERROR(_send_chunk_by_node(chunk, _channels[i], validate_select_idx));
+            const auto& selection = _presort_selection(chunk, index, validate_select_idx);
+            RETURN_IF_ERROR(_send_chunk_by_node(chunk, _channels[i], selection));
         }
     } else { // Improve for all rows are selected
         size_t index_size = partitions[0]->indexes.size();
@@ -71,12 +74,48 @@ Status TabletSinkSender::send_chunk(const OlapTableSchemaParam* schema,
                 index_id_partition_id[index->index_id].emplace(partitions[j]->id);
                 _tablet_ids[j] = partitions[j]->indexes[i].tablets[tablet_indexes[j]];
             }
-            RETURN_IF_ERROR(_send_chunk_by_node(chunk, _channels[i], validate_select_idx));
+            const auto& selection = _presort_selection(chunk, index, validate_select_idx);
+            RETURN_IF_ERROR(_send_chunk_by_node(chunk, _channels[i], selection));
         }
     }
     return Status::OK();
 }
 
+const std::vector<uint16_t>& TabletSinkSender::_presort_selection(Chunk* chunk, const OlapTableIndexSchema* index,
+                                                                 const std::vector<uint16_t>& selection_idx) {
+    if (!config::enable_load_presort || selection_idx.size() <= 1) {
+        return selection_idx;
+    }
+    // Sort by key columns rather than the sort key. Rows with the same key keep their order, which the
+    // receiver relies on to pick the last row of a primary key or unique key table.
+    Columns key_columns;
+    for (const auto* column : index->column_param->columns) {
+        if (!column->is_key()) {
+            continue;
+        }
+        for (const auto* slot : index->slots) {
+            if (slot->col_name() == column->name() && chunk->is_slot_exist(slot->id())) {
+                key_columns.emplace_back(chunk->get_column_by_slot_id(slot->id()));
+                break;
+            }
+        }
+    }
+    if (key_columns.empty()) {
+        return selection_idx;
+    }
+    _sorted_select_idx.assign(selection_idx.begin(), selection_idx.end());
+    std::stable_sort(_sorted_select_idx.begin(), _sorted_select_idx.end(), [&](uint16_t lhs, uint16_t rhs) {
+        for (const auto& column : key_columns) {
+            int cmp = column->compare_at(lhs, rhs, *column, -1);
+            if (cmp != 0) {
+                return cmp < 0;
+            }
+        }
+        return false;
+    });
+    return _sorted_select_idx;
+}
+
 Status TabletSinkSender::_send_chunk_by_node(Chunk* chunk, IndexChannel* channel,
                                              const std::vector<uint16_t>& selection_idx) {
     Status err_st = Status::OK();
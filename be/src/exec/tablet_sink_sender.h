@@ -70,6 +70,10 @@ public:
 
 protected:
     Status _send_chunk_by_node(Chunk* chunk, IndexChannel* channel, const std::vector<uint16_t>& selection_idx);
+    // Returns |selection_idx| stably sorted by the key columns of |index| if config::enable_load_presort
+    // is true, otherwise |selection_idx| itself.
+    const std::vector<uint16_t>& _presort_selection(Chunk* chunk, const OlapTableIndexSchema* index,
+                                                    const std::vector<uint16_t>& selection_idx);
     Status _write_combined_txn_log();
     void _mark_as_failed(const NodeChannel* ch) { _failed_channels.insert(ch->node_id()); }
     bool _is_failed_channel(const NodeChannel* ch) { return _failed_channels.count(ch->node_id()) != 0; }
@@ -104,6 +108,7 @@ protected:
     // one chunk selection for BE node
     std::vector<uint32_t> _node_select_idx;
     std::vector<int64_t> _tablet_ids;
+    std::vector<uint16_t> _sorted_select_idx;
     std::set<int64_t> _failed_channels;
     // mapping from partition id to CombinedTxnLogPB
     std::map<int64_t, CombinedTxnLogPB> _txn_log_map;
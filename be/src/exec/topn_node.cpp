@@ -17,6 +17,7 @@
 #include <any>
 #include <memory>
 
+#include "common/config.h"
 #include "exec/chunks_sorter.h"
 #include "exec/chunks_sorter_full_sort.h"
 #include "exec/chunks_sorter_heap_sort.h"
@@ -374,6 +375,12 @@ pipeline::OpFactories TopNNode::decompose_to_pipeline(pipeline::PipelineBuilderC
     bool need_merge = _analytic_partition_exprs.empty() || is_partition_skewed;
     bool enable_parallel_merge =
             _tnode.sort_node.__isset.enable_parallel_merge && _tnode.sort_node.enable_parallel_merge;
+    // A full sort gathered into one stream can produce every merge-path range of the drivers' sorted runs
+    // concurrently, instead of merging them all in a single source driver.
+    if (!is_partition_topn && _analytic_partition_exprs.empty() && _limit < 0 &&
+        config::pipeline_enable_full_sort_parallel_merge) {
+        enable_parallel_merge = true;
+    }
 
     OpFactories operators_source_with_sort;
 
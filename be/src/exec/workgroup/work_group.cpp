@@ -173,7 +173,11 @@ void WorkGroup::init() {
     _mem_tracker = std::make_shared<MemTracker>(MemTracker::RESOURCE_GROUP, _memory_limit_bytes, _name,
                                                 GlobalEnv::GetInstance()->query_pool_mem_tracker());
     _mem_tracker->set_reserve_limit(_spill_mem_limit_bytes);
-    _driver_sched_entity.set_queue(std::make_unique<pipeline::QuerySharedDriverQueue>());
+    if (config::pipeline_enable_numa_aware_scheduling) {
+        _driver_sched_entity.set_queue(std::make_unique<pipeline::NumaAwareDriverQueue>());
+    } else {
+        _driver_sched_entity.set_queue(std::make_unique<pipeline::QuerySharedDriverQueue>());
+    }
     _scan_sched_entity.set_queue(workgroup::create_scan_task_queue());
     _connector_scan_sched_entity.set_queue(workgroup::create_scan_task_queue());
 
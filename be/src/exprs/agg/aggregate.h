@@ -196,6 +196,10 @@ public:
                                                      int64_t rows_start_offset, int64_t rows_end_offset,
                                                      bool ignore_subtraction, bool ignore_addition) const {}
 
+    // Whether "update_state_removable_cumulatively" re-evaluates the frame instead of subtracting the row leaving it,
+    // e.g. max/min, such a function takes the nullable input column and skips null rows by itself.
+    virtual bool is_removable_by_reevaluation() const { return false; }
+
     // Contains a loop with calls to "merge" function.
     // You can collect arguments into array "states"
     // and do a single call to "merge_batch" for devirtualization and inlining.
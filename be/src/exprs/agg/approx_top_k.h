@@ -61,16 +61,25 @@ struct ApproxTopKState {
     void reset(int32_t k, int32_t counter_num) {
         this->k = k;
         this->counter_num = counter_num;
-        this->unused_idx = 0;
-        this->counters.reserve(counter_num);
-        for (size_t i = 0; i < counter_num; i++) {
-            this->counters.emplace_back(i);
+        if (this->counters.size() == counter_num) {
+            // reuse the counters of the previous run, only the used ones need to be cleared
+            for (int32_t i = 0; i < this->unused_idx; i++) {
+                this->counters[i].value = {};
+                this->counters[i].count = 0;
+            }
+        } else {
+            this->counters.clear();
+            this->counters.reserve(counter_num);
+            for (size_t i = 0; i < counter_num; i++) {
+                this->counters.emplace_back(i);
+            }
         }
+        this->unused_idx = 0;
         null_counter.count = 0;
         this->table.clear();
     }
 
-    void merge(MemPool* mem_pool, const std::vector<Counter> other_counters) {
+    void merge(MemPool* mem_pool, const std::vector<Counter>& other_counters) {
         for (auto& other_counter : other_counters) {
             process<false>(mem_pool, other_counter.value, other_counter.count, true);
         }
@@ -333,6 +342,16 @@ public:
         this->data(state).template process<true>(ctx->mem_pool(), value, 1, false);
     }
 
+    void update_batch_single_state(FunctionContext* ctx, size_t chunk_size, const Column** columns,
+                                   AggDataPtr __restrict state) const override {
+        init_state_if_necessary(ctx, state);
+        const auto* column = down_cast<const InputColumnType*>(ColumnHelper::get_data_column(columns[0]));
+        for (size_t i = 0; i < chunk_size; ++i) {
+            const auto& value = AggDataTypeTraits<LT>::get_row_ref(*column, i);
+            this->data(state).template process<true>(ctx->mem_pool(), value, 1, false);
+        }
+    }
+
     void serialize_to_column(FunctionContext* ctx, ConstAggDataPtr __restrict state, Column* to) const override {
         DCHECK(to->is_binary());
         serialize_state(this->data(state), down_cast<BinaryColumn*>(to));
@@ -340,34 +359,69 @@ public:
 
     void convert_to_serialize_format(FunctionContext* ctx, const Columns& src, size_t chunk_size,
                                      ColumnPtr* dst) const override {
-        const auto kv = get_k_and_counter_num(ctx);
         DCHECK((*dst)->is_binary());
         auto* dst_column = down_cast<BinaryColumn*>((*dst).get());
 
+        // Every row is a state holding a single value (or null), they are serialized directly rather than
+        // building a state of <counter_num> counters per row.
         if (src[0]->is_nullable()) {
             auto* src_nullable_column = down_cast<NullableColumn*>(src[0].get());
             auto* src_column = down_cast<InputColumnType*>(src_nullable_column->data_column().get());
 
-            ApproxTopKState<LT> state;
             for (size_t i = 0; i < src_nullable_column->size(); ++i) {
-                state.reset(kv.first, kv.second);
                 if (src_nullable_column->is_null(i)) {
-                    state.process_null(1);
+                    serialize_single_value(nullptr, dst_column);
                 } else {
-                    state.template process<false>(ctx->mem_pool(), src_column->get_data()[i], 1, false);
+                    serialize_single_value(&src_column->get_data()[i], dst_column);
                 }
-                serialize_state(state, dst_column);
             }
         } else {
             auto* src_column = down_cast<InputColumnType*>(src[0].get());
 
-            ApproxTopKState<LT> state;
             for (auto& value : src_column->get_data()) {
-                state.reset(kv.first, kv.second);
-                state.template process<false>(ctx->mem_pool(), value, 1, false);
-                serialize_state(state, dst_column);
+                serialize_single_value(&value, dst_column);
+            }
+        }
+    }
+
+    // Same format as serialize_state() for a state that has seen a single row, <value> is nullptr for a null row
+    void serialize_single_value(const CppType* value, BinaryColumn* dst) const {
+        Bytes& bytes = dst->get_bytes();
+
+        const int64_t null_count = value == nullptr ? 1 : 0;
+        const int32_t effective_counter_num = value == nullptr ? 0 : 1;
+        size_t total_size = sizeof(int64_t) + sizeof(int32_t);
+        if (value != nullptr) {
+            if constexpr (IsSlice<CppType>) {
+                total_size += sizeof(int64_t) + value->get_size();
+            } else {
+                total_size += sizeof(CppType);
             }
+            total_size += sizeof(int64_t);
         }
+
+        size_t start = bytes.size();
+        const size_t new_size = start + total_size;
+        bytes.resize(new_size);
+        std::memcpy(bytes.data() + start, &null_count, sizeof(int64_t));
+        start += sizeof(int64_t);
+        std::memcpy(bytes.data() + start, &effective_counter_num, sizeof(int32_t));
+        start += sizeof(int32_t);
+        if (value != nullptr) {
+            if constexpr (IsSlice<CppType>) {
+                int64_t slice_size = value->get_size();
+                std::memcpy(bytes.data() + start, &slice_size, sizeof(int64_t));
+                start += sizeof(int64_t);
+                std::memcpy(bytes.data() + start, value->get_data(), slice_size);
+                start += slice_size;
+            } else {
+                std::memcpy(bytes.data() + start, value, sizeof(CppType));
+                start += sizeof(CppType);
+            }
+            const int64_t count = 1;
+            std::memcpy(bytes.data() + start, &count, sizeof(int64_t));
+        }
+        dst->get_offset().emplace_back(new_size);
     }
 
     void serialize_state(const ApproxTopKState<LT>& state, BinaryColumn* dst) const {
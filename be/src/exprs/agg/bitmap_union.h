@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "column/object_column.h"
 #include "column/vectorized_fwd.h"
 #include "exprs/agg/aggregate.h"
@@ -36,9 +38,21 @@ public:
         this->data(state) |= *(col->get_object(row_num));
     }
 
+    void update_batch_single_state(FunctionContext* ctx, size_t chunk_size, const Column** columns,
+                                   AggDataPtr __restrict state) const override {
+        _union_range(down_cast<const BitmapColumn*>(columns[0]), 0, chunk_size, state);
+    }
+
+    void merge_batch_single_state(FunctionContext* ctx, AggDataPtr __restrict state, const Column* column,
+                                  size_t start, size_t size) const override {
+        _union_range(down_cast<const BitmapColumn*>(column), start, size, state);
+    }
+
     void serialize_to_column(FunctionContext* ctx, ConstAggDataPtr __restrict state, Column* to) const override {
         auto* col = down_cast<BitmapColumn*>(to);
         auto& bitmap = const_cast<BitmapValue&>(this->data(state));
+        // The serialized bitmaps are sent to other nodes, run containers usually make them much smaller.
+        bitmap.run_optimize();
         col->append(std::move(bitmap));
     }
 
@@ -54,6 +68,15 @@ public:
     }
 
     std::string get_name() const override { return "bitmap_union"; }
+
+private:
+    void _union_range(const BitmapColumn* col, size_t start, size_t size, AggDataPtr __restrict state) const {
+        std::vector<const BitmapValue*> values(size);
+        for (size_t i = 0; i < size; i++) {
+            values[i] = col->get_object(start + i);
+        }
+        this->data(state).union_many(values.data(), size);
+    }
 };
 
 } // namespace starrocks
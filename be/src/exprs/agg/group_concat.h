@@ -26,6 +26,7 @@
 #include "exprs/function_context.h"
 #include "gutil/casts.h"
 #include "runtime/runtime_state.h"
+#include "util/unaligned_access.h"
 #include "util/utf8.h"
 
 namespace starrocks {
@@ -150,9 +151,30 @@ public:
     }
 
     void merge(FunctionContext* ctx, const Column* column, AggDataPtr __restrict state, size_t row_num) const override {
-        Slice slice = column->get(row_num).get_slice();
-        char* data = slice.data;
-        uint32_t size_value = *reinterpret_cast<uint32_t*>(data);
+        merge_slice(column->get(row_num).get_slice(), state);
+    }
+
+    void merge_batch_single_state(FunctionContext* ctx, AggDataPtr __restrict state, const Column* column,
+                                  size_t start, size_t size) const override {
+        if (size == 0 || !column->is_binary()) {
+            for (size_t i = start; i < start + size; ++i) {
+                merge(ctx, column, state, i);
+            }
+            return;
+        }
+        const auto* binary_column = down_cast<const BinaryColumn*>(column);
+        // the serialized values are never shorter than what they add to the state, grow the string only once
+        const auto& offsets = binary_column->get_offset();
+        this->data(state).intermediate_string.reserve(this->data(state).intermediate_string.size() +
+                                                      offsets[start + size] - offsets[start]);
+        for (size_t i = start; i < start + size; ++i) {
+            merge_slice(binary_column->get_slice(i), state);
+        }
+    }
+
+    void merge_slice(const Slice& slice, AggDataPtr __restrict state) const {
+        const char* data = slice.data;
+        uint32_t size_value = unaligned_load<uint32_t>(data);
         data += sizeof(uint32_t);
 
         if (!this->data(state).initial) {
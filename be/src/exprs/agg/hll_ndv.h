@@ -57,32 +57,15 @@ public:
         }
     }
 
+    void update_batch_single_state(FunctionContext* ctx, size_t chunk_size, const Column** columns,
+                                   AggDataPtr __restrict state) const override {
+        _update_range(this->data(state), columns[0], 0, chunk_size);
+    }
+
     void update_batch_single_state_with_frame(FunctionContext* ctx, AggDataPtr __restrict state, const Column** columns,
                                               int64_t peer_group_start, int64_t peer_group_end, int64_t frame_start,
                                               int64_t frame_end) const override {
-        const auto* column = down_cast<const ColumnType*>(columns[0]);
-
-        if constexpr (lt_is_string<LT>) {
-            uint64_t value = 0;
-            for (size_t i = frame_start; i < frame_end; ++i) {
-                Slice s = column->get_slice(i);
-                value = HashUtil::murmur_hash64A(s.data, s.size, HashUtil::MURMUR_SEED);
-
-                if (value != 0) {
-                    this->data(state).update(value);
-                }
-            }
-        } else {
-            uint64_t value = 0;
-            const auto& v = column->get_data();
-            for (size_t i = frame_start; i < frame_end; ++i) {
-                value = HashUtil::murmur_hash64A(&v[i], sizeof(v[i]), HashUtil::MURMUR_SEED);
-
-                if (value != 0) {
-                    this->data(state).update(value);
-                }
-            }
-        }
+        _update_range(this->data(state), columns[0], frame_start, frame_end);
     }
 
     void merge(FunctionContext* ctx, const Column* column, AggDataPtr __restrict state, size_t row_num) const override {
@@ -171,6 +154,29 @@ public:
             return "ndv";
         }
     }
+
+private:
+    // Hash the rows in batches, and add the hashes to the HLL together.
+    static void _update_range(HyperLogLog& hll, const Column* input, size_t start, size_t end) {
+        static constexpr size_t kBatchSize = 256;
+        const auto* column = down_cast<const ColumnType*>(input);
+        uint64_t hash_values[kBatchSize];
+        for (size_t batch_start = start; batch_start < end; batch_start += kBatchSize) {
+            const size_t batch_end = std::min(batch_start + kBatchSize, end);
+            if constexpr (lt_is_string<LT>) {
+                for (size_t i = batch_start; i < batch_end; ++i) {
+                    Slice s = column->get_slice(i);
+                    hash_values[i - batch_start] = HashUtil::murmur_hash64A(s.data, s.size, HashUtil::MURMUR_SEED);
+                }
+            } else {
+                const auto& v = column->get_data();
+                for (size_t i = batch_start; i < batch_end; ++i) {
+                    hash_values[i - batch_start] = HashUtil::murmur_hash64A(&v[i], sizeof(v[i]), HashUtil::MURMUR_SEED);
+                }
+            }
+            hll.update_batch(hash_values, batch_end - batch_start);
+        }
+    }
 };
 
 } // namespace starrocks
@@ -17,7 +17,10 @@
 #include <limits>
 #include <type_traits>
 
+#include "column/binary_column.h"
+#include "column/column_helper.h"
 #include "column/fixed_length_column.h"
+#include "column/nullable_column.h"
 #include "column/type_traits.h"
 #include "exprs/agg/aggregate.h"
 #include "exprs/agg/aggregate_traits.h"
@@ -133,6 +136,40 @@ struct MinElement<LT, State, StringLTGuard<LT>> {
     }
 };
 
+// Sliding frame evaluation of max/min for "rows between n preceding and m following".
+// The extremum can not be retracted from the state, so the whole frame is re-evaluated only if the row leaving
+// the frame may hold the current extremum, otherwise the row entering the frame is simply merged into the state.
+// `column` may be nullable, null rows are skipped during re-evaluation.
+template <class OP, typename State, typename ValueAt>
+void update_max_min_state_removable_cumulatively(State& state, const Column* column, const ValueAt& value_at,
+                                                 int64_t current_row_position, int64_t partition_start,
+                                                 int64_t partition_end, int64_t rows_start_offset,
+                                                 int64_t rows_end_offset, bool ignore_subtraction,
+                                                 bool ignore_addition) {
+    const uint8_t* null_data = nullptr;
+    if (column->is_nullable()) {
+        null_data = down_cast<const NullableColumn*>(column)->null_column()->raw_data();
+    }
+    const int64_t previous_frame_first_position = current_row_position - 1 + rows_start_offset;
+    const int64_t current_frame_last_position = current_row_position + rows_end_offset;
+    if (!ignore_subtraction && previous_frame_first_position >= partition_start &&
+        previous_frame_first_position < partition_end && OP::is_sync(state, value_at(previous_frame_first_position))) {
+        const int64_t frame_start = std::max(current_row_position + rows_start_offset, partition_start);
+        const int64_t frame_end = std::min(current_frame_last_position + 1, partition_end);
+        state.reset();
+        for (int64_t i = frame_start; i < frame_end; ++i) {
+            if (null_data == nullptr || null_data[i] == 0) {
+                OP()(state, value_at(i));
+            }
+        }
+        return;
+    }
+    if (!ignore_addition && current_frame_last_position >= partition_start &&
+        current_frame_last_position < partition_end) {
+        OP()(state, value_at(current_frame_last_position));
+    }
+}
+
 template <LogicalType LT, typename State, class OP, typename T = RunTimeCppType<LT>, typename = guard::Guard>
 class MaxMinAggregateFunction final
         : public AggregateFunctionBatchHelper<State, MaxMinAggregateFunction<LT, State, OP, T>> {
@@ -159,6 +196,21 @@ public:
         }
     }
 
+    bool is_removable_by_reevaluation() const override { return !lt_is_json<LT>; }
+
+    void update_state_removable_cumulatively(FunctionContext* ctx, AggDataPtr __restrict state, const Column** columns,
+                                             int64_t current_row_position, int64_t partition_start,
+                                             int64_t partition_end, int64_t rows_start_offset, int64_t rows_end_offset,
+                                             bool ignore_subtraction, bool ignore_addition) const override {
+        if constexpr (!lt_is_json<LT>) {
+            const auto& data = down_cast<const InputColumnType*>(ColumnHelper::get_data_column(columns[0]))->get_data();
+            update_max_min_state_removable_cumulatively<OP>(
+                    this->data(state), columns[0], [&](int64_t i) { return data[i]; }, current_row_position,
+                    partition_start, partition_end, rows_start_offset, rows_end_offset, ignore_subtraction,
+                    ignore_addition);
+        }
+    }
+
     void merge(FunctionContext* ctx, const Column* column, AggDataPtr __restrict state, size_t row_num) const override {
         DCHECK(!column->is_nullable() && !column->is_binary());
         const auto* input_column = down_cast<const InputColumnType*>(column);
@@ -216,6 +268,19 @@ public:
         }
     }
 
+    bool is_removable_by_reevaluation() const override { return true; }
+
+    void update_state_removable_cumulatively(FunctionContext* ctx, AggDataPtr __restrict state, const Column** columns,
+                                             int64_t current_row_position, int64_t partition_start,
+                                             int64_t partition_end, int64_t rows_start_offset, int64_t rows_end_offset,
+                                             bool ignore_subtraction, bool ignore_addition) const override {
+        const auto* data_column = down_cast<const BinaryColumn*>(ColumnHelper::get_data_column(columns[0]));
+        update_max_min_state_removable_cumulatively<OP>(
+                this->data(state), columns[0], [&](int64_t i) { return data_column->get_slice(i); },
+                current_row_position, partition_start, partition_end, rows_start_offset, rows_end_offset,
+                ignore_subtraction, ignore_addition);
+    }
+
     void merge(FunctionContext* ctx, const Column* column, AggDataPtr __restrict state, size_t row_num) const override {
         DCHECK(column->is_binary());
         Slice value = column->get(row_num).get_slice();
@@ -252,6 +252,8 @@ public:
         return nested_function->agg_state_table_kind(is_append_only);
     }
 
+    bool is_removable_by_reevaluation() const override { return nested_function->is_removable_by_reevaluation(); }
+
 protected:
     NestedAggregateFunctionPtr nested_function;
 };
@@ -288,6 +290,13 @@ public:
     // TODO(kks): abstract the AVX2 filter process later
     void update_batch(FunctionContext* ctx, size_t chunk_size, size_t state_offset, const Column** columns,
                       AggDataPtr* states) const override {
+        if (chunk_size == 0) {
+            return;
+        }
+        // The nested state lives at a fixed offset of State, so the nested function can update the whole batch
+        // in one call instead of a virtual call per row.
+        const size_t nested_state_offset = this->data(states[0] + state_offset).mutable_nest_state() - states[0];
+
         // Scalar function compute will return non-nullable column
         // for nullable column when the real whole chunk data all not-null.
         if (columns[0]->is_nullable()) {
@@ -300,9 +309,19 @@ public:
             if (!columns[0]->has_null()) {
                 for (size_t i = 0; i < chunk_size; i++) {
                     this->data(states[i] + state_offset).is_null = false;
-                    this->nested_function->update(ctx, &data_column,
-                                                  this->data(states[i] + state_offset).mutable_nest_state(), i);
                 }
+                this->nested_function->update_batch(ctx, chunk_size, nested_state_offset, &data_column, states);
+                return;
+            }
+
+            if constexpr (IgnoreNull) {
+                // The null column is exactly the selection of rows the nested function should skip.
+                for (size_t i = 0; i < chunk_size; i++) {
+                    auto& is_null = this->data(states[i] + state_offset).is_null;
+                    is_null = is_null & f_data[i];
+                }
+                this->nested_function->update_batch_selectively(ctx, chunk_size, nested_state_offset, &data_column,
+                                                                states, column->immutable_null_column_data());
                 return;
             }
 
@@ -359,9 +378,8 @@ public:
         } else {
             for (size_t i = 0; i < chunk_size; ++i) {
                 this->data(states[i] + state_offset).is_null = false;
-                this->nested_function->update(ctx, columns, this->data(states[i] + state_offset).mutable_nest_state(),
-                                              i);
             }
+            this->nested_function->update_batch(ctx, chunk_size, nested_state_offset, columns, states);
         }
     }
 
@@ -638,8 +656,11 @@ public:
                         is_current_frame_end_null = true;
                         this->data(state).null_count++;
                     }
+                    // Functions re-evaluating the frame need the null flags to skip null rows.
+                    const Column* nested_column =
+                            this->nested_function->is_removable_by_reevaluation() ? columns[0] : data_column;
                     this->nested_function->update_state_removable_cumulatively(
-                            ctx, this->data(state).mutable_nest_state(), &data_column, current_row_position,
+                            ctx, this->data(state).mutable_nest_state(), &nested_column, current_row_position,
                             partition_start, partition_end, rows_start_offset, rows_end_offset,
                             is_previous_frame_start_null, is_current_frame_end_null);
                     if (frame_size != this->data(state).null_count) {
@@ -80,6 +80,60 @@ public:
         data(state).is_null = false;
     }
 
+    void update_batch_single_state(FunctionContext* ctx, size_t chunk_size, const Column** columns,
+                                   AggDataPtr __restrict state) const override {
+        if (chunk_size == 0) {
+            return;
+        }
+        if (columns[0]->is_nullable()) {
+            for (size_t i = 0; i < chunk_size; ++i) {
+                update(ctx, columns, state, i);
+            }
+            return;
+        }
+
+        DCHECK(!columns[1]->only_null());
+        DCHECK(!columns[1]->is_null(0));
+
+        const auto* input = down_cast<const DoubleColumn*>(columns[0]);
+        data(state).percentile->add_batch(input->get_data().data(), chunk_size);
+        data(state).targetQuantile = columns[1]->get(0).get_double();
+        data(state).is_null = false;
+    }
+
+    void merge_batch_single_state(FunctionContext* ctx, AggDataPtr __restrict state, const Column* column,
+                                  size_t start, size_t size) const override {
+        // Deserialized digests are merged kMergeBatchSize at a time to bound the memory of the batch
+        static constexpr size_t kMergeBatchSize = 64;
+        std::vector<PercentileValue> srcs;
+        srcs.reserve(std::min(size, kMergeBatchSize));
+        std::vector<const PercentileValue*> src_ptrs;
+        src_ptrs.reserve(std::min(size, kMergeBatchSize));
+
+        const auto* nullable_column = column->is_nullable() ? down_cast<const NullableColumn*>(column) : nullptr;
+        const auto* binary_column = down_cast<const BinaryColumn*>(
+                nullable_column != nullptr ? nullable_column->data_column().get() : column);
+        for (size_t i = start; i < start + size; ++i) {
+            if (nullable_column != nullptr && nullable_column->is_null(i)) {
+                continue;
+            }
+            Slice src = binary_column->get_slice(i);
+            double quantile;
+            memcpy(&quantile, src.data, sizeof(double));
+            data(state).targetQuantile = quantile;
+            data(state).is_null = false;
+
+            srcs.emplace_back();
+            srcs.back().deserialize((char*)src.data + sizeof(double));
+            if (srcs.size() == kMergeBatchSize) {
+                _merge_percentiles(srcs, src_ptrs, state);
+            }
+        }
+        if (!srcs.empty()) {
+            _merge_percentiles(srcs, src_ptrs, state);
+        }
+    }
+
     void serialize_to_column(FunctionContext* ctx, ConstAggDataPtr __restrict state, Column* to) const override {
         size_t size = data(state).percentile->serialize_size();
         uint8_t result[size + sizeof(double)];
@@ -178,5 +232,16 @@ public:
     }
 
     std::string get_name() const override { return "percentile_approx"; }
+
+private:
+    void _merge_percentiles(std::vector<PercentileValue>& srcs, std::vector<const PercentileValue*>& src_ptrs,
+                            AggDataPtr __restrict state) const {
+        src_ptrs.clear();
+        for (const auto& src : srcs) {
+            src_ptrs.push_back(&src);
+        }
+        data(state).percentile->merge(src_ptrs);
+        srcs.clear();
+    }
 };
 } // namespace starrocks
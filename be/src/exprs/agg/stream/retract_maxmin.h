@@ -202,8 +202,11 @@ public:
         T value = get_row_value(columns[0], row_num);
         this->data(state).update_rows(value, -1);
 
-        // reset state to restore from detail
-        if (!this->data(state).is_sync() && OP::is_sync(this->data(state), value)) {
+        // reset state to restore from detail. If this epoch still holds a positive net count of the
+        // retracted value, the value survives in the full detail state and the result is unchanged,
+        // so the detail table rescan can be skipped.
+        if (!this->data(state).is_sync() && OP::is_sync(this->data(state), value) &&
+            this->data(state).count(value) <= 0) {
             this->data(state).set_is_sync(true);
             this->data(state).reset_result();
         }
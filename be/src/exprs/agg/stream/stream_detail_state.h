@@ -71,6 +71,12 @@ public:
         return _detail_state.find(value) != _detail_state.end();
     }
 
+    // Net count of `v` accumulated in this epoch, which may be negative if only retracts were seen.
+    int64_t count(const CppType& v) {
+        auto iter = _detail_state.find(_convert_to_key_type(v));
+        return iter == _detail_state.end() ? 0 : iter->second;
+    }
+
     const StateHashMap& detail_state() const { return _detail_state; }
     const bool is_sync() const { return _is_sync; }
     void set_is_sync(bool sync) { this->_is_sync = sync; }
@@ -145,21 +145,23 @@ struct WindowFunnelState {
             return;
         }
 
-        std::vector<TimestampEvent> other_list;
-
         events_size = (uint8_t)array[0];
         bool other_sorted = (uint8_t)array[1];
 
+        const auto size = events_list.size();
+
+        // append the other events in place, there is no need to stage them in a temporary list
+        events_list.reserve(size + (length - 2) / 2);
         for (size_t i = 2; i < length - 1; i += 2) {
             TimestampType timestamp = array[i];
             int64_t event_level = array[i + 1];
-            other_list.emplace_back(std::make_pair(timestamp, uint8_t(event_level)));
+            events_list.emplace_back(timestamp, uint8_t(event_level));
         }
 
-        const auto size = events_list.size();
-
-        events_list.insert(std::end(events_list), std::begin(other_list), std::end(other_list));
-        if (!sorted && !other_sorted)
+        if (size == 0) {
+            // nothing to merge with, keep the order of the other list
+            if (!other_sorted) std::stable_sort(std::begin(events_list), std::end(events_list), ComparePairFirst{});
+        } else if (!sorted && !other_sorted)
             std::sort(std::begin(events_list), std::end(events_list), ComparePairFirst{});
         else {
             const auto begin = std::begin(events_list);
@@ -550,6 +552,18 @@ public:
 
         const auto timestamp_column = down_cast<const TimeTypeColumn*>(src[1].get());
         const auto* bool_array_column = down_cast<const ArrayColumn*>(src[3].get());
+        const auto& array_offsets = bool_array_column->offsets().get_data();
+        const Column& elements = bool_array_column->elements();
+        const uint8_t* element_nulls = nullptr;
+        const uint8_t* element_data = nullptr;
+        if (elements.is_nullable()) {
+            const auto& nullable_elements = down_cast<const NullableColumn&>(elements);
+            element_nulls = nullable_elements.null_column()->get_data().data();
+            element_data = down_cast<const BooleanColumn*>(nullable_elements.data_column().get())->get_data().data();
+        } else {
+            element_data = down_cast<const BooleanColumn&>(elements).get_data().data();
+        }
+
         for (int i = 0; i < chunk_size; i++) {
             TimestampType tv;
             if constexpr (LT == TYPE_DATETIME) {
@@ -560,18 +574,19 @@ public:
                 tv = timestamp_column->get_data()[i];
             }
 
-            // get 4th value: event cond array
-            auto ele_vector = bool_array_column->get(i).get_array();
+            // get 4th value: event cond array, read from the elements directly instead of building datums
+            const size_t offset = array_offsets[i];
+            const size_t events_size = array_offsets[i + 1] - offset;
             uint8_t event_level = 0;
-            for (uint8_t j = 0; j < ele_vector.size(); j++) {
-                if (!ele_vector[j].is_null() && ele_vector[j].get_uint8() > 0) {
+            for (uint8_t j = 0; j < events_size; j++) {
+                if ((element_nulls == nullptr || !element_nulls[offset + j]) && element_data[offset + j] > 0) {
                     event_level = j + 1;
                     break;
                 }
             }
 
-            size_t events_size = ele_vector.size();
-            bool sorted = false;
+            // a single event is always sorted
+            bool sorted = true;
             int64_t buffer[4];
             buffer[0] = (int64_t)events_size;
             buffer[1] = (int64_t)sorted;
@@ -113,6 +113,7 @@ StatusOr<ColumnPtr> ArrayMapExpr::evaluate_checked(ExprContext* context, Chunk*
         // put captured columns into the new chunk aligning with the first array's offsets
         std::vector<SlotId> slot_ids;
         _children[0]->get_slot_ids(&slot_ids);
+        Columns captured_columns;
         for (auto id : slot_ids) {
             DCHECK(id > 0);
             auto captured = chunk->get_column_by_slot_id(id);
@@ -120,23 +121,49 @@ StatusOr<ColumnPtr> ArrayMapExpr::evaluate_checked(ExprContext* context, Chunk*
                 return Status::InternalError(fmt::format(
                         "The size of the captured column {} is less than array's size.", captured->get_name()));
             }
-            cur_chunk->append_column(captured->replicate(input_array->offsets_column()->get_data()), id);
+            captured_columns.emplace_back(std::move(captured));
         }
-        if (cur_chunk->num_rows() <= chunk->num_rows() * 8) {
+        const auto& offsets = input_array->offsets_column()->get_data();
+        if (input_array->elements_column()->size() <= chunk->num_rows() * 8) {
+            for (size_t i = 0; i < slot_ids.size(); ++i) {
+                cur_chunk->append_column(captured_columns[i]->replicate(offsets), slot_ids[i]);
+            }
             ASSIGN_OR_RETURN(column, context->evaluate(_children[0], cur_chunk.get()));
             column = ColumnHelper::align_return_type(column, type().children[0], cur_chunk->num_rows(), true);
-        } else { // split large chunks into small ones to avoid too large or various batch_size
-            ChunkAccumulator accumulator(DEFAULT_CHUNK_SIZE);
-            RETURN_IF_ERROR(accumulator.push(std::move(cur_chunk)));
-            accumulator.finalize();
-            while (auto tmp_chunk = accumulator.pull()) {
+        } else {
+            // split large arrays into batches of about DEFAULT_CHUNK_SIZE elements, the captured columns are
+            // replicated per batch rather than all at once, to avoid too large or various batch_size.
+            constexpr size_t kBatchSize = DEFAULT_CHUNK_SIZE;
+            size_t num_rows = input_array->size();
+            size_t row = 0;
+            while (row < num_rows) {
+                size_t end_row = row + 1;
+                while (end_row < num_rows && offsets[end_row + 1] - offsets[row] <= kBatchSize) {
+                    ++end_row;
+                }
+                const size_t from = offsets[row];
+                const size_t count = offsets[end_row] - from;
+                auto tmp_chunk = std::make_shared<Chunk>();
+                for (int i = 0; i < argument_num; ++i) {
+                    auto elements = input_elements[i]->clone_empty();
+                    elements->append(*input_elements[i], from, count);
+                    tmp_chunk->append_column(std::move(elements), arguments_ids[i]);
+                }
+                for (size_t i = 0; i < slot_ids.size(); ++i) {
+                    auto replicated = captured_columns[i]->clone_empty();
+                    for (size_t r = row; r < end_row; ++r) {
+                        replicated->append_value_multiple_times(*captured_columns[i], r, offsets[r + 1] - offsets[r]);
+                    }
+                    tmp_chunk->append_column(std::move(replicated), slot_ids[i]);
+                }
                 ASSIGN_OR_RETURN(auto tmp_col, context->evaluate(_children[0], tmp_chunk.get()));
-                tmp_col = ColumnHelper::align_return_type(tmp_col, type().children[0], tmp_chunk->num_rows(), true);
+                tmp_col = ColumnHelper::align_return_type(tmp_col, type().children[0], count, true);
                 if (column == nullptr) {
                     column = tmp_col;
                 } else {
                     column->append(*tmp_col);
                 }
+                row = end_row;
             }
         }
 
@@ -14,9 +14,16 @@
 
 #include "exprs/compound_predicate.h"
 
+#include <map>
+
+#include "common/config.h"
 #include "common/object_pool.h"
 #include "exprs/binary_function.h"
+#include "exprs/column_ref.h"
+#include "exprs/function_call_expr.h"
 #include "exprs/jit/ir_helper.h"
+#include "exprs/like_predicate.h"
+#include "exprs/literal.h"
 #include "exprs/predicate.h"
 #include "exprs/unary_function.h"
 #include "runtime/runtime_state.h"
@@ -123,7 +130,17 @@ DEFINE_BINARY_FUNCTION_WITH_IMPL(OrImpl, l_value, r_value) {
 class VectorizedOrCompoundPredicate final : public Predicate {
 public:
     DEFINE_COMPOUND_CONSTRUCT(VectorizedOrCompoundPredicate);
+
+    Status prepare(RuntimeState* state, ExprContext* context) override {
+        RETURN_IF_ERROR(Expr::prepare(state, context));
+        return _prepare_multi_pattern_match(context);
+    }
+
     StatusOr<ColumnPtr> evaluate_checked(ExprContext* context, Chunk* ptr) override {
+        if (_multi_pattern_match != nullptr) {
+            return _evaluate_multi_pattern_match(context, ptr);
+        }
+
         ASSIGN_OR_RETURN(auto l, _children[0]->evaluate_checked(context, ptr));
 
         int l_trues = ColumnHelper::count_true_with_notnull(l);
@@ -181,6 +198,125 @@ public:
             << ", rhs_is_constant=" << _children[1]->is_constant() << ", expr (" << expr_debug_string << ") )";
         return out.str();
     }
+
+private:
+    // OR-ed constant LIKE/REGEXP predicates on the same column, matched by one multi-pattern hyperscan database.
+    struct MultiPatternGroup {
+        Expr* column;
+        std::vector<std::string> patterns;
+        std::vector<bool> is_like;
+        std::shared_ptr<LikePredicate::MultiPatternMatcher> matcher;
+    };
+
+    struct MultiPatternMatch {
+        std::vector<MultiPatternGroup> groups;
+        // The disjuncts not covered by any group, evaluated one by one.
+        std::vector<Expr*> others;
+    };
+
+    // 60010 is like and 60020 is regexp, see gensrc/script/functions.py
+    static bool _is_like_or_regexp(const Expr* expr) {
+        return dynamic_cast<const VectorizedFunctionCallExpr*>(expr) != nullptr &&
+               (expr->fn().fid == 60010 || expr->fn().fid == 60020) && expr->get_num_children() == 2;
+    }
+
+    static void _collect_disjuncts(Expr* expr, std::vector<Expr*>* disjuncts) {
+        if (auto* pred = dynamic_cast<VectorizedOrCompoundPredicate*>(expr); pred != nullptr) {
+            // The nested predicates are never evaluated on their own, the outermost one takes over.
+            pred->_multi_pattern_match.reset();
+            _collect_disjuncts(pred->_children[0], disjuncts);
+            _collect_disjuncts(pred->_children[1], disjuncts);
+        } else {
+            disjuncts->emplace_back(expr);
+        }
+    }
+
+    Status _prepare_multi_pattern_match(ExprContext* context) {
+        if (config::like_multi_pattern_min_num <= 1) {
+            return Status::OK();
+        }
+
+        std::vector<Expr*> disjuncts;
+        _collect_disjuncts(_children[0], &disjuncts);
+        _collect_disjuncts(_children[1], &disjuncts);
+
+        std::map<SlotId, MultiPatternGroup> slot_groups;
+        std::vector<Expr*> others;
+        for (Expr* disjunct : disjuncts) {
+            Expr* column = _is_like_or_regexp(disjunct) ? disjunct->get_child(0) : nullptr;
+            Expr* pattern = column != nullptr ? disjunct->get_child(1) : nullptr;
+            if (column == nullptr || !column->is_slotref() || dynamic_cast<VectorizedLiteral*>(pattern) == nullptr) {
+                others.emplace_back(disjunct);
+                continue;
+            }
+            ASSIGN_OR_RETURN(auto pattern_column, pattern->evaluate_checked(context, nullptr));
+            if (pattern_column->only_null()) {
+                others.emplace_back(disjunct);
+                continue;
+            }
+            auto& group = slot_groups[down_cast<ColumnRef*>(column)->slot_id()];
+            group.column = column;
+            group.patterns.emplace_back(ColumnHelper::get_const_value<TYPE_VARCHAR>(pattern_column).to_string());
+            group.is_like.emplace_back(disjunct->fn().fid == 60010);
+        }
+
+        auto match = std::make_shared<MultiPatternMatch>();
+        for (auto& [slot_id, group] : slot_groups) {
+            if (group.patterns.size() >= static_cast<size_t>(config::like_multi_pattern_min_num)) {
+                group.matcher = std::make_shared<LikePredicate::MultiPatternMatcher>();
+                auto st = group.matcher->init(group.patterns, group.is_like);
+                if (st.ok()) {
+                    match->groups.emplace_back(std::move(group));
+                    continue;
+                }
+                LOG(WARNING) << "fallback to match patterns one by one: " << st;
+            }
+            // Keep the predicates out of a group in their original form.
+            for (Expr* disjunct : disjuncts) {
+                if (_is_like_or_regexp(disjunct) && disjunct->get_child(0) == group.column) {
+                    others.emplace_back(disjunct);
+                }
+            }
+        }
+        if (match->groups.empty()) {
+            return Status::OK();
+        }
+        match->others = std::move(others);
+        _multi_pattern_match = std::move(match);
+        return Status::OK();
+    }
+
+    StatusOr<ColumnPtr> _evaluate_multi_pattern_match(ExprContext* context, Chunk* ptr) {
+        ColumnPtr result;
+        auto merge = [&](ColumnPtr column) {
+            if (result == nullptr) {
+                result = std::move(column);
+            } else {
+                result = VectorizedLogicPredicateBinaryFunction<OrNullImpl, OrImpl>::template evaluate<TYPE_BOOLEAN>(
+                        result, column);
+            }
+            // all true and not null
+            return ColumnHelper::count_true_with_notnull(result) == result->size();
+        };
+
+        for (const auto& group : _multi_pattern_match->groups) {
+            ASSIGN_OR_RETURN(auto value, group.column->evaluate_checked(context, ptr));
+            ASSIGN_OR_RETURN(auto matched, group.matcher->match(value));
+            if (merge(std::move(matched))) {
+                return result;
+            }
+        }
+        for (Expr* expr : _multi_pattern_match->others) {
+            ASSIGN_OR_RETURN(auto column, expr->evaluate_checked(context, ptr));
+            if (merge(std::move(column))) {
+                return result;
+            }
+        }
+        return result;
+    }
+
+    // Shared by the clones since it's immutable after prepare.
+    std::shared_ptr<MultiPatternMatch> _multi_pattern_match;
 };
 
 DEFINE_UNARY_FN_WITH_IMPL(CompoundPredNot, l) {
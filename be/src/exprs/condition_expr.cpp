@@ -23,7 +23,9 @@
 #include "column/type_traits.h"
 #include "column/vectorized_fwd.h"
 #include "common/object_pool.h"
+#include "exprs/jit/ir_helper.h"
 #include "gutil/casts.h"
+#include "runtime/runtime_state.h"
 #include "runtime/types.h"
 #include "simd/selector.h"
 #include "types/logical_type.h"
@@ -76,6 +78,26 @@ class VectorizedIfNullExpr : public Expr {
 public:
     DEFINE_CLASS_CONSTRUCT_FN(VectorizedIfNullExpr);
 
+    bool is_compilable(RuntimeState* state) const override {
+        return state->can_jit_expr(CompilableExprType::CASE) && IRHelper::support_jit(Type);
+    }
+
+    StatusOr<LLVMDatum> generate_ir_impl(ExprContext* context, JITContext* jit_ctx) override {
+        ASSIGN_OR_RETURN(LLVMDatum lhs, _children[0]->generate_ir(context, jit_ctx))
+        ASSIGN_OR_RETURN(LLVMDatum rhs, _children[1]->generate_ir(context, jit_ctx))
+        auto& b = jit_ctx->builder;
+        auto* lhs_is_null = IRHelper::bool_to_cond(b, lhs.null_flag);
+        LLVMDatum result(b);
+        result.value = b.CreateSelect(lhs_is_null, rhs.value, lhs.value);
+        result.null_flag = b.CreateSelect(lhs_is_null, rhs.null_flag, b.getInt8(0));
+        return result;
+    }
+
+    std::string jit_func_name_impl(RuntimeState* state) const override {
+        return "{ifnull(" + _children[0]->jit_func_name(state) + ", " + _children[1]->jit_func_name(state) + ")}" +
+               (is_constant() ? "c:" : "") + (is_nullable() ? "n:" : "") + type().debug_string();
+    }
+
     StatusOr<ColumnPtr> evaluate_checked(ExprContext* context, Chunk* ptr) override {
         ASSIGN_OR_RETURN(auto lhs, _children[0]->evaluate_checked(context, ptr));
 
@@ -221,6 +243,31 @@ class VectorizedIfExpr : public Expr {
 public:
     DEFINE_CLASS_CONSTRUCT_FN(VectorizedIfExpr);
 
+    bool is_compilable(RuntimeState* state) const override {
+        return state->can_jit_expr(CompilableExprType::CASE) && IRHelper::support_jit(Type);
+    }
+
+    // Both branches are compiled into the loop and selected per row, so there are no branches in the generated code.
+    StatusOr<LLVMDatum> generate_ir_impl(ExprContext* context, JITContext* jit_ctx) override {
+        ASSIGN_OR_RETURN(LLVMDatum cond, _children[0]->generate_ir(context, jit_ctx))
+        ASSIGN_OR_RETURN(LLVMDatum lhs, _children[1]->generate_ir(context, jit_ctx))
+        ASSIGN_OR_RETURN(LLVMDatum rhs, _children[2]->generate_ir(context, jit_ctx))
+        auto& b = jit_ctx->builder;
+        // a null condition is regarded as false
+        auto* is_true = b.CreateAnd(IRHelper::bool_to_cond(b, cond.value),
+                                    b.CreateICmpEQ(cond.null_flag, b.getInt8(0)));
+        LLVMDatum result(b);
+        result.value = b.CreateSelect(is_true, lhs.value, rhs.value);
+        result.null_flag = b.CreateSelect(is_true, lhs.null_flag, rhs.null_flag);
+        return result;
+    }
+
+    std::string jit_func_name_impl(RuntimeState* state) const override {
+        return "{if(" + _children[0]->jit_func_name(state) + ", " + _children[1]->jit_func_name(state) + ", " +
+               _children[2]->jit_func_name(state) + ")}" + (is_constant() ? "c:" : "") + (is_nullable() ? "n:" : "") +
+               type().debug_string();
+    }
+
     StatusOr<ColumnPtr> evaluate_checked(ExprContext* context, Chunk* ptr) override {
         ASSIGN_OR_RETURN(auto bhs, _children[0]->evaluate_checked(context, ptr));
         int true_count = ColumnHelper::count_true_with_notnull(bhs);
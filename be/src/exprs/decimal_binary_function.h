@@ -113,6 +113,26 @@ struct DecimalBinaryFunction {
         return false;
     }
 
+    // Whether all the decimal128 values fit in int64, so the product of any two of them can not overflow int128.
+    static inline bool fit_in_int64(const int128_t* data, size_t num_rows) {
+        bool fit = true;
+        for (size_t i = 0; i < num_rows; ++i) {
+            fit &= (data[i] == static_cast<int64_t>(data[i]));
+        }
+        return fit;
+    }
+
+    // Multiply decimal128 values fitting in int64 with 64x64->128 multiplies, without overflow checking.
+    template <bool lhs_is_const, bool rhs_is_const>
+    static inline void mul_int64_operands(size_t num_rows, const int128_t* lhs_data, const int128_t* rhs_data,
+                                          int128_t* result_data) {
+        for (size_t i = 0; i < num_rows; ++i) {
+            const auto l = static_cast<int64_t>(lhs_data[lhs_is_const ? 0 : i]);
+            const auto r = static_cast<int64_t>(rhs_data[rhs_is_const ? 0 : i]);
+            result_data[i] = static_cast<int128_t>(l) * r;
+        }
+    }
+
     template <bool lhs_is_const, bool rhs_is_const, LogicalType LhsType, LogicalType RhsType, LogicalType ResultType>
     static inline ColumnPtr evaluate(const ColumnPtr& lhs, const ColumnPtr& rhs) {
         using ResultCppType = RunTimeCppType<ResultType>;
@@ -175,8 +195,22 @@ struct DecimalBinaryFunction {
             }
         } else if constexpr (is_mul_op<Op>) {
             // mul operation, no need to adjust scale
-            all_null = adjust_evaluate<lhs_is_const, rhs_is_const, false, BinaryOperator>(
-                    num_rows, lhs_data, rhs_data, result_data, nulls, &has_null, adjust_scale);
+            if constexpr (check_overflow<overflow_mode> && std::is_same_v<RunTimeCppType<LhsType>, int128_t> &&
+                          std::is_same_v<RunTimeCppType<RhsType>, int128_t> &&
+                          std::is_same_v<ResultCppType, int128_t>) {
+                // the operands of decimal128 multiplications are usually far below their limit, skip the per row
+                // overflow checking when the values observed in this chunk make an overflow impossible.
+                if (fit_in_int64(lhs_data, lhs_is_const ? 1 : num_rows) &&
+                    fit_in_int64(rhs_data, rhs_is_const ? 1 : num_rows)) {
+                    mul_int64_operands<lhs_is_const, rhs_is_const>(num_rows, lhs_data, rhs_data, result_data);
+                } else {
+                    all_null = adjust_evaluate<lhs_is_const, rhs_is_const, false, BinaryOperator>(
+                            num_rows, lhs_data, rhs_data, result_data, nulls, &has_null, adjust_scale);
+                }
+            } else {
+                all_null = adjust_evaluate<lhs_is_const, rhs_is_const, false, BinaryOperator>(
+                        num_rows, lhs_data, rhs_data, result_data, nulls, &has_null, adjust_scale);
+            }
         } else if constexpr (is_div_op<Op>) {
             // div operation, scale lhs up by S(rhs)
             if (adjust_scale == 0) {
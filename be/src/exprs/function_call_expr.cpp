@@ -14,12 +14,17 @@
 
 #include "exprs/function_call_expr.h"
 
+#include <algorithm>
 #include <cstdint>
 
+#include "column/binary_column.h"
 #include "column/chunk.h"
+#include "column/column_hash.h"
 #include "column/column_helper.h"
 #include "column/const_column.h"
+#include "column/nullable_column.h"
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
 #include "exprs/anyval_util.h"
 #include "exprs/builtin_functions.h"
 #include "exprs/expr_context.h"
@@ -155,6 +160,97 @@ bool VectorizedFunctionCallExpr::is_constant() const {
     return Expr::is_constant();
 }
 
+// Low cardinality string columns without global dicts, e.g. from external tables, are common. When the only
+// non-constant argument is such a column, the function is evaluated on its distinct values only, and |codes|
+// maps every row to its distinct value.
+static bool dedup_string_argument(const Columns& args, Columns* distinct_args, Buffer<uint32_t>* codes) {
+    static constexpr size_t kMinRows = 256;
+    static constexpr size_t kProbeRows = 64;
+    const int ratio = config::function_call_distinct_string_ratio;
+    if (ratio <= 0) {
+        return false;
+    }
+
+    int string_arg = -1;
+    for (int i = 0; i < args.size(); ++i) {
+        if (args[i]->is_constant()) {
+            continue;
+        }
+        if (string_arg >= 0) {
+            return false;
+        }
+        string_arg = i;
+    }
+    if (string_arg < 0) {
+        return false;
+    }
+    const Column* column = args[string_arg].get();
+    if (column->is_nullable()) {
+        if (column->has_null()) {
+            return false;
+        }
+        column = down_cast<const NullableColumn*>(column)->data_column().get();
+    }
+    if (!column->is_binary() || column->size() < kMinRows) {
+        return false;
+    }
+
+    const auto* binary = down_cast<const BinaryColumn*>(column);
+    const size_t num_rows = binary->size();
+    phmap::flat_hash_map<Slice, uint32_t, SliceHash, SliceEqual> dict;
+    // probe the first rows to give up the high cardinality columns cheaply
+    for (size_t i = 0; i < kProbeRows; ++i) {
+        dict.emplace(binary->get_slice(i), 0);
+    }
+    if (dict.size() * ratio > kProbeRows) {
+        return false;
+    }
+
+    dict.clear();
+    const size_t max_distinct = num_rows / ratio;
+    auto distinct = BinaryColumn::create();
+    codes->resize(num_rows);
+    for (size_t i = 0; i < num_rows; ++i) {
+        Slice value = binary->get_slice(i);
+        auto [iter, inserted] = dict.emplace(value, dict.size());
+        if (inserted) {
+            if (dict.size() > max_distinct) {
+                return false;
+            }
+            distinct->append(value);
+        }
+        (*codes)[i] = iter->second;
+    }
+
+    const size_t num_distinct = distinct->size();
+    distinct_args->clear();
+    for (int i = 0; i < args.size(); ++i) {
+        if (i == string_arg) {
+            if (args[i]->is_nullable()) {
+                distinct_args->emplace_back(NullableColumn::create(distinct, NullColumn::create(num_distinct, 0)));
+            } else {
+                distinct_args->emplace_back(distinct);
+            }
+        } else {
+            ColumnPtr arg = args[i]->clone();
+            arg->resize(num_distinct);
+            distinct_args->emplace_back(std::move(arg));
+        }
+    }
+    return true;
+}
+
+static ColumnPtr expand_distinct_result(const ColumnPtr& distinct_result, const Buffer<uint32_t>& codes) {
+    if (distinct_result->is_constant()) {
+        ColumnPtr result = distinct_result->clone();
+        result->resize(codes.size());
+        return result;
+    }
+    ColumnPtr result = distinct_result->clone_empty();
+    result->append_selective(*distinct_result, codes);
+    return result;
+}
+
 StatusOr<ColumnPtr> VectorizedFunctionCallExpr::evaluate_checked(starrocks::ExprContext* context, Chunk* ptr) {
     FunctionContext* fn_ctx = context->fn_context(_fn_context_index);
 
@@ -183,14 +279,22 @@ StatusOr<ColumnPtr> VectorizedFunctionCallExpr::evaluate_checked(starrocks::Expr
     }
 #endif
 
+    Columns distinct_args;
+    Buffer<uint32_t> codes;
+    const bool on_distinct = !_is_returning_random_value && dedup_string_argument(args, &distinct_args, &codes);
+    const Columns& call_args = on_distinct ? distinct_args : args;
+
     StatusOr<ColumnPtr> result;
     if (_fn_desc->exception_safe) {
-        result = _fn_desc->scalar_function(fn_ctx, args);
+        result = _fn_desc->scalar_function(fn_ctx, call_args);
     } else {
         SCOPED_SET_CATCHED(false);
-        result = _fn_desc->scalar_function(fn_ctx, args);
+        result = _fn_desc->scalar_function(fn_ctx, call_args);
     }
     RETURN_IF_ERROR(result);
+    if (on_distinct) {
+        result = expand_distinct_result(result.value(), codes);
+    }
     if (_fn_desc->check_overflow) {
         std::string err_msg;
         if (UNLIKELY(result.value()->capacity_limit_reached(&err_msg))) {
@@ -215,10 +319,9 @@ bool VectorizedFunctionCallExpr::ngram_bloom_filter(ExprContext* context, const
     // initialize ngram_state: determine whether this index useful or not, split needle into ngram_set if useful
     if (ngram_state == nullptr) {
         ngram_state = std::make_unique<NgramBloomFilterState>();
-        std::vector<Slice>& ngram_set = ngram_state->ngram_set;
         bool index_useful;
         if (_fn_desc->name == "LIKE") {
-            index_useful = split_like_string_to_ngram(fn_ctx, reader_options, ngram_set);
+            index_useful = split_like_string_to_ngram(fn_ctx, reader_options, ngram_state.get());
         } else {
             index_useful = split_normal_string_to_ngram(fn_ctx, reader_options, ngram_state.get(), _fn_desc->name);
         }
@@ -327,7 +430,7 @@ bool VectorizedFunctionCallExpr::split_normal_string_to_ngram(FunctionContext* f
 
 bool VectorizedFunctionCallExpr::split_like_string_to_ngram(FunctionContext* fn_ctx,
                                                             const NgramBloomFilterReaderOptions& reader_options,
-                                                            std::vector<Slice>& ngram_set) const {
+                                                            NgramBloomFilterState* ngram_state) const {
     size_t index_gram_num = reader_options.index_gram_num;
     auto needle_column = fn_ctx->get_constant_column(1);
     if (needle_column == nullptr) {
@@ -336,41 +439,59 @@ bool VectorizedFunctionCallExpr::split_like_string_to_ngram(FunctionContext* fn_
 
     Slice needle = ColumnHelper::get_const_value<TYPE_VARCHAR>(needle_column);
 
+    // the ngrams are built from the literal characters of needle with escape characters removed,
+    // otherwise a pattern like 'a\_bc' would probe the bloom filter with ngrams never written into it.
+    std::string& buf = ngram_state->buffer;
+    buf.clear();
+    buf.reserve(needle.size);
+    // [begin, end) of each ngram in buf
+    std::vector<std::pair<size_t, size_t>> ngram_ranges;
+
     size_t cur_valid_grams_num = 0;
     size_t cur_grams_begin_index = 0;
     bool escaped = false;
 
-    // when iteration begin,[cur_grams_begin_index, i) is the current ngram
-    // cur_valid_grams_num is the number of utf-8 gram in slice[cur_grams_begin_index, i)
+    // cur_valid_grams_num is the number of utf-8 gram in buf[cur_grams_begin_index, buf.size())
     // escaped means needle[i - 1] is '\\'
     for (size_t i = 0; i < needle.size;) {
-        if (escaped && (needle[i] == '%' || needle[i] == '_' || needle[i] == '\\')) {
-            ++cur_valid_grams_num;
-            escaped = false;
-            ++i;
-        } else if (!escaped && (needle[i] == '%' || needle[i] == '_')) {
+        if (!escaped && (needle[i] == '%' || needle[i] == '_')) {
             cur_valid_grams_num = 0;
-            escaped = false;
             ++i;
-            cur_grams_begin_index = i;
-        } else if (!escaped && needle[i] == '\\') {
+            cur_grams_begin_index = buf.size();
+            continue;
+        }
+        if (!escaped && needle[i] == '\\') {
             escaped = true;
             ++i;
-        } else {
-            size_t cur_gram_length = UTF8_BYTE_LENGTH_TABLE[static_cast<unsigned char>(needle.data[i])];
-            i += cur_gram_length;
-            ++cur_valid_grams_num;
-            escaped = false;
+            continue;
         }
 
+        size_t cur_gram_length =
+                std::min<size_t>(UTF8_BYTE_LENGTH_TABLE[static_cast<unsigned char>(needle.data[i])], needle.size - i);
+        buf.append(needle.data + i, cur_gram_length);
+        i += cur_gram_length;
+        ++cur_valid_grams_num;
+        escaped = false;
+
         if (cur_valid_grams_num == index_gram_num) {
-            ngram_set.emplace_back(needle.data + cur_grams_begin_index, i - cur_grams_begin_index);
+            ngram_ranges.emplace_back(cur_grams_begin_index, buf.size());
             cur_valid_grams_num = 0;
-            cur_grams_begin_index = i;
+            cur_grams_begin_index = buf.size();
         }
     }
+
+    // a case insensitive index stores the ngrams in lower case, and LIKE is case sensitive, so the lower case ngrams
+    // of the needle must all be present.
+    if (!reader_options.index_case_sensitive) {
+        std::transform(buf.begin(), buf.end(), buf.begin(), [](unsigned char c) { return std::tolower(c); });
+    }
+
+    std::vector<Slice>& ngram_set = ngram_state->ngram_set;
+    ngram_set.reserve(ngram_ranges.size());
+    for (const auto& [begin, end] : ngram_ranges) {
+        ngram_set.emplace_back(buf.data() + begin, end - begin);
+    }
     // case like "like(col, "nee") when col has a 4gram bloom filter, don't use this index
-    if (ngram_set.empty()) return false;
-    return true;
+    return !ngram_set.empty();
 }
 } // namespace starrocks
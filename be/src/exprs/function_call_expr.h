@@ -53,7 +53,7 @@ private:
                                       NgramBloomFilterState* ngram_state, const std::string& func_name) const;
 
     bool split_like_string_to_ngram(FunctionContext* fn_ctx, const NgramBloomFilterReaderOptions& reader_options,
-                                    std::vector<Slice>& ngram_set) const;
+                                    NgramBloomFilterState* ngram_state) const;
 
     const FunctionDescriptor* _fn_desc{nullptr};
 
@@ -170,6 +170,8 @@ StatusOr<ColumnPtr> GeoFunctions::st_point(FunctionContext* context, const Colum
 
     auto size = columns[0]->size();
     ColumnBuilder<TYPE_VARCHAR> result(size);
+    GeoPoint point;
+    std::string buf;
     for (int row = 0; row < size; ++row) {
         if (x_column.is_null(row) || y_column.is_null(row)) {
             result.append_null();
@@ -178,14 +180,13 @@ StatusOr<ColumnPtr> GeoFunctions::st_point(FunctionContext* context, const Colum
 
         auto x_value = x_column.value(row);
         auto y_value = y_column.value(row);
-        GeoPoint point;
         auto res = point.from_coord(x_value, y_value);
         if (res != GEO_PARSE_OK) {
             result.append_null();
             continue;
         }
 
-        std::string buf;
+        buf.clear();
         point.encode_to(&buf);
         result.append(Slice(buf));
     }
@@ -359,6 +360,9 @@ StatusOr<ColumnPtr> GeoFunctions::st_contains(FunctionContext* context, const Co
 
     auto size = columns[0]->size();
     ColumnBuilder<TYPE_BOOLEAN> result(size);
+    // Points are decoded in place into these instead of allocating a new shape per row, it is the common case of
+    // ST_Contains(polygon, ST_Point(x, y)).
+    GeoPoint points[2];
     for (int row = 0; row < size; ++row) {
         if (lhs_viewer.is_null(row) || rhs_viewer.is_null(row)) {
             result.append_null();
@@ -375,6 +379,8 @@ StatusOr<ColumnPtr> GeoFunctions::st_contains(FunctionContext* context, const Co
         for (i = 0; i < 2; ++i) {
             if (state != nullptr && state->shapes[i] != nullptr) {
                 shapes[i] = state->shapes[i];
+            } else if (points[i].decode_from(strs[i]->data, strs[i]->size)) {
+                shapes[i] = &points[i];
             } else {
                 shapes[i] = local_state.shapes[i] = GeoShape::from_encoded(strs[i]->data, strs[i]->size);
                 if (shapes[i] == nullptr) {
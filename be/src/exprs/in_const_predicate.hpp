@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <algorithm>
+
 #include "column/chunk.h"
 #include "column/column_builder.h"
 #include "column/column_helper.h"
@@ -72,7 +74,9 @@ public:
               _null_in_set(other._null_in_set),
               _is_join_runtime_filter(other._is_join_runtime_filter),
               _eq_null(other._eq_null),
-              _array_size(other._array_size) {}
+              _array_size(other._array_size),
+              _array_base(other._array_base),
+              _is_dense_array(other._is_dense_array) {}
 
     ~VectorizedInConstPredicate() override = default;
 
@@ -98,6 +102,7 @@ public:
             const auto& hash_set = that->hash_set();
             _hash_set.insert(hash_set.begin(), hash_set.end());
             _null_in_set = _null_in_set || that->null_in_set();
+            _reset_dense_array();
             return Status::OK();
         } else {
             return Status::NotSupported(strings::Substitute("$0 cannot be merged with VectorizedInConstPredicate",
@@ -173,6 +178,10 @@ public:
                     _hash_set.emplace(viewer.value(0));
                 }
             }
+            // Only for the IN lists given by the query, the sets of runtime filters are filled by insert() later.
+            if (!use_array && _children.size() > 1) {
+                _try_build_dense_array();
+            }
         }
         return Status::OK();
     }
@@ -326,9 +335,16 @@ public:
         return evaluate_with_filter(context, ptr, nullptr);
     }
 
-    void insert(const ValueType& value) { _hash_set.emplace(value); }
+    void insert(const ValueType& value) {
+        _hash_set.emplace(value);
+        _reset_dense_array();
+    }
 
     void insert_array(const ValueType& value) {
+        if (_is_dense_array) {
+            insert(value);
+            return;
+        }
         if constexpr (can_use_array()) {
             _set_array_index(value);
         }
@@ -339,6 +355,10 @@ public:
     template <bool use_array>
     uint8_t check_value_existence(const ValueType& value) const {
         if constexpr (use_array && can_use_array()) {
+            if (_is_dense_array) {
+                const auto index = static_cast<uint64_t>(value) - static_cast<uint64_t>(_array_base);
+                return index < _array_buffer.size() ? _array_buffer[index] : 0;
+            }
             return _get_array_index(value);
         } else {
             return static_cast<uint8_t>(_hash_set.contains(value));
@@ -380,12 +400,55 @@ private:
         }
     }
 
+    // Probing a byte array is much cheaper than probing the hash set, so an integer IN list whose values fall
+    // into a dense range, e.g. ids generated by applications, is also kept as a byte array indexed by
+    // value - min. The hash set is kept as is for the callers using hash_set().
+    void _try_build_dense_array() {
+        if constexpr (can_use_array() && Type != TYPE_BOOLEAN) {
+            if (_hash_set.empty()) {
+                return;
+            }
+            auto [min_it, max_it] = std::minmax_element(_hash_set.begin(), _hash_set.end());
+            // computed in unsigned to not overflow on the ranges spanning more than half of int64
+            const auto range = static_cast<uint64_t>(*max_it) - static_cast<uint64_t>(*min_it);
+            if (range >= kMaxDenseArraySize ||
+                range >= std::max<uint64_t>(_hash_set.size() * kDenseArrayFactor, kMinDenseArraySize)) {
+                return;
+            }
+            _array_base = *min_it;
+            _array_size = static_cast<int>(range + 1);
+            _array_buffer.assign(_array_size, 0);
+            for (const auto& value : _hash_set) {
+                _array_buffer[static_cast<uint64_t>(value) - static_cast<uint64_t>(_array_base)] = 1;
+            }
+            _is_dense_array = true;
+        }
+    }
+
+    // The values added after the array is built may be out of the dense range, go back to the hash set.
+    void _reset_dense_array() {
+        if (_is_dense_array) {
+            _is_dense_array = false;
+            _array_size = 0;
+            _array_base = 0;
+            _array_buffer.clear();
+        }
+    }
+
+    static constexpr uint64_t kMaxDenseArraySize = 1 << 20;
+    static constexpr uint64_t kMinDenseArraySize = 4096;
+    static constexpr uint64_t kDenseArrayFactor = 8;
+
     const bool _is_not_in{false};
     bool _is_prepare{false};
     bool _null_in_set{false};
     bool _is_join_runtime_filter = false;
     bool _eq_null = false;
     int _array_size = 0;
+    // _array_buffer[i] tells whether _array_base + i is in the set.
+    int64_t _array_base = 0;
+    // The array is built from the values of a dense range rather than given dict codes.
+    bool _is_dense_array = false;
     std::vector<uint8_t> _array_buffer;
 
     in_const_pred_detail::LHashSetType<Type> _hash_set;
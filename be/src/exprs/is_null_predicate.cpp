@@ -17,7 +17,9 @@
 #include "column/column_builder.h"
 #include "column/column_helper.h"
 #include "column/column_viewer.h"
+#include "exprs/jit/ir_helper.h"
 #include "exprs/unary_function.h"
+#include "runtime/runtime_state.h"
 #include "types/logical_type.h"
 
 namespace starrocks {
@@ -62,6 +64,23 @@ public:
         auto col = ColumnHelper::as_raw_column<NullableColumn>(column)->null_column();
         return VectorizedStrictUnaryFunction<isNullImpl>::evaluate<TYPE_NULL, TYPE_BOOLEAN>(col);
     }
+
+    bool is_compilable(RuntimeState* state) const override {
+        return state->can_jit_expr(CompilableExprType::LOGICAL) && IRHelper::support_jit(_children[0]->type().type);
+    }
+
+    StatusOr<LLVMDatum> generate_ir_impl(ExprContext* context, JITContext* jit_ctx) override {
+        ASSIGN_OR_RETURN(LLVMDatum datum, _children[0]->generate_ir(context, jit_ctx))
+        auto& b = jit_ctx->builder;
+        LLVMDatum result(b);
+        result.value = b.CreateZExt(IRHelper::bool_to_cond(b, datum.null_flag), b.getInt8Ty());
+        return result;
+    }
+
+    std::string jit_func_name_impl(RuntimeState* state) const override {
+        return "{" + _children[0]->jit_func_name(state) + " is null}" + (is_constant() ? "c:" : "") +
+               (is_nullable() ? "n:" : "") + type().debug_string();
+    }
 };
 
 DEFINE_UNARY_FN_WITH_IMPL(isNotNullImpl, v) {
@@ -97,6 +116,23 @@ public:
         auto col = ColumnHelper::as_raw_column<NullableColumn>(column)->null_column();
         return VectorizedStrictUnaryFunction<isNotNullImpl>::evaluate<TYPE_NULL, TYPE_BOOLEAN>(col);
     }
+
+    bool is_compilable(RuntimeState* state) const override {
+        return state->can_jit_expr(CompilableExprType::LOGICAL) && IRHelper::support_jit(_children[0]->type().type);
+    }
+
+    StatusOr<LLVMDatum> generate_ir_impl(ExprContext* context, JITContext* jit_ctx) override {
+        ASSIGN_OR_RETURN(LLVMDatum datum, _children[0]->generate_ir(context, jit_ctx))
+        auto& b = jit_ctx->builder;
+        LLVMDatum result(b);
+        result.value = b.CreateZExt(b.CreateICmpEQ(datum.null_flag, b.getInt8(0)), b.getInt8Ty());
+        return result;
+    }
+
+    std::string jit_func_name_impl(RuntimeState* state) const override {
+        return "{" + _children[0]->jit_func_name(state) + " is not null}" + (is_constant() ? "c:" : "") +
+               (is_nullable() ? "n:" : "") + type().debug_string();
+    }
 };
 
 Expr* VectorizedIsNullPredicateFactory::from_thrift(const TExprNode& node) {
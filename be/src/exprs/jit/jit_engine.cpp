@@ -54,13 +54,17 @@
 #include <llvm/Transforms/Vectorize/LoopVectorize.h>
 #include <llvm/Transforms/Vectorize/SLPVectorizer.h>
 
+#include <filesystem>
+#include <fstream>
 #include <memory>
 #include <mutex>
+#include <thread>
 #include <utility>
 
 #include "common/compiler_util.h"
 #include "common/config.h"
 #include "common/status.h"
+#include "common/version.h"
 #include "exprs/expr.h"
 #include "runtime/exec_env.h"
 #include "runtime/mem_tracker.h"
@@ -83,6 +87,57 @@ void JitObjectCache::notifyObjectCompiled(const llvm::Module* M, llvm::MemoryBuf
     std::unique_ptr<llvm::MemoryBuffer> obj_buffer =
             llvm::MemoryBuffer::getMemBufferCopy(Obj.getBuffer(), Obj.getBufferIdentifier());
     _obj_code = std::move(obj_buffer);
+    if (!config::jit_object_cache_dir.empty()) {
+        _save_object_file(Obj.getBuffer());
+    }
+}
+
+// The object code is specialized for the host cpu and the IR generated by this build, so both are parts of the
+// file name, and files written by another cpu or build are never loaded. The file starts with the full cache key
+// to detect hash collisions.
+std::string JitObjectCache::_object_file_path() const {
+    static const std::string host_cpu = llvm::sys::getHostCPUName().str();
+    size_t hash = std::hash<std::string>()(_cache_key);
+    return fmt::format("{}/{}-{}-{:016x}.o", config::jit_object_cache_dir, STARROCKS_COMMIT_HASH, host_cpu, hash);
+}
+
+void JitObjectCache::_save_object_file(llvm::StringRef obj) const {
+    std::error_code ec;
+    std::filesystem::create_directories(config::jit_object_cache_dir, ec);
+    const std::string path = _object_file_path();
+    // write to a temporary file first, so a concurrent reader never sees a partial object
+    const std::string tmp_path =
+            fmt::format("{}.tmp.{}", path, std::hash<std::thread::id>()(std::this_thread::get_id()));
+    {
+        std::ofstream out(tmp_path, std::ios::binary | std::ios::trunc);
+        out << _cache_key << '\n';
+        out.write(obj.data(), obj.size());
+        if (!out) {
+            LOG(WARNING) << "JIT failed to write object file " << tmp_path;
+            std::filesystem::remove(tmp_path, ec);
+            return;
+        }
+    }
+    std::filesystem::rename(tmp_path, path, ec);
+    if (ec) {
+        LOG(WARNING) << "JIT failed to rename object file " << path << ", error = " << ec.message();
+        std::filesystem::remove(tmp_path, ec);
+    }
+}
+
+std::unique_ptr<llvm::MemoryBuffer> JitObjectCache::_load_object_file() {
+    auto file = llvm::MemoryBuffer::getFile(_object_file_path());
+    if (!file) {
+        return nullptr;
+    }
+    llvm::StringRef content = (*file)->getBuffer();
+    if (!content.startswith(_cache_key + "\n")) {
+        return nullptr;
+    }
+    llvm::StringRef obj = content.drop_front(_cache_key.size() + 1);
+    // LLJIT doesn't call notifyObjectCompiled() for the loaded object, so keep a copy for register_func().
+    _obj_code = llvm::MemoryBuffer::getMemBufferCopy(obj, _cache_key);
+    return llvm::MemoryBuffer::getMemBufferCopy(obj, _cache_key);
 }
 
 Status JitObjectCache::register_func(JITScalarFunction func) {
@@ -116,7 +171,10 @@ Status JitObjectCache::register_func(JITScalarFunction func) {
 }
 
 std::unique_ptr<llvm::MemoryBuffer> JitObjectCache::getObject(const llvm::Module* M) {
-    return nullptr;
+    if (config::jit_object_cache_dir.empty()) {
+        return nullptr;
+    }
+    return _load_object_file();
 }
 
 JITEngine::~JITEngine() {
@@ -58,6 +58,11 @@ public:
     size_t get_code_size() const { return _obj_code == nullptr ? 0 : _obj_code->getBufferSize(); }
 
 private:
+    // Persist the compiled object code under config::jit_object_cache_dir, so that it can be reused after restarts.
+    std::string _object_file_path() const;
+    void _save_object_file(llvm::StringRef obj) const;
+    std::unique_ptr<llvm::MemoryBuffer> _load_object_file();
+
     const std::string _cache_key;
     JITScalarFunction _func = nullptr;
     Cache* _lru_cache = nullptr;
@@ -545,10 +545,15 @@ StatusOr<ColumnPtr> LikePredicate::regex_match_partial(FunctionContext* context,
 
 template <bool fullMatch>
 std::string LikePredicate::convert_like_pattern(FunctionContext* context, const Slice& pattern) {
+    auto state = reinterpret_cast<LikePredicateState*>(context->get_function_state(FunctionContext::THREAD_LOCAL));
+    return convert_like_pattern<fullMatch>(state->escape_char, pattern);
+}
+
+template <bool fullMatch>
+std::string LikePredicate::convert_like_pattern(char escape_char, const Slice& pattern) {
     std::string re_pattern;
     re_pattern.clear();
 
-    auto state = reinterpret_cast<LikePredicateState*>(context->get_function_state(FunctionContext::THREAD_LOCAL));
     bool is_escaped = false;
 
     if constexpr (fullMatch) {
@@ -561,7 +566,7 @@ std::string LikePredicate::convert_like_pattern(FunctionContext* context, const
         } else if (!is_escaped && pattern.data[i] == '_') {
             re_pattern.append(".");
             // check for escape char before checking for regex special chars, they might overlap
-        } else if (!is_escaped && pattern.data[i] == state->escape_char) {
+        } else if (!is_escaped && pattern.data[i] == escape_char) {
             is_escaped = true;
         } else if (pattern.data[i] == '.' || pattern.data[i] == '[' || pattern.data[i] == ']' ||
                    pattern.data[i] == '{' || pattern.data[i] == '}' || pattern.data[i] == '(' ||
@@ -602,4 +607,88 @@ void LikePredicate::remove_escape_character(std::string* search_string) {
     }
 }
 
+LikePredicate::MultiPatternMatcher::~MultiPatternMatcher() {
+    if (_scratch != nullptr) {
+        hs_free_scratch(_scratch);
+    }
+    if (_database != nullptr) {
+        hs_free_database(_database);
+    }
+}
+
+Status LikePredicate::MultiPatternMatcher::init(const std::vector<std::string>& patterns,
+                                                const std::vector<bool>& is_like) {
+    DCHECK_EQ(patterns.size(), is_like.size());
+    std::vector<std::string> expressions;
+    std::vector<const char*> expression_ptrs;
+    std::vector<unsigned int> flags;
+    std::vector<unsigned int> ids;
+    expressions.reserve(patterns.size());
+    for (size_t i = 0; i < patterns.size(); ++i) {
+        if (is_like[i]) {
+            expressions.emplace_back(convert_like_pattern<true>('\\', Slice(patterns[i])));
+        } else {
+            expressions.emplace_back(patterns[i]);
+        }
+        expression_ptrs.emplace_back(expressions.back().c_str());
+        flags.emplace_back(HS_FLAG_ALLOWEMPTY | HS_FLAG_DOTALL | HS_FLAG_UTF8 | HS_FLAG_SINGLEMATCH);
+        ids.emplace_back(i);
+    }
+
+    hs_compile_error_t* compile_err = nullptr;
+    if (hs_compile_multi(expression_ptrs.data(), flags.data(), ids.data(), expression_ptrs.size(), HS_MODE_BLOCK,
+                         nullptr, &_database, &compile_err) != HS_SUCCESS) {
+        auto st = Status::InvalidArgument(fmt::format("Invalid hyperscan expression: {}", compile_err->message));
+        hs_free_compile_error(compile_err);
+        return st;
+    }
+    if (hs_alloc_scratch(_database, &_scratch) != HS_SUCCESS) {
+        return Status::InternalError("unable to allocate scratch space");
+    }
+    return Status::OK();
+}
+
+StatusOr<ColumnPtr> LikePredicate::MultiPatternMatcher::match(const ColumnPtr& value_column) const {
+    if (value_column->only_null()) {
+        return value_column;
+    }
+
+    hs_scratch_t* scratch = nullptr;
+    hs_error_t status;
+    if ((status = hs_clone_scratch(_scratch, &scratch)) != HS_SUCCESS) {
+        return Status::InternalError(fmt::format("unable to clone scratch space, status: {}", status));
+    }
+    DeferOp op([&] {
+        hs_error_t st;
+        if ((st = hs_free_scratch(scratch)) != HS_SUCCESS) {
+            LOG(ERROR) << "free scratch space failure. status: " << st;
+        }
+    });
+
+    ColumnViewer<TYPE_VARCHAR> value_viewer(value_column);
+    ColumnBuilder<TYPE_BOOLEAN> result(value_viewer.size());
+    for (int row = 0; row < value_viewer.size(); ++row) {
+        if (value_viewer.is_null(row)) {
+            result.append_null();
+            continue;
+        }
+
+        // All the patterns are compiled with HS_FLAG_SINGLEMATCH, the scan stops at the first pattern matched.
+        bool v = false;
+        auto value = value_viewer.value(row);
+        [[maybe_unused]] auto st = hs_scan(
+                _database, value.size ? value.data : &_DUMMY_STRING_FOR_EMPTY_PATTERN, value.size, 0, scratch,
+                [](unsigned int id, unsigned long long from, unsigned long long to, unsigned int flags,
+                   void* ctx) -> int {
+                    *((bool*)ctx) = true;
+                    return 1;
+                },
+                &v);
+        DCHECK(st == HS_SUCCESS || st == HS_SCAN_TERMINATED) << " status: " << st;
+        result.append(v);
+    }
+
+    return result.build(value_column->is_constant());
+}
+
 } // namespace starrocks
@@ -19,6 +19,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "column/column_builder.h"
 #include "column/column_helper.h"
@@ -58,6 +59,29 @@ public:
      */
     DEFINE_VECTORIZED_FN(regex);
 
+    // Matches a column against several constant LIKE/REGEXP patterns with a single hyperscan scan per row,
+    // used to evaluate `col LIKE 'a%' OR col REGEXP 'b+' OR ...` without scanning the column once per pattern.
+    class MultiPatternMatcher {
+    public:
+        MultiPatternMatcher() = default;
+        ~MultiPatternMatcher();
+
+        MultiPatternMatcher(const MultiPatternMatcher&) = delete;
+        MultiPatternMatcher& operator=(const MultiPatternMatcher&) = delete;
+
+        // is_like[i] tells whether patterns[i] is a LIKE pattern or a regular expression.
+        Status init(const std::vector<std::string>& patterns, const std::vector<bool>& is_like);
+
+        // Returns a boolean column which is true where the value matches any of the patterns,
+        // and null where the value is null.
+        StatusOr<ColumnPtr> match(const ColumnPtr& value_column) const;
+
+    private:
+        hs_database_t* _database = nullptr;
+        // Prototype scratch space, cloned by every match call since the matcher is shared by threads.
+        hs_scratch_t* _scratch = nullptr;
+    };
+
 private:
     /**
      * use for:
@@ -151,6 +175,9 @@ private:
     template <bool fullMatch>
     static std::string convert_like_pattern(FunctionContext* context, const Slice& pattern);
 
+    template <bool fullMatch>
+    static std::string convert_like_pattern(char escape_char, const Slice& pattern);
+
     static void remove_escape_character(std::string* search_string);
 
 private:
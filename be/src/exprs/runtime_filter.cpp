@@ -15,6 +15,7 @@
 #include "exprs/runtime_filter.h"
 
 #include "types/logical_type_infra.h"
+#include "util/compression/block_compression.h"
 #include "util/compression/stream_compression.h"
 
 namespace starrocks {
@@ -61,13 +62,32 @@ SimdBlockFilter::SimdBlockFilter(SimdBlockFilter&& bf) noexcept {
     bf._directory = nullptr;
 }
 
+void SimdBlockFilter::copy_from(const SimdBlockFilter& bf) {
+    clear();
+    if (bf._directory == nullptr) {
+        return;
+    }
+    _log_num_buckets = bf._log_num_buckets;
+    _directory_mask = bf._directory_mask;
+    const size_t alloc_size = get_alloc_size();
+    const int malloc_failed = posix_memalign(reinterpret_cast<void**>(&_directory), 64, alloc_size);
+    if (malloc_failed) throw ::std::bad_alloc();
+    memcpy(_directory, bf._directory, alloc_size);
+}
+
+void SimdBlockFilter::init_pass_all() {
+    clear();
+    init(MINIMUM_ELEMENT_NUM);
+    memset(_directory, 0xff, get_alloc_size());
+}
+
 size_t SimdBlockFilter::max_serialized_size() const {
     const size_t alloc_size = _directory == nullptr ? 0 : get_alloc_size();
     return sizeof(_log_num_buckets) + sizeof(_directory_mask) + // data size + max data size
            sizeof(int32_t) + alloc_size;
 }
 
-size_t SimdBlockFilter::serialize(uint8_t* data) const {
+size_t SimdBlockFilter::serialize(uint8_t* data, const BlockCompressionCodec* codec) const {
     size_t offset = 0;
 #define SIMD_BF_COPY_FIELD(field)                 \
     memcpy(data + offset, &field, sizeof(field)); \
@@ -76,6 +96,20 @@ size_t SimdBlockFilter::serialize(uint8_t* data) const {
     SIMD_BF_COPY_FIELD(_directory_mask);
 
     const size_t alloc_size = get_alloc_size();
+    if (codec != nullptr && _directory != nullptr && alloc_size >= MIN_COMPRESSION_SIZE) {
+        raw::RawString buffer;
+        buffer.resize(codec->max_compressed_len(alloc_size));
+        Slice compressed(buffer.data(), buffer.size());
+        Status st = codec->compress(Slice(reinterpret_cast<const char*>(_directory), alloc_size), &compressed);
+        if (st.ok() && compressed.size < alloc_size) {
+            // a negative data size means the directory is compressed into -data_size bytes.
+            int32_t data_size = -static_cast<int32_t>(compressed.size);
+            SIMD_BF_COPY_FIELD(data_size);
+            memcpy(data + offset, compressed.data, compressed.size);
+            offset += compressed.size;
+            return offset;
+        }
+    }
     int32_t data_size = alloc_size;
     SIMD_BF_COPY_FIELD(data_size);
     if (LIKELY(data_size > 0)) {
@@ -86,7 +120,7 @@ size_t SimdBlockFilter::serialize(uint8_t* data) const {
 #undef SIMD_BF_COPY_FIELD
 }
 
-size_t SimdBlockFilter::deserialize(const uint8_t* data) {
+size_t SimdBlockFilter::deserialize(const uint8_t* data, const BlockCompressionCodec* codec) {
     size_t offset = 0;
     int32_t data_size = 0;
 
@@ -98,6 +132,21 @@ size_t SimdBlockFilter::deserialize(const uint8_t* data) {
     SIMD_BF_COPY_FIELD(data_size);
 #undef SIMD_BF_COPY_FIELD
     const size_t alloc_size = get_alloc_size();
+    if (data_size < 0) {
+        const size_t compressed_size = -static_cast<int64_t>(data_size);
+        const int malloc_failed = posix_memalign(reinterpret_cast<void**>(&(_directory)), 64, alloc_size);
+        if (malloc_failed) throw ::std::bad_alloc();
+        Slice decompressed(reinterpret_cast<char*>(_directory), alloc_size);
+        Status st = codec == nullptr
+                            ? Status::InternalError("no codec to decompress runtime bloom filter")
+                            : codec->decompress(Slice(data + offset, compressed_size), &decompressed);
+        if (!st.ok() || decompressed.size != alloc_size) {
+            LOG(WARNING) << "fail to decompress runtime bloom filter, only min/max filter will be used: " << st;
+            clear();
+        }
+        offset += compressed_size;
+        return offset;
+    }
     DCHECK(data_size == alloc_size);
     if (LIKELY(data_size > 0)) {
         const int malloc_failed = posix_memalign(reinterpret_cast<void**>(&(_directory)), 64, alloc_size);
@@ -170,8 +219,18 @@ size_t JoinRuntimeFilter::max_serialized_size() const {
     return size;
 }
 
+static const BlockCompressionCodec* get_bf_compression_codec(int serialize_version) {
+    const BlockCompressionCodec* codec = nullptr;
+    if (serialize_version >= RF_VERSION_V3) {
+        WARN_IF_ERROR(get_block_compression_codec(CompressionTypePB::LZ4, &codec),
+                      "fail to get lz4 codec for runtime bloom filter");
+    }
+    return codec;
+}
+
 size_t JoinRuntimeFilter::serialize(int serialize_version, uint8_t* data) const {
     size_t offset = 0;
+    const BlockCompressionCodec* codec = get_bf_compression_codec(serialize_version);
     auto num_partitions = _hash_partition_bf.size();
 #define JRF_COPY_FIELD(field)                     \
     memcpy(data + offset, &field, sizeof(field)); \
@@ -183,11 +242,11 @@ size_t JoinRuntimeFilter::serialize(int serialize_version, uint8_t* data) const
 #undef JRF_COPY_FIELD
 
     if (num_partitions == 0) {
-        offset += _bf.serialize(data + offset);
+        offset += _bf.serialize(data + offset, codec);
 
     } else {
         for (const auto& bf : _hash_partition_bf) {
-            offset += bf.serialize(data + offset);
+            offset += bf.serialize(data + offset, codec);
         }
     }
     return offset;
@@ -195,6 +254,7 @@ size_t JoinRuntimeFilter::serialize(int serialize_version, uint8_t* data) const
 
 size_t JoinRuntimeFilter::deserialize(int serialize_version, const uint8_t* data) {
     size_t offset = 0;
+    const BlockCompressionCodec* codec = get_bf_compression_codec(serialize_version);
     size_t num_partitions = 0;
 #define JRF_COPY_FIELD(field)                     \
     memcpy(&field, data + offset, sizeof(field)); \
@@ -206,13 +266,21 @@ size_t JoinRuntimeFilter::deserialize(int serialize_version, const uint8_t* data
 #undef JRF_COPY_FIELD
 
     if (num_partitions == 0) {
-        offset += _bf.deserialize(data + offset);
+        offset += _bf.deserialize(data + offset, codec);
     } else {
+        bool all_can_use = true;
         for (size_t i = 0; i < num_partitions; i++) {
             SimdBlockFilter bf;
-            offset += bf.deserialize(data + offset);
+            offset += bf.deserialize(data + offset, codec);
+            all_can_use &= bf.can_use();
             _hash_partition_bf.emplace_back(std::move(bf));
         }
+        // the partitions should be all usable or all cleared, a partition may be cleared by failed decompression.
+        if (!all_can_use) {
+            for (auto& bf : _hash_partition_bf) {
+                bf.clear();
+            }
+        }
     }
 
     return offset;
@@ -33,11 +33,16 @@ namespace starrocks {
 // 0x1. initial global runtime filter impl
 // 0x2. change simd-block-filter hash function.
 // 0x3. Fix serialize problem
+// 0x4. Compress simd-block-filter with lz4
 inline const constexpr uint8_t RF_VERSION = 0x2;
 inline const constexpr uint8_t RF_VERSION_V2 = 0x3;
+inline const constexpr uint8_t RF_VERSION_V3 = 0x4;
 static_assert(sizeof(RF_VERSION_V2) == sizeof(RF_VERSION));
+static_assert(sizeof(RF_VERSION_V3) == sizeof(RF_VERSION));
 inline const constexpr int32_t RF_VERSION_SZ = sizeof(RF_VERSION_V2);
 
+class BlockCompressionCodec;
+
 // compatible code from 2.5 to 3.0
 // TODO: remove it
 class RuntimeFilterSerializeType {
@@ -92,7 +97,7 @@ static constexpr uint32_t SALT[8] = {0x47b6137b, 0x44974d91, 0x8824ad5b, 0xa2b72
                                      0x705495c7, 0x2df1424b, 0x9efc4947, 0x5c6bfb31};
 
 // Modify from https://github.com/FastFilter/fastfilter_cpp/blob/master/src/bloom/simd-block.h
-// This is avx2 simd implementation for paper <<Cache-, Hash- and Space-Efficient Bloom Filters>>
+// This is avx2/neon simd implementation for paper <<Cache-, Hash- and Space-Efficient Bloom Filters>>
 class SimdBlockFilter {
 public:
     // The filter is divided up into Buckets:
@@ -117,6 +122,12 @@ public:
         const __m256i mask = make_mask(hash >> _log_num_buckets);
         __m256i* const bucket = &reinterpret_cast<__m256i*>(_directory)[bucket_idx];
         _mm256_store_si256(bucket, _mm256_or_si256(*bucket, mask));
+#elif defined(__ARM_NEON)
+        uint32x4_t masks[2];
+        make_mask(hash >> _log_num_buckets, masks);
+        uint32_t* const bucket = _directory[bucket_idx];
+        vst1q_u32(&bucket[0], vorrq_u32(vld1q_u32(&bucket[0]), masks[0]));
+        vst1q_u32(&bucket[4], vorrq_u32(vld1q_u32(&bucket[4]), masks[1]));
 #else
         uint32_t masks[BITS_SET_PER_BLOCK];
         make_mask(hash >> _log_num_buckets, masks);
@@ -168,9 +179,15 @@ public:
     }
 
     size_t max_serialized_size() const;
-    size_t serialize(uint8_t* data) const;
-    size_t deserialize(const uint8_t* data);
+    // if `codec` is not null, the directory is compressed when it's large enough and the compressed one is smaller.
+    size_t serialize(uint8_t* data, const BlockCompressionCodec* codec = nullptr) const;
+    // the bf is cleared if the compressed directory can't be decompressed.
+    size_t deserialize(const uint8_t* data, const BlockCompressionCodec* codec = nullptr);
     void merge(const SimdBlockFilter& bf);
+    // deep copy of `bf`, the cleared bf is copied as a cleared one.
+    void copy_from(const SimdBlockFilter& bf);
+    // init a minimal bloom filter with all bits set, any hash can pass it.
+    void init_pass_all();
     bool check_equal(const SimdBlockFilter& bf) const;
     uint32_t directory_mask() const { return _directory_mask; }
 
@@ -223,6 +240,8 @@ private:
 #endif
     // log2(number of bytes in a bucket):
     static constexpr int LOG_BUCKET_BYTE_SIZE = 5;
+    // the directory smaller than this is never compressed.
+    static constexpr size_t MIN_COMPRESSION_SIZE = 4096;
 
     size_t get_alloc_size() const {
         return _log_num_buckets == 0 ? 0 : (1ull << (_log_num_buckets + LOG_BUCKET_BYTE_SIZE));
@@ -360,8 +379,33 @@ public:
         _join_mode = rf->_join_mode;
         _size += rf->_size;
     }
+    // An early runtime filter is published before all the partial filters of a multi-partitioned runtime filter
+    // are built. It keeps the bloom filters of the ready partitions and passes all the rows of the others, also it
+    // has null and the full min/max range, so it is a superset of the final runtime filter and is replaced by it.
+    bool is_early() const { return _is_early; }
+    // append a copy of the bloom filters of `rf` as the next partitions of the early runtime filter.
+    void concat_early(const JoinRuntimeFilter* rf) {
+        DCHECK(_is_early);
+        if (rf->_hash_partition_bf.empty()) {
+            _hash_partition_bf.emplace_back().copy_from(rf->_bf);
+        } else {
+            for (const auto& bf : rf->_hash_partition_bf) {
+                _hash_partition_bf.emplace_back().copy_from(bf);
+            }
+        }
+        _join_mode = rf->_join_mode;
+        _size += rf->_size;
+    }
+    // append a partition whose partial filter is not ready to the early runtime filter.
+    void concat_pass_all() {
+        DCHECK(_is_early);
+        _hash_partition_bf.emplace_back().init_pass_all();
+    }
+
     virtual bool check_equal(const JoinRuntimeFilter& rf) const;
     virtual JoinRuntimeFilter* create_empty(ObjectPool* pool) = 0;
+    // mark the empty runtime filter as an early one.
+    virtual void init_early() = 0;
     void set_global() { this->_global = true; }
 
     // only used in local colocate filter
@@ -379,6 +423,7 @@ protected:
     SimdBlockFilter _bf;
     std::vector<SimdBlockFilter> _hash_partition_bf;
     bool _always_true = false;
+    bool _is_early = false;
     size_t _rf_version = 0;
     // local colocate filters is local filter we don't have to serialize them
     std::vector<JoinRuntimeFilter*> _group_colocate_filters;
@@ -467,6 +512,12 @@ public:
         return p;
     };
 
+    void init_early() override {
+        _init_full_range();
+        _has_null = true;
+        _is_early = true;
+    }
+
     // create a min/max LT/GT RuntimeFilter with val
     template <bool is_min>
     static RuntimeBloomFilter* create_with_range(ObjectPool* pool, CppType val, bool is_close_interval) {
@@ -715,7 +766,7 @@ public:
     // filter zonemap by evaluating
     // [min_value, max_value] overlapped with [min, max]
     bool filter_zonemap_with_min_max(const CppType* min_value, const CppType* max_value) const {
-        if (min_value == nullptr || max_value == nullptr) return false;
+        if (min_value == nullptr || max_value == nullptr || _is_early) return false;
         if (*max_value < _min) return true;
         if (*min_value > _max) return true;
         return false;
@@ -799,6 +850,10 @@ private:
     }
 
     void _evaluate_min_max(const ContainerType& values, uint8_t* selection, size_t size) const {
+        if (_is_early) {
+            memset(selection, 0x1, size);
+            return;
+        }
         if constexpr (!IsSlice<CppType>) {
             const auto* data = values.data();
             for (size_t i = 0; i < size; i++) {
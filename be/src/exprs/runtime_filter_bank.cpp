@@ -18,6 +18,7 @@
 #include <thread>
 
 #include "column/column.h"
+#include "common/config.h"
 #include "exec/pipeline/runtime_filter_types.h"
 #include "exprs/in_const_predicate.hpp"
 #include "exprs/literal.h"
@@ -70,7 +71,7 @@ size_t RuntimeFilterHelper::serialize_runtime_filter(int rf_version, const JoinR
 size_t RuntimeFilterHelper::serialize_runtime_filter(RuntimeState* state, const JoinRuntimeFilter* rf, uint8_t* data) {
     int32_t rf_version = RF_VERSION;
     if (state->func_version() >= TFunctionVersion::RUNTIME_FILTER_SERIALIZE_VERSION_2) {
-        rf_version = RF_VERSION_V2;
+        rf_version = config::enable_runtime_filter_compression ? RF_VERSION_V3 : RF_VERSION_V2;
     }
     return serialize_runtime_filter(rf_version, rf, data);
 }
@@ -85,7 +86,7 @@ int RuntimeFilterHelper::deserialize_runtime_filter(ObjectPool* pool, JoinRuntim
     uint8_t version = 0;
     memcpy(&version, data, sizeof(version));
     offset += sizeof(version);
-    if (version != RF_VERSION && version != RF_VERSION_V2) {
+    if (version != RF_VERSION && version != RF_VERSION_V2 && version != RF_VERSION_V3) {
         // version mismatch and skip this chunk.
         LOG(WARNING) << "unrecognized version:" << version;
         return 0;
@@ -484,6 +485,8 @@ void RuntimeFilterProbeCollector::init_counter() {
             ADD_COUNTER(_runtime_profile, "JoinRuntimeFilterOutputRows", TUnit::UNIT);
     _eval_context.join_runtime_filter_eval_counter =
             ADD_COUNTER(_runtime_profile, "JoinRuntimeFilterEvaluate", TUnit::UNIT);
+    _eval_context.join_runtime_filter_early_filtered_counter =
+            ADD_COUNTER(_runtime_profile, "JoinRuntimeFilterEarlyFilteredRows", TUnit::UNIT);
 }
 
 void RuntimeFilterProbeCollector::evaluate(Chunk* chunk) {
@@ -507,9 +510,23 @@ void RuntimeFilterProbeCollector::evaluate(Chunk* chunk, RuntimeBloomFilterEvalC
         size_t after = chunk->num_rows();
         eval_context.join_runtime_filter_output_counter->update(after);
         eval_context.join_runtime_filter_eval_counter->update(eval_context.run_filter_nums);
+        if (eval_context.join_runtime_filter_early_filtered_counter != nullptr && before != after &&
+            has_early_runtime_filter(eval_context.driver_sequence)) {
+            eval_context.join_runtime_filter_early_filtered_counter->update(before - after);
+        }
     }
 }
 
+bool RuntimeFilterProbeCollector::has_early_runtime_filter(int32_t driver_sequence) const {
+    for (const auto& it : _descriptors) {
+        const JoinRuntimeFilter* filter = it.second->runtime_filter(driver_sequence);
+        if (filter != nullptr && filter->is_early()) {
+            return true;
+        }
+    }
+    return false;
+}
+
 void RuntimeFilterProbeCollector::evaluate_partial_chunk(Chunk* partial_chunk,
                                                          RuntimeBloomFilterEvalContext& eval_context) {
     if (_descriptors.empty()) return;
@@ -716,8 +733,14 @@ void RuntimeFilterProbeCollector::wait(bool on_scan_node) {
 }
 
 void RuntimeFilterProbeDescriptor::set_runtime_filter(const JoinRuntimeFilter* rf) {
-    const JoinRuntimeFilter* expected = nullptr;
-    _runtime_filter.compare_exchange_strong(expected, rf, std::memory_order_seq_cst, std::memory_order_seq_cst);
+    // only the early runtime filter can be replaced, by the final one or another early one.
+    const JoinRuntimeFilter* expected = _runtime_filter.load();
+    while (expected == nullptr || expected->is_early()) {
+        if (_runtime_filter.compare_exchange_weak(expected, rf, std::memory_order_seq_cst,
+                                                  std::memory_order_seq_cst)) {
+            break;
+        }
+    }
     if (_ready_timestamp == 0 && rf != nullptr && _latency_timer != nullptr) {
         _ready_timestamp = UnixMillis();
         _latency_timer->set((_ready_timestamp - _open_timestamp) * 1000);
@@ -232,6 +232,8 @@ struct RuntimeBloomFilterEvalContext {
     RuntimeProfile::Counter* join_runtime_filter_input_counter = nullptr;
     RuntimeProfile::Counter* join_runtime_filter_output_counter = nullptr;
     RuntimeProfile::Counter* join_runtime_filter_eval_counter = nullptr;
+    // rows filtered out while some early runtime filters are used, see JoinRuntimeFilter::is_early.
+    RuntimeProfile::Counter* join_runtime_filter_early_filtered_counter = nullptr;
 };
 
 // The collection of `RuntimeFilterProbeDescriptor`
@@ -284,6 +286,7 @@ private:
     void do_evaluate(Chunk* chunk);
     void do_evaluate(Chunk* chunk, RuntimeBloomFilterEvalContext& eval_context);
     void do_evaluate_partial_chunk(Chunk* partial_chunk, RuntimeBloomFilterEvalContext& eval_context);
+    bool has_early_runtime_filter(int32_t driver_sequence) const;
     // mapping from filter id to runtime filter descriptor.
     std::map<int32_t, RuntimeFilterProbeDescriptor*> _descriptors;
     int _wait_timeout_ms = 0;
@@ -14,6 +14,10 @@
 
 #include "formats/csv/csv_reader.h"
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 #include <unordered_set>
 
 namespace starrocks {
@@ -555,15 +559,32 @@ void CSVReader::split_record(const Record& record, Fields* columns) const {
     const size_t size = record.size;
 
     if (_column_delimiter_length == 1) {
-        for (size_t i = 0; i < size; ++i, ++ptr) {
-            if (*ptr == _parse_options.column_delimiter[0]) {
-                if (_parse_options.trim_space) {
-                    std::pair<const char*, size_t> newPos = trim(value, ptr - value);
-                    columns->emplace_back(newPos.first, newPos.second);
-                } else {
-                    columns->emplace_back(value, ptr - value);
-                }
-                value = ptr + 1;
+        const char delimiter = _parse_options.column_delimiter[0];
+        const char* const end = record.data + size;
+        auto append_field = [&](const char* field_end) {
+            if (_parse_options.trim_space) {
+                std::pair<const char*, size_t> newPos = trim(value, field_end - value);
+                columns->emplace_back(newPos.first, newPos.second);
+            } else {
+                columns->emplace_back(value, field_end - value);
+            }
+            value = field_end + 1;
+        };
+#ifdef __SSE2__
+        // Compare 16 bytes at a time and walk the bitmask of delimiter positions
+        const __m128i delimiter_vec = _mm_set1_epi8(delimiter);
+        for (; ptr + 16 <= end; ptr += 16) {
+            auto mask = static_cast<uint32_t>(_mm_movemask_epi8(
+                    _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr)), delimiter_vec)));
+            while (mask != 0) {
+                append_field(ptr + __builtin_ctz(mask));
+                mask &= mask - 1;
+            }
+        }
+#endif
+        for (; ptr < end; ++ptr) {
+            if (*ptr == delimiter) {
+                append_field(ptr);
             }
         }
     } else {
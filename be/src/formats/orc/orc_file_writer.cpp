@@ -20,6 +20,7 @@
 #include "column/column_helper.h"
 #include "column/map_column.h"
 #include "column/struct_column.h"
+#include "common/config.h"
 #include "formats/orc/utils.h"
 #include "formats/utils.h"
 #include "runtime/current_thread.h"
@@ -95,6 +96,7 @@ Status ORCFileWriter::init() {
     auto options = orc::WriterOptions();
     ASSIGN_OR_RETURN(auto compression, _convert_compression_type(_compression_type));
     options.setCompression(compression);
+    options.setDictionaryKeySizeThreshold(config::orc_writer_dictionary_key_size_threshold);
     _writer = orc::createWriter(*_schema, _output_stream.get(), options);
     _writer->addUserMetadata(STARROCKS_ORC_WRITER_VERSION_KEY, get_short_version());
     return Status::OK();
@@ -21,28 +21,100 @@
 #include <numeric>
 
 #include "column/chunk.h"
+#include "common/config.h"
 #include "common/statusor.h"
 #include "exprs/function_context.h"
 #include "formats/parquet/column_chunk_writer.h"
 #include "formats/parquet/level_builder.h"
+#include "runtime/current_thread.h"
+#include "util/countdown_latch.h"
 
 namespace starrocks::parquet {
 
+static int count_leaf_columns(const ::parquet::schema::Node& node) {
+    if (node.is_primitive()) {
+        return 1;
+    }
+    const auto& group = static_cast<const ::parquet::schema::GroupNode&>(node);
+    int num_leaves = 0;
+    for (int i = 0; i < group.field_count(); i++) {
+        num_leaves += count_leaf_columns(*group.field(i));
+    }
+    return num_leaves;
+}
+
 ChunkWriter::ChunkWriter(::parquet::RowGroupWriter* rg_writer, const std::vector<TypeDescriptor>& type_descs,
                          const std::shared_ptr<::parquet::schema::GroupNode>& schema,
-                         const std::function<StatusOr<ColumnPtr>(Chunk*, size_t)>& eval_func)
-        : _rg_writer(rg_writer), _type_descs(type_descs), _schema(schema), _eval_func(eval_func) {
+                         const std::function<StatusOr<ColumnPtr>(Chunk*, size_t)>& eval_func,
+                         PriorityThreadPool* encode_pool)
+        : _rg_writer(rg_writer),
+          _type_descs(type_descs),
+          _schema(schema),
+          _eval_func(eval_func),
+          _encode_pool(encode_pool) {
     int num_columns = rg_writer->num_columns();
     _estimated_buffered_bytes.resize(num_columns);
     std::fill(_estimated_buffered_bytes.begin(), _estimated_buffered_bytes.end(), 0);
+    int first_leaf_index = 0;
+    for (size_t i = 0; i < _type_descs.size(); i++) {
+        _first_leaf_indexes.push_back(first_leaf_index);
+        first_leaf_index += count_leaf_columns(*_schema->field(i));
+    }
 }
 
 Status ChunkWriter::write(Chunk* chunk) {
     LevelBuilderContext ctx(chunk->num_rows());
 
+    if (_encode_pool != nullptr && config::enable_parquet_writer_parallel_encode && _type_descs.size() > 1) {
+        return _write_parallel(ctx, chunk);
+    }
+
     // Writes out all leaf parquet columns to the RowGroupWriter. Each leaf column is written fully before
     // the next column is written. Columns are written in DFS order.
-    int leaf_column_idx = 0;
+    for (size_t i = 0; i < _type_descs.size(); i++) {
+        ASSIGN_OR_RETURN(auto col, _eval_func(chunk, i));
+        RETURN_IF_ERROR(_write_column(ctx, i, col));
+    }
+
+    return Status::OK();
+}
+
+Status ChunkWriter::_write_parallel(const LevelBuilderContext& ctx, Chunk* chunk) {
+    // output expressions are evaluated in the calling thread, only encoding is offloaded.
+    const size_t num_columns = _type_descs.size();
+    Columns columns(num_columns);
+    for (size_t i = 0; i < num_columns; i++) {
+        ASSIGN_OR_RETURN(columns[i], _eval_func(chunk, i));
+    }
+
+    std::vector<Status> statuses(num_columns);
+    CountDownLatch latch(static_cast<int>(num_columns));
+    MemTracker* mem_tracker = tls_thread_status.mem_tracker();
+    for (size_t i = 0; i < num_columns; i++) {
+        auto task = [&, i]() {
+            SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(mem_tracker);
+            try {
+                statuses[i] = _write_column(ctx, i, columns[i]);
+            } catch (const ::parquet::ParquetException& e) {
+                statuses[i] = Status::InternalError(fmt::format("encode parquet column error: {}", e.what()));
+            }
+            latch.count_down();
+        };
+        // the last column is encoded by the calling thread, and so are the ones the pool can not take now.
+        if (i + 1 == num_columns || !_encode_pool->try_offer(task)) {
+            task();
+        }
+    }
+    latch.wait();
+
+    for (const auto& st : statuses) {
+        RETURN_IF_ERROR(st);
+    }
+    return Status::OK();
+}
+
+Status ChunkWriter::_write_column(const LevelBuilderContext& ctx, size_t column_idx, const ColumnPtr& col) {
+    int leaf_column_idx = _first_leaf_indexes[column_idx];
 
     auto write_leaf_column = [&](const LevelBuilderResult& result) {
         auto leaf_column_writer = ColumnChunkWriter(_rg_writer->column(leaf_column_idx));
@@ -51,13 +123,8 @@ Status ChunkWriter::write(Chunk* chunk) {
         ++leaf_column_idx;
     };
 
-    for (size_t i = 0; i < _type_descs.size(); i++) {
-        ASSIGN_OR_RETURN(auto col, _eval_func(chunk, i));
-        auto level_builder = LevelBuilder(_type_descs[i], _schema->field(i));
-        RETURN_IF_ERROR(level_builder.write(ctx, col, write_leaf_column));
-    }
-
-    return Status::OK();
+    auto level_builder = LevelBuilder(_type_descs[column_idx], _schema->field(column_idx));
+    return level_builder.write(ctx, col, write_leaf_column);
 }
 
 void ChunkWriter::close() {
@@ -58,13 +58,16 @@ class StatusOr;
 
 namespace starrocks::parquet {
 
+class LevelBuilderContext;
+
 // Wraps parquet::RowGroupWriter.
 // Write chunks into buffer. Flush on closing.
 class ChunkWriter {
 public:
     ChunkWriter(::parquet::RowGroupWriter* rg_writer, const std::vector<TypeDescriptor>& type_descs,
                 const std::shared_ptr<::parquet::schema::GroupNode>& schema,
-                const std::function<StatusOr<ColumnPtr>(Chunk*, size_t)>& eval_func);
+                const std::function<StatusOr<ColumnPtr>(Chunk*, size_t)>& eval_func,
+                PriorityThreadPool* encode_pool = nullptr);
 
     Status write(Chunk* chunk);
 
@@ -73,11 +76,20 @@ public:
     int64_t estimated_buffered_bytes() const;
 
 private:
+    // Encode top level columns concurrently in `_encode_pool`, the leaf columns of a buffered row group
+    // are written into independent buffers.
+    Status _write_parallel(const LevelBuilderContext& ctx, Chunk* chunk);
+
+    Status _write_column(const LevelBuilderContext& ctx, size_t column_idx, const ColumnPtr& col);
+
     ::parquet::RowGroupWriter* _rg_writer;
     std::vector<TypeDescriptor> _type_descs;
     std::shared_ptr<::parquet::schema::GroupNode> _schema;
     std::function<StatusOr<ColumnPtr>(Chunk*, size_t)> _eval_func;
     std::vector<int64_t> _estimated_buffered_bytes;
+    PriorityThreadPool* _encode_pool;
+    // index of the first leaf column of each top level column
+    std::vector<int> _first_leaf_indexes;
 };
 
 } // namespace starrocks::parquet
@@ -35,6 +35,7 @@
 #include "exec/exec_node.h"
 #include "exec/hdfs_scanner.h"
 #include "exprs/expr_context.h"
+#include "exprs/runtime_filter.h"
 #include "formats/parquet/column_converter.h"
 #include "formats/parquet/page_index_reader.h"
 #include "formats/parquet/schema.h"
@@ -47,8 +48,7 @@
 #include "gutil/strings/substitute.h"
 #include "io/shared_buffered_input_stream.h"
 #include "runtime/types.h"
-#include "simd/batch_run_counter.h"
-#include "storage/column_or_predicate.h"
+#include "simd/simd.h"
 #include "storage/column_predicate.h"
 #include "storage/types.h"
 #include "util/runtime_profile.h"
@@ -172,6 +172,18 @@ public:
         return _dict_filter_ctx->rewrite_conjunct_ctxs_to_predicate(_reader.get(), is_group_filtered);
     }
 
+    StatusOr<bool> filter_dict_with_runtime_filter(const JoinRuntimeFilter* filter) override {
+        if (!_col_type->is_string_type() || !_column_all_pages_dict_encoded()) {
+            return false;
+        }
+        ColumnPtr dict_value_column = ColumnHelper::create_column(TypeDescriptor(TYPE_VARCHAR), true);
+        RETURN_IF_ERROR(_reader->get_dict_values(dict_value_column.get()));
+        JoinRuntimeFilter::RunningContext ctx;
+        ctx.use_merged_selection = false;
+        filter->evaluate(dict_value_column.get(), &ctx);
+        return SIMD::count_nonzero(ctx.selection) == 0;
+    }
+
     void init_dict_column(ColumnPtr& column, const std::vector<std::string>& sub_field_path,
                           const size_t& layer) override {
         DCHECK_EQ(sub_field_path.size(), layer);
@@ -184,7 +196,8 @@ public:
     Status filter_dict_column(const ColumnPtr& column, Filter* filter, const std::vector<std::string>& sub_field_path,
                               const size_t& layer) override {
         DCHECK_EQ(sub_field_path.size(), layer);
-        return _dict_filter_ctx->predicate->evaluate_and(column.get(), filter->data());
+        _dict_filter_ctx->filter_dict_codes(column.get(), filter->data());
+        return Status::OK();
     }
 
     Status fill_dst_column(ColumnPtr& dst, const ColumnPtr& src) override {
@@ -360,6 +373,26 @@ void ScalarColumnReader::collect_column_io_range(std::vector<io::SharedBufferedI
     }
 }
 
+void ColumnDictFilterContext::filter_dict_codes(const Column* column, uint8_t* filter) const {
+    const auto* nullable_column = down_cast<const NullableColumn*>(column);
+    const auto* codes_column = down_cast<const FixedLengthColumn<int32_t>*>(nullable_column->data_column().get());
+    const int32_t* codes = codes_column->get_data().data();
+    const uint8_t* mapping = code_filter.data();
+    const size_t num_rows = column->size();
+    if (!nullable_column->has_null()) {
+        for (size_t i = 0; i < num_rows; i++) {
+            filter[i] &= mapping[codes[i]];
+        }
+    } else {
+        // the code of a null row is undefined, use the last entry of `code_filter` for it
+        const uint8_t* nulls = nullable_column->immutable_null_column_data().data();
+        const uint8_t null_result = mapping[code_filter.size() - 1];
+        for (size_t i = 0; i < num_rows; i++) {
+            filter[i] &= nulls[i] ? null_result : mapping[codes[i]];
+        }
+    }
+}
+
 void ScalarColumnReader::select_offset_index(const SparseRange<uint64_t>& range, const uint64_t rg_first_row) {
     if (_offset_index_ctx == nullptr) {
         if (!_chunk_metadata->__isset.offset_index_offset) {
@@ -441,66 +474,8 @@ Status ColumnDictFilterContext::rewrite_conjunct_ctxs_to_predicate(StoredColumnR
         return Status::OK();
     }
 
-    // ---------
-    // get dict codes according to dict values pos.
-    std::vector<int32_t> dict_codes;
-    BatchRunCounter<32> batch_run(filter.data(), 0, filter.size() - 1);
-    BatchCount batch = batch_run.next_batch();
-    int index = 0;
-    while (batch.length > 0) {
-        if (batch.AllSet()) {
-            for (int32_t i = 0; i < batch.length; i++) {
-                dict_codes.emplace_back(index + i);
-            }
-        } else if (batch.NoneSet()) {
-            // do nothing
-        } else {
-            for (int32_t i = 0; i < batch.length; i++) {
-                if (filter[index + i]) {
-                    dict_codes.emplace_back(index + i);
-                }
-            }
-        }
-        index += batch.length;
-        batch = batch_run.next_batch();
-    }
-
-    bool null_is_ok = filter[filter.size() - 1] == 1;
-
-    // eq predicate is faster than in predicate
-    // TODO: improve not eq and not in
-    if (dict_codes.size() == 0) {
-        predicate = nullptr;
-    } else if (dict_codes.size() == 1) {
-        predicate = obj_pool.add(
-                new_column_eq_predicate(get_type_info(kDictCodeFieldType), slot_id, std::to_string(dict_codes[0])));
-    } else {
-        std::vector<std::string> str_codes;
-        str_codes.reserve(dict_codes.size());
-        for (int code : dict_codes) {
-            str_codes.emplace_back(std::to_string(code));
-        }
-        predicate = obj_pool.add(new_column_in_predicate(get_type_info(kDictCodeFieldType), slot_id, str_codes));
-    }
-
-    // deal with if NULL works or not.
-    if (null_is_ok) {
-        ColumnPredicate* result = nullptr;
-        ColumnPredicate* is_null_pred =
-                obj_pool.add(new_column_null_predicate(get_type_info(kDictCodeFieldType), slot_id, true));
-
-        if (predicate != nullptr) {
-            ColumnOrPredicate* or_pred =
-                    obj_pool.add(new ColumnOrPredicate(get_type_info(kDictCodeFieldType), slot_id));
-            or_pred->add_child(predicate);
-            or_pred->add_child(is_null_pred);
-            result = or_pred;
-        } else {
-            result = is_null_pred;
-        }
-        predicate = result;
-    }
-
+    // keep the filter result of each dict value, so that evaluating a row is just a lookup by its dict code.
+    code_filter = std::move(filter);
     return Status::OK();
 }
 
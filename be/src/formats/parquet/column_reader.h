@@ -48,6 +48,7 @@ class RandomAccessFile;
 struct HdfsScanStats;
 class ColumnPredicate;
 class ExprContext;
+class JoinRuntimeFilter;
 class NullableColumn;
 class TIcebergSchemaField;
 
@@ -76,16 +77,19 @@ struct ColumnDictFilterContext {
     constexpr static const LogicalType kDictCodeFieldType = TYPE_INT;
     // conjunct ctxs for each dict filter column
     std::vector<ExprContext*> conjunct_ctxs;
-    // preds transformed from `_conjunct_ctxs` for each dict filter column
-    ColumnPredicate* predicate;
+    // result of `conjunct_ctxs` on each dict value, indexed by dict code.
+    // the extra last entry is the result for null.
+    Filter code_filter;
     // is output column ? if just used for filter, decode is no need
     bool is_decode_needed;
     SlotId slot_id;
     std::vector<std::string> sub_field_path;
-    ObjectPool obj_pool;
 
 public:
     Status rewrite_conjunct_ctxs_to_predicate(StoredColumnReader* reader, bool* is_group_filtered);
+
+    // `column` is a nullable dict code column, AND the result of each row into `filter`.
+    void filter_dict_codes(const Column* column, uint8_t* filter) const;
 };
 
 class ColumnReader {
@@ -136,6 +140,10 @@ public:
     virtual void init_dict_column(ColumnPtr& column, const std::vector<std::string>& sub_field_path,
                                   const size_t& layer) {}
 
+    // Returns true if none of the dict values can pass the runtime filter, then the column chunk can be skipped.
+    // Only works when all the data pages of the column chunk are dict encoded.
+    virtual StatusOr<bool> filter_dict_with_runtime_filter(const JoinRuntimeFilter* filter) { return false; }
+
     virtual Status filter_dict_column(const ColumnPtr& column, Filter* filter,
                                       const std::vector<std::string>& sub_field_path, const size_t& layer) {
         return Status::OK();
@@ -61,6 +61,7 @@
 #include "storage/chunk_helper.h"
 #include "util/coding.h"
 #include "util/hash_util.hpp"
+#include "util/lru_cache.h"
 #include "util/memcmp.h"
 #include "util/runtime_profile.h"
 #include "util/slice.h"
@@ -239,6 +240,46 @@ Status FileReader::_parse_footer(FileMetaDataPtr* file_metadata_ptr, int64_t* fi
     return Status::OK();
 }
 
+static Cache* footer_memory_cache() {
+    static std::unique_ptr<Cache> cache(new_lru_cache(config::parquet_file_metadata_cache_size));
+    return cache.get();
+}
+
+static void delete_cached_file_metadata(const CacheKey& key, void* value) {
+    delete static_cast<FileMetaDataPtr*>(value);
+}
+
+Status FileReader::_get_footer_from_memory_cache() {
+    Cache* cache = footer_memory_cache();
+    std::string metacache_key = _build_metacache_key();
+    {
+        SCOPED_RAW_TIMER(&_scanner_ctx->stats->footer_cache_read_ns);
+        Cache::Handle* handle = cache->lookup(CacheKey(metacache_key));
+        if (handle != nullptr) {
+            _file_metadata = *static_cast<FileMetaDataPtr*>(cache->value(handle));
+            cache->release(handle);
+            _scanner_ctx->stats->footer_cache_read_count += 1;
+            return Status::OK();
+        }
+    }
+
+    int64_t file_metadata_size = 0;
+    RETURN_IF_ERROR(_parse_footer(&_file_metadata, &file_metadata_size));
+    if (file_metadata_size > 0) {
+        auto* capture = new FileMetaDataPtr(_file_metadata);
+        Cache::Handle* handle =
+                cache->insert(CacheKey(metacache_key), capture, file_metadata_size, delete_cached_file_metadata);
+        if (handle != nullptr) {
+            cache->release(handle);
+            _scanner_ctx->stats->footer_cache_write_bytes += file_metadata_size;
+            _scanner_ctx->stats->footer_cache_write_count += 1;
+        }
+    } else {
+        LOG(ERROR) << "Parsing unexpected parquet file metadata size";
+    }
+    return Status::OK();
+}
+
 Status FileReader::_get_footer() {
     if (_scanner_ctx->split_context != nullptr) {
         auto split_ctx = down_cast<const SplitContext*>(_scanner_ctx->split_context);
@@ -247,6 +288,9 @@ Status FileReader::_get_footer() {
     }
 
     if (!_cache) {
+        if (_scanner_ctx->use_file_metacache && config::parquet_file_metadata_cache_size > 0) {
+            return _get_footer_from_memory_cache();
+        }
         int64_t file_metadata_size = 0;
         return _parse_footer(&_file_metadata, &file_metadata_size);
     }
@@ -403,6 +447,10 @@ StatusOr<bool> FileReader::_filter_group(const tparquet::RowGroup& row_group) {
     }
 
     // filter by min/max in runtime filter.
+    return _filter_group_with_runtime_filter(row_group);
+}
+
+StatusOr<bool> FileReader::_filter_group_with_runtime_filter(const tparquet::RowGroup& row_group) {
     if (_scanner_ctx->runtime_filter_collector) {
         std::vector<SlotDescriptor*> min_max_slots(1);
 
@@ -670,6 +718,7 @@ Status FileReader::_init_group_readers() {
     _group_reader_param.lazy_column_coalesce_counter = fd_scanner_ctx.lazy_column_coalesce_counter;
     // for pageIndex
     _group_reader_param.min_max_conjunct_ctxs = fd_scanner_ctx.min_max_conjunct_ctxs;
+    _group_reader_param.runtime_filter_collector = fd_scanner_ctx.runtime_filter_collector;
 
     int64_t row_group_first_row = 0;
     // select and create row group readers.
@@ -728,6 +777,20 @@ Status FileReader::_init_group_readers() {
 }
 
 Status FileReader::_prepare_cur_row_group() {
+    // runtime filters may arrive after the file is opened, so check the row group with them again.
+    while (_cur_row_group_idx < _row_group_size) {
+        ASSIGN_OR_RETURN(bool filtered, _filter_group_with_runtime_filter(
+                                                *_row_group_readers[_cur_row_group_idx]->row_group_metadata()));
+        if (!filtered) {
+            break;
+        }
+        _scanner_ctx->stats->runtime_filter_skip_groups += 1;
+        _cur_row_group_idx++;
+    }
+    if (_cur_row_group_idx >= _row_group_size) {
+        return Status::OK();
+    }
+
     auto& r = _row_group_readers[_cur_row_group_idx];
     // if coalesce read enabled, we have to
     // 0. clear last group memory
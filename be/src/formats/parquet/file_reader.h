@@ -87,6 +87,9 @@ private:
     // get footer of parquet file from cache or parquet file
     Status _get_footer();
 
+    // Get footer from the BE-wide in-memory footer cache, used when block cache is not available.
+    Status _get_footer_from_memory_cache();
+
     std::string _build_metacache_key();
 
     std::shared_ptr<MetaHelper> _build_meta_helper();
@@ -99,6 +102,7 @@ private:
 
     // filter row group by min/max conjuncts
     StatusOr<bool> _filter_group(const tparquet::RowGroup& row_group);
+    StatusOr<bool> _filter_group_with_runtime_filter(const tparquet::RowGroup& row_group);
 
     // get row group to read
     // if scan range conatain the first byte in the row group, will be read
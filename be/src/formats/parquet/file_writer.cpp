@@ -357,7 +357,7 @@ void FileWriterBase::_generate_chunk_writer() {
     DCHECK(_writer != nullptr);
     if (_chunk_writer == nullptr) {
         auto rg_writer = _writer->AppendBufferedRowGroup();
-        _chunk_writer = std::make_unique<ChunkWriter>(rg_writer, _type_descs, _schema, _eval_func);
+        _chunk_writer = std::make_unique<ChunkWriter>(rg_writer, _type_descs, _schema, _eval_func, _encode_pool);
     }
 }
 
@@ -458,6 +458,7 @@ AsyncFileWriter::AsyncFileWriter(std::unique_ptr<WritableFile> writable_file, st
           _executor_pool(executor_pool),
           _parent_profile(parent_profile),
           _state(state) {
+    _encode_pool = executor_pool;
     _io_timer = ADD_TIMER(_parent_profile, "FileWriterIoTimer");
 }
 
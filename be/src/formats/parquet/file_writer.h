@@ -172,6 +172,8 @@ protected:
     std::shared_ptr<::parquet::schema::GroupNode> _schema;
     std::unique_ptr<::parquet::ParquetFileWriter> _writer;
     std::unique_ptr<ChunkWriter> _chunk_writer;
+    // pool to encode the columns of a chunk concurrently, nullptr means encoding in the writing thread
+    PriorityThreadPool* _encode_pool = nullptr;
 
     std::vector<TypeDescriptor> _type_descs;
     std::function<StatusOr<ColumnPtr>(Chunk*, size_t)> _eval_func;
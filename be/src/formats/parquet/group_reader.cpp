@@ -28,6 +28,7 @@
 #include "exprs/expr.h"
 #include "exprs/expr_context.h"
 #include "exprs/function_context.h"
+#include "exprs/runtime_filter_bank.h"
 #include "formats/parquet/metadata.h"
 #include "formats/parquet/page_index_reader.h"
 #include "formats/parquet/schema.h"
@@ -58,13 +59,17 @@ Status GroupReader::init() {
 
 Status GroupReader::prepare() {
     RETURN_IF_ERROR(_rewrite_conjunct_ctxs_to_predicates(&_is_group_filtered));
+    if (!_is_group_filtered) {
+        RETURN_IF_ERROR(_filter_group_with_runtime_filter_dict(&_is_group_filtered));
+    }
     _init_read_chunk();
     _range = SparseRange<uint64_t>(_row_group_first_row, _row_group_first_row + _row_group_metadata->num_rows);
     if (config::parquet_page_index_enable) {
         SCOPED_RAW_TIMER(&_param.stats->page_index_ns);
         _param.stats->rows_before_page_index += _row_group_metadata->num_rows;
-        auto page_index_reader = std::make_unique<PageIndexReader>(this, _param.file, _column_readers,
-                                                                   _row_group_metadata, _param.min_max_conjunct_ctxs);
+        auto page_index_reader =
+                std::make_unique<PageIndexReader>(this, _param.file, _column_readers, _row_group_metadata,
+                                                  _param.min_max_conjunct_ctxs, _param.runtime_filter_collector);
         ASSIGN_OR_RETURN(bool flag, page_index_reader->generate_read_range(_range));
         if (flag && !_is_group_filtered) {
             page_index_reader->select_column_offset_index();
@@ -422,6 +427,36 @@ Status GroupReader::_rewrite_conjunct_ctxs_to_predicates(bool* is_group_filtered
     return Status::OK();
 }
 
+// Runtime filters are checked again with the dictionary of the column chunk here, since they may arrive after the
+// row group is selected by min/max, and bloom filter in them is more selective than min/max for string columns.
+Status GroupReader::_filter_group_with_runtime_filter_dict(bool* is_group_filtered) {
+    if (_param.runtime_filter_collector == nullptr) {
+        return Status::OK();
+    }
+    SCOPED_RAW_TIMER(&_param.stats->group_dict_filter_ns);
+    for (const auto& it : _param.runtime_filter_collector->descriptors()) {
+        const RuntimeFilterProbeDescriptor* rf_desc = it.second;
+        // external node won't have colocate runtime filter
+        const JoinRuntimeFilter* filter = rf_desc->runtime_filter(-1);
+        SlotId probe_slot_id;
+        if (filter == nullptr || filter->has_null() || filter->num_hash_partitions() > 0 ||
+            !rf_desc->is_probe_slot_ref(&probe_slot_id)) {
+            continue;
+        }
+        auto iter = _column_readers.find(probe_slot_id);
+        if (iter == _column_readers.end()) {
+            continue;
+        }
+        ASSIGN_OR_RETURN(bool filtered, iter->second->filter_dict_with_runtime_filter(filter));
+        if (filtered) {
+            _param.stats->runtime_filter_skip_groups += 1;
+            *is_group_filtered = true;
+            return Status::OK();
+        }
+    }
+    return Status::OK();
+}
+
 void GroupReader::_init_chunk_dict_column(ChunkPtr* chunk) {
     // replace dict filter column
     for (int col_idx : _dict_column_indices) {
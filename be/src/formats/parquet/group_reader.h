@@ -47,6 +47,7 @@ namespace starrocks {
 class RandomAccessFile;
 struct HdfsScanStats;
 class ExprContext;
+class RuntimeFilterProbeCollector;
 class TIcebergSchemaField;
 
 namespace parquet {
@@ -101,6 +102,9 @@ struct GroupReaderParam {
 
     // used for pageIndex
     std::vector<ExprContext*> min_max_conjunct_ctxs;
+
+    // used for pageIndex and dict filter with runtime filters.
+    const RuntimeFilterProbeCollector* runtime_filter_collector = nullptr;
 };
 
 class PageIndexReader;
@@ -122,9 +126,11 @@ public:
     void collect_io_ranges(std::vector<io::SharedBufferedInputStream::IORange>* ranges, int64_t* end_offset,
                            ColumnIOType type = ColumnIOType::PAGES);
     void set_end_offset(int64_t value) { _end_offset = value; }
+    const tparquet::RowGroup* row_group_metadata() const { return _row_group_metadata; }
 
     void _use_as_dict_filter_column(int col_idx, SlotId slot_id, std::vector<std::string>& sub_field_path);
     Status _rewrite_conjunct_ctxs_to_predicates(bool* is_group_filtered);
+    Status _filter_group_with_runtime_filter_dict(bool* is_group_filtered);
 
     void _init_chunk_dict_column(ChunkPtr* chunk);
     StatusOr<bool> _filter_chunk_with_dict_filter(ChunkPtr* chunk, Filter* filter);
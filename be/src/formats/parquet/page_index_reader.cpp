@@ -24,8 +24,10 @@
 #include "column/column_helper.h"
 #include "column/vectorized_fwd.h"
 #include "common/compiler_util.h"
+#include "exec/hdfs_scanner.h"
 #include "exprs/expr.h"
 #include "exprs/expr_context.h"
+#include "exprs/runtime_filter_bank.h"
 #include "formats/parquet/column_converter.h"
 #include "formats/parquet/column_reader.h"
 #include "formats/parquet/encoding_plain.h"
@@ -74,6 +76,24 @@ StatusOr<bool> PageIndexReader::generate_read_range(SparseRange<uint64_t>& spars
         }
     }
 
+    // runtime filters with min/max to map<slotId, JoinRuntimeFilter*>
+    std::unordered_map<SlotId, const JoinRuntimeFilter*> slot_id_to_rf_map;
+    if (_runtime_filter_collector != nullptr) {
+        for (const auto& it : _runtime_filter_collector->descriptors()) {
+            const RuntimeFilterProbeDescriptor* rf_desc = it.second;
+            // external node won't have colocate runtime filter
+            const JoinRuntimeFilter* filter = rf_desc->runtime_filter(-1);
+            SlotId probe_slot_id;
+            if (filter == nullptr || filter->has_null() || !rf_desc->is_probe_slot_ref(&probe_slot_id)) {
+                continue;
+            }
+            if (_column_readers.find(probe_slot_id) == _column_readers.end()) {
+                continue;
+            }
+            slot_id_to_rf_map.emplace(probe_slot_id, filter);
+        }
+    }
+
     for (int idx : _group_reader->_active_column_indices) {
         const auto& column = _group_reader->_param.read_cols[idx];
         // complex type will be supported later
@@ -81,8 +101,10 @@ StatusOr<bool> PageIndexReader::generate_read_range(SparseRange<uint64_t>& spars
             continue;
         }
         SlotId slotId = column.slot_id();
-        // no min_max conjunct
-        if (slot_id_to_ctx_map.find(slotId) == slot_id_to_ctx_map.end()) {
+        // no min_max conjunct or runtime filter
+        auto ctx_iter = slot_id_to_ctx_map.find(slotId);
+        auto rf_iter = slot_id_to_rf_map.find(slotId);
+        if (ctx_iter == slot_id_to_ctx_map.end() && rf_iter == slot_id_to_rf_map.end()) {
             continue;
         }
 
@@ -137,15 +159,22 @@ StatusOr<bool> PageIndexReader::generate_read_range(SparseRange<uint64_t>& spars
         // for <= 700, min_selected is {1, 1, 1, 1, 0}, max_selected is {1, 1, 1, 0, 0}
         // min_selected or max_selected is {1, 1, 1, 1, 0}
         // so the page_filter will be {0, 1, 1, 1, 0}
-        for (auto* ctx : slot_id_to_ctx_map.at(slotId)) {
-            ASSIGN_OR_RETURN(ColumnPtr min_selected, ctx->evaluate(min_chunk.get()));
-            ASSIGN_OR_RETURN(ColumnPtr max_selected, ctx->evaluate(max_chunk.get()));
-            auto unpack_min_selected = ColumnHelper::unpack_and_duplicate_const_column(page_num, min_selected);
-            auto unpack_max_selected = ColumnHelper::unpack_and_duplicate_const_column(page_num, max_selected);
-            Filter min_filter = ColumnHelper::merge_nullable_filter(unpack_min_selected.get());
-            Filter max_filter = ColumnHelper::merge_nullable_filter(unpack_max_selected.get());
-            ColumnHelper::or_two_filters(&min_filter, max_filter.data());
-            ColumnHelper::merge_two_filters(&page_filter, min_filter.data());
+        if (ctx_iter != slot_id_to_ctx_map.end()) {
+            for (auto* ctx : ctx_iter->second) {
+                ASSIGN_OR_RETURN(ColumnPtr min_selected, ctx->evaluate(min_chunk.get()));
+                ASSIGN_OR_RETURN(ColumnPtr max_selected, ctx->evaluate(max_chunk.get()));
+                auto unpack_min_selected = ColumnHelper::unpack_and_duplicate_const_column(page_num, min_selected);
+                auto unpack_max_selected = ColumnHelper::unpack_and_duplicate_const_column(page_num, max_selected);
+                Filter min_filter = ColumnHelper::merge_nullable_filter(unpack_min_selected.get());
+                Filter max_filter = ColumnHelper::merge_nullable_filter(unpack_max_selected.get());
+                ColumnHelper::or_two_filters(&min_filter, max_filter.data());
+                ColumnHelper::merge_two_filters(&page_filter, min_filter.data());
+            }
+        }
+
+        if (rf_iter != slot_id_to_rf_map.end()) {
+            _group_reader->_param.stats->runtime_filter_skip_pages += _filter_page_with_runtime_filter(
+                    rf_iter->second, column.slot_type(), column_index, min_column, max_column, &page_filter);
         }
 
         if (!SIMD::contain_zero(page_filter)) {
@@ -181,6 +210,37 @@ StatusOr<bool> PageIndexReader::generate_read_range(SparseRange<uint64_t>& spars
     return page_filtered_flag;
 }
 
+size_t PageIndexReader::_filter_page_with_runtime_filter(const JoinRuntimeFilter* filter, const TypeDescriptor& type,
+                                                        const tparquet::ColumnIndex& column_index,
+                                                        const ColumnPtr& min_column, const ColumnPtr& max_column,
+                                                        Filter* page_filter) {
+    size_t filtered_pages = 0;
+    ColumnPtr page_min = min_column->clone_empty();
+    ColumnPtr page_max = max_column->clone_empty();
+    for (size_t i = 0; i < page_filter->size(); i++) {
+        if (!(*page_filter)[i]) {
+            continue;
+        }
+        bool discard = false;
+        if (i < column_index.null_pages.size() && column_index.null_pages[i]) {
+            // the runtime filter has no null, so the page only has null values can be skipped.
+            discard = true;
+        } else {
+            page_min->reset_column();
+            page_max->reset_column();
+            page_min->append(*min_column, i, 1);
+            page_max->append(*max_column, i, 1);
+            discard = RuntimeFilterHelper::filter_zonemap_with_min_max(type.type, filter, page_min.get(),
+                                                                       page_max.get());
+        }
+        if (discard) {
+            (*page_filter)[i] = 0;
+            filtered_pages++;
+        }
+    }
+    return filtered_pages;
+}
+
 Status PageIndexReader::_decode_value_into_column(ColumnPtr column, const std::vector<string>& values,
                                                   const TypeDescriptor& type, const ParquetField* field,
                                                   const std::string& timezone) {
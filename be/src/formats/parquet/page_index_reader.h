@@ -35,7 +35,9 @@
 #include "storage/range.h"
 
 namespace starrocks {
+class JoinRuntimeFilter;
 class RandomAccessFile;
+class RuntimeFilterProbeCollector;
 
 namespace parquet {
 class ColumnReader;
@@ -65,12 +67,14 @@ class PageIndexReader {
 public:
     PageIndexReader(GroupReader* group_reader, RandomAccessFile* file,
                     const std::unordered_map<SlotId, std::unique_ptr<ColumnReader>>& column_readers,
-                    const tparquet::RowGroup* meta, const std::vector<ExprContext*> min_max_conjunct_ctxs)
+                    const tparquet::RowGroup* meta, const std::vector<ExprContext*> min_max_conjunct_ctxs,
+                    const RuntimeFilterProbeCollector* runtime_filter_collector = nullptr)
             : _group_reader(group_reader),
               _file(file),
               _column_readers(column_readers),
               _row_group_metadata(meta),
-              _min_max_conjunct_ctxs(min_max_conjunct_ctxs) {}
+              _min_max_conjunct_ctxs(min_max_conjunct_ctxs),
+              _runtime_filter_collector(runtime_filter_collector) {}
 
     StatusOr<bool> generate_read_range(SparseRange<uint64_t>& sparse_range);
 
@@ -81,6 +85,11 @@ private:
                                      const TypeDescriptor& type, const ParquetField* field,
                                      const std::string& timezone);
 
+    // filter pages by the min/max in runtime filter, returns the number of pages filtered.
+    size_t _filter_page_with_runtime_filter(const JoinRuntimeFilter* filter, const TypeDescriptor& type,
+                                            const tparquet::ColumnIndex& column_index, const ColumnPtr& min_column,
+                                            const ColumnPtr& max_column, Filter* page_filter);
+
     GroupReader* _group_reader = nullptr;
     RandomAccessFile* _file = nullptr;
     // column readers for column chunk in row group
@@ -90,6 +99,8 @@ private:
 
     // min/max conjuncts
     std::vector<ExprContext*> _min_max_conjunct_ctxs;
+
+    const RuntimeFilterProbeCollector* _runtime_filter_collector = nullptr;
 };
 
 } // namespace starrocks::parquet
\ No newline at end of file
@@ -309,6 +309,9 @@ struct WritableFileOptions {
     bool skip_fill_local_cache = false;
 
     bool direct_write = false;
+    // Advise the kernel to drop the file's pages from the page cache once it's synced and closed.
+    // Only honored by the posix filesystem.
+    bool drop_cache_on_close = false;
 
     // See OpenMode for details.
     FileSystem::OpenMode mode = FileSystem::MUST_CREATE;
@@ -194,8 +194,13 @@ static Status do_writev_at(int fd, const string& filename, uint64_t offset, cons
 
 class PosixWritableFile : public WritableFile {
 public:
-    PosixWritableFile(std::string filename, int fd, uint64_t filesize, bool sync_on_close)
-            : _filename(std::move(filename)), _fd(fd), _sync_on_close(sync_on_close), _filesize(filesize) {
+    PosixWritableFile(std::string filename, int fd, uint64_t filesize, bool sync_on_close,
+                      bool drop_cache_on_close = false)
+            : _filename(std::move(filename)),
+              _fd(fd),
+              _sync_on_close(sync_on_close),
+              _drop_cache_on_close(drop_cache_on_close),
+              _filesize(filesize) {
         FileSystem::on_file_write_open(this);
     }
 
@@ -265,6 +270,13 @@ public:
             }
         }
 
+#if defined(__linux__)
+        // The pages are clean once synced, so dropping them only evicts data nobody is waiting to read.
+        if (_drop_cache_on_close && s.ok() && !_pending_sync) {
+            (void)posix_fadvise(_fd, 0, 0, POSIX_FADV_DONTNEED);
+        }
+#endif
+
         int ret;
         RETRY_ON_EINTR(ret, ::close(_fd));
         _closed = true;
@@ -312,6 +324,7 @@ private:
     std::string _filename;
     int _fd;
     const bool _sync_on_close = false;
+    const bool _drop_cache_on_close = false;
     bool _pending_sync = false;
     bool _closed = false;
     uint64_t _filesize = 0;
@@ -387,7 +400,8 @@ public:
         if (opts.mode == MUST_EXIST) {
             ASSIGN_OR_RETURN(file_size, get_file_size(fname));
         }
-        return std::make_unique<PosixWritableFile>(fname, fd, file_size, opts.sync_on_close);
+        return std::make_unique<PosixWritableFile>(fname, fd, file_size, opts.sync_on_close,
+                                                   opts.drop_cache_on_close);
     }
 
     Status path_exists(const std::string& fname) override {
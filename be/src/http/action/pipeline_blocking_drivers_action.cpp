@@ -18,6 +18,7 @@
 #include <rapidjson/prettywriter.h>
 #include <rapidjson/stringbuffer.h>
 
+#include <algorithm>
 #include <string>
 
 #include "common/logging.h"
@@ -40,14 +41,16 @@ struct DriverInfo {
     std::string driver_desc;
     bool is_fragment_cancelled;
     std::string fragment_status;
+    int64_t blocked_time_ns;
 
     DriverInfo(int32_t driver_id, pipeline::DriverState state, std::string&& driver_desc, bool cancelled,
-               std::string status)
+               std::string status, int64_t blocked_time_ns)
             : driver_id(driver_id),
               state(state),
               driver_desc(std::move(driver_desc)),
               is_fragment_cancelled(cancelled),
-              fragment_status(std::move(status)) {}
+              fragment_status(std::move(status)),
+              blocked_time_ns(blocked_time_ns) {}
 };
 
 void PipelineBlockingDriversAction::handle(HttpRequest* req) {
@@ -84,13 +87,18 @@ void PipelineBlockingDriversAction::_handle_stat(HttpRequest* req) {
         using FragmentMap = std::unordered_map<TUniqueId, DriverInfoList>;
         using QueryMap = std::unordered_map<TUniqueId, FragmentMap>;
 
-        auto query_map_to_doc_func = [&allocator](const QueryMap& query_map) {
+        auto query_map_to_doc_func = [&allocator](QueryMap& query_map) {
             rapidjson::Document queries_obj;
             queries_obj.SetArray();
             for (const auto& [query_id, fragment_map] : query_map) {
                 rapidjson::Document fragments_obj;
                 fragments_obj.SetArray();
-                for (const auto& [fragment_id, driver_info_list] : fragment_map) {
+                for (auto& [fragment_id, driver_info_list] : fragment_map) {
+                    // The driver that has been waiting longest is the most likely to be on the critical path.
+                    std::sort(driver_info_list.begin(), driver_info_list.end(),
+                              [](const DriverInfo& lhs, const DriverInfo& rhs) {
+                                  return lhs.blocked_time_ns > rhs.blocked_time_ns;
+                              });
                     rapidjson::Document drivers_obj;
                     drivers_obj.SetArray();
                     bool is_fragment_cancelled = false;
@@ -103,6 +111,8 @@ void PipelineBlockingDriversAction::_handle_stat(HttpRequest* req) {
                         driver_obj.AddMember("state",
                                              rapidjson::Value(ds_to_string(driver_info.state).c_str(), allocator),
                                              allocator);
+                        driver_obj.AddMember("blocked_time_ms",
+                                             rapidjson::Value(driver_info.blocked_time_ns / 1000000), allocator);
                         driver_obj.AddMember("driver_desc",
                                              rapidjson::Value(driver_info.driver_desc.c_str(), allocator), allocator);
 
@@ -145,6 +155,7 @@ void PipelineBlockingDriversAction::_handle_stat(HttpRequest* req) {
                 int32_t driver_id = driver->driver_id();
                 pipeline::DriverState state = driver->driver_state();
                 std::string driver_desc = driver->to_readable_string();
+                int64_t blocked_time_ns = driver->blocked_time_ns();
 
                 auto fragment_map_it = query_map.find(query_id);
                 if (fragment_map_it == query_map.end()) {
@@ -155,7 +166,8 @@ void PipelineBlockingDriversAction::_handle_stat(HttpRequest* req) {
                 if (driver_list_it == fragment_map.end()) {
                     driver_list_it = fragment_map.emplace(fragment_id, DriverInfoList()).first;
                 }
-                driver_list_it->second.emplace_back(driver_id, state, std::move(driver_desc), is_cancelled, status);
+                driver_list_it->second.emplace_back(driver_id, state, std::move(driver_desc), is_cancelled, status,
+                                                    blocked_time_ns);
             };
         };
 
@@ -85,6 +85,9 @@ void QueryCacheAction::_handle_stat(HttpRequest* req) {
         root.AddMember("lookup_count", rapidjson::Value(lookup_count), allocator);
         root.AddMember("hit_count", rapidjson::Value(hit_count), allocator);
         root.AddMember("hit_ratio", rapidjson::Value(hit_ratio), allocator);
+        root.AddMember("hit_bytes", rapidjson::Value(cache_mgr->hit_bytes()), allocator);
+        root.AddMember("populate_count", rapidjson::Value(cache_mgr->populate_count()), allocator);
+        root.AddMember("populate_bytes", rapidjson::Value(cache_mgr->populate_bytes()), allocator);
     });
 }
 
@@ -257,7 +257,10 @@ Status CacheInputStream::_populate_to_cache(const int64_t offset, const int64_t
             _stats.write_cache_bytes += write_size;
             _stats.write_mem_cache_bytes += options.stats.write_mem_bytes;
             _stats.write_disk_cache_bytes += options.stats.write_disk_bytes;
-        } else if (!r.is_already_exist() && !r.is_resource_busy()) {
+        } else if (r.is_cancelled() || r.is_resource_busy()) {
+            _stats.skip_write_cache_count += 1;
+            _stats.skip_write_cache_bytes += write_size;
+        } else if (!r.is_already_exist()) {
             _stats.write_cache_fail_count += 1;
             _stats.write_cache_fail_bytes += write_size;
             LOG(WARNING) << "write block cache failed, errmsg: " << r.message();
@@ -291,7 +294,10 @@ void CacheInputStream::_deduplicate_shared_buffer(const SharedBufferPtr& sb) {
     // It is impossible that all block exists in block_map because we check block map before
     // reading remote storage.
     for (int64_t i = start_block_id; i <= end_block_id; ++i) {
-        _block_map.erase(i);
+        auto iter = _block_map.find(i);
+        if (iter != _block_map.end() && !iter->second.peeked) {
+            _block_map.erase(iter);
+        }
     }
 
     if (sb->buffer.capacity() == 0) {
@@ -414,13 +420,72 @@ StatusOr<std::string_view> CacheInputStream::peek(int64_t count) {
     // if app level uses zero copy read, it does bypass the cache layer.
     // so here we have to fill cache manually.
     SharedBufferPtr sb;
-    ASSIGN_OR_RETURN(auto s, _sb_stream->peek_shared_buffer(count, &sb));
+    auto ret = _sb_stream->peek_shared_buffer(count, &sb);
+    if (!ret.ok()) {
+        // the data may be served from the block buffer if it is cached, which saves a copy into the caller.
+        if (_enable_block_buffer) {
+            auto block_ret = _peek_block_buffer(count);
+            if (block_ret.ok()) {
+                return block_ret;
+            }
+        }
+        return ret;
+    }
+    auto s = ret.value();
     if (_enable_populate_cache) {
         _populate_cache_from_zero_copy_buffer(s.data(), _offset, count, sb);
     }
     return s;
 }
 
+StatusOr<std::string_view> CacheInputStream::_peek_block_buffer(int64_t count) {
+    const int64_t block_id = _offset / _block_size;
+    const int64_t block_offset = block_id * _block_size;
+    const int64_t load_size = std::min(_block_size, _size - block_offset);
+    if (count <= 0 || _offset + count > block_offset + load_size) {
+        return Status::NotSupported("peek range crosses the block boundary");
+    }
+
+    auto iter = _block_map.find(block_id);
+    if (iter != _block_map.end()) {
+        _stats.read_block_buffer_bytes += count;
+        _stats.read_block_buffer_count += 1;
+    } else {
+        BlockBuffer block;
+        ReadCacheOptions options;
+        options.use_adaptor = _enable_cache_io_adaptor;
+        int64_t read_cache_ns = 0;
+        Status res;
+        {
+            SCOPED_RAW_TIMER(&read_cache_ns);
+            res = _cache->read_buffer(_cache_key, block_offset, load_size, &block.buffer, &options);
+        }
+        if (res.is_resource_busy()) {
+            _stats.skip_read_cache_count += 1;
+            _stats.skip_read_cache_bytes += load_size;
+        }
+        RETURN_IF_ERROR(res);
+        _stats.read_cache_bytes += load_size;
+        _stats.read_cache_count += 1;
+        _stats.read_mem_cache_bytes += options.stats.read_mem_bytes;
+        _stats.read_disk_cache_bytes += options.stats.read_disk_bytes;
+        _stats.read_cache_ns += read_cache_ns;
+        if (_enable_cache_io_adaptor) {
+            _cache->record_read_cache(load_size, read_cache_ns / 1000);
+        }
+        block.offset = block_offset;
+        _block_map[block_id] = block;
+        iter = _block_map.find(block_id);
+    }
+
+    std::string_view view = iter->second.buffer.peek(_offset - block_offset, count);
+    if (static_cast<int64_t>(view.size()) != count) {
+        return Status::NotSupported("peek range is not contiguous in the block buffer");
+    }
+    iter->second.peeked = true;
+    return view;
+}
+
 void CacheInputStream::_populate_cache_from_zero_copy_buffer(const char* p, int64_t offset, int64_t count,
                                                              const SharedBufferPtr& sb) {
     BlockCache* cache = BlockCache::instance();
@@ -445,10 +510,11 @@ void CacheInputStream::_populate_cache_from_zero_copy_buffer(const char* p, int6
             _stats.write_cache_bytes += size;
             _stats.write_mem_cache_bytes += options.stats.write_mem_bytes;
             _stats.write_disk_cache_bytes += options.stats.write_disk_bytes;
-        } else if (r.is_cancelled()) {
+        } else if (r.is_cancelled() || r.is_resource_busy()) {
+            // The write is dropped because it isn't admitted or the cache is under write pressure.
             _stats.skip_write_cache_count += 1;
             _stats.skip_write_cache_bytes += size;
-        } else if (!r.is_already_exist() && !r.is_resource_busy()) {
+        } else if (!r.is_already_exist()) {
             _stats.write_cache_fail_count += 1;
             _stats.write_cache_fail_bytes += size;
             LOG(WARNING) << "write block cache failed, errmsg: " << r.message();
@@ -84,11 +84,15 @@ private:
     struct BlockBuffer {
         int64_t offset;
         IOBuffer buffer;
+        // The buffer is referenced by a peeked view, so it must be kept until the stream is destroyed.
+        bool peeked = false;
     };
     using SharedBufferPtr = SharedBufferedInputStream::SharedBufferPtr;
 
     // Read block from local, if not found, will return Status::NotFound();
     Status _read_block_from_local(const int64_t offset, const int64_t size, char* out);
+    // Peek the range from the block buffer without copying, the range must be inside a single cached block.
+    StatusOr<std::string_view> _peek_block_buffer(int64_t count);
     // Read multiple blocks from remote
     Status _read_blocks_from_remote(const int64_t offset, const int64_t size, char* out);
     Status _populate_to_cache(const int64_t offset, const int64_t size, char* src);
@@ -14,6 +14,7 @@
 
 #include "io_profiler.h"
 
+#include <cmath>
 #include <mutex>
 #include <thread>
 #include <unordered_set>
@@ -56,25 +57,61 @@ void IOProfiler::stop() {
     ::usleep(50000);
 }
 
+// Latencies are recorded into log2 buckets of microseconds, the i-th bucket holds [2^(i-1), 2^i) us,
+// and the first one holds IOs shorter than 1us.
+static constexpr int kLatencyBucketNum = 32;
+
+static int latency_bucket(int64_t latency_ns) {
+    uint64_t latency_us = latency_ns > 0 ? latency_ns / 1000 : 0;
+    if (latency_us == 0) {
+        return 0;
+    }
+    return std::min(kLatencyBucketNum - 1, 64 - __builtin_clzll(latency_us));
+}
+
+// Return the upper bound in microseconds of the bucket containing the given percentile.
+static uint64_t latency_percentile_us(const std::atomic<uint32_t>* hist, double percentile) {
+    uint64_t total = 0;
+    for (int i = 0; i < kLatencyBucketNum; ++i) {
+        total += hist[i].load(std::memory_order_relaxed);
+    }
+    if (total == 0) {
+        return 0;
+    }
+    auto target = static_cast<uint64_t>(std::ceil(total * percentile));
+    uint64_t count = 0;
+    for (int i = 0; i < kLatencyBucketNum; ++i) {
+        count += hist[i].load(std::memory_order_relaxed);
+        if (count >= target) {
+            return 1UL << i;
+        }
+    }
+    return 1UL << (kLatencyBucketNum - 1);
+}
+
 struct IOStatEntry {
     uint64_t id{0};
     std::atomic<uint64_t> read_bytes{0};
     std::atomic<uint64_t> write_bytes{0};
     std::atomic<uint32_t> read_ops{0};
     std::atomic<uint32_t> write_ops{0};
+    std::atomic<uint32_t> read_latency_hist[kLatencyBucketNum]{};
+    std::atomic<uint32_t> write_latency_hist[kLatencyBucketNum]{};
 
     IOStatEntry(uint64_t id) : id(id) {}
 
     bool operator==(const IOStatEntry& other) const { return id == other.id; }
 
-    void add_read(uint64_t bytes) {
+    void add_read(uint64_t bytes, int64_t latency_ns) {
         this->read_bytes.fetch_add(bytes);
         this->read_ops.fetch_add(1);
+        this->read_latency_hist[latency_bucket(latency_ns)].fetch_add(1, std::memory_order_relaxed);
     }
 
-    void add_write(uint64_t bytes) {
+    void add_write(uint64_t bytes, int64_t latency_ns) {
         this->write_bytes.fetch_add(bytes);
         this->write_ops.fetch_add(1);
+        this->write_latency_hist[latency_bucket(latency_ns)].fetch_add(1, std::memory_order_relaxed);
     }
 
     void clear() {
@@ -82,19 +119,28 @@ struct IOStatEntry {
         this->read_ops = 0;
         this->write_bytes = 0;
         this->write_ops = 0;
+        for (int i = 0; i < kLatencyBucketNum; ++i) {
+            this->read_latency_hist[i] = 0;
+            this->write_latency_hist[i] = 0;
+        }
     }
 
     static std::string header_string() {
-        return fmt::format("{:>10} {:>10} {:>16} {:>8} {:>16} {:>8} {:>16} {:>8}", "Tablet", "TAG", "read_bytes", "ops",
-                           "write_bytes", "ops", "total_bytes", "ops");
+        return fmt::format("{:>10} {:>10} {:>16} {:>8} {:>16} {:>8} {:>16} {:>8} {:>12} {:>12} {:>12} {:>12}",
+                           "Tablet", "TAG", "read_bytes", "ops", "write_bytes", "ops", "total_bytes", "ops",
+                           "read_p50_us", "read_p99_us", "write_p50_us", "write_p99_us");
     }
 
     std::string to_string() const {
         uint32_t tag = id >> 48UL;
         uint64_t tablet_id = id & 0x0000FFFFFFFFFFFFUL;
-        return fmt::format("{:>10} {:>10} {:>16} {:>8} {:>16} {:>8} {:>16} {:>8}", tablet_id,
-                           IOProfiler::tag_to_string(tag), read_bytes.load(), read_ops.load(), write_bytes.load(),
-                           write_ops.load(), read_bytes + write_bytes, read_ops + write_ops);
+        return fmt::format("{:>10} {:>10} {:>16} {:>8} {:>16} {:>8} {:>16} {:>8} {:>12} {:>12} {:>12} {:>12}",
+                           tablet_id, IOProfiler::tag_to_string(tag), read_bytes.load(), read_ops.load(),
+                           write_bytes.load(), write_ops.load(), read_bytes + write_bytes, read_ops + write_ops,
+                           latency_percentile_us(read_latency_hist, 0.5),
+                           latency_percentile_us(read_latency_hist, 0.99),
+                           latency_percentile_us(write_latency_hist, 0.5),
+                           latency_percentile_us(write_latency_hist, 0.99));
     }
 };
 
@@ -159,15 +205,15 @@ void IOProfiler::clear_context() {
     current_io_stat = nullptr;
 }
 
-void IOProfiler::_add_context_read(int64_t bytes) {
+void IOProfiler::_add_context_read(int64_t bytes, int64_t latency_ns) {
     if (current_io_stat != nullptr) {
-        current_io_stat->add_read(bytes);
+        current_io_stat->add_read(bytes, latency_ns);
     }
 }
 
-void IOProfiler::_add_context_write(int64_t bytes) {
+void IOProfiler::_add_context_write(int64_t bytes, int64_t latency_ns) {
     if (current_io_stat != nullptr) {
-        current_io_stat->add_write(bytes);
+        current_io_stat->add_write(bytes, latency_ns);
     }
 }
 
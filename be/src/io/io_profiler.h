@@ -110,14 +110,14 @@ public:
     static inline void add_read(int64_t bytes, int64_t latency_ns) {
         _add_tls_read(bytes, latency_ns);
         if (_context_io_mode & IOMode::IOMODE_READ) {
-            _add_context_read(bytes);
+            _add_context_read(bytes, latency_ns);
         }
     }
 
     static inline void add_write(int64_t bytes, int64_t latency_ns) {
         _add_tls_write(bytes, latency_ns);
         if (_context_io_mode & IOMode::IOMODE_WRITE) {
-            _add_context_write(bytes);
+            _add_context_write(bytes, latency_ns);
         }
     }
 
@@ -146,8 +146,8 @@ protected:
     static void _add_tls_sync(int64_t latency_ns);
 
     // Update io statistics associated with a context, such as tag + tablet_id
-    static void _add_context_read(int64_t bytes);
-    static void _add_context_write(int64_t bytes);
+    static void _add_context_read(int64_t bytes, int64_t latency_ns);
+    static void _add_context_write(int64_t bytes, int64_t latency_ns);
 
     static std::atomic<uint32_t> _context_io_mode;
 };
@@ -20,6 +20,10 @@
 #include <aws/s3/model/HeadObjectRequest.h>
 #include <fmt/format.h>
 
+#include <vector>
+
+#include "common/config.h"
+
 #ifdef USE_STAROS
 #include "fslib/metric_key.h"
 #include "metrics/metrics.h"
@@ -41,6 +45,15 @@ StatusOr<int64_t> S3InputStream::read(void* out, int64_t count) {
         return 0;
     }
 
+    const int64_t part_size = config::s3_read_parallel_part_size;
+    if (part_size > 0 && config::s3_read_max_parallel_parts > 1) {
+        int64_t num_bytes = std::min<int64_t>(count, _size - _offset);
+        if (num_bytes >= 2 * part_size) {
+            int64_t num_parts = std::min<int64_t>(num_bytes / part_size, config::s3_read_max_parallel_parts);
+            return _read_parallel(out, num_bytes, num_parts);
+        }
+    }
+
     auto range = fmt::format("bytes={}-{}", _offset, std::min<int64_t>(_offset + count, _size));
     Aws::S3::Model::GetObjectRequest request;
     request.SetBucket(_bucket);
@@ -58,6 +71,49 @@ StatusOr<int64_t> S3InputStream::read(void* out, int64_t count) {
     }
 }
 
+StatusOr<int64_t> S3InputStream::_read_parallel(void* out, int64_t count, int64_t num_parts) {
+    const int64_t part_size = (count + num_parts - 1) / num_parts;
+    std::vector<Aws::S3::Model::GetObjectRequest> requests(num_parts);
+    std::vector<Aws::S3::Model::GetObjectOutcomeCallable> outcomes;
+    outcomes.reserve(num_parts);
+    for (int64_t i = 0; i < num_parts; i++) {
+        int64_t begin = _offset + i * part_size;
+        int64_t end = std::min(begin + part_size, _offset + count);
+        requests[i].SetBucket(_bucket);
+        requests[i].SetKey(_object);
+        // the end of http range is inclusive
+        requests[i].SetRange(fmt::format("bytes={}-{}", begin, end - 1));
+        outcomes.emplace_back(_s3client->GetObjectCallable(requests[i]));
+    }
+
+    // wait for all the requests even if some fail, they reference `requests`.
+    Status status;
+    int64_t bytes_read = 0;
+    bool contiguous = true;
+    for (int64_t i = 0; i < num_parts; i++) {
+        Aws::S3::Model::GetObjectOutcome outcome = outcomes[i].get();
+        if (!status.ok()) {
+            continue;
+        }
+        if (!outcome.IsSuccess()) {
+            status = make_error_status(outcome.GetError());
+            continue;
+        }
+        int64_t part_offset = i * part_size;
+        int64_t expected = std::min(part_size, count - part_offset);
+        Aws::IOStream& body = outcome.GetResult().GetBody();
+        body.read(static_cast<char*>(out) + part_offset, expected);
+        // only the bytes before the first short part are returned
+        if (contiguous) {
+            bytes_read += body.gcount();
+            contiguous = body.gcount() == expected;
+        }
+    }
+    RETURN_IF_ERROR(status);
+    _offset += bytes_read;
+    return bytes_read;
+}
+
 Status S3InputStream::seek(int64_t offset) {
     if (offset < 0) return Status::InvalidArgument(fmt::format("Invalid offset {}", offset));
     _offset = offset;
@@ -53,6 +53,9 @@ public:
     StatusOr<std::string> read_all() override;
 
 private:
+    // read [_offset, _offset + count) by `num_parts` concurrent GetObject requests.
+    StatusOr<int64_t> _read_parallel(void* data, int64_t count, int64_t num_parts);
+
     std::shared_ptr<Aws::S3::S3Client> _s3client;
     std::string _bucket;
     std::string _object;
@@ -16,16 +16,72 @@
 
 #include <gutil/strings/substitute.h>
 
+#include <mutex>
+#include <unordered_map>
+
 #include "common/config.h"
 #include "gutil/strings/fastmem.h"
 #include "runtime/current_thread.h"
 #include "util/runtime_profile.h"
+#include "util/time.h"
 
 namespace starrocks::io {
 
+// reads smaller than this are dominated by the request latency,
+// and reads larger than this are dominated by the throughput.
+static constexpr int64_t kLatencyBoundReadSize = 64 * 1024;
+static constexpr int64_t kThroughputBoundReadSize = 1024 * 1024;
+
+IOCostModel* IOCostModel::get(const std::string& filename) {
+    static std::mutex mutex;
+    static std::unordered_map<std::string, std::unique_ptr<IOCostModel>> models;
+    auto pos = filename.find("://");
+    std::string scheme = pos == std::string::npos ? std::string() : filename.substr(0, pos);
+    std::lock_guard l(mutex);
+    auto& model = models[scheme];
+    if (model == nullptr) {
+        model = std::make_unique<IOCostModel>();
+    }
+    return model.get();
+}
+
+void IOCostModel::update(int64_t bytes, int64_t elapsed_ns) {
+    if (elapsed_ns <= 0) {
+        return;
+    }
+    // exponential moving average with weight 1/8, races between readers only lose a sample.
+    auto ewma = [](std::atomic<int64_t>& value, int64_t sample) {
+        int64_t old_value = value.load(std::memory_order_relaxed);
+        value.store(old_value == 0 ? sample : old_value + (sample - old_value) / 8, std::memory_order_relaxed);
+    };
+    if (bytes <= kLatencyBoundReadSize) {
+        ewma(_latency_ns, elapsed_ns);
+    } else if (bytes >= kThroughputBoundReadSize) {
+        ewma(_bytes_per_second, static_cast<int64_t>(static_cast<double>(bytes) * 1e9 / elapsed_ns));
+    }
+}
+
+int64_t IOCostModel::break_even_gap() const {
+    return static_cast<int64_t>(static_cast<double>(latency_ns()) * bytes_per_second() / 1e9);
+}
+
 SharedBufferedInputStream::SharedBufferedInputStream(std::shared_ptr<SeekableInputStream> stream, std::string filename,
                                                      size_t file_size)
-        : _stream(std::move(stream)), _filename(std::move(filename)), _file_size(file_size) {}
+        : _stream(std::move(stream)),
+          _filename(std::move(filename)),
+          _cost_model(IOCostModel::get(_filename)),
+          _file_size(file_size) {}
+
+int64_t SharedBufferedInputStream::_coalesce_dist_size() const {
+    if (!_options.adaptive_dist_size) {
+        return _options.max_dist_size;
+    }
+    int64_t gap = _cost_model->break_even_gap();
+    if (gap <= 0) {
+        return _options.max_dist_size;
+    }
+    return std::min(gap, _options.max_buffer_size);
+}
 
 void SharedBufferedInputStream::SharedBuffer::align(int64_t align_size, int64_t file_size) {
     if (align_size != 0) {
@@ -68,13 +124,19 @@ Status SharedBufferedInputStream::_sort_and_check_overlap(std::vector<IORange>&
 
 void SharedBufferedInputStream::_merge_small_ranges(const std::vector<IORange>& small_ranges) {
     if (small_ranges.size() > 0) {
+        const int64_t max_dist_size = _coalesce_dist_size();
         auto update_map = [&](size_t from, size_t to) {
             // merge from [unmerge, i-1]
             int64_t ref_count = (to - from + 1);
             int64_t end = (small_ranges[to].offset + small_ranges[to].size);
+            int64_t request_size = 0;
+            for (size_t i = from; i <= to; i++) {
+                request_size += small_ranges[i].size;
+            }
             SharedBufferPtr sb(new SharedBuffer{.raw_offset = small_ranges[from].offset,
                                                 .raw_size = end - small_ranges[from].offset,
-                                                .ref_count = ref_count});
+                                                .ref_count = ref_count,
+                                                .request_size = request_size});
             sb->align(_align_size, _file_size);
             _map.insert(std::make_pair(sb->raw_offset + sb->raw_size, sb));
         };
@@ -86,7 +148,7 @@ void SharedBufferedInputStream::_merge_small_ranges(const std::vector<IORange>&
             size_t now_end = now.offset + now.size;
             size_t prev_end = prev.offset + prev.size;
             if (((now_end - small_ranges[unmerge].offset) <= _options.max_buffer_size) &&
-                (now.offset - prev_end) <= _options.max_dist_size) {
+                (now.offset - prev_end) <= max_dist_size) {
                 continue;
             } else {
                 update_map(unmerge, i - 1);
@@ -108,7 +170,8 @@ Status SharedBufferedInputStream::_set_io_ranges_all_columns(const std::vector<I
     std::vector<IORange> small_ranges;
     for (const IORange& r : check) {
         if (r.size > _options.max_buffer_size) {
-            SharedBufferPtr sb(new SharedBuffer{.raw_offset = r.offset, .raw_size = r.size, .ref_count = 1});
+            SharedBufferPtr sb(new SharedBuffer{
+                    .raw_offset = r.offset, .raw_size = r.size, .ref_count = 1, .request_size = r.size});
             sb->align(_align_size, _file_size);
             _map.insert(std::make_pair(sb->raw_offset + sb->raw_size, sb));
         } else {
@@ -137,7 +200,8 @@ Status SharedBufferedInputStream::_set_io_ranges_active_and_lazy_columns(const s
     for (auto index = 0; index < check.size(); ++index) {
         const IORange& r = check[index];
         if (r.size > _options.max_buffer_size) {
-            SharedBufferPtr sb(new SharedBuffer{.raw_offset = r.offset, .raw_size = r.size, .ref_count = 1});
+            SharedBufferPtr sb(new SharedBuffer{
+                    .raw_offset = r.offset, .raw_size = r.size, .ref_count = 1, .request_size = r.size});
             sb->align(_align_size, _file_size);
             _map.insert(std::make_pair(sb->raw_offset + sb->raw_size, sb));
         } else {
@@ -168,6 +232,7 @@ Status SharedBufferedInputStream::_set_io_ranges_active_and_lazy_columns(const s
                 SharedBufferPtr& sb = iter->second;
                 if (sb->offset <= r.offset && sb->offset + sb->size >= r.offset + r.size) {
                     sb->ref_count++;
+                    sb->request_size += r.size;
                     continue;
                 }
             }
@@ -220,13 +285,16 @@ Status SharedBufferedInputStream::get_bytes(const uint8_t** buffer, size_t offse
         SCOPED_RAW_TIMER(&_shared_io_timer);
         _shared_io_count += 1;
         _shared_io_bytes += sb.size;
+        _shared_request_io_bytes += sb.request_size;
         if (sb.size > sb.raw_size) {
             // after called _deduplicate_shared_buffer(), sb.size maybe is larger than sb.raw_size
             // we will count how many extra bytes we read because of alignment.
             _shared_align_io_bytes += sb.size - sb.raw_size;
         }
         sb.buffer.reserve(sb.size);
+        int64_t start_ns = MonotonicNanos();
         RETURN_IF_ERROR(_stream->read_at_fully(sb.offset, sb.buffer.data(), sb.size));
+        _cost_model->update(sb.size, MonotonicNanos() - start_ns);
     }
     *buffer = sb.buffer.data() + offset - sb.offset;
     return Status::OK();
@@ -247,7 +315,9 @@ Status SharedBufferedInputStream::read_at_fully(int64_t offset, void* out, int64
         SCOPED_RAW_TIMER(&_direct_io_timer);
         _direct_io_count += 1;
         _direct_io_bytes += count;
+        int64_t start_ns = MonotonicNanos();
         RETURN_IF_ERROR(_stream->read_at_fully(offset, out, count));
+        _cost_model->update(count, MonotonicNanos() - start_ns);
         return Status::OK();
     }
     const uint8_t* buffer = nullptr;
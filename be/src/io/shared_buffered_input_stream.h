@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -23,6 +24,26 @@
 
 namespace starrocks::io {
 
+// Cost of reads observed on one kind of storage (the scheme of the file path), shared by all streams.
+// A read of n bytes takes about `latency + n / throughput`, so reading through a gap smaller than
+// `latency * throughput` bytes is cheaper than issuing another request.
+class IOCostModel {
+public:
+    static IOCostModel* get(const std::string& filename);
+
+    void update(int64_t bytes, int64_t elapsed_ns);
+
+    // return 0 if there are no enough samples yet.
+    int64_t break_even_gap() const;
+
+    int64_t latency_ns() const { return _latency_ns.load(std::memory_order_relaxed); }
+    int64_t bytes_per_second() const { return _bytes_per_second.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<int64_t> _latency_ns{0};
+    std::atomic<int64_t> _bytes_per_second{0};
+};
+
 class SharedBufferedInputStream : public SeekableInputStream {
 public:
     struct IORange {
@@ -37,6 +58,9 @@ public:
         static constexpr int64_t MB = 1024 * 1024;
         int64_t max_dist_size = 1 * MB;
         int64_t max_buffer_size = 8 * MB;
+        // pick the max distance of merged ranges from the observed cost of the storage,
+        // `max_dist_size` is used until there are enough samples.
+        bool adaptive_dist_size = false;
     };
     struct SharedBuffer {
         // request range
@@ -46,6 +70,8 @@ public:
         int64_t offset;
         int64_t size;
         int64_t ref_count;
+        // total size of the requested ranges in this buffer, the rest are the gaps read through
+        int64_t request_size = 0;
         std::vector<uint8_t> buffer;
         void align(int64_t align_size, int64_t file_size);
         std::string debug_string() const;
@@ -86,6 +112,7 @@ public:
     int64_t shared_io_count() const { return _shared_io_count; }
     int64_t shared_io_bytes() const { return _shared_io_bytes; }
     int64_t shared_align_io_bytes() const { return _shared_align_io_bytes; }
+    int64_t shared_request_io_bytes() const { return _shared_request_io_bytes; }
     int64_t shared_io_timer() const { return _shared_io_timer; }
     int64_t direct_io_count() const { return _direct_io_count; }
     int64_t direct_io_bytes() const { return _direct_io_bytes; }
@@ -99,12 +126,14 @@ public:
 
 private:
     void _update_estimated_mem_usage();
+    int64_t _coalesce_dist_size() const;
     Status _sort_and_check_overlap(std::vector<IORange>& ranges);
     void _merge_small_ranges(const std::vector<IORange>& ranges);
     Status _set_io_ranges_all_columns(const std::vector<IORange>& ranges);
     Status _set_io_ranges_active_and_lazy_columns(const std::vector<IORange>& ranges);
     const std::shared_ptr<SeekableInputStream> _stream;
     const std::string _filename;
+    IOCostModel* _cost_model;
     std::map<int64_t, SharedBufferPtr> _map;
     CoalesceOptions _options;
     int64_t _offset = 0;
@@ -112,6 +141,7 @@ private:
     int64_t _shared_io_count = 0;
     int64_t _shared_io_bytes = 0;
     int64_t _shared_align_io_bytes = 0;
+    int64_t _shared_request_io_bytes = 0;
     int64_t _shared_io_timer = 0;
     int64_t _direct_io_count = 0;
     int64_t _direct_io_bytes = 0;
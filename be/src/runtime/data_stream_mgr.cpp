@@ -34,6 +34,7 @@
 
 #include "runtime/data_stream_mgr.h"
 
+#include <atomic>
 #include <iostream>
 #include <utility>
 
@@ -128,6 +129,73 @@ std::shared_ptr<DataStreamRecvr> DataStreamMgr::find_recvr(const TUniqueId& frag
 }
 
 Status DataStreamMgr::transmit_chunk(const PTransmitChunkParams& request, ::google::protobuf::Closure** done) {
+    if (request.batched_requests_size() > 0) {
+        return _transmit_batched_chunks(request, done);
+    }
+    return _transmit_chunk(request, done);
+}
+
+namespace {
+// BatchedRequestsClosure runs the done closure of a coalesced rpc, after the closure is released by all the
+// batched requests. A receiver may hold the closure of a request to apply back pressure to the sender.
+class BatchedRequestsClosure final : public google::protobuf::Closure {
+public:
+    explicit BatchedRequestsClosure(google::protobuf::Closure* done) : _done(done) {}
+    ~BatchedRequestsClosure() override = default;
+
+    void ref() { _refs.fetch_add(1); }
+    bool has_only_one_ref() const { return _refs.load() == 1; }
+    google::protobuf::Closure* release_done() { return std::exchange(_done, nullptr); }
+
+    void Run() override {
+        if (_refs.fetch_sub(1) == 1) {
+            if (_done != nullptr) {
+                _done->Run();
+            }
+            delete this;
+        }
+    }
+
+private:
+    google::protobuf::Closure* _done;
+    std::atomic<int> _refs{0};
+};
+} // namespace
+
+Status DataStreamMgr::_transmit_batched_chunks(const PTransmitChunkParams& request,
+                                               ::google::protobuf::Closure** done) {
+    auto* batched_done = new BatchedRequestsClosure(*done);
+    // The reference of this function.
+    batched_done->ref();
+
+    Status st;
+    for (const auto& batched_request : request.batched_requests()) {
+        batched_done->ref();
+        google::protobuf::Closure* request_done = batched_done;
+        st = _transmit_chunk(batched_request, &request_done);
+        if (request_done != nullptr) {
+            request_done->Run();
+        }
+        if (!st.ok()) {
+            break;
+        }
+    }
+
+    if (batched_done->has_only_one_ref()) {
+        // No receiver holds the closure, so return the done closure to the caller to set the status and run it.
+        *done = batched_done->release_done();
+        delete batched_done;
+        return st;
+    }
+    *done = nullptr;
+    batched_done->Run();
+    if (!st.ok()) {
+        LOG(WARNING) << "failed to transmit coalesced chunks: " << st;
+    }
+    return st;
+}
+
+Status DataStreamMgr::_transmit_chunk(const PTransmitChunkParams& request, ::google::protobuf::Closure** done) {
     const PUniqueId& finst_id = request.finst_id();
     // TODO(zc): Use PUniqueId directly
     // We can use PUniqueId directly, because old version StarRocks has already use
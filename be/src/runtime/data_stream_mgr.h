@@ -98,6 +98,7 @@ public:
                                                   std::shared_ptr<QueryStatisticsRecvr> sub_plan_query_statistics_recvr,
                                                   bool is_pipeline, int32_t degree_of_parallelism, bool keep_order);
 
+    // The coalesced requests in request.batched_requests are dispatched to their own receivers.
     Status transmit_chunk(const PTransmitChunkParams& request, ::google::protobuf::Closure** done);
     // Closes all receivers registered for fragment_instance_id immediately.
     void cancel(const TUniqueId& fragment_instance_id);
@@ -108,6 +109,9 @@ public:
     PassThroughChunkBuffer* get_pass_through_chunk_buffer(const TUniqueId& query_id);
 
 private:
+    Status _transmit_chunk(const PTransmitChunkParams& request, ::google::protobuf::Closure** done);
+    Status _transmit_batched_chunks(const PTransmitChunkParams& request, ::google::protobuf::Closure** done);
+
     friend class DataStreamRecvr;
     static const uint32_t BUCKET_NUM = 127;
 
@@ -247,6 +247,7 @@ Status DataStreamRecvr::add_chunks(const PTransmitChunkParams& request, ::google
     int use_sender_id = _is_merging ? request.sender_id() : 0;
     // Add all batches to the same queue if _is_merging is false.
 
+    DeferOp notify_op([this] { _observable.notify_observers(); });
     if (_keep_order) {
         DCHECK(_is_pipeline);
         return _sender_queues[use_sender_id]->add_chunks_and_keep_order(request, metrics, done);
@@ -258,12 +259,14 @@ Status DataStreamRecvr::add_chunks(const PTransmitChunkParams& request, ::google
 void DataStreamRecvr::remove_sender(int sender_id, int be_number) {
     int use_sender_id = _is_merging ? sender_id : 0;
     _sender_queues[use_sender_id]->decrement_senders(be_number);
+    _observable.notify_observers();
 }
 
 void DataStreamRecvr::cancel_stream() {
     for (auto& _sender_queue : _sender_queues) {
         _sender_queue->cancel();
     }
+    _observable.notify_observers();
 }
 
 void DataStreamRecvr::close() {
@@ -281,6 +284,7 @@ void DataStreamRecvr::close() {
     _chunks_merger.reset();
     _cascade_merger.reset();
     _closed = true;
+    _observable.notify_observers();
 }
 
 DataStreamRecvr::~DataStreamRecvr() {
@@ -39,6 +39,7 @@
 #include "column/vectorized_fwd.h"
 #include "common/object_pool.h"
 #include "common/status.h"
+#include "exec/pipeline/pipeline_observer.h"
 #include "exec/sorting/merge_path.h"
 #include "gen_cpp/Types_types.h" // for TUniqueId
 #include "runtime/descriptors.h"
@@ -132,6 +133,10 @@ public:
 
     bool get_encode_level() const { return _encode_level; }
 
+    // The observers are notified when chunks arrive, a sender is done, or the stream is cancelled or closed.
+    void attach_observer(pipeline::PipelineObserver* observer) { _observable.add_observer(observer); }
+    void detach_observer(pipeline::PipelineObserver* observer) { _observable.remove_observer(observer); }
+
 private:
     friend class DataStreamMgr;
     class SenderQueue;
@@ -190,6 +195,9 @@ private:
     // receiver and placed in _sender_queue_pool.
     std::vector<SenderQueue*> _sender_queues;
 
+    // Observers of the pipeline drivers blocked on this receiver.
+    pipeline::Observable _observable;
+
     // SortedChunksMerger merges chunks from different senders.
     std::unique_ptr<SortedChunksMerger> _chunks_merger;
     std::unique_ptr<ChunkMerger> _cascade_merger;
@@ -332,6 +332,7 @@ Status ExecEnv::init(const std::vector<StorePath>& store_paths, bool as_cn) {
                     .set_idle_timeout(MonoDelta::FromMilliseconds(config::streaming_load_thread_pool_idle_time_ms))
                     .build(&streaming_load_pool));
     _streaming_load_thread_pool = streaming_load_pool.release();
+    REGISTER_THREAD_POOL_METRICS(stream_load_io, _streaming_load_thread_pool);
 
     _udf_call_pool = new PriorityThreadPool("udf", config::udf_thread_pool_size, config::udf_thread_pool_size);
     _fragment_mgr = new FragmentMgr(this);
@@ -342,6 +343,7 @@ Status ExecEnv::init(const std::vector<StorePath>& store_paths, bool as_cn) {
                             .set_max_queue_size(1000)
                             .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
                             .build(&_automatic_partition_pool));
+    REGISTER_THREAD_POOL_METRICS(automatic_partition, _automatic_partition_pool);
 
     int num_prepare_threads = config::pipeline_prepare_thread_pool_thread_num;
     if (num_prepare_threads == 0) {
@@ -390,6 +392,19 @@ Status ExecEnv::init(const std::vector<StorePath>& store_paths, bool as_cn) {
                             .set_max_queue_size(INT32_MAX) // unlimit queue size
                             .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
                             .build(&_dictionary_cache_pool));
+    REGISTER_THREAD_POOL_METRICS(dictionary_cache, _dictionary_cache_pool);
+
+    int num_hash_join_build_threads = config::hash_join_build_thread_pool_thread_num;
+    if (num_hash_join_build_threads <= 0) {
+        num_hash_join_build_threads = CpuInfo::num_cores();
+    }
+    RETURN_IF_ERROR(ThreadPoolBuilder("hash_join_build") // thread pool for the parallel build of hash join
+                            .set_min_threads(0)
+                            .set_max_threads(num_hash_join_build_threads)
+                            .set_max_queue_size(INT32_MAX)
+                            .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
+                            .build(&_hash_join_build_pool));
+    REGISTER_THREAD_POOL_METRICS(hash_join_build, _hash_join_build_pool);
 
     std::unique_ptr<ThreadPool> driver_executor_thread_pool;
     _max_executor_threads = CpuInfo::num_cores();
@@ -657,6 +672,10 @@ void ExecEnv::stop() {
         _dictionary_cache_pool->shutdown();
     }
 
+    if (_hash_join_build_pool) {
+        _hash_join_build_pool->shutdown();
+    }
+
 #ifndef BE_TEST
     close_s3_clients();
 #endif
@@ -714,6 +733,7 @@ void ExecEnv::destroy() {
     SAFE_DELETE(_lake_replication_txn_manager);
     SAFE_DELETE(_cache_mgr);
     _dictionary_cache_pool.reset();
+    _hash_join_build_pool.reset();
     _automatic_partition_pool.reset();
     _metrics = nullptr;
 }
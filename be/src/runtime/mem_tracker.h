@@ -190,6 +190,15 @@ public:
         }
     }
 
+    int64_t max_child_consumption() const {
+        int64_t result = 0;
+        std::lock_guard<std::mutex> l(_child_trackers_lock);
+        for (const auto& child : _child_trackers) {
+            result = std::max(result, child->consumption());
+        }
+        return result;
+    }
+
     /// Increases consumption of this tracker and its ancestors by 'bytes' only if
     /// they can all consume 'bytes'. If this brings any of them over, none of them
     /// are updated.
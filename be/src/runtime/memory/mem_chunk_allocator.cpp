@@ -59,6 +59,7 @@ static IntCounter system_alloc_count(MetricUnit::NOUNIT);
 static IntCounter system_free_count(MetricUnit::NOUNIT);
 static IntCounter system_alloc_cost_ns(MetricUnit::NANOSECONDS);
 static IntCounter system_free_cost_ns(MetricUnit::NANOSECONDS);
+static IntCounter system_huge_page_alloc_count(MetricUnit::NOUNIT);
 
 #ifdef BE_TEST
 static std::mutex s_mutex;
@@ -134,6 +135,7 @@ void MemChunkAllocator::init_instance(MemTracker* mem_tracker, size_t reserve_li
     REGISTER_METIRC(system_free_count);
     REGISTER_METIRC(system_alloc_cost_ns);
     REGISTER_METIRC(system_free_cost_ns);
+    REGISTER_METIRC(system_huge_page_alloc_count);
 }
 
 MemChunkAllocator::MemChunkAllocator(MemTracker* mem_tracker, size_t reserve_limit)
@@ -198,6 +200,9 @@ bool MemChunkAllocator::allocate(size_t size, MemChunk* chunk) {
     }
     system_alloc_count.increment(1);
     system_alloc_cost_ns.increment(cost_ns);
+    if (SystemAllocator::use_huge_pages(size)) {
+        system_huge_page_alloc_count.increment(1);
+    }
     if (chunk->data == nullptr) {
         ret = false;
         return ret;
@@ -44,7 +44,8 @@
 
 namespace starrocks {
 
-#define PAGE_SIZE (4 * 1024) // 4K
+#define PAGE_SIZE (4 * 1024)              // 4K
+#define HUGE_PAGE_SIZE (2 * 1024 * 1024) // 2M
 
 uint8_t* SystemAllocator::allocate(MemTracker* mem_tracker, size_t length) {
     if (config::use_mmap_allocate_chunk) {
@@ -68,14 +69,27 @@ void SystemAllocator::free(MemTracker* mem_tracker, uint8_t* ptr, size_t length)
     }
 }
 
+bool SystemAllocator::use_huge_pages(size_t length) {
+    return config::madvise_huge_pages && length >= HUGE_PAGE_SIZE;
+}
+
+void SystemAllocator::advise_huge_pages(uint8_t* ptr, size_t length) {
+    // Large chunks are mostly hash table buckets and sort buffers that are touched all over,
+    // backing them with huge pages saves most of their page faults and TLB misses.
+    if (use_huge_pages(length) && madvise(ptr, length, MADV_HUGEPAGE) != 0) {
+        LOG_EVERY_N(WARNING, 1000) << "fail to madvise huge pages, errno=" << errno;
+    }
+}
+
 uint8_t* SystemAllocator::allocate_via_malloc(size_t length) {
     void* ptr = nullptr;
-    // try to use a whole page instead of parts of one page
-    int res = posix_memalign(&ptr, PAGE_SIZE, length);
+    // try to use a whole page instead of parts of one page, and whole huge pages for large chunks
+    int res = posix_memalign(&ptr, use_huge_pages(length) ? HUGE_PAGE_SIZE : PAGE_SIZE, length);
     if (res != 0) {
         PLOG(ERROR) << "fail to allocate mem via posix_memalign, res=" << res;
         return nullptr;
     }
+    advise_huge_pages((uint8_t*)ptr, length);
     return (uint8_t*)ptr;
 }
 
@@ -85,6 +99,7 @@ uint8_t* SystemAllocator::allocate_via_mmap(MemTracker* mem_tracker, size_t leng
         PLOG(ERROR) << "fail to allocate memory via mmap";
         return nullptr;
     }
+    advise_huge_pages(ptr, length);
     if (mem_tracker != nullptr) {
         mem_tracker->consume(length);
     }
@@ -49,7 +49,11 @@ public:
 
     static void free(MemTracker* mem_tracker, uint8_t* ptr, size_t length);
 
+    // Whether a chunk of `length` bytes is backed by transparent huge pages, see config::madvise_huge_pages.
+    static bool use_huge_pages(size_t length);
+
 private:
+    static void advise_huge_pages(uint8_t* ptr, size_t length);
     static uint8_t* allocate_via_mmap(MemTracker* mem_tracker, size_t length);
     static uint8_t* allocate_via_malloc(size_t length);
 };
@@ -178,8 +178,9 @@ StatusOr<TFetchDataResultPtrs> MysqlResultWriter::process_chunk(Chunk* chunk) {
         int current_rows = 0;
         SCOPED_TIMER(_convert_tuple_timer);
         auto result = std::make_unique<TFetchDataResult>();
-        auto& result_rows = result->result_batch.rows;
-        result_rows.resize(num_rows);
+        // a pointer rather than a reference, it is rebound to the rows of the next result when one is full.
+        auto* result_rows = &result->result_batch.rows;
+        result_rows->resize(num_rows);
 
         for (int i = 0; i < num_rows; ++i) {
             DCHECK_EQ(0, _row_buffer->length());
@@ -192,24 +193,24 @@ StatusOr<TFetchDataResultPtrs> MysqlResultWriter::process_chunk(Chunk* chunk) {
             size_t len = _row_buffer->length();
 
             if (UNLIKELY(current_bytes + len >= _max_row_buffer_size)) {
-                result_rows.resize(current_rows);
+                result_rows->resize(current_rows);
                 results.emplace_back(std::move(result));
 
                 result = std::make_unique<TFetchDataResult>();
-                result_rows = result->result_batch.rows;
-                result_rows.resize(num_rows - i);
+                result_rows = &result->result_batch.rows;
+                result_rows->resize(num_rows - i);
 
                 current_bytes = 0;
                 current_rows = 0;
             }
-            _row_buffer->move_content(&result_rows[current_rows]);
+            _row_buffer->move_content(&(*result_rows)[current_rows]);
             _row_buffer->reserve(len * 1.1);
 
             current_bytes += len;
             current_rows += 1;
         }
         if (current_rows > 0) {
-            result_rows.resize(current_rows);
+            result_rows->resize(current_rows);
             results.emplace_back(std::move(result));
         }
         TRY_CATCH_ALLOC_SCOPE_END()
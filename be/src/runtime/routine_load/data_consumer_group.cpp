@@ -137,6 +137,17 @@ Status KafkaDataConsumerGroup::start_all(StreamLoadContext* ctx) {
         }
     }
 
+    // Take messages from the queue in batches, so the consumer threads and this thread take the queue
+    // lock once per batch instead of once per message. Messages left in the batch are freed on return.
+    constexpr size_t kMaxMessageBatchSize = 128;
+    std::vector<RdKafka::Message*> msg_batch;
+    size_t msg_batch_pos = 0;
+    DeferOp batch_deleter([&] {
+        for (size_t i = msg_batch_pos; i < msg_batch.size(); i++) {
+            delete msg_batch[i];
+        }
+    });
+
     MonotonicStopWatch watch;
     watch.start();
     bool eos = false;
@@ -192,9 +203,14 @@ Status KafkaDataConsumerGroup::start_all(StreamLoadContext* ctx) {
             }
         }
 
-        RdKafka::Message* msg;
-        bool res = _queue.blocking_get(&msg);
+        if (msg_batch_pos == msg_batch.size()) {
+            msg_batch.clear();
+            msg_batch_pos = 0;
+            _queue.blocking_get_batch(&msg_batch, kMaxMessageBatchSize);
+        }
+        bool res = msg_batch_pos < msg_batch.size();
         if (res) {
+            RdKafka::Message* msg = msg_batch[msg_batch_pos++];
             VLOG(3) << "get kafka message"
                     << ", partition: " << msg->partition() << ", offset: " << msg->offset() << ", len: " << msg->len();
             DeferOp msgDeleter([&] { delete msg; });
@@ -431,15 +431,10 @@ void DataStreamRecvr::NonPipelineSenderQueue::clean_buffer_queues() {
 
 DataStreamRecvr::PipelineSenderQueue::PipelineSenderQueue(DataStreamRecvr* parent_recvr, int32_t num_senders,
                                                           int32_t degree_of_parallism)
-        : SenderQueue(parent_recvr), _num_remaining_senders(num_senders), _chunk_queue_states(degree_of_parallism) {
-    for (int i = 0; i < degree_of_parallism; i++) {
-        _chunk_queues.emplace_back();
-    }
-
-    if (parent_recvr->_is_merging) {
-        _producer_token = std::make_unique<ChunkQueue::producer_token_t>(_chunk_queues[0]);
-    }
-}
+        : SenderQueue(parent_recvr),
+          _num_remaining_senders(num_senders),
+          _chunk_queues(degree_of_parallism),
+          _chunk_queue_states(degree_of_parallism) {}
 
 Status DataStreamRecvr::PipelineSenderQueue::get_chunk(Chunk** chunk, const int32_t driver_sequence) {
     if (_is_cancelled) {
@@ -771,7 +766,7 @@ Status DataStreamRecvr::PipelineSenderQueue::add_chunks(const PTransmitChunkPara
             for (auto& item : unprocessed_chunk_queue) {
                 size_t chunk_bytes = item.chunk_bytes;
                 auto* closure = item.closure;
-                _chunk_queues[0].enqueue(*_producer_token, std::move(item));
+                _chunk_queues[0].enqueue(std::move(item));
                 _chunk_queue_states[0].blocked_closure_num += closure != nullptr;
                 _total_chunks++;
                 _recvr->_num_buffered_bytes += chunk_bytes;
@@ -20,7 +20,7 @@
 #include "column/vectorized_fwd.h"
 #include "runtime/data_stream_recvr.h"
 #include "serde/protobuf_serde.h"
-#include "util/moodycamel/concurrentqueue.h"
+#include "util/mpsc_queue.h"
 #include "util/spinlock.h"
 
 namespace google::protobuf {
@@ -141,6 +141,8 @@ private:
 // PipelineSenderQueue will be called in the pipeline execution threads.
 // In order to avoid thread blocking caused by lock competition,
 // we try to use lock-free structures in the relevant interface as much as possible.
+// The chunks are buffered in MPSC queues sharded per consuming driver, so the brpc threads enqueuing chunks
+// never contend with the drivers dequeuing them.
 // It should be noted that some atomic variables are updated at the same time under the protection of lock,
 // which may not be completely consistent when reading without lock, but will eventually be consistent.
 // This won't affect the correctness in our usage scenario.
@@ -226,7 +228,24 @@ private:
     template <bool keep_order>
     Status add_chunks(const PTransmitChunkParams& request, Metrics& metrics, ::google::protobuf::Closure** done);
 
-    typedef moodycamel::ConcurrentQueue<ChunkItem> ChunkQueue;
+    // ChunkQueue is enqueued by the brpc threads without any lock.
+    // The consumers are serialized by _consumer_lock, which is only contended when several drivers share
+    // the same queue, or a driver races with short circuit and cancel.
+    class ChunkQueue {
+    public:
+        void enqueue(ChunkItem&& item) { _queue.enqueue(std::move(item)); }
+
+        bool try_dequeue(ChunkItem& item) {
+            std::lock_guard<SpinLock> l(_consumer_lock);
+            return _queue.try_dequeue(item);
+        }
+
+        size_t size_approx() const { return _queue.size_approx(); }
+
+    private:
+        MpscQueue<ChunkItem> _queue;
+        SpinLock _consumer_lock;
+    };
 
     std::atomic<bool> _is_cancelled{false};
     std::atomic<int> _num_remaining_senders;
@@ -236,10 +255,8 @@ private:
 
     // if _is_pipeline_level_shuffle=true, we will create a queue for each driver sequence to avoid competition
     // otherwise, we will only use the first item
+    // the order of dequeueing is the same as enqueueing, which is required when the order needs to be guaranteed
     std::vector<ChunkQueue> _chunk_queues;
-    // _producer_token is used to ensure that the order of dequeueing is the same as enqueueing
-    // it is only used when the order needs to be guaranteed
-    std::unique_ptr<ChunkQueue::producer_token_t> _producer_token;
 
     struct ChunkQueueState {
         // Record the number of blocked closure in the queue
@@ -20,8 +20,13 @@
 #include <streamvbyte.h>
 #include <streamvbytedelta.h>
 
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+
 #include "column/array_column.h"
 #include "column/binary_column.h"
+#include "column/column_hash.h"
 #include "column/column_visitor_adapter.h"
 #include "column/const_column.h"
 #include "column/decimalv3_column.h"
@@ -35,9 +40,11 @@
 #include "runtime/descriptors.h"
 #include "serde/protobuf_serde.h"
 #include "types/hll.h"
+#include "util/bit_packing.inline.h"
 #include "util/coding.h"
 #include "util/json.h"
 #include "util/percentile_value.h"
+#include "util/phmap/phmap.h"
 
 namespace starrocks::serde {
 namespace {
@@ -147,22 +154,158 @@ const uint8_t* decode_string_lz4(const uint8_t* buff, void* target, size_t size)
     return buff + encode_size;
 }
 
+// The first byte of the frame-of-reference encoded integers tells the layout.
+constexpr uint8_t FOR_NONE = 0;  // not encoded by frame-of-reference, fall back to the other encodings
+constexpr uint8_t FOR_VALUE = 1; // |base|bit width|packed (value - base)|
+constexpr uint8_t FOR_DELTA = 2; // |base|first value|bit width|packed (delta - base)|
+
+template <typename T>
+constexpr bool support_encode_for = std::is_integral_v<T> && sizeof(T) <= sizeof(int64_t);
+
+inline int bit_width_of(uint64_t range) {
+    return range == 0 ? 0 : 64 - __builtin_clzll(range);
+}
+
+// Pack the lowest |bit_width| bits of each value, in the bit order of BitPacking::UnpackValues.
+class BitPackWriter {
+public:
+    explicit BitPackWriter(uint8_t* buff) : _buff(buff) {}
+
+    void put(uint64_t value, int bit_width) {
+        _buffered |= static_cast<unsigned __int128>(value) << _num_bits;
+        _num_bits += bit_width;
+        if (_num_bits >= 64) {
+            encode_fixed64_le(_buff, static_cast<uint64_t>(_buffered));
+            _buff += sizeof(uint64_t);
+            _buffered >>= 64;
+            _num_bits -= 64;
+        }
+    }
+
+    uint8_t* finish() {
+        for (; _num_bits > 0; _num_bits -= std::min(_num_bits, 8)) {
+            *_buff++ = static_cast<uint8_t>(_buffered);
+            _buffered >>= 8;
+        }
+        return _buff;
+    }
+
+private:
+    uint8_t* _buff;
+    unsigned __int128 _buffered = 0;
+    int _num_bits = 0;
+};
+
+// Return nullptr if frame-of-reference cannot reduce the size of the integers.
+template <typename T, bool sorted>
+uint8_t* encode_for(const T* data, size_t num, uint8_t* buff) {
+    using U = std::make_unsigned_t<T>;
+    auto [min_it, max_it] = std::minmax_element(data, data + num);
+    uint8_t layout = FOR_VALUE;
+    T base = *min_it;
+    int bit_width = bit_width_of(static_cast<U>(static_cast<U>(*max_it) - static_cast<U>(*min_it)));
+    if constexpr (sorted) {
+        T min_delta = std::numeric_limits<T>::max();
+        T max_delta = std::numeric_limits<T>::min();
+        for (size_t i = 1; i < num; i++) {
+            T delta = static_cast<T>(static_cast<U>(data[i]) - static_cast<U>(data[i - 1]));
+            min_delta = std::min(min_delta, delta);
+            max_delta = std::max(max_delta, delta);
+        }
+        int delta_bit_width =
+                num > 1 ? bit_width_of(static_cast<U>(static_cast<U>(max_delta) - static_cast<U>(min_delta))) : 0;
+        if (delta_bit_width < bit_width) {
+            layout = FOR_DELTA;
+            base = min_delta;
+            bit_width = delta_bit_width;
+        }
+    }
+    if (bit_width >= sizeof(T) * 8) {
+        return nullptr;
+    }
+
+    *buff++ = layout;
+    buff = write_raw(&base, sizeof(T), buff);
+    if (layout == FOR_DELTA) {
+        buff = write_raw(data, sizeof(T), buff);
+    }
+    *buff++ = static_cast<uint8_t>(bit_width);
+    BitPackWriter writer(buff);
+    if (layout == FOR_VALUE) {
+        for (size_t i = 0; i < num; i++) {
+            writer.put(static_cast<U>(static_cast<U>(data[i]) - static_cast<U>(base)), bit_width);
+        }
+    } else {
+        for (size_t i = 1; i < num; i++) {
+            U delta = static_cast<U>(data[i]) - static_cast<U>(data[i - 1]);
+            writer.put(static_cast<U>(delta - static_cast<U>(base)), bit_width);
+        }
+    }
+    return writer.finish();
+}
+
+template <typename T>
+const uint8_t* decode_for(const uint8_t* buff, uint8_t layout, T* target, size_t num) {
+    using U = std::make_unsigned_t<T>;
+    if (layout != FOR_VALUE && layout != FOR_DELTA) {
+        throw std::runtime_error(fmt::format("unknown frame-of-reference layout {}.", layout));
+    }
+    T base;
+    buff = read_raw(buff, &base, sizeof(T));
+    auto* values = reinterpret_cast<U*>(target);
+    size_t num_packed = num;
+    if (layout == FOR_DELTA) {
+        buff = read_raw(buff, values, sizeof(T));
+        values++;
+        num_packed--;
+    }
+    int bit_width = *buff++;
+    int64_t packed_bytes = (static_cast<int64_t>(num_packed) * bit_width + 7) / 8;
+    auto unpacked = BitPacking::UnpackValues(bit_width, buff, packed_bytes, num_packed, values);
+    if (unpacked.second != static_cast<int64_t>(num_packed)) {
+        throw std::runtime_error(fmt::format("frame-of-reference decode {} values, but {} values are expected.",
+                                             unpacked.second, num_packed));
+    }
+
+    values = reinterpret_cast<U*>(target);
+    if (layout == FOR_VALUE) {
+        for (size_t i = 0; i < num; i++) {
+            values[i] = static_cast<U>(values[i] + static_cast<U>(base));
+        }
+    } else {
+        for (size_t i = 1; i < num; i++) {
+            values[i] = static_cast<U>(values[i - 1] + values[i] + static_cast<U>(base));
+        }
+    }
+    return buff + packed_bytes;
+}
+
 template <typename T, bool sorted>
 class FixedLengthColumnSerde {
 public:
     static int64_t max_serialized_size(const FixedLengthColumnBase<T>& column, const int encode_level) {
         uint32_t size = sizeof(T) * column.size();
+        int64_t for_header_size = _enable_encode_for(encode_level, size) ? 2 + 2 * sizeof(T) : 0;
         if (EncodeContext::enable_encode_integer(encode_level) && size >= ENCODE_SIZE_LIMIT) {
-            return sizeof(uint32_t) + sizeof(uint64_t) +
+            return for_header_size + sizeof(uint32_t) + sizeof(uint64_t) +
                    std::max((int64_t)size, (int64_t)streamvbyte_max_compressedbytes(upper_int32(size)));
         } else {
-            return sizeof(uint32_t) + size;
+            return for_header_size + sizeof(uint32_t) + size;
         }
     }
 
     static uint8_t* serialize(const FixedLengthColumnBase<T>& column, uint8_t* buff, const int encode_level) {
         uint32_t size = sizeof(T) * column.size();
         buff = write_little_endian_32(size, buff);
+        if constexpr (support_encode_for<T>) {
+            if (_enable_encode_for(encode_level, size)) {
+                uint8_t* end = encode_for<T, sorted>(column.raw_data(), column.size(), buff);
+                if (end != nullptr) {
+                    return end;
+                }
+                *buff++ = FOR_NONE;
+            }
+        }
         if (EncodeContext::enable_encode_integer(encode_level) && size >= ENCODE_SIZE_LIMIT) {
             if (sizeof(T) == 4 && sorted) { // only support sorted 32-bit integers
                 buff = encode_integers<true>(column.raw_data(), size, buff, encode_level);
@@ -180,6 +323,14 @@ public:
         buff = read_little_endian_32(buff, &size);
         std::vector<T>& data = column->get_data();
         raw::make_room(&data, size / sizeof(T));
+        if constexpr (support_encode_for<T>) {
+            if (_enable_encode_for(encode_level, size)) {
+                uint8_t layout = *buff++;
+                if (layout != FOR_NONE) {
+                    return decode_for<T>(buff, layout, data.data(), data.size());
+                }
+            }
+        }
         if (EncodeContext::enable_encode_integer(encode_level) && size >= ENCODE_SIZE_LIMIT) {
             if (sizeof(T) == 4 && sorted) { // only support sorted 32-bit integers
                 buff = decode_integers<true>(buff, data.data(), size);
@@ -191,6 +342,11 @@ public:
         }
         return buff;
     }
+
+private:
+    static bool _enable_encode_for(const int encode_level, uint32_t size) {
+        return support_encode_for<T> && EncodeContext::enable_encode_for(encode_level) && size >= ENCODE_SIZE_LIMIT;
+    }
 };
 
 class BinaryColumnSerde {
@@ -200,7 +356,14 @@ public:
         const auto& bytes = column.get_bytes();
         const auto& offsets = column.get_offset();
         int64_t res = sizeof(T) * 2;
+        if (EncodeContext::enable_encode_dict(encode_level)) {
+            // the dictionary is only used if it's smaller than the plain layout
+            res += sizeof(uint8_t);
+        }
         int64_t offsets_size = offsets.size() * sizeof(typename BinaryColumnBase<T>::Offset);
+        if (_enable_encode_for(encode_level, offsets_size)) {
+            res += 2 + 2 * sizeof(T);
+        }
         if (EncodeContext::enable_encode_integer(encode_level) && offsets_size >= ENCODE_SIZE_LIMIT) {
             res += sizeof(uint64_t) +
                    std::max((int64_t)offsets_size, (int64_t)streamvbyte_max_compressedbytes(upper_int32(offsets_size)));
@@ -217,6 +380,15 @@ public:
 
     template <typename T>
     static uint8_t* serialize(const BinaryColumnBase<T>& column, uint8_t* buff, const int encode_level) {
+        if (EncodeContext::enable_encode_dict(encode_level)) {
+            uint8_t* end = _serialize_dict(column, buff + sizeof(uint8_t));
+            if (end != nullptr) {
+                *buff = 1;
+                return end;
+            }
+            *buff++ = 0;
+        }
+
         const auto& bytes = column.get_bytes();
         const auto& offsets = column.get_offset();
 
@@ -239,6 +411,13 @@ public:
         } else {
             buff = write_little_endian_64(offsets_size, buff);
         }
+        if (_enable_encode_for(encode_level, offsets_size)) {
+            uint8_t* end = encode_for<T, true>(offsets.data(), offsets.size(), buff);
+            if (end != nullptr) {
+                return end;
+            }
+            *buff++ = FOR_NONE;
+        }
         if (EncodeContext::enable_encode_integer(encode_level) && offsets_size >= ENCODE_SIZE_LIMIT) {
             if (sizeof(T) == 4) { // only support sorted 32-bit integers
                 buff = encode_integers<true>(offsets.data(), offsets_size, buff, encode_level);
@@ -253,6 +432,13 @@ public:
 
     template <typename T>
     static const uint8_t* deserialize(const uint8_t* buff, BinaryColumnBase<T>* column, const int encode_level) {
+        if (EncodeContext::enable_encode_dict(encode_level)) {
+            uint8_t dict_encoded = *buff++;
+            if (dict_encoded) {
+                return _deserialize_dict(buff, column);
+            }
+        }
+
         T bytes_size = 0;
         if constexpr (std::is_same_v<T, uint32_t>) {
             buff = read_little_endian_32(buff, &bytes_size);
@@ -273,6 +459,12 @@ public:
             buff = read_little_endian_64(buff, &offsets_size);
         }
         raw::make_room(&column->get_offset(), offsets_size / sizeof(typename BinaryColumnBase<T>::Offset));
+        if (_enable_encode_for(encode_level, offsets_size)) {
+            uint8_t layout = *buff++;
+            if (layout != FOR_NONE) {
+                return decode_for<T>(buff, layout, column->get_offset().data(), column->get_offset().size());
+            }
+        }
         if (EncodeContext::enable_encode_integer(encode_level) && offsets_size >= ENCODE_SIZE_LIMIT) {
             if (sizeof(T) == 4) { // only support sorted 32-bit integers
                 buff = decode_integers<true>(buff, column->get_offset().data(), offsets_size);
@@ -284,6 +476,126 @@ public:
         }
         return buff;
     }
+
+private:
+    // codes are stored in uint16_t at most
+    static constexpr size_t DICT_MAX_WORDS = 1 << 16;
+
+    static bool _enable_encode_for(const int encode_level, int64_t offsets_size) {
+        return EncodeContext::enable_encode_for(encode_level) && offsets_size >= ENCODE_SIZE_LIMIT;
+    }
+
+    // Dictionary layout:
+    // uint32: number of rows
+    // uint32: number of words
+    // uint8: bytes of each code, 1 or 2
+    // uint32 * number of words: the length of each word
+    // bytes of the words
+    // codes of the rows
+    // Return nullptr if the dictionary isn't smaller than the plain layout.
+    template <typename T>
+    static uint8_t* _serialize_dict(const BinaryColumnBase<T>& column, uint8_t* buff) {
+        const size_t num_rows = column.size();
+        const auto& bytes = column.get_bytes();
+        if (bytes.size() < ENCODE_SIZE_LIMIT) {
+            return nullptr;
+        }
+        // it's not low-cardinality if most of the rows are distinct
+        const size_t max_words = std::min(DICT_MAX_WORDS, num_rows / 2);
+        phmap::flat_hash_map<Slice, uint16_t, SliceHash> dict;
+        std::vector<Slice> words;
+        std::vector<uint16_t> codes(num_rows);
+        size_t words_bytes = 0;
+        for (size_t i = 0; i < num_rows; i++) {
+            Slice value = column.get_slice(i);
+            auto [iter, inserted] = dict.try_emplace(value, static_cast<uint16_t>(words.size()));
+            if (inserted) {
+                if (words.size() >= max_words) {
+                    return nullptr;
+                }
+                words.emplace_back(value);
+                words_bytes += value.size;
+            }
+            codes[i] = iter->second;
+        }
+
+        const uint8_t code_bytes = words.size() <= (1 << 8) ? sizeof(uint8_t) : sizeof(uint16_t);
+        const size_t dict_size = sizeof(uint32_t) * 2 + sizeof(uint8_t) + sizeof(uint32_t) * words.size() +
+                                 words_bytes + code_bytes * num_rows;
+        const size_t plain_size =
+                sizeof(T) * 2 + bytes.size() + column.get_offset().size() * sizeof(typename BinaryColumnBase<T>::Offset);
+        if (dict_size >= plain_size) {
+            return nullptr;
+        }
+
+        buff = write_little_endian_32(num_rows, buff);
+        buff = write_little_endian_32(words.size(), buff);
+        *buff++ = code_bytes;
+        for (const auto& word : words) {
+            buff = write_little_endian_32(word.size, buff);
+        }
+        for (const auto& word : words) {
+            buff = write_raw(word.data, word.size, buff);
+        }
+        if (code_bytes == sizeof(uint8_t)) {
+            for (size_t i = 0; i < num_rows; i++) {
+                *buff++ = static_cast<uint8_t>(codes[i]);
+            }
+        } else {
+            for (size_t i = 0; i < num_rows; i++) {
+                encode_fixed16_le(buff, codes[i]);
+                buff += sizeof(uint16_t);
+            }
+        }
+        VLOG_ROW << fmt::format("raw size = {}, dict encoded size = {}, words = {}, dict compression ratio = {}\n",
+                                plain_size, dict_size, words.size(), dict_size * 1.0 / plain_size);
+        return buff;
+    }
+
+    template <typename T>
+    static const uint8_t* _deserialize_dict(const uint8_t* buff, BinaryColumnBase<T>* column) {
+        uint32_t num_rows = 0;
+        uint32_t num_words = 0;
+        buff = read_little_endian_32(buff, &num_rows);
+        buff = read_little_endian_32(buff, &num_words);
+        const uint8_t code_bytes = *buff++;
+        if (code_bytes != sizeof(uint8_t) && code_bytes != sizeof(uint16_t)) {
+            throw std::runtime_error(fmt::format("invalid size of dictionary codes {}.", code_bytes));
+        }
+
+        std::vector<Slice> words(num_words);
+        const uint8_t* word_data = buff + sizeof(uint32_t) * num_words;
+        for (uint32_t i = 0; i < num_words; i++) {
+            uint32_t length = 0;
+            buff = read_little_endian_32(buff, &length);
+            words[i] = Slice(word_data, length);
+            word_data += length;
+        }
+        buff = word_data;
+
+        auto& offsets = column->get_offset();
+        raw::make_room(&offsets, num_rows + 1);
+        offsets[0] = 0;
+        const uint8_t* codes = buff;
+        auto code_at = [&](uint32_t row) -> uint32_t {
+            return code_bytes == sizeof(uint8_t) ? codes[row] : decode_fixed16_le(codes + row * sizeof(uint16_t));
+        };
+        for (uint32_t i = 0; i < num_rows; i++) {
+            uint32_t code = code_at(i);
+            if (UNLIKELY(code >= num_words)) {
+                throw std::runtime_error(fmt::format("dictionary code {} is out of {} words.", code, num_words));
+            }
+            offsets[i + 1] = offsets[i] + words[code].size;
+        }
+
+        auto& bytes = column->get_bytes();
+        bytes.resize(offsets[num_rows]);
+        for (uint32_t i = 0; i < num_rows; i++) {
+            const Slice& word = words[code_at(i)];
+            strings::memcpy_inlined(bytes.data() + offsets[i], word.data, word.size);
+        }
+        return buff + code_bytes * num_rows;
+    }
 };
 
 template <typename T>
@@ -14,20 +14,46 @@
 
 #include "serde/encode_context.h"
 
+#include <algorithm>
+
 #include "gen_cpp/data.pb.h" // ChunkPB
 
 namespace starrocks::serde {
 
 EncodeContext::EncodeContext(const int col_num, const int encode_level) : _session_encode_level(encode_level) {
-    for (auto i = 0; i < col_num; ++i) {
-        _column_encode_level.emplace_back(_session_encode_level);
-        _raw_bytes.emplace_back(0);
-        _encoded_bytes.emplace_back(0);
-    }
     // the lowest bit is set and other bits are not zero, then enable adjust.
     if (_session_encode_level & 1 && (_session_encode_level >> 1)) {
         _enable_adjust = true;
     }
+    _init_candidate_levels();
+    for (auto i = 0; i < col_num; ++i) {
+        _column_encode_level.emplace_back(_candidate_levels[0]);
+        _raw_bytes.emplace_back(_candidate_levels.size(), 0);
+        _encoded_bytes.emplace_back(_candidate_levels.size(), 0);
+    }
+}
+
+void EncodeContext::_init_candidate_levels() {
+    const int flags = _flags(_session_encode_level);
+    const int light = flags & LIGHT_ENCODE_MASK;
+    const int heavy = flags & HEAVY_ENCODE_MASK;
+    if (!_enable_adjust || _session_encode_level < 0 || light == 0 || heavy == 0) {
+        _candidate_levels.emplace_back(_session_encode_level);
+        return;
+    }
+    // lightweight codecs are cheaper, so they are preferred if the compression ratios are the same.
+    _candidate_levels.emplace_back(_session_encode_level - heavy);
+    // lightweight codecs fall back to heavyweight codecs for the chunks they don't fit.
+    _candidate_levels.emplace_back(_session_encode_level);
+    _candidate_levels.emplace_back(_session_encode_level - light);
+}
+
+int EncodeContext::_sampling_candidate() const {
+    auto pos = _times % _frequency;
+    if (pos >= EncodeSamplingNum) {
+        return -1;
+    }
+    return pos % _candidate_levels.size();
 }
 
 void EncodeContext::update(const int col_id, uint64_t mem_bytes, uint64_t encode_byte) {
@@ -35,28 +61,36 @@ void EncodeContext::update(const int col_id, uint64_t mem_bytes, uint64_t encode
         return;
     }
     // decide to encode or not by the encoding ratio of the first EncodeSamplingNum of every _frequency chunks
-    if (_times % _frequency < EncodeSamplingNum) {
-        _raw_bytes[col_id] += mem_bytes;
-        _encoded_bytes[col_id] += encode_byte;
+    auto candidate = _sampling_candidate();
+    if (candidate >= 0) {
+        _raw_bytes[col_id][candidate] += mem_bytes;
+        _encoded_bytes[col_id][candidate] += encode_byte;
     }
 }
 
-// if encode ratio < EncodeRatioLimit, encode it, otherwise not.
 void EncodeContext::_adjust(const int col_id) {
     auto old_level = _column_encode_level[col_id];
-    if (_encoded_bytes[col_id] < _raw_bytes[col_id] * EncodeRatioLimit) {
-        _column_encode_level[col_id] = _session_encode_level;
-    } else {
-        _column_encode_level[col_id] = 0;
+    int best_candidate = -1;
+    double best_ratio = EncodeRatioLimit;
+    for (auto i = 0; i < _candidate_levels.size(); ++i) {
+        if (_raw_bytes[col_id][i] == 0) {
+            continue;
+        }
+        double ratio = _encoded_bytes[col_id][i] * 1.0 / _raw_bytes[col_id][i];
+        if (ratio < best_ratio) {
+            best_candidate = i;
+            best_ratio = ratio;
+        }
     }
+    _column_encode_level[col_id] = best_candidate >= 0 ? _candidate_levels[best_candidate] : 0;
     if (old_level != _column_encode_level[col_id] || _session_encode_level < -1) {
         VLOG_ROW << "Old encode level " << old_level << " is changed to " << _column_encode_level[col_id]
                  << " because the first " << EncodeSamplingNum << " of " << _frequency << " in total " << _times
-                 << " chunks' compression ratio is " << _encoded_bytes[col_id] * 1.0 / _raw_bytes[col_id]
-                 << " higher than limit " << EncodeRatioLimit;
+                 << " chunks' best compression ratio is " << best_ratio << " compared with limit "
+                 << EncodeRatioLimit;
     }
-    _encoded_bytes[col_id] = 0;
-    _raw_bytes[col_id] = 0;
+    std::fill(_encoded_bytes[col_id].begin(), _encoded_bytes[col_id].end(), 0);
+    std::fill(_raw_bytes[col_id].begin(), _raw_bytes[col_id].end(), 0);
 }
 
 void EncodeContext::set_encode_levels_in_pb(ChunkPB* const res) {
@@ -75,6 +109,12 @@ void EncodeContext::adjust_encode_levels() {
             _adjust(col_id);
         }
         _frequency = _frequency > 1000000000 ? _frequency : _frequency * 2;
+    } else if (_enable_adjust && _candidate_levels.size() > 1) {
+        // the sampled chunks take turns to use each candidate level
+        auto candidate = _sampling_candidate();
+        if (candidate >= 0) {
+            std::fill(_column_encode_level.begin(), _column_encode_level.end(), _candidate_levels[candidate]);
+        }
     }
 }
 } // namespace starrocks::serde
\ No newline at end of file
@@ -33,6 +33,9 @@ constexpr uint32_t EncodeSamplingNum = 5;
 // EncodeContext adaptively adjusts encode_level according to the compression ratio. In detail,
 // for every _frequency chunks, if the compression ratio for the first EncodeSamplingNum chunks is less than
 // EncodeRatioLimit, then encode the rest chunks, otherwise not.
+// If the session encode level enables both lightweight codecs (dictionary/frame-of-reference) and
+// heavyweight codecs (streamvbyte/lz4), the sampled chunks take turns to use each candidate level,
+// and every column picks the candidate with the lowest compression ratio for the rest chunks.
 
 class EncodeContext {
 public:
@@ -57,21 +60,41 @@ public:
 
     static constexpr uint16_t STREAMVBYTE_PADDING_SIZE = STREAMVBYTE_PADDING;
 
-    static bool enable_encode_integer(const int encode_level) { return encode_level & ENCODE_INTEGER; }
+    static bool enable_encode_integer(const int encode_level) { return _flags(encode_level) & ENCODE_INTEGER; }
 
-    static bool enable_encode_string(const int encode_level) { return encode_level & ENCODE_STRING; }
+    static bool enable_encode_string(const int encode_level) { return _flags(encode_level) & ENCODE_STRING; }
+
+    static bool enable_encode_dict(const int encode_level) { return _flags(encode_level) & ENCODE_DICT; }
+
+    static bool enable_encode_for(const int encode_level) { return _flags(encode_level) & ENCODE_FOR; }
+
+    const std::vector<int>& get_candidate_levels() const { return _candidate_levels; }
 
 private:
     static constexpr int ENCODE_INTEGER = 2;
     static constexpr int ENCODE_STRING = 4;
-
-    // if encode ratio < EncodeRatioLimit, encode it, otherwise not.
+    // low-cardinality binary columns are encoded by a per-chunk dictionary
+    static constexpr int ENCODE_DICT = 8;
+    // integers are encoded by frame-of-reference, and sorted integers by delta + frame-of-reference
+    static constexpr int ENCODE_FOR = 16;
+    static constexpr int HEAVY_ENCODE_MASK = ENCODE_INTEGER | ENCODE_STRING;
+    static constexpr int LIGHT_ENCODE_MASK = ENCODE_DICT | ENCODE_FOR;
+
+    // the digits above 10000 of encode_level are the acceleration of lz4, see encode_string_lz4.
+    static int _flags(const int encode_level) { return encode_level % 10000; }
+
+    void _init_candidate_levels();
+    // the candidate of the current chunk if it's a sampled one, otherwise -1.
+    int _sampling_candidate() const;
+    // pick the candidate with the lowest encode ratio if the ratio < EncodeRatioLimit, otherwise not encode it.
     void _adjust(const int col_id);
     const int _session_encode_level;
     uint64_t _times = 0;
     uint64_t _frequency = 64;
     bool _enable_adjust = false;
-    std::vector<uint64_t> _raw_bytes, _encoded_bytes;
+    std::vector<int> _candidate_levels;
+    // raw and encoded bytes of each candidate for each column
+    std::vector<std::vector<uint64_t>> _raw_bytes, _encoded_bytes;
     std::vector<uint32_t> _column_encode_level;
 };
 } // namespace starrocks::serde
\ No newline at end of file
@@ -46,63 +46,30 @@ int64_t ProtobufChunkSerde::max_serialized_size(const Chunk& chunk, const std::s
 StatusOr<ChunkPB> ProtobufChunkSerde::serialize(const Chunk& chunk, const std::shared_ptr<EncodeContext>& context) {
     StatusOr<ChunkPB> res = serialize_without_meta(chunk, std::move(context));
     if (!res.ok()) return res.status();
-
-    const auto& slot_id_to_index = chunk.get_slot_id_to_index_map();
-    const auto& columns = chunk.columns();
-
-    res->mutable_slot_id_map()->Reserve(static_cast<int>(slot_id_to_index.size()) * 2);
-    for (const auto& kv : slot_id_to_index) {
-        res->mutable_slot_id_map()->Add(kv.first);
-        res->mutable_slot_id_map()->Add(static_cast<int>(kv.second));
-    }
-
-    res->mutable_is_nulls()->Reserve(static_cast<int>(columns.size()));
-    for (const auto& column : columns) {
-        res->mutable_is_nulls()->Add(column->is_nullable());
-    }
-
-    res->mutable_is_consts()->Reserve(static_cast<int>(columns.size()));
-    for (const auto& column : columns) {
-        res->mutable_is_consts()->Add(column->is_constant());
-    }
-
-    DCHECK_EQ(columns.size(), slot_id_to_index.size());
-
-    // serialize extra meta
-    auto* chunk_extra_data =
-            chunk.get_extra_data() ? dynamic_cast<ChunkExtraColumnsData*>(chunk.get_extra_data().get()) : nullptr;
-    if (chunk_extra_data) {
-        auto extra_data_metas = chunk_extra_data->chunk_data_metas();
-        res->mutable_extra_data_metas()->Reserve(extra_data_metas.size());
-        for (auto& data_meta : extra_data_metas) {
-            auto* extra_data_meta_pb = res->add_extra_data_metas();
-            *(extra_data_meta_pb->mutable_type_desc()) = data_meta.type.to_protobuf();
-            extra_data_meta_pb->set_is_const(data_meta.is_const);
-            extra_data_meta_pb->set_is_null(data_meta.is_null);
-        }
-    }
+    RETURN_IF_ERROR(serialize_meta(chunk, &res.value()));
     return res;
 }
 
-StatusOr<ChunkPB> ProtobufChunkSerde::serialize_without_meta(const Chunk& chunk,
-                                                             const std::shared_ptr<EncodeContext>& context) {
-    ChunkPB chunk_pb;
-    chunk_pb.set_compress_type(CompressionTypePB::NO_COMPRESSION);
-
-    std::string* serialized_data = chunk_pb.mutable_data();
+namespace {
+int64_t max_serialized_size_with_extra_data(const Chunk& chunk, const std::shared_ptr<EncodeContext>& context) {
     auto max_serialized_size = ProtobufChunkSerde::max_serialized_size(chunk, context);
     auto* chunk_extra_data =
             chunk.get_extra_data() ? dynamic_cast<ChunkExtraColumnsData*>(chunk.get_extra_data().get()) : nullptr;
     if (chunk_extra_data) {
         max_serialized_size += chunk_extra_data->max_serialized_size(0);
     }
-    raw::stl_string_resize_uninitialized(serialized_data, max_serialized_size);
-    auto* buff = reinterpret_cast<uint8_t*>(serialized_data->data());
+    return max_serialized_size;
+}
+
+// Serialize the data of |chunk| into |buff|, and return the end of the written data.
+// |padding_size| is set to the number of bytes which should be reserved after the data.
+StatusOr<uint8_t*> serialize_chunk_data(const Chunk& chunk, const std::shared_ptr<EncodeContext>& context,
+                                        uint8_t* buff, int* padding_size) {
     encode_fixed32_le(buff + 0, 1);
     encode_fixed32_le(buff + 4, chunk.num_rows());
     buff = buff + 8;
 
-    int padding_size = 0; // as streamvbyte may read up to 16 extra bytes from the input.
+    *padding_size = 0; // as streamvbyte may read up to 16 extra bytes from the input.
     if (context == nullptr) {
         for (auto i = 0; i < chunk.columns().size(); ++i) {
             buff = ColumnArraySerde::serialize(*chunk.columns()[i], buff);
@@ -114,27 +81,108 @@ StatusOr<ChunkPB> ProtobufChunkSerde::serialize_without_meta(const Chunk& chunk,
             if (UNLIKELY(buff == nullptr)) return Status::InternalError("has unsupported column");
             context->update(i, chunk.columns()[i]->byte_size(), buff - buff_begin);
             if (EncodeContext::enable_encode_integer(context->get_encode_level(i))) { // may be use streamvbyte
-                padding_size = context->STREAMVBYTE_PADDING_SIZE;
+                *padding_size = context->STREAMVBYTE_PADDING_SIZE;
             }
         }
     }
 
     // do serialize extra data
+    auto* chunk_extra_data =
+            chunk.get_extra_data() ? dynamic_cast<ChunkExtraColumnsData*>(chunk.get_extra_data().get()) : nullptr;
     if (chunk_extra_data) {
         buff = chunk_extra_data->serialize(buff);
     }
-    chunk_pb.set_serialized_size(buff - reinterpret_cast<const uint8_t*>(serialized_data->data()));
+    return buff;
+}
+
+void log_serialize_ratio(const Chunk& chunk, const ChunkPB& chunk_pb) {
+    VLOG_ROW << "pb serialize data, memory bytes = " << chunk.bytes_usage()
+             << " serialized size = " << chunk_pb.serialized_size()
+             << " uncompressed size = " << chunk_pb.uncompressed_size()
+             << " serialize ratio = " << chunk_pb.serialized_size() * 1.0 / chunk.bytes_usage();
+}
+} // namespace
+
+StatusOr<ChunkPB> ProtobufChunkSerde::serialize_without_meta(const Chunk& chunk,
+                                                             const std::shared_ptr<EncodeContext>& context) {
+    ChunkPB chunk_pb;
+    chunk_pb.set_compress_type(CompressionTypePB::NO_COMPRESSION);
+
+    std::string* serialized_data = chunk_pb.mutable_data();
+    raw::stl_string_resize_uninitialized(serialized_data, max_serialized_size_with_extra_data(chunk, context));
+    auto* buff_begin = reinterpret_cast<uint8_t*>(serialized_data->data());
+    int padding_size = 0;
+    ASSIGN_OR_RETURN(auto* buff_end, serialize_chunk_data(chunk, context, buff_begin, &padding_size));
+
+    chunk_pb.set_serialized_size(buff_end - buff_begin);
     serialized_data->resize(chunk_pb.serialized_size() + padding_size);
     chunk_pb.set_uncompressed_size(serialized_data->size());
     if (context) {
-        VLOG_ROW << "pb serialize data, memory bytes = " << chunk.bytes_usage()
-                 << " serialized size = " << chunk_pb.serialized_size()
-                 << " uncompressed size = " << chunk_pb.uncompressed_size()
-                 << " serialize ratio = " << chunk_pb.serialized_size() * 1.0 / chunk.bytes_usage();
+        log_serialize_ratio(chunk, chunk_pb);
     }
     return std::move(chunk_pb);
 }
 
+StatusOr<ChunkPB> ProtobufChunkSerde::serialize_without_meta(const Chunk& chunk,
+                                                             const std::shared_ptr<EncodeContext>& context,
+                                                             std::unique_ptr<uint8_t[]>* data) {
+    ChunkPB chunk_pb;
+    chunk_pb.set_compress_type(CompressionTypePB::NO_COMPRESSION);
+
+    const int64_t capacity =
+            max_serialized_size_with_extra_data(chunk, context) + EncodeContext::STREAMVBYTE_PADDING_SIZE;
+    std::unique_ptr<uint8_t[]> buffer(new uint8_t[capacity]);
+    int padding_size = 0;
+    ASSIGN_OR_RETURN(auto* buff_end, serialize_chunk_data(chunk, context, buffer.get(), &padding_size));
+
+    chunk_pb.set_serialized_size(buff_end - buffer.get());
+    chunk_pb.set_uncompressed_size(chunk_pb.serialized_size() + padding_size);
+    chunk_pb.set_data_size(chunk_pb.uncompressed_size());
+    if (context) {
+        log_serialize_ratio(chunk, chunk_pb);
+    }
+    *data = std::move(buffer);
+    return std::move(chunk_pb);
+}
+
+Status ProtobufChunkSerde::serialize_meta(const Chunk& chunk, ChunkPB* chunk_pb) {
+    const auto& slot_id_to_index = chunk.get_slot_id_to_index_map();
+    const auto& columns = chunk.columns();
+
+    chunk_pb->mutable_slot_id_map()->Reserve(static_cast<int>(slot_id_to_index.size()) * 2);
+    for (const auto& kv : slot_id_to_index) {
+        chunk_pb->mutable_slot_id_map()->Add(kv.first);
+        chunk_pb->mutable_slot_id_map()->Add(static_cast<int>(kv.second));
+    }
+
+    chunk_pb->mutable_is_nulls()->Reserve(static_cast<int>(columns.size()));
+    for (const auto& column : columns) {
+        chunk_pb->mutable_is_nulls()->Add(column->is_nullable());
+    }
+
+    chunk_pb->mutable_is_consts()->Reserve(static_cast<int>(columns.size()));
+    for (const auto& column : columns) {
+        chunk_pb->mutable_is_consts()->Add(column->is_constant());
+    }
+
+    DCHECK_EQ(columns.size(), slot_id_to_index.size());
+
+    // serialize extra meta
+    auto* chunk_extra_data =
+            chunk.get_extra_data() ? dynamic_cast<ChunkExtraColumnsData*>(chunk.get_extra_data().get()) : nullptr;
+    if (chunk_extra_data) {
+        auto extra_data_metas = chunk_extra_data->chunk_data_metas();
+        chunk_pb->mutable_extra_data_metas()->Reserve(extra_data_metas.size());
+        for (auto& data_meta : extra_data_metas) {
+            auto* extra_data_meta_pb = chunk_pb->add_extra_data_metas();
+            *(extra_data_meta_pb->mutable_type_desc()) = data_meta.type.to_protobuf();
+            extra_data_meta_pb->set_is_const(data_meta.is_const);
+            extra_data_meta_pb->set_is_null(data_meta.is_null);
+        }
+    }
+    return Status::OK();
+}
+
 StatusOr<Chunk> ProtobufChunkSerde::deserialize(const RowDescriptor& row_desc, const ChunkPB& chunk_pb,
                                                 const int encode_level) {
     auto res = build_protobuf_chunk_meta(row_desc, chunk_pb);
@@ -48,6 +48,19 @@ public:
     static StatusOr<ChunkPB> serialize_without_meta(const Chunk& chunk,
                                                     const std::shared_ptr<EncodeContext>& context = nullptr);
 
+    // Like `serialize_without_meta()` but the data is written into a buffer allocated by `new uint8_t[]` and
+    // returned by |data| instead of ChunkPB::data(), so that the buffer can be handed over to brpc IOBuf
+    // without copy. ChunkPB::data_size() is set to the size of the data.
+    static StatusOr<ChunkPB> serialize_without_meta(const Chunk& chunk, const std::shared_ptr<EncodeContext>& context,
+                                                    std::unique_ptr<uint8_t[]>* data);
+
+    // Fill the following fields of ChunkPB, which are left unfilled by `serialize_without_meta()`:
+    //  - slot_id_map()
+    //  - tuple_id_map()
+    //  - is_nulls()
+    //  - is_consts()
+    static Status serialize_meta(const Chunk& chunk, ChunkPB* chunk_pb);
+
     // REQUIRE: the following fields of |chunk_pb| must be non-empty:
     //  - slot_id_map()
     //  - tuple_id_map()
@@ -178,22 +178,31 @@ void PInternalServiceImplBase<T>::_transmit_chunk(google::protobuf::RpcControlle
     });
     if (cntl->request_attachment().size() > 0) {
         butil::IOBuf& io_buf = cntl->request_attachment();
-        for (size_t i = 0; i < req->chunks().size(); ++i) {
-            auto chunk = req->mutable_chunks(i);
-            if (UNLIKELY(io_buf.size() < chunk->data_size())) {
-                auto msg = fmt::format("iobuf's size {} < {}", io_buf.size(), chunk->data_size());
-                LOG(WARNING) << msg;
-                st = Status::InternalError(msg);
-                return;
-            }
-            // also with copying due to the discontinuous memory in chunk
-            auto size = io_buf.cutn(chunk->mutable_data(), chunk->data_size());
-            if (UNLIKELY(size != chunk->data_size())) {
-                auto msg = fmt::format("iobuf read {} != expected {}.", size, chunk->data_size());
-                LOG(WARNING) << msg;
-                st = Status::InternalError(msg);
-                return;
+        auto cut_chunks_data = [&io_buf](PTransmitChunkParams* params) {
+            for (size_t i = 0; i < params->chunks().size(); ++i) {
+                auto chunk = params->mutable_chunks(i);
+                if (UNLIKELY(io_buf.size() < chunk->data_size())) {
+                    auto msg = fmt::format("iobuf's size {} < {}", io_buf.size(), chunk->data_size());
+                    LOG(WARNING) << msg;
+                    return Status::InternalError(msg);
+                }
+                // also with copying due to the discontinuous memory in chunk
+                auto size = io_buf.cutn(chunk->mutable_data(), chunk->data_size());
+                if (UNLIKELY(size != chunk->data_size())) {
+                    auto msg = fmt::format("iobuf read {} != expected {}.", size, chunk->data_size());
+                    LOG(WARNING) << msg;
+                    return Status::InternalError(msg);
+                }
             }
+            return Status::OK();
+        };
+        st = cut_chunks_data(req);
+        // The chunk data of the coalesced requests are placed in order.
+        for (int i = 0; st.ok() && i < req->batched_requests_size(); ++i) {
+            st = cut_chunks_data(req->mutable_batched_requests(i));
+        }
+        if (!st.ok()) {
+            return;
         }
     }
 
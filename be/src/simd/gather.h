@@ -65,5 +65,35 @@ struct SIMDGather {
             c++;
         }
     }
+
+    // b[i] = a[c[i]];
+    // T is a 4 or 8 bytes trivially copyable type (eg: int32_t, int64_t, float, double)
+    // the caller must make sure all c[i] are valid indexes of a
+    template <class T, class TC>
+    static void gather_values(T* b, const T* a, const TC* c, int num_rows) {
+        static_assert(sizeof(TC) == 4);
+        static_assert(std::is_integral_v<TC>);
+        int i = 0;
+#ifdef __AVX2__
+        if constexpr (sizeof(T) == 4) {
+            for (; i + 8 <= num_rows; i += 8) {
+                __m256i index = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(c + i));
+                __m256i gathered = _mm256_i32gather_epi32(reinterpret_cast<const int*>(a), index, 4);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(b + i), gathered);
+            }
+            _mm256_zeroupper();
+        } else if constexpr (sizeof(T) == 8) {
+            for (; i + 4 <= num_rows; i += 4) {
+                __m128i index = _mm_loadu_si128(reinterpret_cast<const __m128i*>(c + i));
+                __m256i gathered = _mm256_i32gather_epi64(reinterpret_cast<const long long*>(a), index, 8);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(b + i), gathered);
+            }
+            _mm256_zeroupper();
+        }
+#endif
+        for (; i < num_rows; i++) {
+            b[i] = a[c[i]];
+        }
+    }
 };
 } // namespace starrocks
@@ -15,6 +15,7 @@
 #include "storage/compaction_manager.h"
 
 #include <chrono>
+#include <cmath>
 #include <thread>
 
 #include "storage/data_dir.h"
@@ -345,6 +346,11 @@ void CompactionManager::update_tablet(const TabletSharedPtr& tablet) {
         CompactionCandidate candidate;
         candidate.tablet = tablet;
         candidate.score = tablet->compaction_score();
+        int64_t scans = tablet->take_query_scan_count();
+        if (config::compaction_read_heat_weight > 0 && scans > 0) {
+            // prefer tablets whose rowsets are read often, their read amplification costs the most
+            candidate.score *= 1 + config::compaction_read_heat_weight * std::log2(1.0 + scans);
+        }
         candidate.type = tablet->compaction_type();
         update_candidates({candidate});
     }
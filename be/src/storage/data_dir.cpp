@@ -59,6 +59,7 @@
 #include "util/errno.h"
 #include "util/monotime.h"
 #include "util/string_util.h"
+#include "util/threadpool.h"
 
 using strings::Substitute;
 
@@ -278,10 +279,12 @@ Status DataDir::load() {
     LOG(INFO) << "begin loading tablet from meta " << _path;
     std::set<int64_t> tablet_ids;
     std::set<int64_t> failed_tablet_ids;
-    auto load_tablet_func = [this, &tablet_ids, &failed_tablet_ids](int64_t tablet_id, int32_t schema_hash,
-                                                                    std::string_view value) -> bool {
+    std::mutex tablet_ids_lock;
+    auto load_one_tablet = [this, &tablet_ids, &failed_tablet_ids, &tablet_ids_lock](
+                                   int64_t tablet_id, int32_t schema_hash, std::string_view value) {
         Status st =
                 _tablet_manager->load_tablet_from_meta(this, tablet_id, schema_hash, value, false, false, false, false);
+        std::lock_guard l(tablet_ids_lock);
         if (!st.ok() && !st.is_not_found() && !st.is_already_exist()) {
             // load_tablet_from_meta() may return NotFound which means the tablet status is DELETED
             // This may happen when the tablet was just deleted before the BE restarted,
@@ -295,10 +298,44 @@ Status DataDir::load() {
         } else {
             tablet_ids.insert(tablet_id);
         }
+    };
+    // Deserializing tablet metas and creating tablets dominates the startup time of a BE with many tablets, so the
+    // meta iteration hands them over to a thread pool. The bounded queue makes the iteration load the tablet by
+    // itself when the workers fall behind, which also bounds the memory held by copied metas.
+    std::unique_ptr<ThreadPool> load_tablet_pool;
+    if (config::load_tablet_meta_threads_per_data_dir > 1) {
+        Status st = ThreadPoolBuilder("load_tablet_meta")
+                            .set_min_threads(1)
+                            .set_max_threads(config::load_tablet_meta_threads_per_data_dir)
+                            .set_max_queue_size(config::load_tablet_meta_threads_per_data_dir * 64)
+                            .build(&load_tablet_pool);
+        if (!st.ok()) {
+            LOG(WARNING) << "create load tablet meta thread pool failed, load tablets serially. path: " << _path
+                         << " error: " << st.message();
+            load_tablet_pool.reset();
+        }
+    }
+    auto load_tablet_func = [&load_one_tablet, &load_tablet_pool](int64_t tablet_id, int32_t schema_hash,
+                                                                  std::string_view value) -> bool {
+        if (load_tablet_pool != nullptr) {
+            auto task = [&load_one_tablet, tablet_id, schema_hash, meta = std::string(value)]() {
+                load_one_tablet(tablet_id, schema_hash, meta);
+            };
+            if (load_tablet_pool->submit_func(std::move(task)).ok()) {
+                return true;
+            }
+        }
+        load_one_tablet(tablet_id, schema_hash, value);
         return true;
     };
+    auto wait_load_tablet_pool = [&load_tablet_pool]() {
+        if (load_tablet_pool != nullptr) {
+            load_tablet_pool->wait();
+        }
+    };
     Status load_tablet_status =
             TabletMetaManager::walk_until_timeout(_kv_store, load_tablet_func, config::load_tablet_timeout_seconds);
+    wait_load_tablet_pool();
     if (load_tablet_status.is_time_out()) {
         LOG(WARNING) << "load tablets from rocksdb timeout, try to compact meta and retry. path: " << _path;
         Status s = _kv_store->compact();
@@ -317,6 +354,10 @@ Status DataDir::load() {
         tablet_ids.clear();
         failed_tablet_ids.clear();
         load_tablet_status = TabletMetaManager::walk(_kv_store, load_tablet_func);
+        wait_load_tablet_pool();
+    }
+    if (load_tablet_pool != nullptr) {
+        load_tablet_pool->shutdown();
     }
 
     if (failed_tablet_ids.size() != 0) {
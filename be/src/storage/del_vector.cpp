@@ -39,6 +39,10 @@ void DelVector::_add_dels(const std::vector<uint32_t>& dels) {
     } else {
         _roaring->addMany(dels.size(), dels.data());
     }
+    // Deleted rows of a segment are often consecutive (e.g. a whole range is rewritten by an update), keep
+    // them as run containers so the cached and persisted delvec stay small.
+    _roaring->runOptimize();
+    _roaring->shrinkToFit();
     _update_stats();
 }
 
@@ -353,7 +353,14 @@ Status DeltaWriter::_init() {
         return st;
     }
     _mem_table_sink = std::make_unique<MemTableRowsetWriterSink>(_rowset_writer.get());
-    _flush_token = _storage_engine->memtable_flush_executor()->create_flush_token();
+    // Segments of a duplicate-key rowset are overlapping, so memtables can be flushed in any order.
+    // Secondary replicas receive segments in flush order, so keep flushing serially if there are any.
+    auto flush_mode = ThreadPool::ExecutionMode::SERIAL;
+    if (config::enable_parallel_memtable_flush && _tablet_schema->keys_type() == KeysType::DUP_KEYS &&
+        !(_replica_state == Primary && _opt.replicas.size() > 1)) {
+        flush_mode = ThreadPool::ExecutionMode::CONCURRENT;
+    }
+    _flush_token = _storage_engine->memtable_flush_executor()->create_flush_token(flush_mode);
     if (_replica_state == Primary && _opt.replicas.size() > 1) {
         _replicate_token = _storage_engine->segment_replicate_executor()->create_replicate_token(&_opt);
     }
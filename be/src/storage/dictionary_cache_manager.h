@@ -155,6 +155,7 @@ public:
         switch (_type) {
         case DictionaryCacheEncoderType::PK_ENCODE: {
             size_t size = src->size();
+            dest->reserve(dest->size() + size);
             const auto* raw_data = reinterpret_cast<const KeyCppType*>(src->raw_data());
 
             if (LIKELY(size >= 2 * PREFETCHN)) {
@@ -190,9 +191,9 @@ public:
                         if (iter == _dictionary.end()) {
                             return Status::NotFound("key not found in dictionary cache");
                         }
-                        dest->append_datum(*_get_datum(iter->second));
+                        dest->append_datum(_get_datum(iter->second));
                         if constexpr (std::is_same_v<ValueCppType, Slice>) {
-                            value_encode_flags[i] = *(reinterpret_cast<uint8_t*>(iter->second.data) - 1);
+                            value_encode_flags[beg_index + j] = *(reinterpret_cast<uint8_t*>(iter->second.data) - 1);
                         }
                     }
                 }
@@ -203,7 +204,7 @@ public:
                     if (iter == _dictionary.end()) {
                         return Status::NotFound("key not found in dictionary cache");
                     }
-                    dest->append_datum(*_get_datum(iter->second));
+                    dest->append_datum(_get_datum(iter->second));
                     if constexpr (std::is_same_v<ValueCppType, Slice>) {
                         value_encode_flags[i] = *(reinterpret_cast<uint8_t*>(iter->second.data) - 1);
                     }
@@ -214,7 +215,7 @@ public:
                     if (iter == _dictionary.end()) {
                         return Status::NotFound("key not found in dictionary cache");
                     }
-                    dest->append_datum(*_get_datum(iter->second));
+                    dest->append_datum(_get_datum(iter->second));
                     if constexpr (std::is_same_v<ValueCppType, Slice>) {
                         value_encode_flags[i] = *(reinterpret_cast<uint8_t*>(iter->second.data) - 1);
                     }
@@ -234,15 +235,16 @@ public:
     virtual std::mutex& lock() override { return _lock; }
 
 private:
-    inline std::shared_ptr<Datum> _get_datum(const ValueCppType& v) {
+    // Returned by value, the datum only wraps the value or the slice of the cache entry.
+    inline Datum _get_datum(const ValueCppType& v) {
         switch (_type) {
         case DictionaryCacheEncoderType::PK_ENCODE: {
-            return std::make_shared<Datum>(v);
+            return Datum(v);
         }
         default:
             break;
         }
-        return nullptr;
+        return {};
     }
 
     template <class KeyCppType, class ValueCppType>
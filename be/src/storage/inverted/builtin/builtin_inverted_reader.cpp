@@ -0,0 +1,212 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/inverted/builtin/builtin_inverted_reader.h"
+
+#include <fmt/format.h>
+
+#include "common/config.h"
+#include "fs/fs.h"
+#include "storage/inverted/index_descriptor.hpp"
+#include "storage/olap_common.h"
+#include "types/logical_type.h"
+#include "util/coding.h"
+#include "util/crc32c.h"
+
+namespace starrocks {
+
+Status BuiltinInvertedReader::create(const std::string& path, const std::shared_ptr<TabletIndex>& tablet_index,
+                                     LogicalType field_type, std::unique_ptr<InvertedReader>* res) {
+    if (!is_string_type(field_type)) {
+        return Status::InvalidArgument(fmt::format("Not supported type {}", field_type));
+    }
+    *res = std::make_unique<BuiltinInvertedReader>(path, tablet_index->index_id());
+    return Status::OK();
+}
+
+Status BuiltinInvertedReader::new_iterator(const std::shared_ptr<TabletIndex> index_meta,
+                                           InvertedIndexIterator** iterator) {
+    *iterator = new InvertedIndexIterator(index_meta, this);
+    return Status::OK();
+}
+
+Status BuiltinInvertedReader::_read_meta(RandomAccessFile* file, ColumnIndexMetaPB* meta) {
+    // meta size (4 bytes) and meta checksum (4 bytes) at the end of the file
+    const int64_t fixed_size = 8;
+    ASSIGN_OR_RETURN(auto file_size, file->get_size());
+    if (file_size < fixed_size) {
+        return Status::Corruption(fmt::format("Bad builtin inverted index file {}: file size {} < {}",
+                                              file->filename(), file_size, fixed_size));
+    }
+    uint8_t fixed_buf[fixed_size];
+    RETURN_IF_ERROR(file->read_at_fully(file_size - fixed_size, fixed_buf, fixed_size));
+    uint32_t meta_size = decode_fixed32_le(fixed_buf);
+    uint32_t expect_checksum = decode_fixed32_le(fixed_buf + 4);
+    if (file_size < fixed_size + meta_size) {
+        return Status::Corruption(fmt::format("Bad builtin inverted index file {}: file size {} < {}",
+                                              file->filename(), file_size, fixed_size + meta_size));
+    }
+
+    std::string meta_buf;
+    meta_buf.resize(meta_size);
+    RETURN_IF_ERROR(file->read_at_fully(file_size - fixed_size - meta_size, meta_buf.data(), meta_size));
+    uint32_t actual_checksum = crc32c::Value(meta_buf.data(), meta_buf.size());
+    if (actual_checksum != expect_checksum) {
+        return Status::Corruption(fmt::format("Bad builtin inverted index file {}: checksum not match, {} vs {}",
+                                              file->filename(), actual_checksum, expect_checksum));
+    }
+    if (!meta->ParseFromString(meta_buf) || !meta->has_bitmap_index()) {
+        return Status::Corruption(
+                fmt::format("Bad builtin inverted index file {}: failed to parse meta", file->filename()));
+    }
+    return Status::OK();
+}
+
+Status BuiltinInvertedReader::_new_bitmap_iterator(RandomAccessFile* file, OlapReaderStatistics* stats,
+                                                   std::unique_ptr<BitmapIndexIterator>* iter) {
+    IndexReadOptions opts;
+    opts.use_page_cache = !config::disable_storage_page_cache;
+    opts.read_file = file;
+    opts.stats = stats;
+    if (!_bitmap_reader.loaded()) {
+        ColumnIndexMetaPB meta;
+        RETURN_IF_ERROR(_read_meta(file, &meta));
+        RETURN_IF_ERROR(_bitmap_reader.load(opts, meta.bitmap_index()).status());
+    }
+    BitmapIndexIterator* bitmap_iter = nullptr;
+    RETURN_IF_ERROR(_bitmap_reader.new_iterator(opts, &bitmap_iter));
+    iter->reset(bitmap_iter);
+    return Status::OK();
+}
+
+// Ordinal of the first term that is >= value, num_terms if there is no such term.
+static Status seek_term(BitmapIndexIterator* iter, const Slice& value, rowid_t num_terms, rowid_t* ordinal,
+                        bool* exact_match) {
+    Status st = iter->seek_dictionary(&value, exact_match);
+    if (st.is_not_found()) {
+        *ordinal = num_terms;
+        *exact_match = false;
+        return Status::OK();
+    }
+    RETURN_IF_ERROR(st);
+    *ordinal = iter->current_ordinal();
+    return Status::OK();
+}
+
+// Only patterns like 'abc%' or 'abc*' can be answered by a range of the sorted dictionary.
+static bool wildcard_to_prefix(const Slice& pattern, std::string* prefix) {
+    if (pattern.size == 0 || (pattern.data[pattern.size - 1] != '%' && pattern.data[pattern.size - 1] != '*')) {
+        return false;
+    }
+    for (size_t i = 0; i + 1 < pattern.size; i++) {
+        char c = pattern.data[i];
+        if (c == '%' || c == '*' || c == '_' || c == '?' || c == '\\') {
+            return false;
+        }
+    }
+    prefix->assign(pattern.data, pattern.size - 1);
+    return true;
+}
+
+Status BuiltinInvertedReader::query(OlapReaderStatistics* stats, const std::string& column_name,
+                                    const void* query_value, InvertedIndexQueryType query_type,
+                                    roaring::Roaring* bit_map) {
+    const auto* value = reinterpret_cast<const Slice*>(query_value);
+    OlapReaderStatistics local_stats;
+    if (stats == nullptr) {
+        stats = &local_stats;
+    }
+    ASSIGN_OR_RETURN(auto file, FileSystem::Default()->new_random_access_file(
+                                        IndexDescriptor::builtin_index_file_path(_index_path)));
+    std::unique_ptr<BitmapIndexIterator> iter;
+    RETURN_IF_ERROR(_new_bitmap_iterator(file.get(), stats, &iter));
+
+    // the null bitmap is stored after the bitmaps of all the terms
+    const rowid_t num_terms = iter->bitmap_nums() - (iter->has_null_bitmap() ? 1 : 0);
+    rowid_t from = 0;
+    rowid_t to = num_terms;
+    rowid_t ordinal = 0;
+    bool exact_match = false;
+    switch (query_type) {
+    case InvertedIndexQueryType::EQUAL_QUERY:
+    case InvertedIndexQueryType::MATCH_ALL_QUERY:
+    case InvertedIndexQueryType::MATCH_PHRASE_QUERY:
+        // an untokenized value is a single term
+        RETURN_IF_ERROR(seek_term(iter.get(), *value, num_terms, &ordinal, &exact_match));
+        from = ordinal;
+        to = exact_match ? ordinal + 1 : ordinal;
+        break;
+    case InvertedIndexQueryType::LESS_THAN_QUERY:
+        RETURN_IF_ERROR(seek_term(iter.get(), *value, num_terms, &ordinal, &exact_match));
+        to = ordinal;
+        break;
+    case InvertedIndexQueryType::LESS_EQUAL_QUERY:
+        RETURN_IF_ERROR(seek_term(iter.get(), *value, num_terms, &ordinal, &exact_match));
+        to = exact_match ? ordinal + 1 : ordinal;
+        break;
+    case InvertedIndexQueryType::GREATER_THAN_QUERY:
+        RETURN_IF_ERROR(seek_term(iter.get(), *value, num_terms, &ordinal, &exact_match));
+        from = exact_match ? ordinal + 1 : ordinal;
+        break;
+    case InvertedIndexQueryType::GREATER_EQUAL_QUERY:
+        RETURN_IF_ERROR(seek_term(iter.get(), *value, num_terms, &ordinal, &exact_match));
+        from = ordinal;
+        break;
+    case InvertedIndexQueryType::MATCH_WILDCARD_QUERY: {
+        std::string prefix;
+        if (!wildcard_to_prefix(*value, &prefix)) {
+            return Status::NotSupported(fmt::format("Builtin inverted index only supports prefix wildcard, pattern: {}",
+                                                    value->to_string()));
+        }
+        RETURN_IF_ERROR(seek_term(iter.get(), Slice(prefix), num_terms, &from, &exact_match));
+        // the terms with the prefix are all less than the prefix with its last byte increased
+        while (!prefix.empty() && static_cast<uint8_t>(prefix.back()) == 0xFF) {
+            prefix.pop_back();
+        }
+        if (!prefix.empty()) {
+            prefix.back() = static_cast<char>(static_cast<uint8_t>(prefix.back()) + 1);
+            RETURN_IF_ERROR(seek_term(iter.get(), Slice(prefix), num_terms, &to, &exact_match));
+        }
+        break;
+    }
+    default:
+        return Status::NotSupported(
+                fmt::format("Builtin inverted index does not support query type {}", static_cast<int>(query_type)));
+    }
+
+    roaring::Roaring result;
+    if (from < to) {
+        RETURN_IF_ERROR(iter->read_union_bitmap(from, to, &result));
+    }
+    bit_map->swap(result);
+    return Status::OK();
+}
+
+Status BuiltinInvertedReader::query_null(OlapReaderStatistics* stats, const std::string& column_name,
+                                         roaring::Roaring* bit_map) {
+    OlapReaderStatistics local_stats;
+    if (stats == nullptr) {
+        stats = &local_stats;
+    }
+    ASSIGN_OR_RETURN(auto file, FileSystem::Default()->new_random_access_file(
+                                        IndexDescriptor::builtin_index_file_path(_index_path)));
+    std::unique_ptr<BitmapIndexIterator> iter;
+    RETURN_IF_ERROR(_new_bitmap_iterator(file.get(), stats, &iter));
+    roaring::Roaring result;
+    RETURN_IF_ERROR(iter->read_null_bitmap(&result));
+    bit_map->swap(result);
+    return Status::OK();
+}
+
+} // namespace starrocks
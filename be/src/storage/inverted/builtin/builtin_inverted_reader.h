@@ -0,0 +1,55 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "storage/inverted/inverted_reader.h"
+#include "storage/rowset/bitmap_index_reader.h"
+
+namespace starrocks {
+
+class RandomAccessFile;
+
+// Reader of the index written by BuiltinInvertedWriter. Equal, range and prefix wildcard queries are
+// answered from the sorted dictionary, other queries return NotSupported and are evaluated on the rows.
+class BuiltinInvertedReader : public InvertedReader {
+public:
+    explicit BuiltinInvertedReader(std::string path, const uint32_t index_id)
+            : InvertedReader(std::move(path), index_id) {}
+
+    static Status create(const std::string& path, const std::shared_ptr<TabletIndex>& tablet_index,
+                         LogicalType field_type, std::unique_ptr<InvertedReader>* res);
+
+    Status new_iterator(const std::shared_ptr<TabletIndex> index_meta, InvertedIndexIterator** iterator) override;
+
+    Status query(OlapReaderStatistics* stats, const std::string& column_name, const void* query_value,
+                 InvertedIndexQueryType query_type, roaring::Roaring* bit_map) override;
+
+    Status query_null(OlapReaderStatistics* stats, const std::string& column_name, roaring::Roaring* bit_map) override;
+
+    InvertedIndexReaderType get_inverted_index_reader_type() override { return InvertedIndexReaderType::STRING; }
+
+private:
+    Status _read_meta(RandomAccessFile* file, ColumnIndexMetaPB* meta);
+
+    Status _new_bitmap_iterator(RandomAccessFile* file, OlapReaderStatistics* stats,
+                                std::unique_ptr<BitmapIndexIterator>* iter);
+
+    BitmapIndexReader _bitmap_reader;
+};
+
+} // namespace starrocks
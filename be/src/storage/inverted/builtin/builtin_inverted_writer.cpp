@@ -0,0 +1,73 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/inverted/builtin/builtin_inverted_writer.h"
+
+#include <fmt/format.h>
+
+#include "fs/fs.h"
+#include "fs/fs_util.h"
+#include "storage/inverted/index_descriptor.hpp"
+#include "storage/inverted/inverted_index_option.h"
+#include "storage/types.h"
+#include "types/logical_type.h"
+#include "util/coding.h"
+#include "util/crc32c.h"
+
+namespace starrocks {
+
+Status BuiltinInvertedWriter::create(const TypeInfoPtr& typeinfo, const std::string& directory,
+                                     TabletIndex* tablet_index, std::unique_ptr<InvertedWriter>* res) {
+    LogicalType type = typeinfo->type();
+    if (type != LogicalType::TYPE_CHAR && type != LogicalType::TYPE_VARCHAR) {
+        return Status::NotSupported(
+                fmt::format("Unsupported type for builtin inverted index: {}", type_to_string_v2(type)));
+    }
+    auto parser_type = get_inverted_index_parser_type_from_string(
+            get_parser_string_from_properties(tablet_index->index_properties()));
+    if (parser_type != InvertedIndexParserType::PARSER_NONE) {
+        return Status::NotSupported(fmt::format("Builtin inverted index does not support parser {}",
+                                                inverted_index_parser_type_to_string(parser_type)));
+    }
+    *res = std::make_unique<BuiltinInvertedWriter>(typeinfo, directory);
+    return Status::OK();
+}
+
+Status BuiltinInvertedWriter::init() {
+    return BitmapIndexWriter::create(_typeinfo, &_bitmap_writer);
+}
+
+// The file is laid out as:
+//   dictionary pages | bitmap pages | ColumnIndexMetaPB | meta size (4 bytes) | meta checksum (4 bytes)
+Status BuiltinInvertedWriter::finish() {
+    RETURN_IF_ERROR(fs::create_directories(_directory));
+    ASSIGN_OR_RETURN(auto wfile,
+                     FileSystem::Default()->new_writable_file(IndexDescriptor::builtin_index_file_path(_directory)));
+
+    ColumnIndexMetaPB meta;
+    RETURN_IF_ERROR(_bitmap_writer->finish(wfile.get(), &meta));
+
+    std::string footer;
+    if (!meta.SerializeToString(&footer)) {
+        return Status::InternalError("Failed to serialize builtin inverted index meta");
+    }
+    uint32_t meta_size = footer.size();
+    uint32_t checksum = crc32c::Value(footer.data(), footer.size());
+    put_fixed32_le(&footer, meta_size);
+    put_fixed32_le(&footer, checksum);
+    RETURN_IF_ERROR(wfile->append(footer));
+    return wfile->close();
+}
+
+} // namespace starrocks
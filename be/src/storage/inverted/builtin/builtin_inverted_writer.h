@@ -0,0 +1,62 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "storage/inverted/inverted_writer.h"
+#include "storage/rowset/bitmap_index_writer.h"
+#include "storage/tablet_schema.h"
+
+namespace starrocks {
+
+// Inverted index for untokenized string columns that does not depend on CLucene. The terms are
+// kept in a sorted dictionary and every term refers to a roaring bitmap of the row ids it occurs
+// in. Both are written as indexed columns, so that they are read through PageIO and the storage
+// page cache like any other page of a segment.
+//
+// The index is stored as a single file inside the directory of the inverted index.
+class BuiltinInvertedWriter : public InvertedWriter {
+public:
+    BuiltinInvertedWriter(TypeInfoPtr typeinfo, std::string directory)
+            : _typeinfo(std::move(typeinfo)), _directory(std::move(directory)) {}
+
+    ~BuiltinInvertedWriter() override = default;
+
+    static Status create(const TypeInfoPtr& typeinfo, const std::string& directory, TabletIndex* tablet_index,
+                         std::unique_ptr<InvertedWriter>* res);
+
+    Status init() override;
+
+    void add_values(const void* values, size_t count) override { _bitmap_writer->add_values(values, count); }
+
+    void add_nulls(uint32_t count) override { _bitmap_writer->add_nulls(count); }
+
+    Status finish() override;
+
+    uint64_t size() const override { return _bitmap_writer->size(); }
+
+    uint64_t estimate_buffer_size() const override { return _bitmap_writer->size(); }
+
+    uint64_t total_mem_footprint() const override { return _bitmap_writer->size(); }
+
+private:
+    TypeInfoPtr _typeinfo;
+    std::string _directory;
+    std::unique_ptr<BitmapIndexWriter> _bitmap_writer;
+};
+
+} // namespace starrocks
@@ -18,9 +18,12 @@
 
 #include <boost/locale/encoding_utf.hpp>
 #include <memory>
+#include <optional>
 
+#include "common/config.h"
 #include "match_operator.h"
 #include "storage/inverted/index_descriptor.hpp"
+#include "storage/page_cache.h"
 #include "types/logical_type.h"
 #include "util/defer_op.h"
 #include "util/faststring.h"
@@ -46,6 +49,19 @@ Status CLuceneInvertedReader::create(const std::string& path, const std::shared_
     }
 }
 
+// The index files of a segment are immutable, so the result of a query only depends on the index path,
+// the column, the query type and the search string.
+static StoragePageCache::CacheKey query_result_cache_key(const std::string& index_path, const std::string& column_name,
+                                                         InvertedIndexQueryType query_type,
+                                                         const std::string& search_str) {
+    std::string fname;
+    fname.reserve(index_path.size() + column_name.size() + search_str.size() + 16);
+    fname.append("inverted:").append(index_path).push_back('\0');
+    fname.append(column_name).push_back('\0');
+    fname.append(search_str);
+    return {std::move(fname), static_cast<int64_t>(query_type)};
+}
+
 Status FullTextCLuceneInvertedReader::query(OlapReaderStatistics* stats, const std::string& column_name,
                                             const void* query_value, InvertedIndexQueryType query_type,
                                             roaring::Roaring* bit_map) {
@@ -62,6 +78,20 @@ Status FullTextCLuceneInvertedReader::query(OlapReaderStatistics* stats, const s
         return Status::NotFound(fmt::format("Not exists index_file {}", _index_path.c_str()));
     }
 
+    StoragePageCache* cache = StoragePageCache::instance();
+    bool use_cache =
+            cache != nullptr && config::enable_inverted_index_query_result_cache && !config::disable_storage_page_cache;
+    std::optional<StoragePageCache::CacheKey> cache_key;
+    if (use_cache) {
+        cache_key.emplace(query_result_cache_key(_index_path, column_name, query_type, search_str));
+        PageCacheHandle handle;
+        if (cache->lookup(*cache_key, &handle)) {
+            Slice data = handle.data();
+            *bit_map = roaring::Roaring::readSafe(data.data, data.size);
+            return Status::OK();
+        }
+    }
+
     std::unique_ptr<MatchOperator> match_operator;
 
     auto* directory = lucene::store::FSDirectory::getDirectory(_index_path.c_str());
@@ -112,6 +142,15 @@ Status FullTextCLuceneInvertedReader::query(OlapReaderStatistics* stats, const s
         LOG(WARNING) << "CLuceneError occured, error msg: " << e.what();
         return Status::InternalError(fmt::format("CLuceneError occured, error msg: {}", e.what()));
     }
+    if (use_cache) {
+        result.runOptimize();
+        size_t size = result.getSizeInBytes();
+        std::unique_ptr<uint8_t[]> buf(new uint8_t[size]);
+        result.write(reinterpret_cast<char*>(buf.get()));
+        PageCacheHandle handle;
+        cache->insert(*cache_key, Slice(buf.get(), size), &handle);
+        buf.release();
+    }
     bit_map->swap(result);
     return Status::OK();
 }
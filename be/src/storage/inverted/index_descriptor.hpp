@@ -34,6 +34,11 @@ public:
     }
 
     static const std::string get_temporary_null_bitmap_file_name() { return "null_bitmap"; }
+
+    // the builtin inverted index keeps the dictionary and the bitmaps in one file of the index directory
+    static std::string builtin_index_file_path(const std::string& index_dir) {
+        return fmt::format("{}/builtin_index", index_dir);
+    }
 };
 
 } // namespace starrocks
\ No newline at end of file
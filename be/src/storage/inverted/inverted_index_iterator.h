@@ -45,7 +45,7 @@ public:
 
 private:
     const std::shared_ptr<TabletIndex> _index_meta;
-    OlapReaderStatistics* _stats;
+    OlapReaderStatistics* _stats = nullptr;
     InvertedReader* _reader;
     InvertedIndexParserType _analyser_type;
 };
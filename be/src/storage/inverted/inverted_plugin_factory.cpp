@@ -14,6 +14,7 @@
 
 #include "storage/inverted/inverted_plugin_factory.h"
 
+#include "builtin/builtin_plugin.h"
 #include "clucene/clucene_plugin.h"
 #include "common/statusor.h"
 
@@ -22,6 +23,8 @@ StatusOr<InvertedPlugin*> InvertedPluginFactory::get_plugin(InvertedImplementTyp
     switch (imp_type) {
     case InvertedImplementType::CLUCENE:
         return &CLucenePlugin::get_instance();
+    case InvertedImplementType::BUILTIN:
+        return &BuiltinPlugin::get_instance();
     default:
         return Status::InternalError("Invalid implement of inverted type");
     }
@@ -23,6 +23,7 @@
 #include <thread>
 
 #include "agent/master_info.h"
+#include "common/config.h"
 #include "common/status.h"
 #include "fs/fs.h"
 #include "gen_cpp/FrontendService.h"
@@ -32,6 +33,7 @@
 #include "runtime/exec_env.h"
 #include "service/service_be/lake_service.h"
 #include "storage/lake/compaction_task.h"
+#include "storage/lake/metacache.h"
 #include "storage/lake/tablet_manager.h"
 #include "storage/memtable_flush_executor.h"
 #include "storage/storage_engine.h"
@@ -134,9 +136,35 @@ void CompactionScheduler::compact(::google::protobuf::RpcController* controller,
         _task_queues.put(idx, context);
         is_checker = false;
     }
+    if (config::lake_compaction_prefetch_tablet_metadata && request->tablet_ids_size() > 1) {
+        prefetch_tablet_metadata(request);
+    }
     TEST_SYNC_POINT("CompactionScheduler::compact:return");
 }
 
+void CompactionScheduler::prefetch_tablet_metadata(const CompactRequest* request) {
+    auto pool = ExecEnv::GetInstance()->load_segment_thread_pool();
+    if (pool == nullptr) {
+        return;
+    }
+    auto version = request->version();
+    // The first tablet is compacted right away and reads its metadata itself
+    for (int i = 1, sz = request->tablet_ids_size(); i < sz; i++) {
+        auto tablet_id = request->tablet_ids(i);
+        auto path = _tablet_mgr->tablet_metadata_location(tablet_id, version);
+        if (_tablet_mgr->metacache()->lookup_tablet_metadata(path) != nullptr) {
+            continue;
+        }
+        auto st = pool->submit_func([tablet_mgr = _tablet_mgr, path = std::move(path)]() {
+            // Errors are ignored here, the compaction task will read the metadata again and report them
+            (void)tablet_mgr->get_tablet_metadata(path);
+        });
+        if (!st.ok()) {
+            break;
+        }
+    }
+}
+
 void CompactionScheduler::list_tasks(std::vector<CompactionTaskInfo>* infos) {
     std::lock_guard l(_contexts_lock);
     for (butil::LinkNode<CompactionTaskContext>* node = _contexts.head(); node != _contexts.end();
@@ -222,6 +222,10 @@ private:
 
     Status do_compaction(std::unique_ptr<CompactionTaskContext> context);
 
+    // Load the metadata of the tablets in |request| into the metacache in the background, so that the tasks of
+    // a request with many small tablets do not each wait for a metadata read when they start.
+    void prefetch_tablet_metadata(const CompactRequest* request);
+
     int choose_task_queue_by_txn_id(int64_t txn_id) { return txn_id % _task_queues.task_queue_safe_size(); }
 
     bool reschedule_task_if_needed(int id);
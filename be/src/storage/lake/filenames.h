@@ -100,6 +100,14 @@ inline int64_t parse_combined_txn_log_filename(std::string_view file_name) {
     return txn_id;
 }
 
+inline std::string combined_tablet_metadata_filename(int64_t version) {
+    return fmt::format("{:016X}.metas", version);
+}
+
+inline bool is_combined_tablet_metadata(std::string_view file_name) {
+    return HasSuffixString(file_name, ".metas");
+}
+
 inline std::string tablet_metadata_lock_filename(int64_t tablet_id, int64_t version, int64_t expire_time) {
     return fmt::format("{:016X}_{:016X}_{:016X}.lock", tablet_id, version, expire_time);
 }
@@ -120,12 +120,12 @@ Status LakePersistentIndex::minor_compact() {
     auto location = _tablet_mgr->sst_location(_tablet_id, filename);
     ASSIGN_OR_RETURN(auto wf, fs::new_writable_file(location));
     uint64_t filesize = 0;
-    RETURN_IF_ERROR(_immutable_memtable->flush(wf.get(), &filesize));
+    PersistentIndexSstablePB sstable_pb;
+    RETURN_IF_ERROR(_immutable_memtable->flush(wf.get(), &filesize, sstable_pb.mutable_range()));
     RETURN_IF_ERROR(wf->close());
 
     auto sstable = std::make_unique<PersistentIndexSstable>();
     ASSIGN_OR_RETURN(auto rf, fs::new_random_access_file(location));
-    PersistentIndexSstablePB sstable_pb;
     sstable_pb.set_filename(filename);
     sstable_pb.set_filesize(filesize);
     sstable_pb.set_version(_version.major_number());
@@ -152,13 +152,22 @@ Status LakePersistentIndex::get_from_sstables(size_t n, const Slice* keys, Index
     if (key_indexes->empty() || _sstables.empty()) {
         return Status::OK();
     }
+    // sort the keys once, so that every sstable is visited with one forward scan
+    std::vector<KeyIndex> sorted_key_indexes(key_indexes->begin(), key_indexes->end());
+    PersistentIndexSstable::sort_key_indexes(keys, &sorted_key_indexes);
     for (auto iter = _sstables.rbegin(); iter != _sstables.rend(); ++iter) {
         KeyIndexSet found_key_indexes;
-        RETURN_IF_ERROR((*iter)->multi_get(keys, *key_indexes, version, values, &found_key_indexes));
+        RETURN_IF_ERROR((*iter)->multi_get(keys, sorted_key_indexes, version, values, &found_key_indexes));
+        if (found_key_indexes.empty()) {
+            continue;
+        }
         set_difference(key_indexes, found_key_indexes);
         if (key_indexes->empty()) {
             break;
         }
+        sorted_key_indexes.erase(std::remove_if(sorted_key_indexes.begin(), sorted_key_indexes.end(),
+                                                [&](KeyIndex key_index) { return found_key_indexes.count(key_index); }),
+                                 sorted_key_indexes.end());
     }
     return Status::OK();
 }
@@ -256,6 +265,44 @@ Status LakePersistentIndex::replace(size_t n, const Slice* keys, const IndexValu
     return Status::OK();
 }
 
+std::pair<int, int> LakePersistentIndex::pick_compaction_sstables(const PersistentIndexSstableMetaPB& sstable_meta) {
+    const auto& sstables = sstable_meta.sstables();
+    const int num_sstables = sstables.size();
+    const int min_versions = config::lake_pk_index_sst_min_compaction_versions;
+    const int64_t max_compaction_bytes = config::lake_pk_index_sst_max_compaction_bytes;
+    if (!config::lake_pk_index_sst_size_tiered_compaction) {
+        // merge from the oldest sstable
+        int64_t total_filesize = 0;
+        int end = 0;
+        while (end < num_sstables) {
+            total_filesize += sstables[end++].filesize();
+            if (total_filesize >= max_compaction_bytes && end >= min_versions) {
+                break;
+            }
+        }
+        return {0, end};
+    }
+    // Size tiered: grow a run of adjacent sstables towards the older ones, and only take an older sstable
+    // into the run when it is not much larger than the whole run. So a large old sstable is rewritten only
+    // after enough newer data has piled up, instead of once per compaction. The first run, from the newest
+    // sstables on, that is long enough is picked.
+    const double size_ratio = 1 + std::max(config::lake_pk_index_sst_compaction_size_ratio, 0) / 100.0;
+    for (int end = num_sstables; end >= min_versions; end--) {
+        int start = end - 1;
+        int64_t total_filesize = sstables[start].filesize();
+        while (start > 0 && sstables[start - 1].filesize() <= total_filesize * size_ratio) {
+            if (total_filesize >= max_compaction_bytes && end - start >= min_versions) {
+                break;
+            }
+            total_filesize += sstables[--start].filesize();
+        }
+        if (end - start >= min_versions) {
+            return {start, end};
+        }
+    }
+    return {0, 0};
+}
+
 Status LakePersistentIndex::prepare_merging_iterator(
         const TabletMetadata& metadata, TxnLogPB* txn_log,
         std::vector<std::shared_ptr<PersistentIndexSstable>>* merging_sstables,
@@ -270,11 +317,11 @@ Status LakePersistentIndex::prepare_merging_iterator(
         }
     });
 
-    auto max_compaction_bytes = config::lake_pk_index_sst_max_compaction_bytes;
-    iters.reserve(metadata.sstable_meta().sstables().size());
-    size_t total_filesize = 0;
+    auto [start, end] = pick_compaction_sstables(metadata.sstable_meta());
+    iters.reserve(end - start);
     std::stringstream ss_debug;
-    for (const auto& sstable_pb : metadata.sstable_meta().sstables()) {
+    for (int i = start; i < end; i++) {
+        const auto& sstable_pb = metadata.sstable_meta().sstables(i);
         // build sstable from meta, instead of reuse `_sstables`, to keep it thread safe
         ASSIGN_OR_RETURN(auto rf,
                          fs::new_random_access_file(_tablet_mgr->sst_location(_tablet_id, sstable_pb.filename())));
@@ -283,17 +330,12 @@ Status LakePersistentIndex::prepare_merging_iterator(
         merging_sstables->push_back(merging_sstable);
         sstable::Iterator* iter = merging_sstable->new_iterator(read_options);
         iters.emplace_back(iter);
-        total_filesize += sstable_pb.filesize();
         // add input sstable.
         txn_log->mutable_op_compaction()->add_input_sstables()->CopyFrom(merging_sstable->sstable_pb());
         ss_debug << sstable_pb.filename() << " | ";
-        if (total_filesize >= max_compaction_bytes &&
-            merging_sstables->size() >= config::lake_pk_index_sst_min_compaction_versions) {
-            break;
-        }
     }
     sstable::Options options;
-    (*merging_iter_ptr).reset(sstable::NewMergingIterator(options.comparator, &iters[0], iters.size()));
+    (*merging_iter_ptr).reset(sstable::NewMergingIterator(options.comparator, iters.data(), iters.size()));
     (*merging_iter_ptr)->SeekToFirst();
     iters.clear(); // Clear the vector without deleting iterators since they are now managed by merge_iter_ptr.
     VLOG(2) << "prepare sst for merge : " << ss_debug.str();
@@ -301,13 +343,17 @@ Status LakePersistentIndex::prepare_merging_iterator(
 }
 
 Status LakePersistentIndex::merge_sstables(std::unique_ptr<sstable::Iterator> iter_ptr,
-                                           sstable::TableBuilder* builder) {
+                                           sstable::TableBuilder* builder, PersistentIndexSstableRangePB* range) {
     auto merger = std::make_unique<KeyValueMerger>(iter_ptr->key().to_string(), builder);
+    range->set_start_key(iter_ptr->key().to_string());
+    std::string key;
     while (iter_ptr->Valid()) {
-        RETURN_IF_ERROR(merger->merge(iter_ptr->key().to_string(), iter_ptr->value().to_string()));
+        key = iter_ptr->key().to_string();
+        RETURN_IF_ERROR(merger->merge(key, iter_ptr->value().to_string()));
         iter_ptr->Next();
     }
     RETURN_IF_ERROR(iter_ptr->status());
+    range->set_end_key(key);
     merger->finish();
     return builder->Finish();
 }
@@ -334,12 +380,13 @@ Status LakePersistentIndex::major_compact(const TabletMetadata& metadata, int64_
     filter_policy.reset(const_cast<sstable::FilterPolicy*>(sstable::NewBloomFilterPolicy(10)));
     options.filter_policy = filter_policy.get();
     sstable::TableBuilder builder(options, wf.get());
-    RETURN_IF_ERROR(merge_sstables(std::move(merging_iter_ptr), &builder));
+    auto* output_sstable = txn_log->mutable_op_compaction()->mutable_output_sstable();
+    RETURN_IF_ERROR(merge_sstables(std::move(merging_iter_ptr), &builder, output_sstable->mutable_range()));
     RETURN_IF_ERROR(wf->close());
 
     // record output sstable pb
-    txn_log->mutable_op_compaction()->mutable_output_sstable()->set_filename(filename);
-    txn_log->mutable_op_compaction()->mutable_output_sstable()->set_filesize(builder.FileSize());
+    output_sstable->set_filename(filename);
+    output_sstable->set_filesize(builder.FileSize());
     return Status::OK();
 }
 
@@ -363,15 +410,17 @@ Status LakePersistentIndex::apply_opcompaction(const TxnLogPB_OpCompaction& op_c
     for (const auto& input_sstable : op_compaction.input_sstables()) {
         filenames.insert(input_sstable.filename());
     }
-    _sstables.erase(std::remove_if(_sstables.begin(), _sstables.end(),
-                                   [&](const std::unique_ptr<PersistentIndexSstable>& sstable) {
-                                       return filenames.contains(sstable->sstable_pb().filename());
-                                   }),
-                    _sstables.end());
-    if (!_sstables.empty()) {
-        DCHECK(sstable_pb.version() <= _sstables[0]->sstable_pb().version());
-    }
-    _sstables.insert(_sstables.begin(), std::move(sstable));
+    // The input sstables are adjacent, the output takes the place of the oldest one.
+    auto is_input = [&](const std::unique_ptr<PersistentIndexSstable>& sstable) {
+        return filenames.contains(sstable->sstable_pb().filename());
+    };
+    auto pos = std::find_if(_sstables.begin(), _sstables.end(), is_input) - _sstables.begin();
+    _sstables.erase(std::remove_if(_sstables.begin(), _sstables.end(), is_input), _sstables.end());
+    pos = std::min<size_t>(pos, _sstables.size());
+    if (pos < _sstables.size()) {
+        DCHECK(sstable_pb.version() <= _sstables[pos]->sstable_pb().version());
+    }
+    _sstables.insert(_sstables.begin() + pos, std::move(sstable));
     return Status::OK();
 }
 
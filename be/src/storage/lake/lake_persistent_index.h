@@ -118,6 +118,10 @@ public:
 
     Status apply_opcompaction(const TxnLogPB_OpCompaction& op_compaction);
 
+    // Returns the range [start, end) of the adjacent sstables in |sstable_meta| to merge by major_compact.
+    // start == end means there is nothing to merge.
+    static std::pair<int, int> pick_compaction_sstables(const PersistentIndexSstableMetaPB& sstable_meta);
+
     void commit(MetaFileBuilder* builder);
 
     Status load_from_lake_tablet(TabletManager* tablet_mgr, const TabletMetadataPtr& metadata, int64_t base_version,
@@ -155,7 +159,9 @@ private:
                                     std::vector<std::shared_ptr<PersistentIndexSstable>>* merging_sstables,
                                     std::unique_ptr<sstable::Iterator>* merging_iter_ptr);
 
-    Status merge_sstables(std::unique_ptr<sstable::Iterator> iter_ptr, sstable::TableBuilder* builder);
+    // |range|: set to the key range of the merged sstable.
+    Status merge_sstables(std::unique_ptr<sstable::Iterator> iter_ptr, sstable::TableBuilder* builder,
+                          PersistentIndexSstableRangePB* range);
 
 private:
     std::unique_ptr<PersistentIndexMemtable> _memtable;
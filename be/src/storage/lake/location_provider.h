@@ -65,6 +65,10 @@ public:
         return join_path(metadata_root_location(tablet_id), tablet_metadata_filename(tablet_id, version));
     }
 
+    std::string combined_tablet_metadata_location(int64_t tablet_id, int64_t version) const {
+        return join_path(metadata_root_location(tablet_id), combined_tablet_metadata_filename(version));
+    }
+
     std::string txn_log_location(int64_t tablet_id, int64_t txn_id) const {
         return join_path(txn_log_root_location(tablet_id), txn_log_filename(tablet_id, txn_id));
     }
@@ -143,8 +143,8 @@ size_t PersistentIndexMemtable::memory_usage() const {
     return mem_usage;
 }
 
-Status PersistentIndexMemtable::flush(WritableFile* wf, uint64_t* filesize) {
-    return PersistentIndexSstable::build_sstable(_map, wf, filesize);
+Status PersistentIndexMemtable::flush(WritableFile* wf, uint64_t* filesize, PersistentIndexSstableRangePB* range) {
+    return PersistentIndexSstable::build_sstable(_map, wf, filesize, range);
 }
 
 void PersistentIndexMemtable::clear() {
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include "gen_cpp/types.pb.h"
 #include "storage/persistent_index.h"
 #include "util/phmap/btree.h"
 
@@ -54,7 +55,7 @@ public:
 
     size_t memory_usage() const;
 
-    Status flush(WritableFile* wf, uint64_t* filesize);
+    Status flush(WritableFile* wf, uint64_t* filesize, PersistentIndexSstableRangePB* range = nullptr);
 
     void clear();
 
@@ -16,6 +16,8 @@
 
 #include <butil/time.h> // NOLINT
 
+#include <algorithm>
+
 #include "fs/fs.h"
 #include "storage/lake/utils.h"
 #include "storage/sstable/table_builder.h"
@@ -41,7 +43,7 @@ Status PersistentIndexSstable::init(std::unique_ptr<RandomAccessFile> rf, const
 
 Status PersistentIndexSstable::build_sstable(
         const phmap::btree_map<std::string, std::list<IndexValueWithVer>, std::less<>>& map, WritableFile* wf,
-        uint64_t* filesz) {
+        uint64_t* filesz, PersistentIndexSstableRangePB* range) {
     std::unique_ptr<sstable::FilterPolicy> filter_policy;
     filter_policy.reset(const_cast<sstable::FilterPolicy*>(sstable::NewBloomFilterPolicy(10)));
     sstable::Options options;
@@ -59,19 +61,51 @@ Status PersistentIndexSstable::build_sstable(
     }
     RETURN_IF_ERROR(builder.Finish());
     *filesz = builder.FileSize();
+    if (range != nullptr && !map.empty()) {
+        range->set_start_key(map.begin()->first);
+        range->set_end_key(map.rbegin()->first);
+    }
     return Status::OK();
 }
 
+void PersistentIndexSstable::sort_key_indexes(const Slice* keys, std::vector<KeyIndex>* key_indexes) {
+    std::sort(key_indexes->begin(), key_indexes->end(),
+              [keys](KeyIndex lhs, KeyIndex rhs) { return keys[lhs].compare(keys[rhs]) < 0; });
+}
+
 Status PersistentIndexSstable::multi_get(const Slice* keys, const KeyIndexSet& key_indexes, int64_t version,
                                          IndexValue* values, KeyIndexSet* found_key_indexes) const {
-    std::vector<std::string> index_value_with_vers(key_indexes.size());
+    std::vector<KeyIndex> sorted_key_indexes(key_indexes.begin(), key_indexes.end());
+    sort_key_indexes(keys, &sorted_key_indexes);
+    return multi_get(keys, sorted_key_indexes, version, values, found_key_indexes);
+}
+
+Status PersistentIndexSstable::multi_get(const Slice* keys, const std::vector<KeyIndex>& sorted_key_indexes,
+                                         int64_t version, IndexValue* values, KeyIndexSet* found_key_indexes) const {
+    auto begin = sorted_key_indexes.begin();
+    auto end = sorted_key_indexes.end();
+    if (_sstable_pb.has_range()) {
+        // skip the keys outside of the key range of this sstable without touching any block
+        Slice start_key(_sstable_pb.range().start_key());
+        Slice end_key(_sstable_pb.range().end_key());
+        begin = std::lower_bound(begin, end, start_key,
+                                 [keys](KeyIndex lhs, const Slice& key) { return keys[lhs].compare(key) < 0; });
+        end = std::upper_bound(begin, end, end_key,
+                               [keys](const Slice& key, KeyIndex rhs) { return key.compare(keys[rhs]) < 0; });
+        TRACE_COUNTER_INCREMENT("sst_range_filter_rows", sorted_key_indexes.size() - (end - begin));
+        if (begin == end) {
+            return Status::OK();
+        }
+    }
+    std::vector<std::string> index_value_with_vers(end - begin);
     sstable::ReadOptions options;
     auto start_ts = butil::gettimeofday_us();
-    RETURN_IF_ERROR(_sst->MultiGet(options, keys, key_indexes.begin(), key_indexes.end(), &index_value_with_vers));
+    RETURN_IF_ERROR(_sst->MultiGet(options, keys, begin, end, &index_value_with_vers));
     auto end_ts = butil::gettimeofday_us();
     TRACE_COUNTER_INCREMENT("multi_get", end_ts - start_ts);
     size_t i = 0;
-    for (auto& key_index : key_indexes) {
+    for (auto it = begin; it != end; ++it) {
+        KeyIndex key_index = *it;
         // Index_value_with_vers is empty means key is not found in sst.
         // Value in sst can not be empty.
         if (index_value_with_vers[i].empty()) {
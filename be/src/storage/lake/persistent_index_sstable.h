@@ -15,6 +15,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include "gen_cpp/lake_types.pb.h"
 #include "storage/persistent_index.h"
@@ -27,6 +28,7 @@ namespace starrocks {
 
 class WritableFile;
 class PersistentIndexSstablePB;
+class PersistentIndexSstableRangePB;
 
 namespace lake {
 using KeyIndex = size_t;
@@ -42,8 +44,9 @@ public:
     Status init(std::unique_ptr<RandomAccessFile> rf, const PersistentIndexSstablePB& sstable_pb, Cache* cache,
                 bool need_filter = true);
 
+    // |range| : if not null, set to the key range of the built sstable.
     static Status build_sstable(const phmap::btree_map<std::string, std::list<IndexValueWithVer>, std::less<>>& map,
-                                WritableFile* wf, uint64_t* filesz);
+                                WritableFile* wf, uint64_t* filesz, PersistentIndexSstableRangePB* range = nullptr);
 
     // multi_get can get multi keys at onces
     // |keys| : Address point to first element of key array.
@@ -54,6 +57,14 @@ public:
     Status multi_get(const Slice* keys, const KeyIndexSet& key_indexes, int64_t version, IndexValue* values,
                      KeyIndexSet* found_key_indexes) const;
 
+    // Same as above, but |sorted_key_indexes| must be ordered by their keys, so that the sstable is
+    // visited with one forward scan and the keys outside of the key range of the sstable are skipped.
+    Status multi_get(const Slice* keys, const std::vector<KeyIndex>& sorted_key_indexes, int64_t version,
+                     IndexValue* values, KeyIndexSet* found_key_indexes) const;
+
+    // Sort |key_indexes| by their keys in |keys|.
+    static void sort_key_indexes(const Slice* keys, std::vector<KeyIndex>* key_indexes);
+
     sstable::Iterator* new_iterator(const sstable::ReadOptions& options) { return _sst->NewIterator(options); }
 
     const PersistentIndexSstablePB& sstable_pb() const { return _sstable_pb; }
@@ -65,6 +65,7 @@ StatusOr<std::vector<ChunkIteratorPtr>> Rowset::read(const Schema& schema, const
     seg_options.pred_tree = options.pred_tree;
     seg_options.predicates_for_zone_map = options.predicates_for_zone_map;
     seg_options.use_page_cache = options.use_page_cache;
+    seg_options.fill_data_page_cache = options.fill_data_page_cache;
     seg_options.profile = options.profile;
     seg_options.reader_type = options.reader_type;
     seg_options.chunk_size = options.chunk_size;
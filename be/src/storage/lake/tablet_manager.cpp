@@ -22,6 +22,7 @@
 
 #include "agent/master_info.h"
 #include "common/compiler_util.h"
+#include "common/config.h"
 #include "fmt/format.h"
 #include "fs/fs.h"
 #include "fs/fs_util.h"
@@ -90,6 +91,10 @@ std::string TabletManager::combined_txn_log_location(int64_t tablet_id, int64_t
     return _location_provider->combined_txn_log_location(tablet_id, txn_id);
 }
 
+std::string TabletManager::combined_tablet_metadata_location(int64_t tablet_id, int64_t version) const {
+    return _location_provider->combined_tablet_metadata_location(tablet_id, version);
+}
+
 std::string TabletManager::txn_slog_location(int64_t tablet_id, int64_t txn_id) const {
     return _location_provider->txn_slog_location(tablet_id, txn_id);
 }
@@ -235,7 +240,30 @@ TabletMetadataPtr TabletManager::get_latest_cached_tablet_metadata(int64_t table
 }
 
 StatusOr<TabletMetadataPtr> TabletManager::get_tablet_metadata(int64_t tablet_id, int64_t version) {
-    return get_tablet_metadata(tablet_metadata_location(tablet_id, version));
+    auto res = get_tablet_metadata(tablet_metadata_location(tablet_id, version));
+    if (!res.status().is_not_found() || !config::lake_enable_combined_tablet_metadata) {
+        return res;
+    }
+    // The metadata may have been written as part of a combined metadata object of the partition
+    auto combined_path = combined_tablet_metadata_location(tablet_id, version);
+    auto metas = std::make_shared<CombinedTabletMetadataPB>();
+    ProtobufFile file(combined_path);
+    if (auto st = file.load(metas.get(), false); !st.ok()) {
+        return st.is_not_found() ? res : StatusOr<TabletMetadataPtr>(st);
+    }
+    TabletMetadataPtr target;
+    for (const auto& meta : metas->tablet_metas()) {
+        auto ptr = std::make_shared<TabletMetadataPB>(meta);
+        _metacache->cache_tablet_metadata(tablet_metadata_location(ptr->id(), ptr->version()), ptr);
+        if (ptr->id() == tablet_id) {
+            target = std::move(ptr);
+        }
+    }
+    if (target == nullptr) {
+        return Status::NotFound(fmt::format("{} does not contain metadata of tablet {}", combined_path, tablet_id));
+    }
+    TRACE("got tablet metadata from combined metadata");
+    return target;
 }
 
 StatusOr<TabletMetadataPtr> TabletManager::get_tablet_metadata(const string& path, bool fill_cache) {
@@ -405,6 +433,31 @@ Status TabletManager::put_combined_txn_log(const starrocks::CombinedTxnLogPB& lo
     return file.save(logs);
 }
 
+Status TabletManager::put_combined_tablet_metadata(const CombinedTabletMetadataPB& metas) {
+    if (UNLIKELY(metas.tablet_metas_size() == 0)) {
+        return Status::InvalidArgument("empty CombinedTabletMetadataPB");
+    }
+    auto tablet_id = metas.tablet_metas(0).id();
+    auto version = metas.tablet_metas(0).version();
+    for (const auto& meta : metas.tablet_metas()) {
+        if (UNLIKELY(meta.version() != version)) {
+            return Status::InvalidArgument(fmt::format("tablet {} has version {}, expected version {}", meta.id(),
+                                                       meta.version(), version));
+        }
+    }
+    auto t0 = butil::gettimeofday_us();
+    auto path = _location_provider->combined_tablet_metadata_location(tablet_id, version);
+    ProtobufFile file(path);
+    RETURN_IF_ERROR(file.save(metas));
+    for (const auto& meta : metas.tablet_metas()) {
+        auto ptr = std::make_shared<TabletMetadataPB>(meta);
+        _metacache->cache_tablet_metadata(tablet_metadata_location(ptr->id(), ptr->version()), ptr);
+        _metacache->cache_tablet_metadata(tablet_latest_metadata_cache_key(ptr->id()), ptr);
+    }
+    g_put_tablet_metadata_latency << (butil::gettimeofday_us() - t0);
+    return Status::OK();
+}
+
 StatusOr<int64_t> TabletManager::get_tablet_data_size(int64_t tablet_id, int64_t* version_hint) {
     int64_t size = 0;
     TabletMetadataPtr metadata;
@@ -99,6 +99,11 @@ public:
 
     Status put_combined_txn_log(const CombinedTxnLogPB& logs);
 
+    // Write the metadata of several tablets of the same partition and version as one object, so that
+    // publishing a partition with many tablets needs one PUT instead of one per tablet. The metadata of
+    // every tablet is also cached under its own location.
+    Status put_combined_tablet_metadata(const CombinedTabletMetadataPB& metas);
+
     StatusOr<TxnLogPtr> get_txn_log(int64_t tablet_id, int64_t txn_id);
 
     StatusOr<TxnLogPtr> get_txn_log(const std::string& path, bool fill_cache = true);
@@ -140,6 +145,8 @@ public:
 
     std::string combined_txn_log_location(int64_t tablet_id, int64_t txn_id) const;
 
+    std::string combined_tablet_metadata_location(int64_t tablet_id, int64_t version) const;
+
     std::string segment_location(int64_t tablet_id, std::string_view segment_name) const;
 
     std::string del_location(int64_t tablet_id, std::string_view del_name) const;
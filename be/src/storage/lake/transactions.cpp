@@ -14,6 +14,9 @@
 
 #include "storage/lake/transactions.h"
 
+#include <future>
+
+#include "common/config.h"
 #include "fs/fs_util.h"
 #include "gen_cpp/lake_types.pb.h"
 #include "gutil/strings/join.h"
@@ -27,6 +30,7 @@
 #include "storage/lake/update_manager.h"
 #include "storage/lake/vacuum.h" // delete_files_async
 #include "util/lru_cache.h"
+#include "util/threadpool.h"
 
 namespace {
 
@@ -132,6 +136,24 @@ StatusOr<TxnLogPtr> load_txn_log(TabletManager* tablet_mgr, int64_t tablet_id, c
     }
 }
 
+// Start loading the txn logs of |txns| in the background, so that a batch publish waits for the object storage
+// once instead of once per txn. A txn log is loaded in the calling thread if its task can not be submitted.
+std::vector<std::future<StatusOr<TxnLogPtr>>> prefetch_txn_logs(TabletManager* tablet_mgr, int64_t tablet_id,
+                                                                std::span<const TxnInfoPB> txns) {
+    std::vector<std::future<StatusOr<TxnLogPtr>>> futures;
+    futures.reserve(txns.size());
+    auto pool = ExecEnv::GetInstance()->load_segment_thread_pool();
+    for (const auto& txn : txns) {
+        auto task = std::make_shared<std::packaged_task<StatusOr<TxnLogPtr>()>>(
+                [=]() { return load_txn_log(tablet_mgr, tablet_id, txn); });
+        futures.emplace_back(task->get_future());
+        if (pool == nullptr || !pool->submit_func([task]() { (*task)(); }).ok()) {
+            (*task)();
+        }
+    }
+    return futures;
+}
+
 } // namespace
 
 StatusOr<TabletMetadataPtr> publish_version(TabletManager* tablet_mgr, int64_t tablet_id, int64_t base_version,
@@ -215,8 +237,13 @@ StatusOr<TabletMetadataPtr> publish_version(TabletManager* tablet_mgr, int64_t t
     // 5. txn4 will be published in later publish task, but we can't judge what's the latest_version in BE and we can not reapply txn_log if
     // txn logs have been deleted.
     int txn_offset = base_version - ori_base_version;
+    std::vector<std::future<StatusOr<TxnLogPtr>>> prefetched_txn_logs;
+    if (config::lake_enable_publish_version_prefetch_txn_log && txns.size() > static_cast<size_t>(txn_offset) + 1) {
+        prefetched_txn_logs = prefetch_txn_logs(tablet_mgr, tablet_id, txns.subspan(txn_offset));
+    }
     for (size_t i = txn_offset, sz = txns.size(); i < sz; i++) {
-        auto txn_log_st = load_txn_log(tablet_mgr, tablet_id, txns[i]);
+        auto txn_log_st = prefetched_txn_logs.empty() ? load_txn_log(tablet_mgr, tablet_id, txns[i])
+                                                      : prefetched_txn_logs[i - txn_offset].get();
 
         if (txn_log_st.status().is_not_found()) {
             if (i == 0) {
@@ -369,16 +369,20 @@ static Status vacuum_tablet_metadata(TabletManager* tablet_mgr, std::string_view
         erase_tablet_metadata_from_metacache(tablet_mgr, files);
     };
 
+    // All tablets share the same data and metadata directory, so their garbage files are deleted by shared
+    // deleters: a partition with many small tablets then issues full batches instead of a few tiny batches
+    // per tablet. Metadata files are deleted only after all data files recorded in them have been deleted,
+    // so that a failed vacuum can find the garbage files again in the next round.
+    AsyncFileDeleter datafile_deleter(config::lake_vacuum_min_batch_delete_size);
+    AsyncFileDeleter metafile_deleter(INT64_MAX, metafile_delete_cb);
     for (auto tablet_id : tablet_ids) {
-        AsyncFileDeleter datafile_deleter(config::lake_vacuum_min_batch_delete_size);
-        AsyncFileDeleter metafile_deleter(INT64_MAX, metafile_delete_cb);
         RETURN_IF_ERROR(collect_files_to_vacuum(tablet_mgr, root_dir, tablet_id, grace_timestamp, min_retain_version,
                                                 &datafile_deleter, &metafile_deleter, vacuumed_file_size));
-        RETURN_IF_ERROR(datafile_deleter.finish());
-        RETURN_IF_ERROR(metafile_deleter.finish());
-        (*vacuumed_files) += datafile_deleter.delete_count();
-        (*vacuumed_files) += metafile_deleter.delete_count();
     }
+    RETURN_IF_ERROR(datafile_deleter.finish());
+    RETURN_IF_ERROR(metafile_deleter.finish());
+    (*vacuumed_files) += datafile_deleter.delete_count();
+    (*vacuumed_files) += metafile_deleter.delete_count();
     return Status::OK();
 }
 
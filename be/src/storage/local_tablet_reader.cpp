@@ -151,9 +151,9 @@ Status LocalTabletReader::multi_get(const Chunk& keys, const std::vector<uint32_
         values.get_column_by_index(col_idx)->append_selective(*read_columns[col_idx], idxes.data(), 0, idxes.size());
     }
     int64_t t_end = MonotonicMillis();
-    LOG(INFO) << strings::Substitute("multi_get tablet:$0 version:$1 #columns:$2 #rows:$3 found:$4 time:$5ms",
-                                     _tablet->tablet_id(), _version, value_column_ids.size(), n, idxes.size(),
-                                     t_end - t_start);
+    VLOG(2) << strings::Substitute("multi_get tablet:$0 version:$1 #columns:$2 #rows:$3 found:$4 time:$5ms",
+                                   _tablet->tablet_id(), _version, value_column_ids.size(), n, idxes.size(),
+                                   t_end - t_start);
     return Status::OK();
 }
 
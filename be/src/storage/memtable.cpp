@@ -411,15 +411,26 @@ Status MemTable::_sort(bool is_final, bool by_sort_key) {
     if (_keys_type != KeysType::PRIMARY_KEYS) {
         by_sort_key = true;
     }
-    RETURN_IF_ERROR(_sort_column_inc(by_sort_key));
-    if (is_final) {
+    bool already_sorted = false;
+    RETURN_IF_ERROR(_sort_column_inc(by_sort_key, &already_sorted));
+    if (is_final && already_sorted) {
+        // The input is already ordered by the sort key, e.g. loads ordered by event time, use it as the result
+        _result_chunk = std::move(_chunk);
+    } else if (is_final) {
         // No need to reserve, it will be reserve in IColumn::append_selective(),
         // Otherwise it will use more peak memory
         _result_chunk = _chunk->clone_empty_with_schema(0);
         _append_to_sorted_chunk(_chunk.get(), _result_chunk.get(), true);
         _chunk.reset();
     } else {
-        _result_chunk = _chunk->clone_empty_with_schema();
+        // _aggregate(false) resets _result_chunk after merging it, reuse its columns
+        // to avoid allocating the buffers again on every merge
+        if (_result_chunk != nullptr && _result_chunk->num_rows() == 0 &&
+            _result_chunk->num_columns() == _chunk->num_columns()) {
+            StarRocksMetrics::instance()->memtable_merge_chunk_reuse_total.increment(1);
+        } else {
+            _result_chunk = _chunk->clone_empty_with_schema();
+        }
         _append_to_sorted_chunk(_chunk.get(), _result_chunk.get(), false);
         _chunk->reset();
     }
@@ -486,7 +497,24 @@ Status MemTable::_split_upserts_deletes(ChunkPtr& src, ChunkPtr* upserts, std::u
     return Status::OK();
 }
 
-Status MemTable::_sort_column_inc(bool by_sort_key) {
+// Whether the rows of |columns| are already in the order of |sort_descs|. Returns at the first pair of rows that
+// are out of order, so the check is cheap for random input and saves the whole sort for ordered input.
+static bool is_sorted_by(const Columns& columns, const SortDescs& sort_descs, size_t num_rows) {
+    for (size_t row = 1; row < num_rows; row++) {
+        for (size_t col = 0; col < columns.size(); col++) {
+            const auto& desc = sort_descs.get_column_desc(col);
+            int cmp = columns[col]->compare_at(row - 1, row, *columns[col], desc.nan_direction()) * desc.sort_order;
+            if (cmp < 0) {
+                break;
+            } else if (cmp > 0) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+Status MemTable::_sort_column_inc(bool by_sort_key, bool* already_sorted) {
     Columns columns;
     std::vector<ColumnId> sort_key_idxes;
     if (by_sort_key) {
@@ -531,6 +559,14 @@ Status MemTable::_sort_column_inc(bool by_sort_key) {
         }
     }
 
+    // |_permutations| is initialized to the identity permutation, which is the result of a stable sort of
+    // ordered input
+    if (is_sorted_by(columns, sort_descs, _chunk->num_rows())) {
+        if (already_sorted != nullptr) {
+            *already_sorted = true;
+        }
+        return Status::OK();
+    }
     Status st = stable_sort_and_tie_columns(false, columns, sort_descs, &_permutations);
     return st;
 }
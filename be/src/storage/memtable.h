@@ -75,7 +75,8 @@ private:
     Status _merge();
 
     Status _sort(bool is_final, bool by_sort_key = false);
-    Status _sort_column_inc(bool by_sort_key = false);
+    // |already_sorted| is set to true if the rows are already in order and |_permutations| is left as is.
+    Status _sort_column_inc(bool by_sort_key = false, bool* already_sorted = nullptr);
     void _append_to_sorted_chunk(Chunk* src, Chunk* dest, bool is_final);
 
     void _init_aggregator_if_needed();
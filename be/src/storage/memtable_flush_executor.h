@@ -53,10 +53,10 @@ class MemTable;
 // the statistic of a certain flush handler.
 // use atomic because it may be updated by multi threads
 struct FlushStatistic {
-    int64_t flush_time_ns = 0;
-    int64_t flush_count = 0;
-    int64_t flush_size_bytes = 0;
-    int64_t cur_flush_count = 0;
+    std::atomic<int64_t> flush_time_ns = 0;
+    std::atomic<int64_t> flush_count = 0;
+    std::atomic<int64_t> flush_size_bytes = 0;
+    std::atomic<int64_t> cur_flush_count = 0;
     std::atomic<int64_t> queueing_memtable_num = 0;
 };
 
@@ -64,7 +64,7 @@ std::ostream& operator<<(std::ostream& os, const FlushStatistic& stat);
 
 // A thin wrapper of ThreadPoolToken to submit task.
 // For a tablet, there may be multiple memtables, which will be flushed to disk
-// one by one in the order of generation.
+// one by one in the order of generation, or concurrently if the token is CONCURRENT.
 // If a memtable flush fails, then:
 // 1. Immediately disallow submission of any subsequent memtable
 // 2. For the memtables that have already been submitted, there is no need to flush,
@@ -146,6 +146,8 @@ public:
     Status update_max_threads(int max_threads);
 
     // NOTE: we use SERIAL mode here to ensure all mem-tables from one tablet are flushed in order.
+    // CONCURRENT mode can only be used if the order of segments in the rowset does not matter and
+    // the callbacks of submitted memtables do not depend on each other.
     std::unique_ptr<FlushToken> create_flush_token(
             ThreadPool::ExecutionMode execution_mode = ThreadPool::ExecutionMode::SERIAL);
 
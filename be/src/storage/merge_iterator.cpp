@@ -108,12 +108,30 @@ public:
     size_t last_row_less_than(const ComparableChunk& rhs, size_t limit_num) {
         // As we previously pop this chunk from the heap top, `_compared_row` in this chunk
         // must be less than all rows in rhs, thus here we start comparision from _compared_row + 1;
-        size_t next_compare_row = _compared_row + 1;
-        size_t upper_bound = std::min(_compared_row + limit_num, _chunk->num_rows());
-        while (next_compare_row < upper_bound && less_than(next_compare_row, rhs)) {
-            next_compare_row++;
+        size_t lo = _compared_row + 1;
+        size_t hi = std::min(_compared_row + limit_num, _chunk->num_rows());
+        // Rows of the chunk are sorted, so gallop forward with doubling steps until a row is not less than |rhs|,
+        // then binary search the last step. A run of n rows costs O(log n) comparisons instead of n, and a run of
+        // a single row still costs one.
+        size_t step = 1;
+        while (lo < hi) {
+            size_t probe = std::min(lo + step - 1, hi - 1);
+            if (!less_than(probe, rhs)) {
+                hi = probe;
+                break;
+            }
+            lo = probe + 1;
+            step <<= 1;
+        }
+        while (lo < hi) {
+            size_t mid = lo + (hi - lo) / 2;
+            if (less_than(mid, rhs)) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
         }
-        return next_compare_row;
+        return lo;
     }
 
     bool less_than(size_t lhs_row, const ComparableChunk& rhs) {
@@ -177,7 +177,9 @@ inline Status OlapRuntimeScanRangePruner::_update(const ColumnIdToGlobalDictMap*
         // 1. runtime filter arrived
         // 2. runtime filter updated and read rows greater than rf_update_threhold
         // we will filter by index
-        if (auto rf = _unarrived_runtime_filters[i]->runtime_filter(_driver_sequence)) {
+        // early runtime filter has no min/max, so wait for the final one.
+        const JoinRuntimeFilter* rf = _unarrived_runtime_filters[i]->runtime_filter(_driver_sequence);
+        if (rf != nullptr && !rf->is_early()) {
             size_t rf_version = rf->rf_version();
             if (_arrived_runtime_filters_masks[i] == 0 ||
                 (rf_version > _rf_versions[i] && raw_read_rows - _raw_read_rows > rf_update_threhold)) {
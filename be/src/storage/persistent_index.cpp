@@ -15,6 +15,7 @@
 #include "storage/persistent_index.h"
 
 #include <cstring>
+#include <mutex>
 #include <numeric>
 #include <utility>
 
@@ -3266,12 +3267,16 @@ Status PersistentIndex::_build_commit(TabletLoader* loader, PersistentIndexMetaP
 
 Status PersistentIndex::_insert_rowsets(TabletLoader* loader, const Schema& pkey_schema,
                                         std::unique_ptr<Column> pk_column) {
-    std::vector<uint32_t> rowids;
-    rowids.reserve(4096);
-    auto chunk_shared_ptr = ChunkHelper::new_chunk(pkey_schema, 4096);
-    auto chunk = chunk_shared_ptr.get();
+    // The loader may read several rowsets concurrently, so every invocation of the handler owns its chunk and
+    // encoding buffers, and only the inserts into the index are serialized.
+    std::mutex insert_mutex;
     RETURN_IF_ERROR(loader->rowset_iterator(pkey_schema, [&](const std::vector<ChunkIteratorPtr>& itrs,
                                                              uint32_t rowset_id) {
+        std::vector<uint32_t> rowids;
+        rowids.reserve(4096);
+        auto chunk_shared_ptr = ChunkHelper::new_chunk(pkey_schema, 4096);
+        auto chunk = chunk_shared_ptr.get();
+        std::unique_ptr<Column> local_pk_column = pk_column != nullptr ? pk_column->clone_empty() : nullptr;
         for (size_t i = 0; i < itrs.size(); i++) {
             auto itr = itrs[i].get();
             if (itr == nullptr) {
@@ -3287,10 +3292,10 @@ Status PersistentIndex::_insert_rowsets(TabletLoader* loader, const Schema& pkey
                     return st;
                 } else {
                     Column* pkc = nullptr;
-                    if (pk_column != nullptr) {
-                        pk_column->reset_column();
-                        PrimaryKeyEncoder::encode(pkey_schema, *chunk, 0, chunk->num_rows(), pk_column.get());
-                        pkc = pk_column.get();
+                    if (local_pk_column != nullptr) {
+                        local_pk_column->reset_column();
+                        PrimaryKeyEncoder::encode(pkey_schema, *chunk, 0, chunk->num_rows(), local_pk_column.get());
+                        pkc = local_pk_column.get();
                     } else {
                         pkc = chunk->columns()[0].get();
                     }
@@ -3303,6 +3308,7 @@ Status PersistentIndex::_insert_rowsets(TabletLoader* loader, const Schema& pkey
                         values.emplace_back(base + rowids[i]);
                     }
                     Status st;
+                    std::lock_guard l(insert_mutex);
                     if (pkc->is_binary()) {
                         st = insert(pkc->size(), reinterpret_cast<const Slice*>(pkc->raw_data()), values.data(), false);
                     } else {
@@ -44,7 +44,8 @@ public:
     virtual StatusOr<EditVersion> applied_version() = 0;
     // Do some special setting if need
     virtual void setting() = 0;
-    // iterator all rowset and get their iterator and basic stat
+    // iterator all rowset and get their iterator and basic stat.
+    // |handler| may be called concurrently for different rowsets.
     virtual Status rowset_iterator(
             const Schema& pkey_schema,
             const std::function<Status(const std::vector<ChunkIteratorPtr>&, uint32_t)>& handler) = 0;
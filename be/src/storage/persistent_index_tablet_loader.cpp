@@ -14,10 +14,17 @@
 
 #include "storage/persistent_index_tablet_loader.h"
 
+#include <atomic>
+#include <mutex>
+
+#include "common/config.h"
 #include "storage/chunk_helper.h"
 #include "storage/rowset/rowset.h"
+#include "storage/storage_engine.h"
 #include "storage/tablet.h"
 #include "storage/tablet_updates.h"
+#include "storage/update_manager.h"
+#include "util/threadpool.h"
 
 namespace starrocks {
 
@@ -44,10 +51,24 @@ StatusOr<EditVersion> PersistentIndexTabletLoader::applied_version() {
     return lastest_applied_version;
 }
 
+Status PersistentIndexTabletLoader::_rowset_iterator(
+        const Schema& pkey_schema, const RowsetSharedPtr& rowset, int64_t apply_version,
+        const std::function<Status(const std::vector<ChunkIteratorPtr>&, uint32_t)>& handler) {
+    OlapReaderStatistics stats;
+    RowsetReleaseGuard guard(rowset);
+    auto res = rowset->get_segment_iterators2(pkey_schema, _tablet->tablet_schema(), data_dir()->get_meta(),
+                                              apply_version, &stats);
+    if (!res.ok()) {
+        return res.status();
+    }
+    auto& itrs = res.value();
+    RETURN_ERROR_IF_FALSE(itrs.size() == rowset->num_segments(), "itrs.size != num_segments");
+    return handler(itrs, rowset->rowset_meta()->get_rowset_seg_id());
+}
+
 Status PersistentIndexTabletLoader::rowset_iterator(
         const Schema& pkey_schema,
         const std::function<Status(const std::vector<ChunkIteratorPtr>&, uint32_t)>& handler) {
-    OlapReaderStatistics stats;
     int64_t apply_version = 0;
     std::vector<RowsetSharedPtr> rowsets;
     std::vector<uint32_t> rowset_ids;
@@ -72,17 +93,49 @@ Status PersistentIndexTabletLoader::rowset_iterator(
                   << " #rowset:" << rowsets.size() << " #segment:" << _total_segments << " #row:" << total_rows << " -"
                   << total_dels << "=" << total_rows - total_dels << " bytes:" << _total_data_size;
     }
-    for (auto& rowset : rowsets) {
-        RowsetReleaseGuard guard(rowset);
-        auto res = rowset->get_segment_iterators2(pkey_schema, _tablet->tablet_schema(), data_dir()->get_meta(),
-                                                  apply_version, &stats);
-        if (!res.ok()) {
-            return res.status();
+    ThreadPool* pool = nullptr;
+    if (StorageEngine::instance() != nullptr && StorageEngine::instance()->update_manager() != nullptr) {
+        pool = StorageEngine::instance()->update_manager()->get_pindex_rebuild_thread_pool();
+    }
+    const size_t parallelism = std::min<size_t>(std::max(config::pindex_rebuild_parallelism, 1), rowsets.size());
+    if (pool == nullptr || parallelism <= 1) {
+        for (auto& rowset : rowsets) {
+            RETURN_IF_ERROR(_rowset_iterator(pkey_schema, rowset, apply_version, handler));
+        }
+        return Status::OK();
+    }
+
+    // Each worker takes the next rowset until all of them are read or one of them fails.
+    std::atomic<size_t> next_rowset{0};
+    std::mutex status_mutex;
+    Status load_status;
+    auto has_error = [&]() {
+        std::lock_guard l(status_mutex);
+        return !load_status.ok();
+    };
+    auto set_error = [&](const Status& st) {
+        std::lock_guard l(status_mutex);
+        if (load_status.ok()) {
+            load_status = st;
+        }
+    };
+    auto worker = [&]() {
+        for (size_t i = next_rowset.fetch_add(1); i < rowsets.size() && !has_error(); i = next_rowset.fetch_add(1)) {
+            auto st = _rowset_iterator(pkey_schema, rowsets[i], apply_version, handler);
+            if (!st.ok()) {
+                set_error(st);
+            }
+        }
+    };
+    auto token = pool->new_token(ThreadPool::ExecutionMode::CONCURRENT);
+    for (size_t i = 0; i < parallelism; i++) {
+        auto st = token->submit_func(worker);
+        if (!st.ok()) {
+            set_error(st);
+            break;
         }
-        auto& itrs = res.value();
-        RETURN_ERROR_IF_FALSE(itrs.size() == rowset->num_segments(), "itrs.size != num_segments");
-        RETURN_IF_ERROR(handler(itrs, rowset->rowset_meta()->get_rowset_seg_id()));
     }
-    return Status::OK();
+    token->wait();
+    return load_status;
 }
 } // namespace starrocks
\ No newline at end of file
@@ -44,6 +44,9 @@ public:
             const std::function<Status(const std::vector<ChunkIteratorPtr>&, uint32_t)>& handler) override;
 
 private:
+    Status _rowset_iterator(const Schema& pkey_schema, const RowsetSharedPtr& rowset, int64_t apply_version,
+                            const std::function<Status(const std::vector<ChunkIteratorPtr>&, uint32_t)>& handler);
+
     Tablet* _tablet;
 };
 
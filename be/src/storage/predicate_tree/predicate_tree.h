@@ -321,8 +321,25 @@ struct CompoundNodeContext {
     std::vector<uint16_t> selected_idx_buffer;
 
     struct CompoundAndContext {
+        // The vectorized children are reordered by their observed pass ratio every `kReorderInterval`
+        // evaluations, so that the most selective child runs first and the later ones can be skipped
+        // as soon as no row is selected.
+        static constexpr size_t kReorderInterval = 16;
+
+        struct VecChild {
+            ConstPredicateNodePtr node;
+            // Rows selected before and after evaluating this child since the last reorder.
+            size_t input_rows = 0;
+            size_t selected_rows = 0;
+
+            double pass_ratio() const {
+                return input_rows == 0 ? 1.0 : static_cast<double>(selected_rows) / input_rows;
+            }
+        };
+
         std::vector<const PredicateColumnNode*> non_vec_children;
-        std::vector<ConstPredicateNodePtr> vec_children;
+        std::vector<VecChild> vec_children;
+        size_t num_evaluations = 0;
     };
     std::optional<CompoundAndContext> and_context;
 };
@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <algorithm>
+
 #include "gutil/strings/substitute.h"
 #include "simd/simd.h"
 #include "storage/predicate_tree/predicate_tree.h"
@@ -180,12 +182,12 @@ inline Status PredicateCompoundNode<CompoundNodeType::AND>::evaluate(CompoundNod
                 if (!child.col_pred()->can_vectorized()) {
                     ctx.non_vec_children.emplace_back(&child);
                 } else {
-                    ctx.vec_children.emplace_back(&child);
+                    ctx.vec_children.push_back({ConstPredicateNodePtr(&child)});
                 }
             }
         }
         for (const auto& child : _compound_children) {
-            ctx.vec_children.emplace_back(&child);
+            ctx.vec_children.push_back({ConstPredicateNodePtr(&child)});
         }
     }
     auto& ctx = node_ctx.and_context.value();
@@ -193,22 +195,37 @@ inline Status PredicateCompoundNode<CompoundNodeType::AND>::evaluate(CompoundNod
     // Evaluate vectorized predicates first.
     bool first = true;
     bool contains_true = true;
-    for (const auto& child : ctx.vec_children) {
+    size_t num_selected = num_rows;
+    for (auto& child : ctx.vec_children) {
         if (first) {
             first = false;
-            RETURN_IF_ERROR(
-                    child.visit([&](const auto& pred) { return pred.evaluate(contexts, chunk, selection, from, to); }));
+            RETURN_IF_ERROR(child.node.visit(
+                    [&](const auto& pred) { return pred.evaluate(contexts, chunk, selection, from, to); }));
         } else {
-            RETURN_IF_ERROR(child.visit(
+            RETURN_IF_ERROR(child.node.visit(
                     [&](const auto& pred) { return pred.evaluate_and(contexts, chunk, selection, from, to); }));
         }
 
-        contains_true = SIMD::count_nonzero(selection + from, num_rows);
+        child.input_rows += num_selected;
+        num_selected = SIMD::count_nonzero(selection + from, num_rows);
+        child.selected_rows += num_selected;
+        contains_true = num_selected > 0;
         if (!contains_true) {
             break;
         }
     }
 
+    using AndContext = CompoundNodeContext::CompoundAndContext;
+    if (ctx.vec_children.size() > 1 && ++ctx.num_evaluations >= AndContext::kReorderInterval) {
+        std::stable_sort(ctx.vec_children.begin(), ctx.vec_children.end(),
+                         [](const auto& lhs, const auto& rhs) { return lhs.pass_ratio() < rhs.pass_ratio(); });
+        for (auto& child : ctx.vec_children) {
+            child.input_rows = 0;
+            child.selected_rows = 0;
+        }
+        ctx.num_evaluations = 0;
+    }
+
     // Evaluate non-vectorized predicates using evaluate_branchless.
     if (contains_true && !ctx.non_vec_children.empty()) {
         auto& selected_idx_buffer = node_ctx.selected_idx_buffer;
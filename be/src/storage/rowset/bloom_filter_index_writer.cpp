@@ -212,32 +212,37 @@ public:
         size_t gram_num = this->_bf_options.gram_num;
         const auto* cur_slice = reinterpret_cast<const Slice*>(values);
         for (int i = 0; i < count; ++i) {
-            std::vector<size_t> index;
-            size_t slice_gram_num = get_utf8_index(*cur_slice, &index);
+            // lower the whole row once instead of every ngram of it, the utf-8 layout is kept because
+            // only ascii characters are changed.
+            Slice row = *cur_slice;
+            if (!this->_bf_options.case_sensitive) {
+                row = row.tolower(_lower_buffer);
+            }
+
+            _utf8_index.clear();
+            size_t slice_gram_num = get_utf8_index(row, &_utf8_index);
 
             size_t j;
             for (j = 0; j + gram_num <= slice_gram_num; j++) {
                 // find next ngram
-                size_t cur_ngram_length = j + gram_num < slice_gram_num ? index[j + gram_num] - index[j]
-                                                                        : cur_slice->get_size() - index[j];
-                Slice cur_ngram = Slice(cur_slice->data + index[j], cur_ngram_length);
+                size_t cur_ngram_length = j + gram_num < slice_gram_num ? _utf8_index[j + gram_num] - _utf8_index[j]
+                                                                        : row.get_size() - _utf8_index[j];
+                Slice cur_ngram = Slice(row.data + _utf8_index[j], cur_ngram_length);
 
                 // add this ngram into set
                 if (_values.find(unaligned_load<CppType>(&cur_ngram)) == _values.end()) {
-                    if (this->_bf_options.case_sensitive) {
-                        _values.insert(get_value<field_type>(&cur_ngram, this->_typeinfo, &this->_pool));
-                    } else {
-                        // todo::exist two copy of ngram, need to optimize
-                        std::string lower_ngram;
-                        Slice lower_ngram_slice = cur_ngram.tolower(lower_ngram);
-                        _values.insert(get_value<field_type>(&lower_ngram_slice, this->_typeinfo, &this->_pool));
-                    }
+                    _values.insert(get_value<field_type>(&cur_ngram, this->_typeinfo, &this->_pool));
                 }
             }
             // move to next row
             ++cur_slice;
         }
     }
+
+private:
+    // reused by rows to avoid allocations
+    std::vector<size_t> _utf8_index;
+    std::string _lower_buffer;
 };
 } // namespace
 
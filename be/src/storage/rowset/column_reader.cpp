@@ -313,6 +313,7 @@ Status ColumnReader::read_page(const ColumnIteratorOptions& iter_opts, const Pag
     opts.stats = iter_opts.stats;
     opts.verify_checksum = true;
     opts.use_page_cache = iter_opts.use_page_cache;
+    opts.fill_data_page_cache = iter_opts.fill_data_page_cache;
     opts.encoding_type = _encoding_info->encoding();
     opts.kept_in_memory = false;
 
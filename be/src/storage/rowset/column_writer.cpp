@@ -734,9 +734,14 @@ Status ScalarColumnWriter::append(const uint8_t* data, const uint8_t* null_flags
         bool page_full = false;
         bool has_null_in_page = false;
         size_t num_written = 0;
+        size_t to_add = remaining;
+        if (_opts.data_page_max_rows > 0) {
+            DCHECK_LT(_next_rowid - _first_rowid, _opts.data_page_max_rows);
+            to_add = std::min<size_t>(to_add, _opts.data_page_max_rows - (_next_rowid - _first_rowid));
+        }
         if (_curr_page_format == 2) {
-            num_written = _page_builder->add(data, remaining);
-            page_full = num_written < remaining;
+            num_written = _page_builder->add(data, to_add);
+            page_full = num_written < to_add;
             if (_null_map_builder_v2 != nullptr) {
                 _null_map_builder_v2->add_null_flags(null_flags, num_written);
                 // The input data may be split into multiple pages, so |has_null| is true does
@@ -746,14 +751,14 @@ Status ScalarColumnWriter::append(const uint8_t* data, const uint8_t* null_flags
                 _null_map_builder_v2->set_has_null(has_null_in_page);
             }
         } else if (!has_null) {
-            num_written = _page_builder->add(data, remaining);
-            page_full = num_written < remaining;
+            num_written = _page_builder->add(data, to_add);
+            page_full = num_written < to_add;
             if (_null_map_builder_v1 != nullptr) {
                 _null_map_builder_v1->add_run(false, num_written);
             }
         } else {
             const uint8_t* ptr = data;
-            ByteIterator iter(null_flags, std::min(remaining, _opts.data_page_size / field_size));
+            ByteIterator iter(null_flags, std::min(to_add, _opts.data_page_size / field_size));
             for (auto pair = iter.next(); pair.first > 0 && !page_full; pair = iter.next()) {
                 auto [run, is_null] = pair;
                 size_t num_add = run;
@@ -798,6 +803,7 @@ Status ScalarColumnWriter::append(const uint8_t* data, const uint8_t* null_flags
         _next_rowid += num_written;
         data += field_size * num_written;
         null_flags += num_written;
+        page_full |= _opts.data_page_max_rows > 0 && _next_rowid - _first_rowid >= _opts.data_page_max_rows;
         if (page_full) {
             RETURN_IF_ERROR(finish_current_page());
         }
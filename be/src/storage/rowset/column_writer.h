@@ -34,6 +34,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <memory> // for unique_ptr
 
 #include "column/vectorized_fwd.h"
@@ -65,6 +66,8 @@ struct ColumnWriterOptions {
     // - output: encoding/indexes/dict_page members
     ColumnMetaPB* meta;
     uint32_t data_page_size = config::data_page_size;
+    // 0 means no limit
+    uint32_t data_page_max_rows = std::max(config::data_page_max_rows, 0);
     uint32_t page_format = 2;
     // store compressed page only when space saving is above the threshold.
     // space saving = 1 - compressed_size / uncompressed_size
@@ -38,6 +38,7 @@
 #include <string>
 
 #include "column/column.h"
+#include "common/config.h"
 #include "common/logging.h"
 #include "fs/fs.h"
 #include "gutil/strings/substitute.h"
@@ -49,6 +50,7 @@
 #include "util/faststring.h"
 #include "util/runtime_profile.h"
 #include "util/scoped_cleanup.h"
+#include "util/starrocks_metrics.h"
 
 namespace starrocks {
 
@@ -128,6 +130,48 @@ Status PageIO::write_page(WritableFile* wfile, const std::vector<Slice>& body, c
     return Status::OK();
 }
 
+// Decompress and decode the page in `page_slice`, which is laid out as PageBody, PageFooter, FooterSize(4).
+// `page` and `page_slice` are replaced only if a new buffer is allocated.
+static Status decompress_and_decode_page(const PageReadOptions& opts, PageFooterPB* footer, uint32_t footer_size,
+                                         std::unique_ptr<char[]>* page, Slice* page_slice) {
+    uint32_t body_size = page_slice->size - 4 - footer_size;
+    if (body_size != footer->uncompressed_size()) { // need decompress body
+        if (opts.codec == nullptr) {
+            return Status::Corruption(strings::Substitute(
+                    "Bad page: page is compressed but codec is NO_COMPRESSION, file=$0", opts.read_file->filename()));
+        }
+        SCOPED_RAW_TIMER(&opts.stats->decompress_ns);
+        // Allocate APPEND_OVERFLOW_MAX_SIZE more bytes to make append_strings_overflow work
+        std::unique_ptr<char[]> decompressed_page(
+                new char[footer->uncompressed_size() + footer_size + 4 + Column::APPEND_OVERFLOW_MAX_SIZE]);
+
+        // decompress page body
+        Slice compressed_body(page_slice->data, body_size);
+        Slice decompressed_body(decompressed_page.get(), footer->uncompressed_size());
+        RETURN_IF_ERROR(opts.codec->decompress(compressed_body, &decompressed_body));
+        if (decompressed_body.size != footer->uncompressed_size()) {
+            return Status::Corruption(strings::Substitute(
+                    "Bad page: record uncompressed size=$0 vs real decompressed size=$1, file=$2",
+                    footer->uncompressed_size(), decompressed_body.size, opts.read_file->filename()));
+        }
+        // append footer and footer size
+        memcpy(decompressed_body.data + decompressed_body.size, page_slice->data + body_size, footer_size + 4);
+        // free memory of compressed page
+        *page = std::move(decompressed_page);
+        *page_slice = Slice(page->get(), footer->uncompressed_size() + footer_size + 4);
+        opts.stats->uncompressed_bytes_read += page_slice->size;
+    } else {
+        opts.stats->uncompressed_bytes_read += body_size;
+    }
+
+    return StoragePageDecoder::decode_page(footer, footer_size + 4, opts.encoding_type, page, page_slice);
+}
+
+// Whether a page is cached as it is stored on disk, i.e. before decompression and decoding.
+static bool cache_raw_page(const PageFooterPB& footer) {
+    return config::storage_page_cache_keep_compressed_data_page && footer.type() == DATA_PAGE;
+}
+
 Status PageIO::read_and_decompress_page(const PageReadOptions& opts, PageHandle* handle, Slice* body,
                                         PageFooterPB* footer) {
     // the function will be used by query or load, current load is not allowed to fail when memory reach the limit,
@@ -153,7 +197,27 @@ Status PageIO::read_and_decompress_page(const PageReadOptions& opts, PageHandle*
                     strings::Substitute("Bad page: invalid footer, read from page cache, file=$0, footer_size=$1",
                                         opts.read_file->filename(), footer_size));
         }
+        if (cache_raw_page(*footer)) {
+            int64_t decode_ns = 0;
+            std::unique_ptr<char[]> page;
+            {
+                SCOPED_RAW_TIMER(&decode_ns);
+                RETURN_IF_ERROR(decompress_and_decode_page(opts, footer, footer_size, &page, &page_slice));
+            }
+            if (page != nullptr) {
+                // the decoded page is owned by handle, and the cached page is released
+                *handle = PageHandle(page_slice);
+                page.release();
+            }
+            StarRocksMetrics::instance()->page_cache_raw_data_page_hit_total.increment(1);
+            StarRocksMetrics::instance()->page_cache_raw_data_page_decode_ns_total.increment(decode_ns);
+        }
         *body = Slice(page_slice.data, page_slice.size - 4 - footer_size);
+        if (footer->type() == DATA_PAGE) {
+            StarRocksMetrics::instance()->page_cache_data_page_hit_total.increment(1);
+        } else {
+            StarRocksMetrics::instance()->page_cache_index_page_hit_total.increment(1);
+        }
         return Status::OK();
     }
 
@@ -201,42 +265,42 @@ Status PageIO::read_and_decompress_page(const PageReadOptions& opts, PageHandle*
                                     opts.read_file->filename(), footer_size));
     }
 
-    uint32_t body_size = page_slice.size - 4 - footer_size;
-    if (body_size != footer->uncompressed_size()) { // need decompress body
-        if (opts.codec == nullptr) {
-            return Status::Corruption(strings::Substitute(
-                    "Bad page: page is compressed but codec is NO_COMPRESSION, file=$0", opts.read_file->filename()));
+    const bool is_data_page = footer->type() == DATA_PAGE;
+    if (opts.use_page_cache) {
+        if (is_data_page) {
+            StarRocksMetrics::instance()->page_cache_data_page_miss_total.increment(1);
+        } else {
+            StarRocksMetrics::instance()->page_cache_index_page_miss_total.increment(1);
         }
-        SCOPED_RAW_TIMER(&opts.stats->decompress_ns);
-        // Allocate APPEND_OVERFLOW_MAX_SIZE more bytes to make append_strings_overflow work
-        std::unique_ptr<char[]> decompressed_page(
-                new char[footer->uncompressed_size() + footer_size + 4 + Column::APPEND_OVERFLOW_MAX_SIZE]);
+    }
+    const bool fill_page_cache = opts.use_page_cache && (opts.fill_data_page_cache || !is_data_page);
+    if (opts.use_page_cache && !fill_page_cache) {
+        StarRocksMetrics::instance()->page_cache_data_page_skip_insert_total.increment(1);
+    }
 
-        // decompress page body
-        Slice compressed_body(page_slice.data, body_size);
-        Slice decompressed_body(decompressed_page.get(), footer->uncompressed_size());
-        RETURN_IF_ERROR(opts.codec->decompress(compressed_body, &decompressed_body));
-        if (decompressed_body.size != footer->uncompressed_size()) {
-            return Status::Corruption(strings::Substitute(
-                    "Bad page: record uncompressed size=$0 vs real decompressed size=$1, file=$2",
-                    footer->uncompressed_size(), decompressed_body.size, opts.read_file->filename()));
+    if (fill_page_cache && cache_raw_page(*footer)) {
+        // insert the page as it is stored on disk, and decompress it into a page owned by handle
+        cache->insert(cache_key, page_slice, &cache_handle, opts.kept_in_memory);
+        page.release(); // memory now managed by cache
+        page_slice = cache_handle.data();
+        RETURN_IF_ERROR(decompress_and_decode_page(opts, footer, footer_size, &page, &page_slice));
+        if (page != nullptr) {
+            *handle = PageHandle(page_slice);
+            page.release(); // memory now managed by handle
+        } else {
+            *handle = PageHandle(std::move(cache_handle));
         }
-        // append footer and footer size
-        memcpy(decompressed_body.data + decompressed_body.size, page_slice.data + body_size, footer_size + 4);
-        // free memory of compressed page
-        page = std::move(decompressed_page);
-        page_slice = Slice(page.get(), footer->uncompressed_size() + footer_size + 4);
-        opts.stats->uncompressed_bytes_read += page_slice.size;
-    } else {
-        opts.stats->uncompressed_bytes_read += body_size;
+        *body = Slice(page_slice.data, page_slice.size - 4 - footer_size);
+        return Status::OK();
     }
 
-    RETURN_IF_ERROR(StoragePageDecoder::decode_page(footer, footer_size + 4, opts.encoding_type, &page, &page_slice));
+    RETURN_IF_ERROR(decompress_and_decode_page(opts, footer, footer_size, &page, &page_slice));
 
     *body = Slice(page_slice.data, page_slice.size - 4 - footer_size);
-    if (opts.use_page_cache) {
+    if (fill_page_cache) {
         // insert this page into cache and return the cache handle
-        cache->insert(cache_key, page_slice, &cache_handle, opts.kept_in_memory);
+        bool in_memory = opts.kept_in_memory || (!is_data_page && config::storage_page_cache_protect_index_pages);
+        cache->insert(cache_key, page_slice, &cache_handle, in_memory);
         *handle = PageHandle(std::move(cache_handle));
     } else {
         *handle = PageHandle(page_slice);
@@ -64,6 +64,9 @@ struct PageReadOptions {
     bool verify_checksum = true;
     // whether to use page cache in read path
     bool use_page_cache = true;
+    // whether to insert data pages read from disk into page cache, only used when use_page_cache is true.
+    // other types of pages (index, dictionary, short key) are always inserted.
+    bool fill_data_page_cache = true;
     // if true, use DURABLE CachePriority in page cache
     // currently used for in memory olap table
     bool kept_in_memory = false;
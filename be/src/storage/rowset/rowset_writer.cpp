@@ -466,7 +466,8 @@ StatusOr<std::unique_ptr<SegmentWriter>> HorizontalRowsetWriter::_create_segment
         // temporary segment files.
         path = Rowset::segment_file_path(_context.rowset_path_prefix, _context.rowset_id, _num_segment);
     }
-    ASSIGN_OR_RETURN(auto wfile, _fs->new_writable_file(path));
+    WritableFileOptions opts{.sync_on_close = true, .drop_cache_on_close = _context.drop_page_cache_on_close};
+    ASSIGN_OR_RETURN(auto wfile, _fs->new_writable_file(opts, path));
     const auto schema = _context.tablet_schema;
     auto segment_writer = std::make_unique<SegmentWriter>(std::move(wfile), _num_segment, schema, _writer_options);
     RETURN_IF_ERROR(segment_writer->init());
@@ -516,19 +517,23 @@ std::string HorizontalRowsetWriter::_error_msg() {
 Status HorizontalRowsetWriter::flush_chunk(const Chunk& chunk, SegmentPB* seg_info) {
     // 1. pure upsert
     // once upsert, subsequent flush can only do upsert
-    switch (_flush_chunk_state) {
-    case FlushChunkState::UNKNOWN:
-        _flush_chunk_state = FlushChunkState::UPSERT;
-        break;
-    case FlushChunkState::UPSERT:
-        break;
-    case FlushChunkState::DELETE:
-        _flush_chunk_state = FlushChunkState::MIXED;
-        break;
-    case FlushChunkState::MIXED:
-        break;
-    default:
-        return Status::Cancelled(_error_msg());
+    {
+        // memtables of a duplicate-key tablet may be flushed concurrently
+        std::lock_guard<std::mutex> l(_lock);
+        switch (_flush_chunk_state) {
+        case FlushChunkState::UNKNOWN:
+            _flush_chunk_state = FlushChunkState::UPSERT;
+            break;
+        case FlushChunkState::UPSERT:
+            break;
+        case FlushChunkState::DELETE:
+            _flush_chunk_state = FlushChunkState::MIXED;
+            break;
+        case FlushChunkState::MIXED:
+            break;
+        default:
+            return Status::Cancelled(_error_msg());
+        }
     }
     return _flush_chunk(chunk, seg_info);
 }
@@ -1002,8 +1007,10 @@ Status HorizontalRowsetWriter::_flush_segment_writer(std::unique_ptr<SegmentWrit
     uint64_t index_size = 0;
     uint64_t footer_position = 0;
     RETURN_IF_ERROR((*segment_writer)->finalize(&segment_size, &index_size, &footer_position));
-    _num_rows_of_tmp_segment_files.push_back(_num_rows_written - _num_rows_flushed);
-    _num_rows_flushed = _num_rows_written;
+    // Lock the bookkeeping, segment writers may be flushed concurrently, see MemTableFlushExecutor
+    std::lock_guard<std::mutex> l(_lock);
+    _num_rows_of_tmp_segment_files.push_back((*segment_writer)->num_rows());
+    _num_rows_flushed += (*segment_writer)->num_rows();
     if (_context.tablet_schema->keys_type() == KeysType::PRIMARY_KEYS && _context.is_partial_update) {
         uint64_t footer_size = segment_size - footer_position;
         auto* partial_rowset_footer = _rowset_txn_meta_pb->add_partial_rowset_footers();
@@ -1014,11 +1021,8 @@ Status HorizontalRowsetWriter::_flush_segment_writer(std::unique_ptr<SegmentWrit
             seg_info->set_partial_footer_size(footer_size);
         }
     }
-    {
-        std::lock_guard<std::mutex> l(_lock);
-        _total_data_size += static_cast<int64_t>(segment_size);
-        _total_index_size += static_cast<int64_t>(index_size);
-    }
+    _total_data_size += static_cast<int64_t>(segment_size);
+    _total_index_size += static_cast<int64_t>(index_size);
 
     // check global_dict efficacy
     const auto& seg_global_dict_columns_valid_info = (*segment_writer)->global_dict_columns_valid_info();
@@ -1196,8 +1200,10 @@ Status VerticalRowsetWriter::final_flush() {
 StatusOr<std::unique_ptr<SegmentWriter>> VerticalRowsetWriter::_create_segment_writer(
         const std::vector<uint32_t>& column_indexes, bool is_key) {
     std::lock_guard<std::mutex> l(_lock);
-    ASSIGN_OR_RETURN(auto wfile, _fs->new_writable_file(Rowset::segment_file_path(_context.rowset_path_prefix,
-                                                                                  _context.rowset_id, _num_segment)));
+    WritableFileOptions opts{.sync_on_close = true, .drop_cache_on_close = _context.drop_page_cache_on_close};
+    ASSIGN_OR_RETURN(auto wfile, _fs->new_writable_file(opts, Rowset::segment_file_path(_context.rowset_path_prefix,
+                                                                                        _context.rowset_id,
+                                                                                        _num_segment)));
     const auto schema = _context.tablet_schema;
     auto segment_writer = std::make_unique<SegmentWriter>(std::move(wfile), _num_segment, schema, _writer_options);
     RETURN_IF_ERROR(segment_writer->init(column_indexes, is_key));
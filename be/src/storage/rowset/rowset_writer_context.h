@@ -88,6 +88,9 @@ public:
 
     bool miss_auto_increment_column = false;
 
+    // drop the written segment files from the page cache on close, used by compaction output
+    bool drop_page_cache_on_close = false;
+
     // partial update mode
     PartialUpdateMode partial_update_mode = PartialUpdateMode::UNKNOWN_MODE;
 
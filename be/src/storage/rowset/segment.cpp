@@ -42,6 +42,7 @@
 
 #include "column/column_access_path.h"
 #include "column/schema.h"
+#include "common/config.h"
 #include "common/logging.h"
 #include "gutil/strings/substitute.h"
 #include "segment_iterator.h"
@@ -226,13 +227,18 @@ Status Segment::open(size_t* footer_length_hint, const FooterPointerPB* partial_
     return res.status();
 }
 
+// File options to read the segment metadata, i.e. the footer and the short key index.
+static RandomAccessFileOptions metadata_file_options(const LakeIOOptions& lake_io_opts) {
+    return RandomAccessFileOptions{
+            .skip_fill_local_cache = !lake_io_opts.fill_data_cache && !config::lake_segment_metadata_fill_data_cache,
+            .buffer_size = lake_io_opts.buffer_size};
+}
+
 Status Segment::_open(size_t* footer_length_hint, const FooterPointerPB* partial_rowset_footer,
                       const LakeIOOptions& lake_io_opts) {
     SegmentFooterPB footer;
-    RandomAccessFileOptions opts{.skip_fill_local_cache = !lake_io_opts.fill_data_cache,
-                                 .buffer_size = lake_io_opts.buffer_size};
-
-    ASSIGN_OR_RETURN(auto read_file, _fs->new_random_access_file(opts, _segment_file_info));
+    auto file_opts = metadata_file_options(lake_io_opts);
+    ASSIGN_OR_RETURN(auto read_file, _fs->new_random_access_file(file_opts, _segment_file_info));
     RETURN_IF_ERROR(Segment::parse_segment_footer(read_file.get(), &footer, footer_length_hint, partial_rowset_footer));
     RETURN_IF_ERROR(_create_column_readers(&footer));
     _num_rows = footer.num_rows();
@@ -333,8 +339,7 @@ Status Segment::load_index(const LakeIOOptions& lake_io_opts) {
 
 Status Segment::_load_index(const LakeIOOptions& lake_io_opts) {
     // read and parse short key index page
-    RandomAccessFileOptions file_opts{.skip_fill_local_cache = !lake_io_opts.fill_data_cache,
-                                      .buffer_size = lake_io_opts.buffer_size};
+    auto file_opts = metadata_file_options(lake_io_opts);
     ASSIGN_OR_RETURN(auto read_file, _fs->new_random_access_file(file_opts, _segment_file_info));
 
     PageReadOptions opts;
@@ -208,6 +208,7 @@ private:
     StatusOr<SparseRange<>> _get_row_ranges_by_key_ranges();
     StatusOr<SparseRange<>> _get_row_ranges_by_short_key_ranges();
     Status _get_row_ranges_by_zone_map();
+    Status _prune_delete_predicates_by_segment_zone_map();
     Status _get_row_ranges_by_bloom_filter();
     Status _get_row_ranges_by_rowid_range();
 
@@ -277,6 +278,11 @@ private:
     // `ucid` means unique column id, use it for searching delta column group.
     Status _init_column_iterator_by_cid(const ColumnId cid, const ColumnUID ucid, bool check_dict_enc);
 
+    // Read the pages of column `cid` from `file` through a SharedBufferedInputStream, which coalesces the page
+    // ranges of the final scan range into large reads.
+    void _init_io_coalesce_column_file(ColumnId cid, RandomAccessFile* file, const std::string& filename,
+                                       int64_t file_size, ColumnIteratorOptions* iter_opts);
+
     void _update_stats(io::SeekableInputStream* rfile);
 
     //  This function will search and build the segment from delta column group.
@@ -441,6 +447,7 @@ Status SegmentIterator::_init() {
     RETURN_IF_ERROR(_apply_del_vector());
     // Support prefilter for now
     RETURN_IF_ERROR(_apply_bitmap_index());
+    RETURN_IF_ERROR(_prune_delete_predicates_by_segment_zone_map());
     RETURN_IF_ERROR(_get_row_ranges_by_zone_map());
     RETURN_IF_ERROR(_get_row_ranges_by_bloom_filter());
     RETURN_IF_ERROR(_apply_inverted_index());
@@ -533,10 +540,25 @@ void SegmentIterator::_init_column_access_paths() {
     }
 }
 
+void SegmentIterator::_init_io_coalesce_column_file(ColumnId cid, RandomAccessFile* file, const std::string& filename,
+                                                   int64_t file_size, ColumnIteratorOptions* iter_opts) {
+    auto shared_buffered_input_stream =
+            std::make_unique<io::SharedBufferedInputStream>(file->stream(), filename, file_size);
+    auto options = io::SharedBufferedInputStream::CoalesceOptions{
+            .max_dist_size = config::io_coalesce_read_max_distance_size,
+            .max_buffer_size = config::io_coalesce_read_max_buffer_size};
+    shared_buffered_input_stream->set_coalesce_options(options);
+    iter_opts->read_file = shared_buffered_input_stream.get();
+    iter_opts->is_io_coalesce = true;
+    _column_files[cid] = std::move(shared_buffered_input_stream);
+    _io_coalesce_column_index.emplace_back(cid);
+}
+
 Status SegmentIterator::_init_column_iterator_by_cid(const ColumnId cid, const ColumnUID ucid, bool check_dict_enc) {
     ColumnIteratorOptions iter_opts;
     iter_opts.stats = _opts.stats;
     iter_opts.use_page_cache = _opts.use_page_cache;
+    iter_opts.fill_data_page_cache = _opts.fill_data_page_cache;
     iter_opts.check_dict_encoding = check_dict_enc;
     iter_opts.reader_type = _opts.reader_type;
     iter_opts.lake_io_opts = _opts.lake_io_opts;
@@ -564,27 +586,23 @@ Status SegmentIterator::_init_column_iterator_by_cid(const ColumnId cid, const C
         if (config::io_coalesce_lake_read_enable && !_segment->is_default_column(col) &&
             _segment->lake_tablet_manager() != nullptr) {
             ASSIGN_OR_RETURN(auto file_size, _segment->get_data_size());
-            auto shared_buffered_input_stream =
-                    std::make_unique<io::SharedBufferedInputStream>(rfile->stream(), _segment->file_name(), file_size);
-            auto options = io::SharedBufferedInputStream::CoalesceOptions{
-                    .max_dist_size = config::io_coalesce_read_max_distance_size,
-                    .max_buffer_size = config::io_coalesce_read_max_buffer_size};
-            shared_buffered_input_stream->set_coalesce_options(options);
-            iter_opts.read_file = shared_buffered_input_stream.get();
-            iter_opts.is_io_coalesce = true;
-            _column_files[cid] = std::move(shared_buffered_input_stream);
-            _io_coalesce_column_index.emplace_back(cid);
+            _init_io_coalesce_column_file(cid, rfile.get(), _segment->file_name(), file_size, &iter_opts);
         } else {
             iter_opts.read_file = rfile.get();
             _column_files[cid] = std::move(rfile);
         }
     } else {
         // create delta column iterator
-        // TODO io_coalesce
         _column_iterators[cid] = std::move(col_iter);
         ASSIGN_OR_RETURN(auto dcg_file, _opts.fs->new_random_access_file(opts, dcg_filename));
-        iter_opts.read_file = dcg_file.get();
-        _column_files[cid] = std::move(dcg_file);
+        if (config::io_coalesce_lake_read_enable && _segment->lake_tablet_manager() != nullptr) {
+            // rows of delta column group are aligned with the segment, so the same scan range applies.
+            ASSIGN_OR_RETURN(auto file_size, dcg_file->get_size());
+            _init_io_coalesce_column_file(cid, dcg_file.get(), dcg_filename, file_size, &iter_opts);
+        } else {
+            iter_opts.read_file = dcg_file.get();
+            _column_files[cid] = std::move(dcg_file);
+        }
     }
     RETURN_IF_ERROR(_column_iterators[cid]->init(iter_opts));
     return Status::OK();
@@ -807,6 +825,45 @@ StatusOr<SparseRange<>> SegmentIterator::_get_row_ranges_by_short_key_ranges() {
     return res;
 }
 
+// Drop the delete conditions that cannot match any row of this segment according to its segment-level zone map,
+// e.g, `dt < '2024-01-01'` on a segment whose `dt` starts from '2024-06-01'. Delete conditions are only removed by
+// compaction, so with many pending delete versions most of them usually miss the segment, and each one that is
+// left would otherwise be evaluated on every chunk read. If none is left, deleted rows are not checked at all.
+Status SegmentIterator::_prune_delete_predicates_by_segment_zone_map() {
+    RETURN_IF(!config::enable_index_segment_level_zonemap_filter, Status::OK());
+    RETURN_IF(_opts.delete_predicates.empty(), Status::OK());
+    // the segment zone map is stale for columns rewritten by a delta column group.
+    RETURN_IF(!_dcgs.empty(), Status::OK());
+
+    auto tablet_schema = _opts.tablet_schema ? _opts.tablet_schema : _segment->tablet_schema_share_ptr();
+    auto may_match = [&](const ConjunctivePredicates& conjunct) {
+        std::set<ColumnId> columns;
+        conjunct.get_column_ids(&columns);
+        std::vector<const ColumnPredicate*> preds;
+        for (ColumnId cid : columns) {
+            const ColumnReader* reader = _segment->column_with_uid(tablet_schema->column(cid).unique_id());
+            if (reader == nullptr || !reader->has_zone_map()) {
+                continue;
+            }
+            preds.clear();
+            conjunct.predicates_of_column(cid, &preds);
+            // the zone map is parsed with the predicate type, which differs from a segment written before a
+            // column type change.
+            if (preds.empty() || preds[0]->type_info()->type() != reader->column_type()) {
+                continue;
+            }
+            if (!reader->segment_zone_map_filter(preds)) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    auto& conjuncts = _opts.delete_predicates.predicate_list();
+    std::erase_if(conjuncts, [&](const ConjunctivePredicates& conjunct) { return !may_match(conjunct); });
+    return Status::OK();
+}
+
 Status SegmentIterator::_get_row_ranges_by_zone_map() {
     RETURN_IF(!config::enable_index_page_level_zonemap_filter, Status::OK());
     RETURN_IF(_scan_range.empty(), Status::OK());
@@ -63,6 +63,7 @@ Status SegmentReadOptions::convert_to(SegmentReadOptions* dst, const std::vector
     dst->fs = fs;
     dst->stats = stats;
     dst->use_page_cache = use_page_cache;
+    dst->fill_data_page_cache = fill_data_page_cache;
     dst->profile = profile;
     dst->global_dictmaps = global_dictmaps;
     dst->rowid_range_option = rowid_range_option;
@@ -86,6 +87,7 @@ std::string SegmentReadOptions::debug_string() const {
     ss << "],delete_predicates={";
     ss << "},unsafe_tablet_schema_ref={";
     ss << "},use_page_cache=" << use_page_cache;
+    ss << ",fill_data_page_cache=" << fill_data_page_cache;
     return ss.str();
 }
 
@@ -14,6 +14,8 @@
 
 #include "rowset_column_update_state.h"
 
+#include <algorithm>
+
 #include "common/tracer.h"
 #include "fs/fs_util.h"
 #include "gutil/strings/substitute.h"
@@ -671,16 +673,42 @@ Status RowsetColumnUpdateState::finalize(Tablet* tablet, Rowset* rowset, uint32_
     };
     // 2. getter all rss_rowid_to_update_rowid, and prepare .col writer by the way
     int64_t insert_rows = 0;
-    // rss_id -> rowid -> <update file id, update_rowids>
-    std::map<uint32_t, RowidsToUpdateRowids> rss_rowid_to_update_rowid;
+    // Collect <rss_rowid, <update file id, update_rowid>> of all update files and sort them once, so that the
+    // source segments are visited in (rssid, rowid) order without a map insertion per updated row.
+    std::vector<std::pair<uint64_t, std::pair<uint32_t, uint32_t>>> sorted_rss_rowids;
+    size_t total_update_rows = 0;
+    for (const auto& state : _partial_update_states) {
+        total_update_rows += state.rss_rowid_to_update_rowid.size();
+    }
+    sorted_rss_rowids.reserve(total_update_rows);
     for (int upt_id = 0; upt_id < _partial_update_states.size(); upt_id++) {
         for (const auto& each : _partial_update_states[upt_id].rss_rowid_to_update_rowid) {
-            auto rssid = (uint32_t)(each.first >> 32);
-            auto rowid = (uint32_t)(each.first & ROWID_MASK);
-            rss_rowid_to_update_rowid[rssid][rowid] = std::make_pair(upt_id, each.second);
+            sorted_rss_rowids.emplace_back(each.first, std::make_pair(upt_id, each.second));
         }
         insert_rows += _partial_update_states[upt_id].insert_rowids.size();
     }
+    // stable sort keeps the update files in order for the same source row
+    std::stable_sort(sorted_rss_rowids.begin(), sorted_rss_rowids.end(),
+                     [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+    // rss_id -> rowid -> <update file id, update_rowids>
+    std::map<uint32_t, RowidsToUpdateRowids> rss_rowid_to_update_rowid;
+    RowidsToUpdateRowids* cur_rowids = nullptr;
+    uint32_t cur_rssid = UINT32_MAX;
+    for (size_t i = 0; i < sorted_rss_rowids.size(); i++) {
+        // the same source row is updated by several update files, the last one wins
+        if (i + 1 < sorted_rss_rowids.size() && sorted_rss_rowids[i + 1].first == sorted_rss_rowids[i].first) {
+            continue;
+        }
+        auto rssid = (uint32_t)(sorted_rss_rowids[i].first >> 32);
+        auto rowid = (uint32_t)(sorted_rss_rowids[i].first & ROWID_MASK);
+        if (cur_rowids == nullptr || rssid != cur_rssid) {
+            cur_rowids = &rss_rowid_to_update_rowid[rssid];
+            cur_rssid = rssid;
+        }
+        cur_rowids->emplace_back(rowid, sorted_rss_rowids[i].second);
+    }
+    sorted_rss_rowids.clear();
+    sorted_rss_rowids.shrink_to_fit();
     cost_str << " [generate delta column group writer] " << watch.elapsed_time();
     watch.reset();
     OlapReaderStatistics stats;
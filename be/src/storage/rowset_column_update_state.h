@@ -114,8 +114,8 @@ using BatchPKsPtr = std::shared_ptr<BatchPKs>;
 class RowsetColumnUpdateState {
 public:
     using DeltaColumnGroupPtr = std::shared_ptr<DeltaColumnGroup>;
-    // rowid -> <update file id, update_rowids>
-    using RowidsToUpdateRowids = std::map<uint32_t, std::pair<uint32_t, uint32_t>>;
+    // rowid -> <update file id, update_rowids>, sorted by rowid
+    using RowidsToUpdateRowids = std::vector<std::pair<uint32_t, std::pair<uint32_t, uint32_t>>>;
 
     RowsetColumnUpdateState();
     ~RowsetColumnUpdateState();
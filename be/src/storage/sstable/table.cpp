@@ -236,12 +236,31 @@ template <class ForwardIt>
 Status Table::MultiGet(const ReadOptions& options, const Slice* keys, ForwardIt begin, ForwardIt end,
                        std::vector<std::string>* values) {
     Status s;
-    Iterator* iiter = rep_->index_block->NewIterator(rep_->options.comparator);
+    std::unique_ptr<Iterator> iiter(rep_->index_block->NewIterator(rep_->options.comparator));
     std::unique_ptr<Iterator> current_block_itr_ptr;
+    const Comparator* comparator = rep_->options.comparator;
 
     // return true if find k
-    auto search_in_block = [](const Slice& k, std::string* value, Iterator* current_block_itr) -> StatusOr<bool> {
-        current_block_itr->Seek(k);
+    auto search_in_block = [comparator](const Slice& k, std::string* value, Iterator* current_block_itr,
+                                        bool positioned) -> StatusOr<bool> {
+        // The keys are sorted, so when the iterator is left at the previous key, a close following key is reached
+        // by a few forward steps, cheaper than a binary search over the restart points of the block.
+        static constexpr int kMaxForwardSteps = 16;
+        bool seeked = false;
+        if (positioned) {
+            for (int step = 0; step < kMaxForwardSteps && current_block_itr->Valid(); ++step) {
+                if (comparator->Compare(current_block_itr->key(), k) >= 0) {
+                    seeked = true;
+                    break;
+                }
+                current_block_itr->Next();
+            }
+            // passing the end of the block also means k is not in this block
+            seeked = seeked || !current_block_itr->Valid();
+        }
+        if (!seeked) {
+            current_block_itr->Seek(k);
+        }
         if (current_block_itr->Valid() && k == current_block_itr->key()) {
             value->assign(current_block_itr->value().data, current_block_itr->value().size);
             return true;
@@ -256,12 +275,16 @@ Status Table::MultiGet(const ReadOptions& options, const Slice* keys, ForwardIt
     bool founded = false;
     for (auto it = begin; it != end; ++it, ++i) {
         auto& k = keys[*it];
-        if (current_block_itr_ptr != nullptr && current_block_itr_ptr->Valid()) {
+        if (current_block_itr_ptr != nullptr) {
             // keep searching current block
-            ASSIGN_OR_RETURN(founded, search_in_block(k, &(*values)[i], current_block_itr_ptr.get()));
+            ASSIGN_OR_RETURN(founded, search_in_block(k, &(*values)[i], current_block_itr_ptr.get(), true));
             if (founded) {
                 TRACE_COUNTER_INCREMENT("continue_block_read", 1);
                 continue;
+            } else if (current_block_itr_ptr->Valid()) {
+                // The keys are sorted and the block was read for a smaller key, so a key that falls
+                // before the end of the block is not in this table.
+                continue;
             } else {
                 current_block_itr_ptr.reset(nullptr);
             }
@@ -280,21 +303,20 @@ Status Table::MultiGet(const ReadOptions& options, const Slice* keys, ForwardIt
                 current_block_itr_ptr.reset(BlockReader(this, options, iiter->value()));
                 auto end_ts = butil::gettimeofday_us();
                 TRACE_COUNTER_INCREMENT("read_block", end_ts - start_ts);
-                ASSIGN_OR_RETURN(founded, search_in_block(k, &(*values)[i], current_block_itr_ptr.get()));
+                ASSIGN_OR_RETURN(founded, search_in_block(k, &(*values)[i], current_block_itr_ptr.get(), false));
             }
         }
     }
     if (s.ok()) {
         s = iiter->status();
     }
-    delete iiter;
     return s;
 }
 
 // If new container wants to be supported in MultiGet, the initialization can be added here.
-template Status Table::MultiGet<std::set<size_t>::iterator>(const ReadOptions& options, const Slice* keys,
-                                                            std::set<size_t>::iterator begin,
-                                                            std::set<size_t>::iterator end,
-                                                            std::vector<std::string>* values);
+template Status Table::MultiGet<std::vector<size_t>::const_iterator>(const ReadOptions& options, const Slice* keys,
+                                                                     std::vector<size_t>::const_iterator begin,
+                                                                     std::vector<size_t>::const_iterator end,
+                                                                     std::vector<std::string>* values);
 
 } // namespace starrocks::sstable
@@ -47,6 +47,7 @@ public:
 
     // Batch get keys within indexes iterator between begin to end.
     // If entry found, value of the corresponding index will be set.
+    // REQUIRES: the keys referred by [begin, end) are in ascending order, so that each block is read at most once.
     template <typename ForwardIt>
     Status MultiGet(const ReadOptions&, const Slice* keys, ForwardIt begin, ForwardIt end,
                     std::vector<std::string>* values);
@@ -227,6 +227,10 @@ public:
     int64_t last_base_compaction_success_time() { return _last_base_compaction_success_millis; }
     void set_last_base_compaction_success_time(int64_t millis) { _last_base_compaction_success_millis = millis; }
 
+    void increase_query_scan_count() { _query_scan_count.fetch_add(1, std::memory_order_relaxed); }
+    // return the number of query scans since last call and reset it
+    int64_t take_query_scan_count() { return _query_scan_count.exchange(0, std::memory_order_relaxed); }
+
     void delete_all_files();
 
     bool check_rowset_id(const RowsetId& rowset_id);
@@ -433,6 +437,8 @@ private:
     std::atomic<int64_t> _last_cumu_compaction_success_millis{0};
     // timestamp of last base compaction success
     std::atomic<int64_t> _last_base_compaction_success_millis{0};
+    // number of query scans since the compaction candidate was last refreshed
+    std::atomic<int64_t> _query_scan_count{0};
 
     std::atomic<TStatusCode::type> _last_cumu_compaction_failure_status = TStatusCode::OK;
 
@@ -967,26 +967,33 @@ Status TabletManager::report_all_tablets_info(std::map<TTabletId, TTablet>* tabl
     StarRocksMetrics::instance()->report_all_tablets_requests_total.increment(1);
 
     size_t max_tablet_rowset_num = 0;
+    // we use this vector to save all tablet ptr for saving lock time, building the report info of a tablet takes
+    // its meta lock and should not block tablet creation and deletion in the same shard.
+    std::vector<TabletSharedPtr> shard_tablets;
     for (const auto& tablets_shard : _tablets_shards) {
-        std::shared_lock rlock(tablets_shard.lock);
-        for (const auto& [tablet_id, tablet_ptr] : tablets_shard.tablet_map) {
+        {
+            std::shared_lock rlock(tablets_shard.lock);
+            shard_tablets.reserve(tablets_shard.tablet_map.size());
+            for (const auto& [tablet_id, tablet_ptr] : tablets_shard.tablet_map) {
+                shard_tablets.push_back(tablet_ptr);
+            }
+        }
+        for (const auto& tablet_ptr : shard_tablets) {
             TTablet t_tablet;
             TTabletInfo tablet_info;
             tablet_ptr->build_tablet_report_info(&tablet_info);
             max_tablet_rowset_num = std::max(max_tablet_rowset_num, tablet_ptr->version_count());
             // find expired transaction corresponding to this tablet
-            TabletInfo tinfo(tablet_id, tablet_ptr->schema_hash(), tablet_ptr->tablet_uid());
+            TabletInfo tinfo(tablet_ptr->tablet_id(), tablet_ptr->schema_hash(), tablet_ptr->tablet_uid());
             auto find = expire_txn_map.find(tinfo);
             if (find != expire_txn_map.end()) {
                 tablet_info.__set_transaction_ids(find->second);
                 expire_txn_map.erase(find);
             }
-            t_tablet.tablet_infos.push_back(tablet_info);
-
-            if (!t_tablet.tablet_infos.empty()) {
-                tablets_info->emplace(tablet_id, t_tablet);
-            }
+            t_tablet.tablet_infos.push_back(std::move(tablet_info));
+            tablets_info->emplace(tablet_ptr->tablet_id(), std::move(t_tablet));
         }
+        shard_tablets.clear();
     }
     LOG(INFO) << "Report all " << tablets_info->size()
               << " tablets info. max_tablet_rowset_num:" << max_tablet_rowset_num;
@@ -122,6 +122,9 @@ Status TabletReader::open(const TabletReaderParams& read_params) {
         read_params.reader_type != ReaderType::READER_ALTER_TABLE && !is_compaction(read_params.reader_type)) {
         return Status::NotSupported("reader type not supported now");
     }
+    if (read_params.reader_type == ReaderType::READER_QUERY && _tablet != nullptr) {
+        _tablet->increase_query_scan_count();
+    }
     if (read_params.use_pk_index) {
         // defer init collector to IO scanner thread when calling do_get_next()
         _reader_params = &read_params;
@@ -212,6 +215,7 @@ Status TabletReader::_init_collector_for_pk_index_read() {
     rs_opts.runtime_state = _reader_params->runtime_state;
     rs_opts.profile = _reader_params->profile;
     rs_opts.use_page_cache = _reader_params->use_page_cache;
+    rs_opts.fill_data_page_cache = _reader_params->fill_data_page_cache;
     rs_opts.tablet_schema = _tablet_schema;
     rs_opts.global_dictmaps = _reader_params->global_dictmaps;
     rs_opts.unused_output_column_ids = _reader_params->unused_output_column_ids;
@@ -286,6 +290,7 @@ Status TabletReader::get_segment_iterators(const TabletReaderParams& params, std
     rs_opts.runtime_state = params.runtime_state;
     rs_opts.profile = params.profile;
     rs_opts.use_page_cache = params.use_page_cache;
+    rs_opts.fill_data_page_cache = params.fill_data_page_cache;
     rs_opts.tablet_schema = _tablet_schema;
     rs_opts.global_dictmaps = params.global_dictmaps;
     rs_opts.unused_output_column_ids = params.unused_output_column_ids;
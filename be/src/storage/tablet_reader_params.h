@@ -58,6 +58,9 @@ struct TabletReaderParams {
     // 2. when read column index page
     //     if config::disable_storage_page_cache is false, we use page cache
     bool use_page_cache = false;
+    // Whether data pages read from disk are inserted into the page cache. Only takes effect when
+    // use_page_cache is true, index and dictionary pages are always inserted.
+    bool fill_data_page_cache = true;
 
     // Options only applies to cloud-native table r/w IO
     LakeIOOptions lake_io_opts{.fill_data_cache = true};
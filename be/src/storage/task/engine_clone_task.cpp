@@ -37,8 +37,11 @@
 #include <fmt/format.h>
 #include <sys/stat.h>
 
+#include <atomic>
 #include <filesystem>
+#include <mutex>
 #include <set>
+#include <thread>
 
 #include "agent/agent_common.h"
 #include "agent/finish_task.h"
@@ -64,6 +67,7 @@
 #include "util/defer_op.h"
 #include "util/network_util.h"
 #include "util/string_parser.hpp"
+#include "util/thread.h"
 #include "util/thrift_rpc_helper.h"
 
 using std::set;
@@ -578,11 +582,11 @@ Status EngineCloneTask::_download_files(DataDir* data_dir, const std::string& re
     }
 
     // Get copy from remote
-    uint64_t total_file_size = 0;
+    std::atomic<uint64_t> total_file_size{0};
     MonotonicStopWatch watch;
     watch.start();
-    for (int i = 0; i < file_name_list.size(); ++i) {
-        std::string& file_name = file_name_list[i];
+    auto download_file = [&](size_t i) -> Status {
+        const std::string& file_name = file_name_list[i];
         auto remote_file_url = remote_url_prefix + file_name;
 
         uint64_t file_size = 0;
@@ -604,7 +608,7 @@ Status EngineCloneTask::_download_files(DataDir* data_dir, const std::string& re
             return Status::InternalError("Disk reach capacity limit");
         }
 
-        total_file_size += file_size;
+        total_file_size.fetch_add(file_size, std::memory_order_relaxed);
         uint64_t estimate_timeout = file_size / config::download_low_speed_limit_kbps / 1024;
         if (estimate_timeout < config::download_low_speed_time) {
             estimate_timeout = config::download_low_speed_time;
@@ -630,16 +634,57 @@ Status EngineCloneTask::_download_files(DataDir* data_dir, const std::string& re
             chmod(local_file_path.c_str(), S_IRUSR | S_IWUSR);
             return Status::OK();
         };
-        RETURN_IF_ERROR(HttpClient::execute_with_retry(DOWNLOAD_FILE_MAX_RETRY, 1, download_cb));
+        return HttpClient::execute_with_retry(DOWNLOAD_FILE_MAX_RETRY, 1, download_cb);
+    };
+
+    // Download all files but the header concurrently, the header is still copied after all of them.
+    size_t num_data_files = file_name_list.empty() ? 0 : file_name_list.size() - 1;
+    size_t num_download_threads = std::min<size_t>(std::max(config::clone_download_file_parallelism, 1),
+                                                   num_data_files);
+    if (num_download_threads <= 1) {
+        for (size_t i = 0; i < num_data_files; ++i) {
+            RETURN_IF_ERROR(download_file(i));
+        }
+    } else {
+        std::atomic<size_t> next_file{0};
+        std::mutex status_lock;
+        Status download_status;
+        std::vector<std::thread> download_threads;
+        download_threads.reserve(num_download_threads);
+        for (size_t t = 0; t < num_download_threads; ++t) {
+            download_threads.emplace_back([&]() {
+                for (size_t i = next_file++; i < num_data_files; i = next_file++) {
+                    Status st = download_file(i);
+                    if (!st.ok()) {
+                        std::lock_guard l(status_lock);
+                        if (download_status.ok()) {
+                            download_status = st;
+                        }
+                        // let the other threads stop picking up files
+                        next_file = num_data_files;
+                        break;
+                    }
+                }
+            });
+            Thread::set_thread_name(download_threads.back(), "clone_download");
+        }
+        for (auto& thread : download_threads) {
+            thread.join();
+        }
+        RETURN_IF_ERROR(download_status);
+    }
+    if (!file_name_list.empty()) {
+        RETURN_IF_ERROR(download_file(file_name_list.size() - 1));
     } // Clone files from remote backend
 
     uint64_t total_time_ms = watch.elapsed_time() / 1000 / 1000;
     total_time_ms = total_time_ms > 0 ? total_time_ms : 0;
     double copy_rate = 0.0;
     if (total_time_ms > 0) {
-        copy_rate = total_file_size / ((double)total_time_ms) / 1000;
+        copy_rate = total_file_size.load() / ((double)total_time_ms) / 1000;
     }
-    LOG(INFO) << "Copied tablet " << _signature << " files=" << file_name_list.size() << ". bytes=" << total_file_size
+    LOG(INFO) << "Copied tablet " << _signature << " files=" << file_name_list.size()
+              << ". bytes=" << total_file_size.load()
               << " cost=" << total_time_ms << " ms"
               << " rate=" << copy_rate << " MB/s";
     return Status::OK();
@@ -61,7 +61,8 @@ UpdateManager::UpdateManager(MemTracker* mem_tracker)
     _index_cache_mem_tracker = std::make_unique<MemTracker>(-1, "index_cache", mem_tracker);
     _del_vec_cache_mem_tracker = std::make_unique<MemTracker>(-1, "del_vec_cache", mem_tracker);
     _compaction_state_mem_tracker = std::make_unique<MemTracker>(-1, "compaction_state", mem_tracker);
-    _delta_column_group_cache_mem_tracker = std::make_unique<MemTracker>(-1, "delta_column_group_cache");
+    _delta_column_group_cache_mem_tracker =
+            std::make_unique<MemTracker>(-1, "delta_column_group_cache", mem_tracker);
 
     _index_cache.set_mem_tracker(_index_cache_mem_tracker.get());
     _update_state_cache.set_mem_tracker(_update_state_mem_tracker.get());
@@ -103,6 +104,9 @@ Status UpdateManager::init() {
             config::get_pindex_worker_count > max_thread_cnt ? config::get_pindex_worker_count : max_thread_cnt * 2;
     RETURN_IF_ERROR(
             ThreadPoolBuilder("get_pindex").set_max_threads(max_get_thread_cnt).build(&_get_pindex_thread_pool));
+    RETURN_IF_ERROR(ThreadPoolBuilder("pindex_rebuild")
+                            .set_max_threads(max_thread_cnt)
+                            .build(&_pindex_rebuild_thread_pool));
 
     _persistent_index_compaction_mgr = std::make_unique<PersistentIndexCompactionManager>();
     RETURN_IF_ERROR(_persistent_index_compaction_mgr->init());
@@ -113,6 +117,9 @@ void UpdateManager::stop() {
     if (_get_pindex_thread_pool) {
         _get_pindex_thread_pool->shutdown();
     }
+    if (_pindex_rebuild_thread_pool) {
+        _pindex_rebuild_thread_pool->shutdown();
+    }
     if (_apply_thread_pool) {
         _apply_thread_pool->shutdown();
     }
@@ -168,6 +175,7 @@ Status UpdateManager::get_delta_column_group(KVStore* meta, const TabletSegmentI
 }
 
 Status UpdateManager::get_del_vec(KVStore* meta, const TabletSegmentId& tsid, int64_t version, DelVectorPtr* pdelvec) {
+    StarRocksMetrics::instance()->update_del_vector_get_total.increment(1);
     {
         std::lock_guard<std::mutex> lg(_del_vec_cache_lock);
         auto itr = _del_vec_cache.find(tsid);
@@ -176,7 +184,7 @@ Status UpdateManager::get_del_vec(KVStore* meta, const TabletSegmentId& tsid, in
                 VLOG(3) << strings::Substitute("get_del_vec cached tablet_segment=$0 version=$1 actual_version=$2",
                                                tsid.to_string(), version, itr->second->version());
                 // cache valid
-                // TODO(cbl): add cache hit stats
+                StarRocksMetrics::instance()->update_del_vector_get_hit_cache.increment(1);
                 *pdelvec = itr->second;
                 return Status::OK();
             }
@@ -95,6 +95,7 @@ public:
 
     ThreadPool* apply_thread_pool() { return _apply_thread_pool.get(); }
     ThreadPool* get_pindex_thread_pool() { return _get_pindex_thread_pool.get(); }
+    ThreadPool* get_pindex_rebuild_thread_pool() { return _pindex_rebuild_thread_pool.get(); }
     PersistentIndexCompactionManager* get_pindex_compaction_mgr() { return _persistent_index_compaction_mgr.get(); }
 
     DynamicCache<uint64_t, PrimaryIndex>& index_cache() { return _index_cache; }
@@ -178,6 +179,8 @@ private:
 
     std::unique_ptr<ThreadPool> _apply_thread_pool;
     std::unique_ptr<ThreadPool> _get_pindex_thread_pool;
+    // reads the rowsets of a tablet in parallel when its persistent index is rebuilt
+    std::unique_ptr<ThreadPool> _pindex_rebuild_thread_pool;
     std::unique_ptr<PersistentIndexCompactionManager> _persistent_index_compaction_mgr;
 
     bool _keep_pindex_bf = true;
@@ -216,6 +216,61 @@ BitmapValue& BitmapValue::operator|=(const BitmapValue& rhs) {
     return *this;
 }
 
+void BitmapValue::union_many(const BitmapValue* const* values, size_t n) {
+    std::vector<const detail::Roaring64Map*> bitmaps;
+    for (size_t i = 0; i < n; i++) {
+        if (values[i]->_type == BITMAP) {
+            bitmaps.push_back(values[i]->_bitmap.get());
+        }
+    }
+    if (bitmaps.size() <= 1) {
+        for (size_t i = 0; i < n; i++) {
+            *this |= *values[i];
+        }
+        return;
+    }
+
+    _mem_usage = 0;
+    if (_type == BITMAP) {
+        bitmaps.push_back(_bitmap.get());
+    }
+    auto result = std::make_shared<detail::Roaring64Map>(
+            detail::Roaring64Map::fastunion(bitmaps.size(), bitmaps.data()));
+    switch (_type) {
+    case EMPTY:
+    case BITMAP:
+        break;
+    case SINGLE:
+        result->add(_sv);
+        break;
+    case SET:
+        for (auto x : *_set) {
+            result->add(x);
+        }
+        _set.reset();
+        break;
+    }
+    _bitmap = std::move(result);
+    _type = BITMAP;
+
+    for (size_t i = 0; i < n; i++) {
+        const BitmapValue* value = values[i];
+        switch (value->_type) {
+        case EMPTY:
+        case BITMAP:
+            break;
+        case SINGLE:
+            _bitmap->add(value->_sv);
+            break;
+        case SET:
+            for (auto x : *value->_set) {
+                _bitmap->add(x);
+            }
+            break;
+        }
+    }
+}
+
 // Note: rhs BitmapValue is only readable after this method
 // Compute the intersection between the current bitmap and the provided bitmap.
 // Possible type transitions are:
@@ -906,6 +961,13 @@ void BitmapValue::compress() {
     }
 }
 
+void BitmapValue::run_optimize() {
+    if (_type == BITMAP && _bitmap.use_count() <= 1) {
+        _mem_usage = 0;
+        _bitmap->runOptimize();
+    }
+}
+
 void BitmapValue::clear() {
     if (_bitmap != nullptr) {
         if (_bitmap.use_count() <= 1) {
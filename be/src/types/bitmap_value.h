@@ -134,6 +134,12 @@ public:
     // SINGLE -> BITMAP
     BitmapValue& operator|=(const BitmapValue& rhs);
 
+    // Note: the values are only readable after this method
+    // Compute the union between the current bitmap and `n` provided bitmaps.
+    // All roaring bitmaps are unioned with one many-way union, which is much cheaper than
+    // applying `|=` for every value when many large bitmaps are aggregated into one.
+    void union_many(const BitmapValue* const* values, size_t n);
+
     // Note: rhs BitmapValue is only readable after this method
     // Compute the intersection between the current bitmap and the provided bitmap.
     // Possible type transitions are:
@@ -185,6 +191,11 @@ public:
     // This method should be called before `serialize_size`.
     void compress();
 
+    // Convert containers to run containers where it saves space, e.g. before sending the bitmap
+    // to another node. A bitmap that is still shared with other values is left untouched to avoid
+    // a deep copy.
+    void run_optimize();
+
     void clear();
     void reset();
 
@@ -38,7 +38,9 @@
 // the detail class such as Roaring64Map.
 // So other files should not include this file except bitmap_value.cpp.
 #include <cstdint>
+#include <map>
 #include <optional>
+#include <vector>
 
 #include "roaring/array_util.h"
 #include "roaring/bitset_util.h"
@@ -880,10 +882,22 @@ public:
      * pointer).
      */
     static Roaring64Map fastunion(size_t n, const Roaring64Map** inputs) {
-        Roaring64Map ans;
-        // not particularly fast
+        // Group the 32-bit bitmaps by their high 32 bits and union each group with a single
+        // many-way roaring union, instead of folding the inputs pairwise which re-materializes
+        // the intermediate containers once per input.
+        std::map<uint32_t, std::vector<const Roaring*>> groups;
         for (size_t lcv = 0; lcv < n; ++lcv) {
-            ans |= *(inputs[lcv]);
+            for (const auto& map_entry : inputs[lcv]->roarings) {
+                groups[map_entry.first].push_back(&map_entry.second);
+            }
+        }
+        Roaring64Map ans;
+        for (auto& [key, group] : groups) {
+            if (group.size() == 1) {
+                ans.roarings.emplace(key, *group[0]);
+            } else {
+                ans.roarings.emplace(key, Roaring::fastunion(group.size(), group.data()));
+            }
         }
         return ans;
     }
@@ -169,6 +169,20 @@ void HyperLogLog::update(uint64_t hash_value) {
     }
 }
 
+void HyperLogLog::update_batch(const uint64_t* hash_values, size_t num_values) {
+    size_t i = 0;
+    for (; i < num_values && (_type == HLL_DATA_EMPTY || _type == HLL_DATA_EXPLICIT); ++i) {
+        if (hash_values[i] != 0) {
+            update(hash_values[i]);
+        }
+    }
+    for (; i < num_values; ++i) {
+        if (hash_values[i] != 0) {
+            _update_registers(hash_values[i]);
+        }
+    }
+}
+
 MFV_AVX512(void merge_registers_impl(uint8_t* dest, const uint8_t* other) {
     constexpr int SIMD_SIZE = sizeof(__m512i);
     constexpr int loop = HLL_REGISTERS_COUNT / SIMD_SIZE;
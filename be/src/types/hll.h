@@ -114,6 +114,10 @@ public:
     // NOTE: input must be a hash_value
     void update(uint64_t hash_value);
 
+    // Add a batch of hash values, the zero ones are skipped. Once the registers are used, the values are
+    // written into registers directly without checking the representation per value.
+    void update_batch(const uint64_t* hash_values, size_t num_values);
+
     void merge(const HyperLogLog& other);
 
     // Return max size of serialized binary
@@ -40,6 +40,7 @@
 #include <deque>
 #include <list>
 #include <mutex>
+#include <vector>
 
 #include "util/stopwatch.hpp"
 
@@ -143,6 +144,26 @@ public:
         return false;
     }
 
+    // Appends at most |max_items| items to |out| and blocks only if the queue is empty.
+    // Return false iff empty *AND* has been shutdown.
+    bool blocking_get_batch(std::vector<T>* out, size_t max_items) {
+        std::unique_lock<Lock> l(_lock);
+        _not_empty.wait(l, [this]() { return !_items.empty() || _shutdown; });
+        if (_items.empty()) {
+            return false;
+        }
+        for (size_t i = 0; i < max_items && !_items.empty(); i++) {
+            if constexpr (std::is_move_assignable<T>::value) {
+                out->emplace_back(std::move(_items.front()));
+            } else {
+                out->emplace_back(_items.front());
+            }
+            _items.pop_front();
+        }
+        _not_full.notify_all();
+        return true;
+    }
+
     // Return 1 on success;
     // Return 0 on queue empty;
     // Return -1 on shutdown;
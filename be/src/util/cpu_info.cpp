@@ -383,6 +383,13 @@ void CpuInfo::_get_cache_info(long cache_sizes[NUM_CACHE_LEVELS], long cache_lin
 #endif
 }
 
+long CpuInfo::get_cache_size(CacheLevel level) {
+    long cache_sizes[NUM_CACHE_LEVELS];
+    long cache_line_sizes[NUM_CACHE_LEVELS];
+    _get_cache_info(cache_sizes, cache_line_sizes);
+    return std::max(cache_sizes[level], 0L);
+}
+
 std::string CpuInfo::debug_string() {
     DCHECK(initialized_);
     std::stringstream stream;
@@ -80,8 +80,29 @@ public:
     /// remain stable.
     static int get_current_core();
 
+    /// Returns the maximum number of NUMA nodes that will be online in the system.
+    static int get_max_num_numa_nodes() { return max_num_numa_nodes_; }
+
+    /// Returns the NUMA node of the core with ID 'core'.
+    static int get_numa_node_of_core(int core) {
+        DCHECK_GE(core, 0);
+        DCHECK_LT(core, max_num_cores_);
+        return core_to_numa_node_[core];
+    }
+
+    /// Returns the cores belonging to the NUMA node with ID 'node'.
+    static const std::vector<int>& get_cores_of_numa_node(int node) {
+        DCHECK_GE(node, 0);
+        DCHECK_LT(node, max_num_numa_nodes_);
+        return numa_node_to_cores_[node];
+    }
+
     static std::string debug_string();
 
+    /// Returns the size in bytes of the given cache level, or 0 if it cannot be determined.
+    /// Callers should fall back to a reasonable default in that case.
+    static long get_cache_size(CacheLevel level);
+
 private:
     /// Initialize NUMA-related state - called from Init();
     static void _init_numa();
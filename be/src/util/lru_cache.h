@@ -13,6 +13,7 @@
 #include <string_view>
 #include <vector>
 
+#include "common/compiler_util.h"
 #include "util/slice.h"
 
 namespace starrocks {
@@ -266,7 +267,9 @@ private:
 };
 
 // A single shard of sharded cache.
-class LRUCache {
+// Shards live next to each other in ShardedLRUCache, and every lookup writes the shard's mutex and counters, so
+// each shard is cache line aligned to keep lookups on neighbouring shards from contending on the same line.
+class alignas(CACHE_LINE_SIZE) LRUCache {
 public:
     LRUCache();
     ~LRUCache() noexcept;
@@ -0,0 +1,89 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+namespace starrocks {
+
+// MpscQueue is an unbounded lock-free FIFO queue for multiple producers and a single consumer.
+// - Any thread can enqueue(), and it never waits for the other producers or the consumer.
+// - Only one thread can try_dequeue() at a time, the caller should serialize the consumers if there are many.
+// try_dequeue() may return false in the short window that a producer has taken its position but not yet linked
+// its node, the element will be visible after this producer returns.
+//
+// See "Non-intrusive MPSC node-based queue" by Dmitry Vyukov.
+template <typename T>
+class MpscQueue {
+public:
+    MpscQueue() : _head(new Node()), _tail(_head.load(std::memory_order_relaxed)) {}
+
+    ~MpscQueue() {
+        T value;
+        while (try_dequeue(value)) {
+        }
+        delete _tail;
+    }
+
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+    // Any thread.
+    void enqueue(T&& value) {
+        auto* node = new Node(std::move(value));
+        _size.fetch_add(1, std::memory_order_relaxed);
+        Node* prev = _head.exchange(node, std::memory_order_acq_rel);
+        prev->next.store(node, std::memory_order_release);
+    }
+
+    // Consumer only.
+    bool try_dequeue(T& value) {
+        Node* tail = _tail;
+        Node* next = tail->next.load(std::memory_order_acquire);
+        if (next == nullptr) {
+            return false;
+        }
+        // next becomes the new dummy node after its value is taken.
+        value = std::move(next->value);
+        _tail = next;
+        delete tail;
+        _size.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // The result is only an approximate value, when the queue is modified concurrently.
+    size_t size_approx() const {
+        const int64_t size = _size.load(std::memory_order_relaxed);
+        return size > 0 ? size : 0;
+    }
+
+private:
+    struct Node {
+        Node() = default;
+        explicit Node(T&& value) : value(std::move(value)) {}
+
+        T value{};
+        std::atomic<Node*> next{nullptr};
+    };
+
+    // Put head and tail into different cache lines, since head is updated by producers and tail by the consumer.
+    alignas(64) std::atomic<Node*> _head;
+    alignas(64) Node* _tail;
+    alignas(64) std::atomic<int64_t> _size{0};
+};
+
+} // namespace starrocks
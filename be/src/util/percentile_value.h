@@ -34,8 +34,20 @@ public:
 
     void add(float value) { _tdigest.add(value); }
 
+    void add_batch(const double* values, size_t n) { _tdigest.add(values, n); }
+
     void merge(const PercentileValue* other) { _tdigest.merge(&other->_tdigest); }
 
+    // Merge several percentiles at once, which costs one pass over the centroids instead of one per input.
+    void merge(const std::vector<const PercentileValue*>& others) {
+        std::vector<const TDigest*> digests;
+        digests.reserve(others.size());
+        for (const auto* other : others) {
+            digests.push_back(&other->_tdigest);
+        }
+        _tdigest.add(digests);
+    }
+
     uint64_t serialize_size() const {
         //_type 1 bytes
         return 1 + _tdigest.serialize_size();
@@ -35,7 +35,10 @@
 
 #include <glog/logging.h>
 
+#include <type_traits>
+
 #include "gutil/port.h"
+#include "simd/gather.h"
 #include "util/bit_stream_utils.inline.h"
 #include "util/bit_util.h"
 
@@ -953,8 +956,13 @@ inline int RleBatchDecoder<T>::GetBatchWithDict(const TV* dictionary, int32_t di
         if (UNLIKELY(!IndicesInRange(indices, num_literals_to_set, dictionary_length))) {
             return -1;
         }
-        for (int i = 0; i < num_literals_to_set; ++i) {
-            values[num_consumed + i] = dictionary[indices[i]];
+        if constexpr ((sizeof(TV) == 4 || sizeof(TV) == 8) && std::is_trivially_copyable_v<TV> &&
+                      sizeof(T) == 4 && std::is_integral_v<T>) {
+            SIMDGather::gather_values(values + num_consumed, dictionary, indices, num_literals_to_set);
+        } else {
+            for (int i = 0; i < num_literals_to_set; ++i) {
+                values[num_consumed + i] = dictionary[indices[i]];
+            }
         }
         num_consumed += num_literals_to_set;
     }
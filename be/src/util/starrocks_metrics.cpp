@@ -53,6 +53,16 @@ StarRocksMetrics::StarRocksMetrics() : _metrics(_s_registry_name) {
     REGISTER_STARROCKS_METRIC(http_request_send_bytes);
     REGISTER_STARROCKS_METRIC(query_scan_bytes);
     REGISTER_STARROCKS_METRIC(query_scan_rows);
+    REGISTER_STARROCKS_METRIC(spill_arbitration_spilled_operators_total);
+    REGISTER_STARROCKS_METRIC(spill_arbitration_skipped_operators_total);
+    REGISTER_STARROCKS_METRIC(spill_arbitration_revocable_bytes);
+    REGISTER_STARROCKS_METRIC(page_cache_data_page_hit_total);
+    REGISTER_STARROCKS_METRIC(page_cache_data_page_miss_total);
+    REGISTER_STARROCKS_METRIC(page_cache_index_page_hit_total);
+    REGISTER_STARROCKS_METRIC(page_cache_index_page_miss_total);
+    REGISTER_STARROCKS_METRIC(page_cache_data_page_skip_insert_total);
+    REGISTER_STARROCKS_METRIC(page_cache_raw_data_page_hit_total);
+    REGISTER_STARROCKS_METRIC(page_cache_raw_data_page_decode_ns_total);
 
     REGISTER_STARROCKS_METRIC(load_channel_add_chunks_total);
     REGISTER_STARROCKS_METRIC(load_channel_add_chunks_duration_us);
@@ -74,6 +84,7 @@ StarRocksMetrics::StarRocksMetrics() : _metrics(_s_registry_name) {
     REGISTER_STARROCKS_METRIC(memtable_flush_io_time_us);
     REGISTER_STARROCKS_METRIC(memtable_flush_memory_bytes_total);
     REGISTER_STARROCKS_METRIC(memtable_flush_disk_bytes_total);
+    REGISTER_STARROCKS_METRIC(memtable_merge_chunk_reuse_total);
     REGISTER_STARROCKS_METRIC(segment_flush_total);
     REGISTER_STARROCKS_METRIC(segment_flush_duration_us);
     REGISTER_STARROCKS_METRIC(segment_flush_io_time_us);
@@ -90,6 +101,8 @@ StarRocksMetrics::StarRocksMetrics() : _metrics(_s_registry_name) {
     REGISTER_STARROCKS_METRIC(update_del_vector_bytes_total);
     REGISTER_STARROCKS_METRIC(update_del_vector_deletes_total);
     REGISTER_STARROCKS_METRIC(update_del_vector_deletes_new);
+    REGISTER_STARROCKS_METRIC(update_del_vector_get_total);
+    REGISTER_STARROCKS_METRIC(update_del_vector_get_hit_cache);
     REGISTER_STARROCKS_METRIC(column_partial_update_apply_total);
     REGISTER_STARROCKS_METRIC(column_partial_update_apply_duration_us);
     REGISTER_STARROCKS_METRIC(delta_column_group_get_total);
@@ -99,6 +99,20 @@ public:
     METRIC_DEFINE_INT_GAUGE(query_scan_bytes_per_second, MetricUnit::BYTES);
     METRIC_DEFINE_INT_COUNTER(query_scan_bytes, MetricUnit::BYTES);
     METRIC_DEFINE_INT_COUNTER(query_scan_rows, MetricUnit::ROWS);
+    // operators asked to spill or kept in memory when a resource group or the process runs out of spill memory
+    METRIC_DEFINE_INT_COUNTER(spill_arbitration_spilled_operators_total, MetricUnit::NOUNIT);
+    METRIC_DEFINE_INT_COUNTER(spill_arbitration_skipped_operators_total, MetricUnit::NOUNIT);
+    METRIC_DEFINE_INT_COUNTER(spill_arbitration_revocable_bytes, MetricUnit::BYTES);
+    // storage page cache lookups by page class, index pages include dictionary and short key pages
+    METRIC_DEFINE_INT_COUNTER(page_cache_data_page_hit_total, MetricUnit::OPERATIONS);
+    METRIC_DEFINE_INT_COUNTER(page_cache_data_page_miss_total, MetricUnit::OPERATIONS);
+    METRIC_DEFINE_INT_COUNTER(page_cache_index_page_hit_total, MetricUnit::OPERATIONS);
+    METRIC_DEFINE_INT_COUNTER(page_cache_index_page_miss_total, MetricUnit::OPERATIONS);
+    // data pages read from disk but not inserted into the page cache by the scan admission policy
+    METRIC_DEFINE_INT_COUNTER(page_cache_data_page_skip_insert_total, MetricUnit::OPERATIONS);
+    // hits of data pages cached compressed, and the time spent to decompress and decode them
+    METRIC_DEFINE_INT_COUNTER(page_cache_raw_data_page_hit_total, MetricUnit::OPERATIONS);
+    METRIC_DEFINE_INT_COUNTER(page_cache_raw_data_page_decode_ns_total, MetricUnit::NANOSECONDS);
 
     // counters
     METRIC_DEFINE_INT_COUNTER(fragment_requests_total, MetricUnit::REQUESTS);
@@ -234,6 +248,8 @@ public:
     METRIC_DEFINE_INT_COUNTER(memtable_flush_memory_bytes_total, MetricUnit::BYTES);
     // total disk size of memtables which is smaller than memtable_flush_memory_bytes_total because of compression
     METRIC_DEFINE_INT_COUNTER(memtable_flush_disk_bytes_total, MetricUnit::BYTES);
+    // number of memtable merges which reuse the columns of the previous merge instead of allocating new ones
+    METRIC_DEFINE_INT_COUNTER(memtable_merge_chunk_reuse_total, MetricUnit::OPERATIONS);
     METRIC_DEFINE_INT_COUNTER(segment_flush_total, MetricUnit::OPERATIONS);
     METRIC_DEFINE_INT_COUNTER(segment_flush_duration_us, MetricUnit::MICROSECONDS);
     METRIC_DEFINE_INT_COUNTER(segment_flush_io_time_us, MetricUnit::MICROSECONDS);
@@ -250,6 +266,8 @@ public:
     METRIC_DEFINE_UINT_GAUGE(update_del_vector_bytes_total, MetricUnit::BYTES);
     METRIC_DEFINE_UINT_COUNTER(update_del_vector_deletes_total, MetricUnit::NOUNIT);
     METRIC_DEFINE_UINT_COUNTER(update_del_vector_deletes_new, MetricUnit::NOUNIT);
+    METRIC_DEFINE_INT_COUNTER(update_del_vector_get_total, MetricUnit::REQUESTS);
+    METRIC_DEFINE_INT_COUNTER(update_del_vector_get_hit_cache, MetricUnit::REQUESTS);
     METRIC_DEFINE_INT_COUNTER(column_partial_update_apply_total, MetricUnit::REQUESTS);
     METRIC_DEFINE_INT_COUNTER(column_partial_update_apply_duration_us, MetricUnit::MICROSECONDS);
     METRIC_DEFINE_INT_COUNTER(delta_column_group_get_total, MetricUnit::REQUESTS);
@@ -338,6 +356,10 @@ public:
     METRICS_DEFINE_THREAD_POOL(segment_flush);
     METRICS_DEFINE_THREAD_POOL(update_apply);
     METRICS_DEFINE_THREAD_POOL(pk_index_compaction);
+    METRICS_DEFINE_THREAD_POOL(stream_load_io);
+    METRICS_DEFINE_THREAD_POOL(automatic_partition);
+    METRICS_DEFINE_THREAD_POOL(dictionary_cache);
+    METRICS_DEFINE_THREAD_POOL(hash_join_build);
 
     METRIC_DEFINE_UINT_GAUGE(load_rpc_threadpool_size, MetricUnit::NOUNIT);
 
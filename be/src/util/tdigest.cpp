@@ -367,6 +367,24 @@ void TDigest::add(Value x) {
     add(x, 1);
 }
 
+void TDigest::add(const double* values, size_t n) {
+    size_t i = 0;
+    while (i < n) {
+        // add(Value) processes as soon as the unprocessed buffer exceeds _max_unprocessed, fill up to that point
+        size_t room = _unprocessed.size() <= _max_unprocessed ? _max_unprocessed + 1 - _unprocessed.size() : 1;
+        size_t end = std::min(n, i + room);
+        for (; i < end; i++) {
+            auto x = static_cast<Value>(values[i]);
+            if (std::isnan(x)) {
+                continue;
+            }
+            _unprocessed.emplace_back(x, 1);
+            _unprocessed_weight += 1;
+        }
+        processIfNecessary();
+    }
+}
+
 void TDigest::compress() {
     process();
 }
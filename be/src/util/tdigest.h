@@ -165,6 +165,9 @@ public:
     Value quantileProcessed(Value q) const;
     Value compression() const;
     void add(Value x);
+    // add `n` values with weight 1, same as calling add(Value) for each of them but without the
+    // per-value bookkeeping.
+    void add(const double* values, size_t n);
     void compress();
     // add a single centroid to the unprocessed vector, processing previously unprocessed sorted if our limit has
     // been reached.
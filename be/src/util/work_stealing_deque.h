@@ -0,0 +1,125 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+namespace starrocks {
+
+// WorkStealingDeque is a bounded lock-free Chase-Lev deque of pointers.
+// - Only the owner thread can push() and pop() at the bottom.
+// - Any thread, including the owner, can steal() from the top.
+// push() returns false when the deque is full, and pop()/steal() return nullptr when the deque is empty
+// or the race with the other thieves is lost.
+//
+// See "Correct and Efficient Work-Stealing for Weak Memory Models" (Lê et al., PPoPP 2013).
+template <typename T>
+class WorkStealingDeque {
+    static_assert(std::is_pointer_v<T>, "WorkStealingDeque only supports pointer elements");
+
+public:
+    explicit WorkStealingDeque(size_t capacity)
+            : _capacity(_round_up_to_power_of_two(capacity)),
+              _mask(_capacity - 1),
+              _buffer(new std::atomic<T>[_capacity]) {}
+
+    ~WorkStealingDeque() = default;
+
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    // Owner only.
+    bool push(T item) {
+        const int64_t b = _bottom.load(std::memory_order_relaxed);
+        const int64_t t = _top.load(std::memory_order_acquire);
+        if (b - t >= static_cast<int64_t>(_capacity)) {
+            return false;
+        }
+        _buffer[b & _mask].store(item, std::memory_order_relaxed);
+        _bottom.store(b + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Owner only. Take the most recently pushed element.
+    T pop() {
+        const int64_t b = _bottom.load(std::memory_order_relaxed) - 1;
+        _bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t t = _top.load(std::memory_order_relaxed);
+
+        T item = nullptr;
+        if (t <= b) {
+            item = _buffer[b & _mask].load(std::memory_order_relaxed);
+            if (t == b) {
+                // The last element, race with the thieves.
+                if (!_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                    item = nullptr;
+                }
+                _bottom.store(b + 1, std::memory_order_relaxed);
+            }
+        } else {
+            _bottom.store(b + 1, std::memory_order_relaxed);
+        }
+        return item;
+    }
+
+    // Any thread. Take the least recently pushed element.
+    T steal() {
+        int64_t t = _top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const int64_t b = _bottom.load(std::memory_order_acquire);
+        if (t >= b) {
+            return nullptr;
+        }
+
+        T item = _buffer[t & _mask].load(std::memory_order_relaxed);
+        if (!_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            return nullptr;
+        }
+        return item;
+    }
+
+    // The result is only an approximate value, when the deque is modified concurrently.
+    size_t size() const {
+        const int64_t b = _bottom.load(std::memory_order_relaxed);
+        const int64_t t = _top.load(std::memory_order_relaxed);
+        return b > t ? b - t : 0;
+    }
+
+    bool empty() const { return size() == 0; }
+    size_t capacity() const { return _capacity; }
+
+private:
+    static size_t _round_up_to_power_of_two(size_t n) {
+        size_t capacity = 1;
+        while (capacity < n) {
+            capacity <<= 1;
+        }
+        return capacity;
+    }
+
+    const size_t _capacity;
+    const size_t _mask;
+    std::unique_ptr<std::atomic<T>[]> _buffer;
+
+    // Put top and bottom into different cache lines, since top is updated by thieves and bottom by the owner.
+    alignas(64) std::atomic<int64_t> _top{0};
+    alignas(64) std::atomic<int64_t> _bottom{0};
+};
+
+} // namespace starrocks
@@ -20,10 +20,12 @@
 #include <cstring>
 #include <filesystem>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "common/statusor.h"
 #include "fs/fs_util.h"
 #include "storage/options.h"
+#include "util/defer_op.h"
 
 namespace starrocks {
 
@@ -239,6 +241,50 @@ TEST_F(BlockCacheTest, write_with_overwrite_option) {
     cache->shutdown();
 }
 
+TEST_F(BlockCacheTest, write_with_frequency_admission) {
+    std::unique_ptr<BlockCache> cache(new BlockCache);
+    const size_t block_size = 1024 * 1024;
+
+    CacheOptions options;
+    options.mem_space_size = 20 * 1024 * 1024;
+    options.block_size = block_size;
+    options.max_concurrent_inserts = 100000;
+    options.max_flying_memory_mb = 100;
+    options.engine = "starcache";
+    Status status = cache->init(options);
+    ASSERT_TRUE(status.ok());
+
+    int32_t old_min_access_count = config::datacache_admission_min_access_count;
+    config::datacache_admission_min_access_count = 3;
+    DeferOp defer([&]() { config::datacache_admission_min_access_count = old_min_access_count; });
+
+    const size_t cache_size = 1024;
+    const std::string cache_key = "test_admission_file";
+    std::string value(cache_size, 'a');
+    char rvalue[cache_size] = {0};
+
+    // the first two attempts are rejected
+    for (int i = 0; i < 2; ++i) {
+        Status st = cache->write_buffer(cache_key, 0, cache_size, value.c_str());
+        ASSERT_TRUE(st.is_cancelled()) << st;
+        ASSERT_TRUE(cache->read_buffer(cache_key, 0, cache_size, rvalue).status().is_not_found());
+    }
+
+    Status st = cache->write_buffer(cache_key, 0, cache_size, value.c_str());
+    ASSERT_TRUE(st.ok()) << st;
+    auto res = cache->read_buffer(cache_key, 0, cache_size, rvalue);
+    ASSERT_TRUE(res.status().ok());
+    ASSERT_EQ(memcmp(rvalue, value.c_str(), cache_size), 0);
+
+    // overwrite bypasses the admission
+    WriteCacheOptions write_options;
+    write_options.overwrite = true;
+    st = cache->write_buffer(cache_key, block_size, cache_size, value.c_str(), &write_options);
+    ASSERT_TRUE(st.ok()) << st;
+
+    cache->shutdown();
+}
+
 TEST_F(BlockCacheTest, read_cache_with_adaptor) {
     const std::string cache_dir = "./block_disk_cache4";
     ASSERT_TRUE(fs::create_directories(cache_dir).ok());
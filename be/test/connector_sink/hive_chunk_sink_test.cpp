@@ -21,6 +21,7 @@
 #include <future>
 #include <thread>
 
+#include "common/config.h"
 #include "connector/connector_chunk_sink.h"
 #include "exec/pipeline/fragment_context.h"
 #include "formats/file_writer.h"
@@ -230,6 +231,68 @@ TEST_F(HiveChunkSinkTest, test_partitioned_sink) {
     }
 }
 
+TEST_F(HiveChunkSinkTest, test_max_open_partition_writers) {
+    auto old_limit = config::connector_sink_max_open_partition_writers;
+    config::connector_sink_max_open_partition_writers = 2;
+    DeferOp defer([&]() { config::connector_sink_max_open_partition_writers = old_limit; });
+
+    std::vector<std::string> partition_column_names = {"k1"};
+    std::vector<std::unique_ptr<ColumnEvaluator>> partition_column_evaluators =
+            ColumnSlotIdEvaluator::from_types({TypeDescriptor::from_logical_type(TYPE_VARCHAR)});
+    // writer1 is the largest when writer3 is opened, so it is committed early.
+    auto mock_file_writer1 = std::make_shared<MockFileWriter>();
+    EXPECT_CALL(*mock_file_writer1, init()).WillOnce(Return(Status::OK()));
+    EXPECT_CALL(*mock_file_writer1, get_written_bytes()).WillRepeatedly(Return(50));
+    EXPECT_CALL(*mock_file_writer1, write(_)).WillOnce(Return(ByMove(make_ready_future(Status::OK()))));
+    EXPECT_CALL(*mock_file_writer1, commit())
+            .WillOnce(Return(ByMove(make_ready_future(CommitResult{.io_status = Status::OK()}))));
+    auto mock_file_writer2 = std::make_shared<MockFileWriter>();
+    EXPECT_CALL(*mock_file_writer2, init()).WillOnce(Return(Status::OK()));
+    EXPECT_CALL(*mock_file_writer2, get_written_bytes()).WillRepeatedly(Return(10));
+    EXPECT_CALL(*mock_file_writer2, write(_)).WillOnce(Return(ByMove(make_ready_future(Status::OK()))));
+    EXPECT_CALL(*mock_file_writer2, commit())
+            .WillOnce(Return(ByMove(make_ready_future(CommitResult{.io_status = Status::OK()}))));
+    auto mock_file_writer3 = std::make_shared<MockFileWriter>();
+    EXPECT_CALL(*mock_file_writer3, init()).WillOnce(Return(Status::OK()));
+    EXPECT_CALL(*mock_file_writer3, write(_)).WillOnce(Return(ByMove(make_ready_future(Status::OK()))));
+    EXPECT_CALL(*mock_file_writer3, commit())
+            .WillOnce(Return(ByMove(make_ready_future(CommitResult{.io_status = Status::OK()}))));
+    auto mock_file_writer_factory = std::make_unique<MockFileWriterFactory>();
+    EXPECT_CALL(*mock_file_writer_factory, init()).WillOnce(Return(Status::OK()));
+    EXPECT_CALL(*mock_file_writer_factory, create(_))
+            .WillOnce(Return(ByMove(mock_file_writer1)))
+            .WillOnce(Return(ByMove(mock_file_writer2)))
+            .WillOnce(Return(ByMove(mock_file_writer3)));
+    auto location_provider = std::make_unique<LocationProvider>("base_path", "ffffff", 0, 0, "parquet");
+    auto sink = std::make_unique<HiveChunkSink>(partition_column_names, std::move(partition_column_evaluators),
+                                                std::move(location_provider), std::move(mock_file_writer_factory), 100,
+                                                _runtime_state);
+    EXPECT_OK(sink->init());
+
+    size_t num_commits = 0;
+    for (const auto& partition : {"p1", "p2", "p3"}) {
+        auto chunk = std::make_shared<Chunk>();
+        auto partition_column = BinaryColumn::create();
+        partition_column->append(partition);
+        chunk->append_column(partition_column, 0);
+        auto futures = sink->add(chunk);
+        ASSERT_TRUE(futures.ok());
+        EXPECT_EQ(futures.value().add_chunk_futures.size(), 1);
+        EXPECT_OK(futures.value().add_chunk_futures[0].get());
+        for (auto& f : futures.value().commit_file_futures) {
+            EXPECT_OK(f.get().io_status);
+            num_commits++;
+        }
+    }
+    EXPECT_EQ(num_commits, 1);
+
+    auto futures = sink->finish();
+    EXPECT_EQ(futures.commit_file_futures.size(), 2);
+    for (auto& f : futures.commit_file_futures) {
+        EXPECT_OK(f.get().io_status);
+    }
+}
+
 TEST_F(HiveChunkSinkTest, test_callback) {
     {
         std::vector<std::string> partition_column_names = {"k1"};
@@ -154,6 +154,35 @@ TEST(HashMapTest, Insert) {
     }
 }
 
+TEST(HashMapTest, Int16DirectMapped) {
+    const int chunk_size = 64;
+    using TestAggHashMapKey = Int16AggHashMapWithOneNumberKey<PhmapSeed1>;
+    RuntimeProfile profile("dummy");
+    AggStatistics statis(&profile);
+    TestAggHashMapKey key(chunk_size, &statis);
+    MemPool pool;
+
+    Columns key_columns;
+    key_columns.emplace_back(Int16Column::create());
+    std::vector<int16_t> values = {std::numeric_limits<int16_t>::min(), -1, 0, 1, std::numeric_limits<int16_t>::max()};
+    for (int i = 0; i < chunk_size; ++i) {
+        key_columns.back()->append_datum(Datum(values[i % values.size()]));
+    }
+    Buffer<AggDataPtr> agg_states(chunk_size);
+    auto allocate_func = [&pool](auto& key) { return pool.allocate(16); };
+    key.build_hash_map(chunk_size, key_columns, &pool, allocate_func, &agg_states);
+
+    ASSERT_EQ(values.size(), key.hash_map.size());
+    for (int i = 0; i < chunk_size; ++i) {
+        ASSERT_EQ(agg_states[i % values.size()], agg_states[i]);
+    }
+    std::set<int16_t> res_sets;
+    for (auto it = key.hash_map.begin(); it != key.hash_map.end(); ++it) {
+        res_sets.insert(it->first);
+    }
+    ASSERT_EQ(std::set<int16_t>(values.begin(), values.end()), res_sets);
+}
+
 TEST(HashMapTest, TwoLevelConvert) {
     std::vector<std::string> keys(1000);
     for (int i = 0; i < 1000; i++) {
@@ -175,6 +204,77 @@ TEST(HashMapTest, TwoLevelConvert) {
     }
 }
 
+TEST(HashMapTest, TwoLevelConvertVariant) {
+    RuntimeState dummy;
+    RuntimeProfile profile("dummy");
+    AggStatistics statis(&profile);
+    MemPool pool;
+    const size_t num_rows = 100;
+    Buffer<AggDataPtr> agg_states(num_rows);
+    auto allocate_func = [&pool](const auto& key) { return pool.allocate(16); };
+
+    // nullable int64 key, the null key should be kept after converting.
+    {
+        auto column = ColumnHelper::create_column(TypeDescriptor(TYPE_BIGINT), true);
+        for (size_t i = 0; i < num_rows; i++) {
+            if (i % 10 == 0) {
+                column->append_nulls(1);
+            } else {
+                column->append_datum(Datum(static_cast<int64_t>(i)));
+            }
+        }
+        Columns key_columns{column};
+
+        AggHashMapVariant variant;
+        variant.init(&dummy, AggHashMapVariant::Type::phase1_null_int64, &statis);
+        variant.visit([&](auto& hash_map_with_key) {
+            hash_map_with_key->build_hash_map(num_rows, key_columns, &pool, allocate_func, &agg_states);
+        });
+        ASSERT_EQ(variant.size(), 91);
+
+        variant.convert_to_two_level(&dummy);
+        ASSERT_EQ(variant.size(), 91);
+        variant.visit([](auto& hash_map_with_key) {
+            using HashMapWithKey = std::decay_t<decltype(*hash_map_with_key)>;
+            ASSERT_TRUE((std::is_same_v<HashMapWithKey, NullInt64TwoLevelAggHashMapWithOneNumberKey<PhmapSeed1>>));
+            ASSERT_NE(hash_map_with_key->get_null_key_data(), nullptr);
+        });
+    }
+
+    // fixed size key, the fixed byte size should be kept after converting.
+    {
+        Columns key_columns;
+        for (int k = 1; k <= 2; k++) {
+            auto column = ColumnHelper::create_column(TypeDescriptor(TYPE_INT), false);
+            for (size_t i = 0; i < num_rows; i++) {
+                column->append_datum(Datum(static_cast<int32_t>(i / k)));
+            }
+            key_columns.emplace_back(std::move(column));
+        }
+
+        AggHashMapVariant variant;
+        variant.init(&dummy, AggHashMapVariant::Type::phase2_slice_fx8, &statis);
+        variant.visit([&](auto& hash_map_with_key) {
+            if constexpr (is_combined_fixed_size_key<std::decay_t<decltype(*hash_map_with_key)>>) {
+                hash_map_with_key->has_null_column = false;
+                hash_map_with_key->fixed_byte_size = 8;
+            }
+            hash_map_with_key->build_hash_map(num_rows, key_columns, &pool, allocate_func, &agg_states);
+        });
+        ASSERT_EQ(variant.size(), num_rows);
+
+        variant.convert_to_two_level(&dummy);
+        ASSERT_EQ(variant.size(), num_rows);
+        variant.visit([](auto& hash_map_with_key) {
+            using HashMapWithKey = std::decay_t<decltype(*hash_map_with_key)>;
+            ASSERT_TRUE((std::is_same_v<HashMapWithKey, SerializedKeyFixedSize8TwoLevelAggHashMap<PhmapSeed2>>));
+            if constexpr (is_combined_fixed_size_key<HashMapWithKey>) {
+                ASSERT_EQ(hash_map_with_key->fixed_byte_size, 8);
+            }
+        });
+    }
+}
+
 class AggHashMapKeyNotFoundsTest : public ::testing::Test {
 public:
     template <typename HashMapWithKey>
@@ -464,6 +464,41 @@ TEST_F(ChunksSorterTest, topn_sort_with_limit) {
     }
 }
 
+// NOLINTNEXTLINE
+TEST_F(ChunksSorterTest, topn_filter_by_merged_segment) {
+    std::vector<bool> is_asc{true, true};
+    std::vector<bool> is_null_first{true, true};
+    std::vector<ExprContext*> sort_exprs;
+    sort_exprs.push_back(new ExprContext(_expr_nation.get()));
+    sort_exprs.push_back(new ExprContext(_expr_cust_key.get()));
+    ASSERT_OK(Expr::prepare(sort_exprs, _runtime_state.get()));
+    ASSERT_OK(Expr::open(sort_exprs, _runtime_state.get()));
+
+    std::vector<int32_t> expected{69, 70, 71, 4, 54, 16, 41, 49, 55, 56, 52, 2, 12, 24, 58};
+    for (size_t limit = 1; limit <= expected.size(); limit++) {
+        // Sort after every chunk, so that the later chunks are filtered by the merged segment
+        ChunksSorterTopn sorter(_runtime_state.get(), &sort_exprs, &is_asc, &is_null_first, "", 0, limit,
+                                TTopNType::ROW_NUMBER, 1);
+        auto pool = std::make_unique<ObjectPool>();
+        sorter.setup_runtime(_runtime_state.get(), pool->add(new RuntimeProfile("", false)),
+                             pool->add(new MemTracker(1L << 62, "", nullptr)));
+        ASSERT_OK(sorter.update(_runtime_state.get(), ChunkPtr(_chunk_1->clone_unique().release())));
+        ASSERT_OK(sorter.update(_runtime_state.get(), ChunkPtr(_chunk_2->clone_unique().release())));
+        ASSERT_OK(sorter.update(_runtime_state.get(), ChunkPtr(_chunk_3->clone_unique().release())));
+        ASSERT_OK(sorter.done(_runtime_state.get()));
+
+        ChunkPtr page = consume_page_from_sorter(sorter);
+        ASSERT_EQ(limit, page->num_rows());
+        std::vector<int32_t> result;
+        for (size_t i = 0; i < page->num_rows(); ++i) {
+            result.push_back(page->get(i).get(0).get_int32());
+        }
+        EXPECT_EQ(std::vector<int32_t>(expected.begin(), expected.begin() + limit), result);
+    }
+
+    clear_sort_exprs(sort_exprs);
+}
+
 // NOLINTNEXTLINE
 TEST_F(ChunksSorterTest, rank_topn) {
     std::vector<bool> is_asc{true};
@@ -1612,6 +1612,53 @@ TEST_F(HdfsScannerTest, TestParquetRuntimeFilter) {
     }
 }
 
+TEST_F(HdfsScannerTest, TestParquetLateRuntimeFilter) {
+    SlotDesc parquet_descs[] = {{"c1", TypeDescriptor::from_logical_type(LogicalType::TYPE_BIGINT)},
+                                {"c2", TypeDescriptor::from_logical_type(LogicalType::TYPE_BIGINT)},
+                                {"c3", TypeDescriptor::from_logical_type(LogicalType::TYPE_VARCHAR, 22)},
+                                {""}};
+
+    const std::string parquet_file = "./be/test/exec/test_data/parquet_scanner/small_row_group_data.parquet";
+
+    auto* range = _create_scan_range(parquet_file, 0, 0);
+    auto* tuple_desc = _create_tuple_desc(parquet_descs);
+    auto* param = _create_param(parquet_file, range, tuple_desc);
+
+    auto scanner = std::make_shared<HdfsParquetScanner>();
+
+    RuntimeFilterProbeCollector rf_collector;
+    RuntimeFilterProbeDescriptor rf_probe_desc;
+    ColumnRef c1ref(tuple_desc->slots()[0]);
+    ExprContext probe_expr_ctx(&c1ref);
+    ASSERT_OK(probe_expr_ctx.prepare(_runtime_state));
+    ASSERT_OK(probe_expr_ctx.open(_runtime_state));
+
+    // the runtime filter is not arrived when the scanner is opened.
+    ASSERT_OK(rf_probe_desc.init(0, &probe_expr_ctx));
+    rf_collector.add_descriptor(&rf_probe_desc);
+    param->runtime_filter_collector = &rf_collector;
+
+    ASSERT_OK(scanner->init(_runtime_state, *param));
+    ASSERT_OK(scanner->open(_runtime_state));
+
+    // c1 max is 99999, so the row groups after the current one are all skipped.
+    JoinRuntimeFilter* f = RuntimeFilterHelper::create_join_runtime_filter(&_pool, LogicalType::TYPE_BIGINT);
+    f->init(10);
+    ColumnPtr column = ColumnHelper::create_column(tuple_desc->slots()[0]->type(), false);
+    auto c = ColumnHelper::cast_to_raw<LogicalType::TYPE_BIGINT>(column);
+    c->append(10000000);
+    ASSERT_OK(RuntimeFilterHelper::fill_runtime_bloom_filter(column, LogicalType::TYPE_BIGINT, f, 0, false));
+    rf_probe_desc.set_runtime_filter(f);
+
+    Status status;
+    uint64_t records = 0;
+    READ_SCANNER_RETURN_ROWS(scanner, records);
+    EXPECT_LT(records, 100000);
+
+    scanner->close();
+    probe_expr_ctx.close(_runtime_state);
+}
+
 // =============================================================================
 
 /*
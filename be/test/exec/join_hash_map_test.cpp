@@ -19,6 +19,8 @@
 #include "runtime/descriptor_helper.h"
 #include "runtime/exec_env.h"
 #include "runtime/mem_tracker.h"
+#include "util/defer_op.h"
+#include "util/threadpool.h"
 
 namespace starrocks {
 class JoinHashMapTest : public ::testing::Test {
@@ -838,6 +840,40 @@ TEST_F(JoinHashMapTest, CalcBucketNums) {
     }
 }
 
+// NOLINTNEXTLINE
+TEST_F(JoinHashMapTest, LookupBucketHeads) {
+    JoinHashTableItems table_items;
+    HashTableProbeState probe_state;
+
+    const uint32_t row_count = 100;
+    table_items.first.resize(64);
+    for (uint32_t i = 0; i < table_items.first.size(); i++) {
+        table_items.first[i] = i + 1;
+    }
+    probe_state.buckets.resize(row_count);
+    probe_state.next.resize(row_count);
+    Buffer<uint8_t> is_nulls(row_count);
+    for (uint32_t i = 0; i < row_count; i++) {
+        probe_state.buckets[i] = (i * 7) % table_items.first.size();
+        is_nulls[i] = i % 3 == 0;
+    }
+
+    for (bool enable_prefetch : {false, true}) {
+        table_items.enable_prefetch = enable_prefetch;
+
+        probe_state.next.assign(row_count, 0);
+        JoinHashMapHelper::lookup_bucket_heads(table_items, &probe_state, row_count);
+        for (uint32_t i = 0; i < row_count; i++) {
+            ASSERT_EQ(probe_state.next[i], (i * 7) % table_items.first.size() + 1);
+        }
+
+        JoinHashMapHelper::lookup_bucket_heads(table_items, &probe_state, row_count, is_nulls.data());
+        for (uint32_t i = 0; i < row_count; i++) {
+            ASSERT_EQ(probe_state.next[i], is_nulls[i] ? 0 : (i * 7) % table_items.first.size() + 1);
+        }
+    }
+}
+
 // NOLINTNEXTLINE
 TEST_F(JoinHashMapTest, GetHashKey) {
     auto c1 = JoinHashMapTest::create_int32_column(2, 0);
@@ -1437,6 +1473,50 @@ TEST_F(JoinHashMapTest, ProbeFromHtFirstOneToOneAllMatch) {
     DO_TEST_PROBE_END()
 }
 
+// NOLINTNEXTLINE
+TEST_F(JoinHashMapTest, ProbeFromHtFirstOneToManyWithPrefetch) {
+    JoinHashTableItems table_items;
+    HashTableProbeState probe_state;
+
+    table_items.next.resize(8193);
+    table_items.join_keys.emplace_back(JoinKeyDesc{&_int_type, false, nullptr});
+    table_items.enable_prefetch = true;
+
+    prepare_probe_state(&probe_state, 2048);
+    probe_state.next.resize(config::vector_chunk_size);
+
+    Buffer<int32_t> build_data(8193);
+    Buffer<int32_t> probe_data(2048);
+
+    // Each probe row matches the two build rows i + 1 and i + 1 + 4096.
+    table_items.next[0] = 0;
+    for (size_t i = 0; i < 4096; i++) {
+        build_data[1 + i] = i;
+        build_data[1 + 4096 + i] = i;
+        table_items.next[1 + i] = 0;
+        table_items.next[1 + 4096 + i] = 1 + i;
+    }
+    for (size_t i = 0; i < 2048; i++) {
+        probe_data[i] = i;
+        probe_state.next[i] = 1 + 4096 + i;
+    }
+
+    auto join_hash_map = std::make_unique<JoinHashMapForOneKey(TYPE_INT)>(&table_items, &probe_state);
+    probe_state.probe_index.assign(4096 + 8, 0);
+    probe_state.build_index.assign(4096 + 8, 0);
+    join_hash_map->_probe_from_ht<true>(_runtime_state.get(), build_data, probe_data);
+
+    ASSERT_EQ(probe_state.match_flag, JoinMatchFlag::NORMAL);
+    ASSERT_FALSE(probe_state.has_remain);
+    ASSERT_EQ(probe_state.count, 4096);
+    for (uint32_t i = 0; i < 2048; i++) {
+        ASSERT_EQ(probe_state.probe_index[2 * i], i);
+        ASSERT_EQ(probe_state.build_index[2 * i], i + 1 + 4096);
+        ASSERT_EQ(probe_state.probe_index[2 * i + 1], i);
+        ASSERT_EQ(probe_state.build_index[2 * i + 1], i + 1);
+    }
+}
+
 // NOLINTNEXTLINE
 TEST_F(JoinHashMapTest, ProbeFromHtFirstOneToOneMostMatch) {
     JoinHashTableItems table_items;
@@ -1824,6 +1904,187 @@ TEST_F(JoinHashMapTest, OneKeyJoinHashTable) {
     check_int32_column(column5, 5, 11);
     ColumnPtr column6 = result_chunk->get_column_by_slot_id(5);
     check_int32_column(column6, 5, 21);
+    ASSERT_TRUE(hash_table.is_linear_probing());
+
+    hash_table.close();
+}
+
+// NOLINTNEXTLINE
+TEST_F(JoinHashMapTest, ParallelJoinHashTableBuilder) {
+    const uint32_t row_count = 100000;
+    Buffer<int32_t> keys(row_count + 1);
+    Buffer<uint8_t> is_nulls(row_count + 1, 0);
+    for (uint32_t i = 1; i <= row_count; i++) {
+        // Duplicated keys make the chains longer than 1.
+        keys[i] = static_cast<int32_t>(i % 30011);
+        is_nulls[i] = i % 7 == 0;
+    }
+
+    auto prepare_items = [&](JoinHashTableItems* items) {
+        items->row_count = row_count;
+        items->bucket_size = JoinHashMapHelper::calc_bucket_size(row_count + 1);
+        items->first.assign(items->bucket_size, 0);
+        items->next.assign(row_count + 1, 0);
+    };
+    auto calc_buckets = [&](uint32_t start, uint32_t count, uint32_t* buckets) {
+        const uint32_t bucket_size = JoinHashMapHelper::calc_bucket_size(row_count + 1);
+        for (uint32_t i = start; i < start + count; i++) {
+            buckets[i] = JoinHashMapHelper::calc_bucket_num<int32_t>(keys[i], bucket_size);
+        }
+    };
+
+    for (const uint8_t* nulls : {static_cast<const uint8_t*>(nullptr), is_nulls.data()}) {
+        JoinHashTableItems expected;
+        prepare_items(&expected);
+        for (uint32_t i = 1; i <= row_count; i++) {
+            if (nulls == nullptr || nulls[i] == 0) {
+                uint32_t bucket = JoinHashMapHelper::calc_bucket_num<int32_t>(keys[i], expected.bucket_size);
+                expected.next[i] = expected.first[bucket];
+                expected.first[bucket] = i;
+            }
+        }
+
+        std::unique_ptr<ThreadPool> pool;
+        ASSERT_OK(ThreadPoolBuilder("hash_join_build_test").set_max_threads(4).build(&pool));
+        for (ThreadPool* build_pool : {static_cast<ThreadPool*>(nullptr), pool.get()}) {
+            for (uint32_t dop : {1, 3, 8}) {
+                JoinHashTableItems items;
+                prepare_items(&items);
+                ParallelJoinHashTableBuilder::build(&items, calc_buckets, nulls, dop, build_pool);
+                ASSERT_EQ(expected.first, items.first);
+                ASSERT_EQ(expected.next, items.next);
+                ASSERT_EQ(dop, items.build_info.dop);
+                ASSERT_LE(items.build_info.min_partition_rows, items.build_info.max_partition_rows);
+            }
+        }
+        pool->shutdown();
+    }
+}
+
+// NOLINTNEXTLINE
+TEST_F(JoinHashMapTest, UniqueKeyBucketHelper) {
+    using Helper = UniqueKeyBucketHelper<int64_t>;
+    ASSERT_EQ(4, Helper::NUM_SLOTS);
+    ASSERT_EQ(7, UniqueKeyBucketHelper<int32_t>::NUM_SLOTS);
+
+    // Few buckets to make the probe sequences go across the buckets.
+    const uint32_t num_keys = 1000;
+    const uint32_t bucket_size = Helper::calc_bucket_size(num_keys);
+    ASSERT_EQ(0, bucket_size & (bucket_size - 1));
+    ASSERT_GE(bucket_size * Helper::NUM_SLOTS * 3, num_keys * 4);
+
+    Buffer<UniqueKeyBucket> buckets;
+    buckets.assign(bucket_size, {});
+    for (uint32_t i = 1; i <= num_keys; i++) {
+        int64_t key = static_cast<int64_t>(i) * 1000003;
+        ASSERT_TRUE(Helper::insert(buckets.data(), bucket_size, key, Helper::hash(key), i));
+    }
+    for (uint32_t i = 1; i <= num_keys; i++) {
+        int64_t key = static_cast<int64_t>(i) * 1000003;
+        ASSERT_FALSE(Helper::insert(buckets.data(), bucket_size, key, Helper::hash(key), i));
+        ASSERT_EQ(i, Helper::find(buckets.data(), bucket_size, key, Helper::hash(key)));
+        ASSERT_EQ(0, Helper::find(buckets.data(), bucket_size, key + 1, Helper::hash(key + 1)));
+    }
+    // The hash collision of different keys.
+    ASSERT_TRUE(Helper::insert(buckets.data(), bucket_size, -1, Helper::hash(1000003), num_keys + 1));
+    ASSERT_EQ(num_keys + 1, Helper::find(buckets.data(), bucket_size, -1, Helper::hash(1000003)));
+    ASSERT_EQ(1, Helper::find(buckets.data(), bucket_size, 1000003, Helper::hash(1000003)));
+}
+
+// NOLINTNEXTLINE
+TEST_F(JoinHashMapTest, OneKeyJoinHashTableWithDuplicatedKeys) {
+    TDescriptorTableBuilder row_desc_builder;
+    add_tuple_descriptor(&row_desc_builder, LogicalType::TYPE_INT, false);
+    add_tuple_descriptor(&row_desc_builder, LogicalType::TYPE_INT, false);
+
+    auto row_desc = create_row_desc(&row_desc_builder, false);
+    auto probe_row_desc = create_probe_desc(&row_desc_builder, false);
+    auto build_row_desc = create_build_desc(&row_desc_builder, false);
+
+    HashTableParam param = create_table_param(TJoinOp::INNER_JOIN, 6);
+    param.row_desc = row_desc.get();
+    param.join_keys.emplace_back(JoinKeyDesc{&_int_type, false, nullptr});
+    param.probe_row_desc = probe_row_desc.get();
+    param.build_row_desc = build_row_desc.get();
+
+    JoinHashTable hash_table;
+    hash_table.create(param);
+
+    // Every key of the build side appears twice.
+    for (int i = 0; i < 2; i++) {
+        auto build_chunk = create_int32_build_chunk(10, false);
+        Columns build_keys_column{build_chunk->columns()[0]};
+        hash_table.append_chunk(build_chunk, build_keys_column);
+    }
+    ASSERT_OK(hash_table.build(_runtime_state.get()));
+    ASSERT_FALSE(hash_table.is_linear_probing());
+
+    auto probe_chunk = create_int32_probe_chunk(5, 1, false);
+    Columns probe_key_columns{probe_chunk->columns()[0]};
+    ChunkPtr result_chunk = std::make_shared<Chunk>();
+    bool eos = false;
+    ASSERT_OK(hash_table.probe(_runtime_state.get(), probe_key_columns, &probe_chunk, &result_chunk, &eos));
+    ASSERT_EQ(10, result_chunk->num_rows());
+
+    hash_table.close();
+}
+
+// NOLINTNEXTLINE
+TEST_F(JoinHashMapTest, RadixPartitionedJoinHashTable) {
+    auto old_enable = config::enable_hash_join_radix_partition;
+    auto old_min_ht_bytes = config::hash_join_radix_partition_min_ht_bytes;
+    auto old_partition_bytes = config::hash_join_radix_partition_bytes;
+    config::enable_hash_join_radix_partition = true;
+    config::hash_join_radix_partition_min_ht_bytes = 0;
+    // Each partition has only one bucket.
+    config::hash_join_radix_partition_bytes = 1;
+    DeferOp defer([&]() {
+        config::enable_hash_join_radix_partition = old_enable;
+        config::hash_join_radix_partition_min_ht_bytes = old_min_ht_bytes;
+        config::hash_join_radix_partition_bytes = old_partition_bytes;
+    });
+
+    TDescriptorTableBuilder row_desc_builder;
+    add_tuple_descriptor(&row_desc_builder, LogicalType::TYPE_INT, false);
+    add_tuple_descriptor(&row_desc_builder, LogicalType::TYPE_INT, false);
+
+    auto row_desc = create_row_desc(&row_desc_builder, false);
+    auto probe_row_desc = create_probe_desc(&row_desc_builder, false);
+    auto build_row_desc = create_build_desc(&row_desc_builder, false);
+
+    HashTableParam param = create_table_param(TJoinOp::INNER_JOIN, 6);
+    param.row_desc = row_desc.get();
+    param.join_keys.emplace_back(JoinKeyDesc{&_int_type, false, nullptr});
+    param.probe_row_desc = probe_row_desc.get();
+    param.build_row_desc = build_row_desc.get();
+
+    JoinHashTable hash_table;
+    hash_table.create(param);
+
+    // The duplicated keys make the chains longer than 1.
+    for (int i = 0; i < 2; i++) {
+        auto build_chunk = create_int32_build_chunk(10, false);
+        Columns build_keys_column{build_chunk->columns()[0]};
+        hash_table.append_chunk(build_chunk, build_keys_column);
+    }
+    ASSERT_OK(hash_table.build(_runtime_state.get()));
+    ASSERT_EQ(hash_table.get_bucket_size(), hash_table.radix_partitions());
+
+    auto probe_chunk = create_int32_probe_chunk(5, 1, false);
+    Columns probe_key_columns{probe_chunk->columns()[0]};
+    ChunkPtr result_chunk = std::make_shared<Chunk>();
+    bool eos = false;
+    ASSERT_OK(hash_table.probe(_runtime_state.get(), probe_key_columns, &probe_chunk, &result_chunk, &eos));
+    ASSERT_EQ(10, result_chunk->num_rows());
+
+    // The build columns are permuted along with the keys.
+    ColumnPtr probe_keys = result_chunk->get_column_by_slot_id(0);
+    ColumnPtr build_keys = result_chunk->get_column_by_slot_id(3);
+    ColumnPtr build_values = result_chunk->get_column_by_slot_id(4);
+    for (size_t i = 0; i < result_chunk->num_rows(); i++) {
+        ASSERT_EQ(probe_keys->get(i).get_int32(), build_keys->get(i).get_int32());
+        ASSERT_EQ(build_keys->get(i).get_int32() + 10, build_values->get(i).get_int32());
+    }
 
     hash_table.close();
 }
@@ -0,0 +1,52 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/scan/chunk_buffer_limiter.h"
+
+#include <gtest/gtest.h>
+
+namespace starrocks::pipeline {
+
+TEST(DynamicChunkBufferLimiterTest, test_capacity_follows_mem_limit) {
+    // 100 bytes per row and 1000 rows per chunk, so each chunk takes 100KB.
+    DynamicChunkBufferLimiter limiter(64, 8, 1000 * 1000, 1000);
+    ASSERT_EQ(8, limiter.capacity());
+
+    limiter.update_avg_row_bytes(100 * 1000, 1000, 1000);
+    ASSERT_EQ(10, limiter.capacity());
+
+    // the new limit applies at once, without waiting for more rows.
+    limiter.update_mem_limit(300 * 1000);
+    ASSERT_EQ(3, limiter.capacity());
+    limiter.update_mem_limit(100 * 1000 * 1000);
+    ASSERT_EQ(64, limiter.capacity());
+    limiter.update_mem_limit(0);
+    ASSERT_EQ(1, limiter.capacity());
+}
+
+TEST(DynamicChunkBufferLimiterTest, test_mem_limit_before_stats) {
+    DynamicChunkBufferLimiter limiter(64, 8, 1000 * 1000, 1000);
+    // there is no row size yet, the default capacity is kept.
+    limiter.update_mem_limit(100);
+    ASSERT_EQ(8, limiter.capacity());
+
+    auto token = limiter.pin(8);
+    ASSERT_NE(nullptr, token);
+    ASSERT_TRUE(limiter.is_full());
+    ASSERT_EQ(nullptr, limiter.pin(1));
+    token.reset();
+    ASSERT_FALSE(limiter.is_full());
+}
+
+} // namespace starrocks::pipeline
@@ -0,0 +1,94 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "common/config.h"
+#include "exec/pipeline/exchange/local_exchange.h"
+
+namespace starrocks::pipeline {
+
+class HotKeyDetectorTest : public ::testing::Test {
+public:
+    void SetUp() override { _old_ratio = config::local_exchange_hot_key_ratio; }
+    void TearDown() override { config::local_exchange_hot_key_ratio = _old_ratio; }
+
+private:
+    double _old_ratio = 0;
+};
+
+TEST_F(HotKeyDetectorTest, test_detect) {
+    config::local_exchange_hot_key_ratio = 0.1;
+    HotKeyDetector detector;
+
+    // Not enough sampled rows.
+    detector.add(1, 100);
+    detector.try_detect(8);
+    ASSERT_FALSE(detector.has_hot_keys());
+
+    // Key 1 takes 50% and key 2 takes 10%, which is less than the share of two drivers.
+    detector.add(1, 2000);
+    detector.add(2, 410);
+    for (uint32_t key = 100; key < 100 + 1586; ++key) {
+        detector.add(key, 1);
+    }
+    detector.try_detect(8);
+    ASSERT_TRUE(detector.is_hot(1));
+    ASSERT_FALSE(detector.is_hot(2));
+    ASSERT_FALSE(detector.is_hot(100));
+    ASSERT_EQ(1, detector.max_num_hot_keys());
+
+    // Key 1 is not hot in the next window.
+    for (uint32_t key = 0; key < 4096; ++key) {
+        detector.add(key, 1);
+    }
+    detector.try_detect(8);
+    ASSERT_FALSE(detector.has_hot_keys());
+    ASSERT_EQ(1, detector.max_num_hot_keys());
+}
+
+TEST_F(HotKeyDetectorTest, test_disabled) {
+    config::local_exchange_hot_key_ratio = 0;
+    HotKeyDetector detector;
+    detector.add(1, 8192);
+    detector.try_detect(8);
+    ASSERT_FALSE(detector.has_hot_keys());
+
+    // No hot key for a single driver.
+    config::local_exchange_hot_key_ratio = 0.1;
+    detector.add(1, 8192);
+    detector.try_detect(1);
+    ASSERT_FALSE(detector.has_hot_keys());
+}
+
+TEST_F(HotKeyDetectorTest, test_distribution_profile) {
+    config::local_exchange_hot_key_ratio = 0.1;
+    PartitionDistribution distribution;
+    distribution.partition_rows.resize(3, 0);
+    distribution.add_rows(0, 10);
+    distribution.add_rows(2, 5);
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_EQ(i % 3, distribution.next_split_partition(3));
+    }
+    distribution.num_split_rows = 4;
+
+    RuntimeProfile profile("LocalExchangeSink");
+    distribution.update_profile(&profile);
+    ASSERT_EQ("[10,0,5]", *profile.get_info_string("PartitionRowDistribution"));
+    ASSERT_EQ(10, profile.get_counter("PartitionRowsMax")->value());
+    ASSERT_EQ(0, profile.get_counter("PartitionRowsMin")->value());
+    ASSERT_EQ(4, profile.get_counter("HotKeySplitRows")->value());
+}
+
+} // namespace starrocks::pipeline
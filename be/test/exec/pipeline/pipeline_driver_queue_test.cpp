@@ -165,6 +165,194 @@ PARALLEL_TEST(QuerySharedDriverQueueTest, test_take_close) {
     consumer_thread->join();
 }
 
+PARALLEL_TEST(NumaAwareDriverQueueTest, test_take_local_first) {
+    NumaAwareDriverQueue queue(2);
+    ASSERT_EQ(2, queue.num_nodes());
+
+    QueryContext query_context;
+    auto driver01 = std::make_shared<PipelineDriver>(_gen_operators(), &query_context, nullptr, nullptr, -1);
+    driver01->set_numa_node(0);
+    auto driver11 = std::make_shared<PipelineDriver>(_gen_operators(), &query_context, nullptr, nullptr, -1);
+    driver11->set_numa_node(1);
+    auto driver12 = std::make_shared<PipelineDriver>(_gen_operators(), &query_context, nullptr, nullptr, -1);
+    driver12->set_numa_node(1);
+
+    queue.put_back(driver01.get());
+    queue.put_back(driver11.get());
+    queue.put_back(driver12.get());
+    ASSERT_EQ(3, queue.size());
+    ASSERT_EQ(1, queue.size_of_node(0));
+    ASSERT_EQ(2, queue.size_of_node(1));
+
+    // The drivers of the local node are taken first, and then the drivers of the other nodes are stolen.
+    NumaAwareDriverQueue::set_current_numa_node(1);
+    const int64_t num_steals = NumaAwareDriverQueue::num_steals_of_node(1);
+    std::vector<DriverRawPtr> out_drivers = {driver11.get(), driver12.get(), driver01.get()};
+    for (auto* out_driver : out_drivers) {
+        auto maybe_driver = queue.take(false);
+        ASSERT_TRUE(maybe_driver.ok());
+        ASSERT_EQ(out_driver, maybe_driver.value());
+    }
+    ASSERT_EQ(num_steals + 1, NumaAwareDriverQueue::num_steals_of_node(1));
+    // The home node isn't changed by stealing.
+    ASSERT_EQ(0, driver01->numa_node());
+
+    auto maybe_driver = queue.take(false);
+    ASSERT_TRUE(maybe_driver.ok());
+    ASSERT_EQ(nullptr, maybe_driver.value());
+    NumaAwareDriverQueue::set_current_numa_node(-1);
+}
+
+PARALLEL_TEST(NumaAwareDriverQueueTest, test_assign_home_node) {
+    NumaAwareDriverQueue queue(2);
+
+    QueryContext query_context;
+    auto driver1 = std::make_shared<PipelineDriver>(_gen_operators(), &query_context, nullptr, nullptr, -1);
+    auto driver2 = std::make_shared<PipelineDriver>(_gen_operators(), &query_context, nullptr, nullptr, -1);
+    auto driver3 = std::make_shared<PipelineDriver>(_gen_operators(), &query_context, nullptr, nullptr, -1);
+
+    // The thread isn't pinned to any node, so the home nodes are assigned in round-robin order.
+    queue.put_back(std::vector<DriverRawPtr>{driver1.get(), driver2.get()});
+    ASSERT_EQ(0, driver1->numa_node());
+    ASSERT_EQ(1, driver2->numa_node());
+
+    // The home node is the node of the current thread.
+    NumaAwareDriverQueue::set_current_numa_node(1);
+    queue.put_back(driver3.get());
+    ASSERT_EQ(1, driver3->numa_node());
+    NumaAwareDriverQueue::set_current_numa_node(-1);
+
+    ASSERT_EQ(1, queue.size_of_node(0));
+    ASSERT_EQ(2, queue.size_of_node(1));
+}
+
+PARALLEL_TEST(NumaAwareDriverQueueTest, test_take_block) {
+    NumaAwareDriverQueue queue(2);
+
+    QueryContext query_context;
+    auto driver1 = std::make_shared<PipelineDriver>(_gen_operators(), &query_context, nullptr, nullptr, -1);
+    driver1->set_numa_node(1);
+
+    auto consumer_thread = std::make_shared<std::thread>([&queue, &driver1] {
+        NumaAwareDriverQueue::set_current_numa_node(0);
+        auto maybe_driver = queue.take(true);
+        ASSERT_TRUE(maybe_driver.ok());
+        ASSERT_EQ(driver1.get(), maybe_driver.value());
+    });
+
+    sleep(1);
+    queue.put_back(driver1.get());
+
+    consumer_thread->join();
+}
+
+PARALLEL_TEST(NumaAwareDriverQueueTest, test_take_close) {
+    NumaAwareDriverQueue queue(2);
+
+    auto consumer_thread = std::make_shared<std::thread>([&queue] {
+        auto maybe_driver = queue.take(true);
+        ASSERT_TRUE(maybe_driver.status().is_cancelled());
+    });
+
+    sleep(1);
+    queue.close();
+
+    consumer_thread->join();
+}
+
+PARALLEL_TEST(WorkStealingDriverQueueTest, test_local_queue) {
+    WorkStealingDriverQueue queue(std::make_unique<QuerySharedDriverQueue>(), 2, 4);
+
+    QueryContext query_context;
+    auto driver1 = std::make_shared<PipelineDriver>(_gen_operators(), &query_context, nullptr, nullptr, -1);
+    auto driver2 = std::make_shared<PipelineDriver>(_gen_operators(), &query_context, nullptr, nullptr, -1);
+    auto driver3 = std::make_shared<PipelineDriver>(_gen_operators(), &query_context, nullptr, nullptr, -1);
+
+    queue.bind_executor_thread();
+
+    // The driver from the executor thread is put back to the local queue, the others to the global queue.
+    queue.put_back(driver1.get());
+    queue.put_back_from_executor(driver2.get());
+    queue.put_back_from_executor(driver3.get());
+    ASSERT_EQ(3, queue.size());
+    ASSERT_TRUE(driver1->is_in_ready_queue());
+    ASSERT_FALSE(driver2->is_in_ready_queue());
+
+    // The local queue is taken first in FIFO order.
+    std::vector<DriverRawPtr> out_drivers = {driver2.get(), driver3.get(), driver1.get()};
+    for (auto* out_driver : out_drivers) {
+        auto maybe_driver = queue.take(false);
+        ASSERT_TRUE(maybe_driver.ok());
+        ASSERT_EQ(out_driver, maybe_driver.value());
+    }
+    ASSERT_EQ(2, queue.num_local_takes());
+    ASSERT_EQ(0, queue.size());
+
+    queue.unbind_executor_thread();
+}
+
+PARALLEL_TEST(WorkStealingDriverQueueTest, test_steal) {
+    WorkStealingDriverQueue queue(std::make_unique<QuerySharedDriverQueue>(), 2, 4);
+
+    QueryContext query_context;
+    auto driver1 = std::make_shared<PipelineDriver>(_gen_operators(), &query_context, nullptr, nullptr, -1);
+
+    queue.bind_executor_thread();
+    queue.put_back_from_executor(driver1.get());
+
+    // Another executor thread steals the driver from the local queue of this thread.
+    auto thief_thread = std::make_shared<std::thread>([&queue, &driver1] {
+        queue.bind_executor_thread();
+        auto maybe_driver = queue.take(false);
+        ASSERT_TRUE(maybe_driver.ok());
+        ASSERT_EQ(driver1.get(), maybe_driver.value());
+        queue.unbind_executor_thread();
+    });
+    thief_thread->join();
+    ASSERT_EQ(1, queue.num_steals());
+    ASSERT_EQ(0, queue.size());
+
+    queue.unbind_executor_thread();
+}
+
+PARALLEL_TEST(WorkStealingDriverQueueTest, test_unbind_and_overflow) {
+    WorkStealingDriverQueue queue(std::make_unique<QuerySharedDriverQueue>(), 1, 1);
+
+    QueryContext query_context;
+    auto driver1 = std::make_shared<PipelineDriver>(_gen_operators(), &query_context, nullptr, nullptr, -1);
+    auto driver2 = std::make_shared<PipelineDriver>(_gen_operators(), &query_context, nullptr, nullptr, -1);
+
+    queue.bind_executor_thread();
+    queue.put_back_from_executor(driver1.get());
+    // The local queue is full, so the driver is put back to the global queue.
+    queue.put_back_from_executor(driver2.get());
+    ASSERT_FALSE(driver1->is_in_ready_queue());
+    ASSERT_TRUE(driver2->is_in_ready_queue());
+
+    // The remaining drivers in the local queue are moved to the global queue.
+    queue.unbind_executor_thread();
+    ASSERT_TRUE(driver1->is_in_ready_queue());
+    ASSERT_EQ(2, queue.size());
+
+    std::vector<DriverRawPtr> out_drivers = {driver2.get(), driver1.get()};
+    for (auto* out_driver : out_drivers) {
+        auto maybe_driver = queue.take(true);
+        ASSERT_TRUE(maybe_driver.ok());
+        ASSERT_EQ(out_driver, maybe_driver.value());
+    }
+
+    // All the local queues are in use, so the other thread works without a local queue.
+    queue.bind_executor_thread();
+    auto other_thread = std::make_shared<std::thread>([&queue, &driver1] {
+        queue.bind_executor_thread();
+        queue.put_back_from_executor(driver1.get());
+        ASSERT_TRUE(driver1->is_in_ready_queue());
+        queue.unbind_executor_thread();
+    });
+    other_thread->join();
+    queue.unbind_executor_thread();
+}
+
 class WorkGroupDriverQueueTest : public ::testing::Test {
 public:
     void SetUp() override {
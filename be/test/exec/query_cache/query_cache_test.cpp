@@ -117,10 +117,13 @@ TEST_F(QueryCacheTest, testCacheManager) {
     }
 
     ASSERT_EQ(cache_mgr->memory_usage(), 960);
+    ASSERT_EQ(cache_mgr->populate_count(), 10);
+    ASSERT_EQ(cache_mgr->populate_bytes(), 960);
     for (auto i = 0; i < 10; ++i) {
         auto status = cache_mgr->probe(strings::Substitute("key_$0", i));
         ASSERT_TRUE(status.ok());
     }
+    ASSERT_EQ(cache_mgr->hit_bytes(), 960);
 
     ASSERT_EQ(cache_mgr->memory_usage(), 960);
     for (auto i = 10; i < 20; ++i) {
@@ -128,6 +131,7 @@ TEST_F(QueryCacheTest, testCacheManager) {
         ASSERT_FALSE(status.ok());
     }
     ASSERT_EQ(cache_mgr->memory_usage(), 960);
+    ASSERT_EQ(cache_mgr->hit_bytes(), 960);
 
     for (auto i = 20; i < 30; ++i) {
         cache_mgr->populate(strings::Substitute("key_$0", i), create_cache_value(100));
@@ -233,6 +233,36 @@ TEST(SortingTest, materialize_by_permutation_binary) {
     ASSERT_EQ("rock", merged->get(1).get_slice());
 }
 
+TEST(SortingTest, sort_binary_column_with_shared_prefix) {
+    std::vector<std::string> values = {"starrocks",  "star",       std::string("star\0", 5), "",
+                                       "starrocks1", "starrock",   "starrocks",               "\xff",
+                                       "abc",        "abcdefghij", "abcdefghi",               "abcdefgh"};
+    ColumnPtr column = BinaryColumn::create();
+    for (const auto& value : values) {
+        down_cast<BinaryColumn*>(column.get())->append(Slice(value));
+    }
+
+    for (bool asc : {true, false}) {
+        SmallPermutation permutation = create_small_permutation(values.size());
+        Tie tie(values.size(), 1);
+        std::pair<int, int> range{0, static_cast<int>(values.size())};
+        ASSERT_OK(sort_and_tie_column(false, column, SortDesc(asc, true), permutation, tie, range, true));
+
+        std::vector<std::string> expected = values;
+        if (asc) {
+            std::sort(expected.begin(), expected.end());
+        } else {
+            std::sort(expected.begin(), expected.end(), std::greater<>());
+        }
+        for (size_t i = 0; i < values.size(); i++) {
+            ASSERT_EQ(expected[i], values[permutation[i].index_in_chunk]) << "asc=" << asc << " i=" << i;
+            if (i > 0) {
+                ASSERT_EQ(expected[i] == expected[i - 1], tie[i] == 1) << "asc=" << asc << " i=" << i;
+            }
+        }
+    }
+}
+
 TEST(SortingTest, materialize_by_permutation_int) {
     Int32Column::Ptr input1 = Int32Column::create();
     Int32Column::Ptr input2 = Int32Column::create();
@@ -291,6 +321,74 @@ TEST(SortingTest, sorted_runs) {
     ASSERT_EQ(99, slice->num_rows());
 }
 
+static Columns build_random_columns(size_t num_rows, uint32_t seed) {
+    std::default_random_engine e(seed);
+    std::uniform_int_distribution<int32_t> small(-3, 3);
+    Columns columns;
+    // nullable int with a few values, not null bigint with a few values, nullable int
+    columns.push_back(ColumnHelper::create_column(TypeDescriptor(TYPE_INT), true));
+    columns.push_back(ColumnHelper::create_column(TypeDescriptor(TYPE_BIGINT), false));
+    columns.push_back(ColumnHelper::create_column(TypeDescriptor(TYPE_INT), true));
+    for (size_t i = 0; i < num_rows; i++) {
+        int32_t v = small(e);
+        if (v == 0) {
+            columns[0]->append_nulls(1);
+        } else {
+            columns[0]->append_datum(Datum(v * 1000000));
+        }
+        columns[1]->append_datum(Datum((int64_t)small(e) * (1L << 40)));
+        v = small(e);
+        if (v == 0) {
+            columns[2]->append_nulls(1);
+        } else {
+            columns[2]->append_datum(Datum(v));
+        }
+    }
+    return columns;
+}
+
+TEST(SortingTest, sort_by_normalized_key) {
+    std::atomic<bool> cancel{false};
+    std::vector<std::pair<std::vector<bool>, std::vector<bool>>> descs = {
+            {{true, true, true}, {true, true, true}},
+            {{false, true, false}, {true, false, false}},
+            {{false, false, false}, {false, false, true}},
+    };
+    for (auto& [asc, null_first] : descs) {
+        SortDescs sort_desc(asc, null_first);
+        Columns columns = build_random_columns(1000, 1);
+
+        Permutation expected;
+        ASSERT_OK(sort_and_tie_columns(cancel, columns, sort_desc, &expected, false));
+        Permutation actual;
+        ASSERT_OK(sort_and_tie_columns(cancel, columns, sort_desc, &actual, true));
+        ASSERT_EQ(expected.size(), actual.size());
+        for (size_t i = 0; i < expected.size(); i++) {
+            ASSERT_EQ(0, compare_chunk_row(sort_desc, columns, columns, expected[i].index_in_chunk,
+                                           actual[i].index_in_chunk));
+        }
+
+        // vertical chunks with limit
+        std::vector<Columns> vertical_chunks = {build_random_columns(500, 2), build_random_columns(500, 3)};
+        Permutation perm;
+        for (uint32_t chunk = 0; chunk < vertical_chunks.size(); chunk++) {
+            for (uint32_t row = 0; row < vertical_chunks[chunk][0]->size(); row++) {
+                perm.emplace_back(chunk, row);
+            }
+        }
+        Permutation expected_perm = perm;
+        ASSERT_OK(sort_vertical_chunks(cancel, vertical_chunks, sort_desc, expected_perm, 100, false, false));
+        Permutation actual_perm = perm;
+        ASSERT_OK(sort_vertical_chunks(cancel, vertical_chunks, sort_desc, actual_perm, 100, false, true));
+        ASSERT_EQ(expected_perm.size(), actual_perm.size());
+        for (size_t i = 0; i < expected_perm.size(); i++) {
+            ASSERT_EQ(0, compare_chunk_row(sort_desc, vertical_chunks[expected_perm[i].chunk_index],
+                                           vertical_chunks[actual_perm[i].chunk_index], expected_perm[i].index_in_chunk,
+                                           actual_perm[i].index_in_chunk));
+        }
+    }
+}
+
 TEST(SortingTest, merge_sorted_chunks) {
     auto runtime_state = create_runtime_state();
     std::vector<ChunkUniquePtr> input_chunks;
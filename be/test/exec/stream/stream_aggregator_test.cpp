@@ -661,6 +661,32 @@ TEST_F(MinMaxCountStreamAggregateTestWithRetract, TestWihRetracts_MultiRun2) {
     _stream_aggregator->close(_runtime_state);
 }
 
+TEST_F(MinMaxCountStreamAggregateTestWithRetract, TestWihRetracts_DuplicateValueInEpoch) {
+    DCHECK_IF_ERROR(_stream_aggregator->prepare(_runtime_state, &_obj_pool, _runtime_profile));
+    DCHECK_IF_ERROR(_stream_aggregator->open(_runtime_state));
+
+    // Run 1
+    // Input:
+    // key  value
+    // 1    +2
+    // 1    +2
+    // 1    -2
+    // key  min max count op
+    // 1    2   2   1   0
+    RunBatchAndCheck(1, StreamRowData<int64_t>{{{1, 1, 1}, {2, 2, 2}}, {0, 0, 1}},
+                     StreamRowData<int64_t>{{{1}, {2}, {2}, {1}}, {0}});
+    // Run 2
+    // Input:
+    // key  value
+    // 1    +3
+    // key  min max count op
+    // 1    2   2   1   UPDATE_BEFORE
+    // 1    2   3   2   UPDATE_AFTER
+    RunBatchAndCheck(2, StreamRowData<int64_t>{{{1}, {3}}, {0}},
+                     StreamRowData<int64_t>{{{1, 1}, {2, 2}, {2, 3}, {1, 2}}, {2, 3}});
+    _stream_aggregator->close(_runtime_state);
+}
+
 ///////////////  All Aggregate Functions ///////////////
 class AllStreamAggregateFunctionsTestBase : public StreamAggregateTestBase {
 public:
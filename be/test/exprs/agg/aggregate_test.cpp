@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <optional>
 
 #include "column/array_column.h"
 #include "column/column_builder.h"
@@ -1127,6 +1128,57 @@ TEST_F(AggregateTest, test_window_funnel) {
     ASSERT_EQ(2, result_column->get_data()[0]);
 }
 
+TEST_F(AggregateTest, test_window_funnel_serialize_and_merge) {
+    std::vector<FunctionContext::TypeDesc> arg_types = {
+            AnyValUtil::column_type_to_type_desc(TypeDescriptor::from_logical_type(TYPE_BIGINT)),
+            AnyValUtil::column_type_to_type_desc(TypeDescriptor::from_logical_type(TYPE_DATETIME)),
+            AnyValUtil::column_type_to_type_desc(TypeDescriptor::from_logical_type(TYPE_INT)),
+            AnyValUtil::column_type_to_type_desc(TypeDescriptor::from_logical_type(TYPE_ARRAY))};
+    auto return_type = AnyValUtil::column_type_to_type_desc(TypeDescriptor::from_logical_type(TYPE_INT));
+    std::unique_ptr<FunctionContext> local_ctx(FunctionContext::create_test_context(std::move(arg_types), return_type));
+    const AggregateFunction* func = get_aggregate_function("window_funnel", TYPE_DATETIME, TYPE_INT, false);
+
+    // events: [false, true, false] at 12:30:50, [true, false, null] at 12:30:30, [false, false, true] at 12:31:00
+    ColumnBuilder<TYPE_BOOLEAN> builder(config::vector_chunk_size);
+    for (bool v : {false, true, false, true, false, false, false, false, true}) {
+        builder.append(v);
+    }
+    auto null_col = NullColumn::create(9, 0);
+    null_col->get_data()[5] = 1;
+    auto events = ArrayColumn::create(NullableColumn::create(builder.build(false), std::move(null_col)),
+                                      UInt32Column::create());
+    events->offsets_column()->append(0);
+    events->offsets_column()->append(3);
+    events->offsets_column()->append(6);
+    events->offsets_column()->append(9);
+
+    auto timestamps = TimestampColumn::create();
+    timestamps->append(TimestampValue::create(2022, 6, 10, 12, 30, 50));
+    timestamps->append(TimestampValue::create(2022, 6, 10, 12, 30, 30));
+    timestamps->append(TimestampValue::create(2022, 6, 10, 12, 31, 0));
+
+    Columns src{ColumnHelper::create_const_column<TYPE_BIGINT>(1800, 3), timestamps,
+                ColumnHelper::create_const_column<TYPE_INT>(0, 3), events};
+    ColumnPtr serialized = ArrayColumn::create(NullableColumn::create(Int64Column::create(), NullColumn::create()),
+                                               UInt32Column::create());
+    down_cast<ArrayColumn*>(serialized.get())->offsets_column()->append(0);
+    func->convert_to_serialize_format(local_ctx.get(), src, 3, &serialized);
+    ASSERT_EQ(3, serialized->size());
+
+    // merge mode: [SlotRef(ARRAY<BIGINT>), IntLiteral(BIGINT), IntLiteral(INT)]
+    Columns const_columns{nullptr, ColumnHelper::create_const_column<TYPE_BIGINT>(1800, 1),
+                          ColumnHelper::create_const_column<TYPE_INT>(0, 1)};
+    local_ctx->set_constant_columns(const_columns);
+
+    auto state = ManagedAggrState::create(ctx, func);
+    for (size_t i = 0; i < serialized->size(); i++) {
+        func->merge(local_ctx.get(), serialized.get(), state->state(), i);
+    }
+    auto result_column = Int32Column::create();
+    func->finalize_to_column(local_ctx.get(), state->state(), result_column.get());
+    ASSERT_EQ(3, result_column->get_data()[0]);
+}
+
 TEST_F(AggregateTest, test_dict_merge) {
     const AggregateFunction* func = get_aggregate_function("dict_merge", TYPE_ARRAY, TYPE_VARCHAR, false);
     ColumnBuilder<TYPE_VARCHAR> builder(config::vector_chunk_size);
@@ -1235,6 +1287,103 @@ TEST_F(AggregateTest, test_sum_nullable) {
     ASSERT_EQ(4950, result_data.get_data()[0]);
 }
 
+TEST_F(AggregateTest, test_sum_nullable_update_batch) {
+    using NullableSumInt64 = NullableAggregateFunctionState<SumAggregateState<int64_t>, false>;
+    const AggregateFunction* sum_null = get_aggregate_function("sum", TYPE_INT, TYPE_BIGINT, true);
+    std::vector<std::unique_ptr<ManagedAggrState>> managed_states;
+    for (int i = 0; i < 3; i++) {
+        managed_states.emplace_back(ManagedAggrState::create(ctx, sum_null));
+    }
+
+    // group i % 3, and all rows of group 2 are null
+    auto data_column = Int32Column::create();
+    auto null_column = NullColumn::create();
+    std::vector<AggDataPtr> states;
+    int64_t expected[2] = {0, 0};
+    for (int i = 0; i < 100; i++) {
+        data_column->append(i);
+        null_column->append(i % 3 == 2 ? 1 : 0);
+        states.push_back(managed_states[i % 3]->state());
+        if (i % 3 != 2) {
+            expected[i % 3] += i;
+        }
+    }
+    auto column = NullableColumn::create(std::move(data_column), std::move(null_column));
+    const Column* row_column = column.get();
+
+    sum_null->update_batch(ctx, column->size(), 0, &row_column, states.data());
+    for (int i = 0; i < 2; i++) {
+        auto* null_state = (NullableSumInt64*)managed_states[i]->state();
+        ASSERT_FALSE(null_state->is_null);
+        ASSERT_EQ(expected[i], *reinterpret_cast<const int64_t*>(null_state->nested_state()));
+    }
+    ASSERT_TRUE(((NullableSumInt64*)managed_states[2]->state())->is_null);
+
+    // all not null
+    auto column2 = NullableColumn::create(Int32Column::create(), NullColumn::create());
+    int64_t expected2 = 0;
+    for (int i = 0; i < 100; i++) {
+        column2->append_datum(Datum(i));
+        if (i % 3 == 2) {
+            expected2 += i;
+        }
+    }
+    const Column* row_column2 = column2.get();
+    sum_null->update_batch(ctx, column2->size(), 0, &row_column2, states.data());
+    auto* null_state = (NullableSumInt64*)managed_states[2]->state();
+    ASSERT_FALSE(null_state->is_null);
+    ASSERT_EQ(expected2, *reinterpret_cast<const int64_t*>(null_state->nested_state()));
+}
+
+TEST_F(AggregateTest, test_max_min_removable_cumulatively) {
+    // rows between 2 preceding and 1 following, every 5th row is null and values go up and down
+    constexpr int64_t kNumRows = 64;
+    constexpr int64_t kStartOffset = -2;
+    constexpr int64_t kEndOffset = 1;
+    auto column = NullableColumn::create(Int32Column::create(), NullColumn::create());
+    for (int i = 0; i < kNumRows; i++) {
+        if (i % 5 == 0) {
+            column->append_nulls(1);
+        } else {
+            column->append_datum(Datum((i * 37) % 17 - 8));
+        }
+    }
+    const Column* row_column = column.get();
+
+    using NullableIntState = NullableAggregateFunctionState<MaxAggregateData<TYPE_INT>, true>;
+    for (const std::string name : {"max", "min"}) {
+        const AggregateFunction* func = get_window_function(name, TYPE_INT, TYPE_INT, true);
+        ASSERT_TRUE(func->is_removable_by_reevaluation());
+        auto state = ManagedAggrState::create(ctx, func);
+        for (int64_t row = 0; row < kNumRows; row++) {
+            func->update_state_removable_cumulatively(ctx, state->state(), &row_column, row, 0, kNumRows,
+                                                      kStartOffset, kEndOffset, false, false);
+
+            std::optional<int32_t> expected;
+            for (int64_t i = std::max<int64_t>(0, row + kStartOffset); i <= std::min(kNumRows - 1, row + kEndOffset);
+                 i++) {
+                if (column->is_null(i)) {
+                    continue;
+                }
+                int32_t value = column->get(i).get_int32();
+                if (!expected) {
+                    expected = value;
+                } else {
+                    expected = name == "max" ? std::max(*expected, value) : std::min(*expected, value);
+                }
+            }
+
+            // MaxAggregateData and MinAggregateData of TYPE_INT share the same layout
+            auto* null_state = reinterpret_cast<NullableIntState*>(state->state());
+            ASSERT_EQ(!expected.has_value(), null_state->is_null) << name << " at row " << row;
+            if (expected) {
+                ASSERT_EQ(*expected, *reinterpret_cast<const int32_t*>(null_state->nested_state()))
+                        << name << " at row " << row;
+            }
+        }
+    }
+}
+
 TEST_F(AggregateTest, test_count_nullable) {
     const AggregateFunction* func = get_aggregate_function("count", TYPE_BIGINT, TYPE_BIGINT, true);
     auto state = ManagedAggrState::create(ctx, func);
@@ -307,4 +307,45 @@ TEST_F(VectorizedFunctionCallExprTest, prepare_close) {
     expr_context.close(&_runtime_state);
 }
 
+TEST_F(VectorizedFunctionCallExprTest, evaluateOnDistinctStrings) {
+    TFunction function;
+    TFunctionName functionName;
+    functionName.__set_db_name("db");
+    functionName.__set_function_name("upper");
+
+    function.__set_name(functionName);
+    function.__set_binary_type(TFunctionBinaryType::BUILTIN);
+    function.__set_has_var_args(false);
+    function.__set_fid(30150);
+
+    expr_node.__set_fn(function);
+    expr_node.type = gen_type_desc(TPrimitiveType::VARCHAR);
+
+    VectorizedFunctionCallExpr expr(expr_node);
+
+    const std::vector<std::string> values = {"abc", "Def", "ghI"};
+    auto str = BinaryColumn::create();
+    for (int i = 0; i < 1024; ++i) {
+        str->append(values[i % values.size()]);
+    }
+    MockColumnExpr col(expr_node, str);
+    expr.add_child(&col);
+
+    ExprContext exprContext(&expr);
+    std::vector<ExprContext*> expr_ctxs = {&exprContext};
+
+    ASSERT_OK(Expr::prepare(expr_ctxs, &_runtime_state));
+    ASSERT_OK(Expr::open(expr_ctxs, &_runtime_state));
+
+    ColumnPtr result = expr.evaluate(&exprContext, nullptr);
+    ASSERT_EQ(1024, result->size());
+    auto* binary = ColumnHelper::get_binary_column(result.get());
+    const std::vector<std::string> expected = {"ABC", "DEF", "GHI"};
+    for (int i = 0; i < 1024; ++i) {
+        ASSERT_EQ(expected[i % expected.size()], binary->get_slice(i).to_string());
+    }
+
+    Expr::close(expr_ctxs, &_runtime_state);
+}
+
 } // namespace starrocks
@@ -460,4 +460,51 @@ TEST_F(geographyFunctionsTest, st_containsConstTest) {
     GeoFunctions::st_contains_close(ctx.get(), FunctionContext::FRAGMENT_LOCAL);
 }
 
+TEST_F(geographyFunctionsTest, st_containsPointColumnTest) {
+    std::unique_ptr<FunctionContext> ctx(FunctionContext::create_test_context());
+
+    std::string polygon_wkt = "POLYGON ((10 10, 50 10, 50 50, 10 50, 10 10))";
+    GeoParseStatus status;
+    std::unique_ptr<GeoShape> polygon(GeoShape::from_wkt(polygon_wkt.data(), polygon_wkt.size(), &status));
+    ASSERT_NE(nullptr, polygon);
+    std::string polygon_buf;
+    polygon->encode_to(&polygon_buf);
+
+    auto x_column = DoubleColumn::create();
+    auto y_column = DoubleColumn::create();
+    for (auto [x, y] : std::vector<std::pair<double, double>>{{25, 25}, {5, 5}, {30, 40}, {55, 20}}) {
+        x_column->append(x);
+        y_column->append(y);
+    }
+    auto points = GeoFunctions::st_point(ctx.get(), {x_column, y_column}).value();
+
+    // the same points are checked against a constant polygon and against a polygon column.
+    for (bool const_polygon : {true, false}) {
+        ColumnPtr polygon_column;
+        if (const_polygon) {
+            polygon_column = ColumnHelper::create_const_column<TYPE_VARCHAR>(Slice(polygon_buf), points->size());
+        } else {
+            auto column = BinaryColumn::create();
+            for (size_t i = 0; i < points->size(); i++) {
+                column->append(Slice(polygon_buf));
+            }
+            polygon_column = column;
+        }
+        Columns columns{polygon_column, points};
+        ctx->set_constant_columns({const_polygon ? polygon_column : nullptr, nullptr});
+        ASSERT_TRUE(GeoFunctions::st_contains_prepare(ctx.get(), FunctionContext::FRAGMENT_LOCAL).ok());
+
+        auto res = GeoFunctions::st_contains(ctx.get(), columns).value();
+        auto bools = ColumnHelper::cast_to<TYPE_BOOLEAN>(res);
+        ASSERT_EQ(4, res->size());
+        ASSERT_TRUE(bools->get_data()[0]);
+        ASSERT_FALSE(bools->get_data()[1]);
+        ASSERT_TRUE(bools->get_data()[2]);
+        ASSERT_FALSE(bools->get_data()[3]);
+
+        ASSERT_TRUE(GeoFunctions::st_contains_close(ctx.get(), FunctionContext::FRAGMENT_LOCAL).ok());
+        ctx->set_function_state(FunctionContext::FRAGMENT_LOCAL, nullptr);
+    }
+}
+
 } // namespace starrocks
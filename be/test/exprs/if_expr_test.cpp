@@ -18,7 +18,9 @@
 #include "column/column_helper.h"
 #include "column/fixed_length_column.h"
 #include "exprs/condition_expr.h"
+#include "exprs/exprs_test_helper.h"
 #include "exprs/mock_vectorized_expr.h"
+#include "runtime/runtime_state.h"
 
 namespace starrocks {
 
@@ -47,6 +49,7 @@ public:
     }
 
 private:
+    RuntimeState runtime_state;
     std::vector<TTypeDesc> tttype_desc;
     TExprNode expr_node;
 };
@@ -211,4 +214,28 @@ TEST_F(VectorizedIfExprTest, ifNullRightConst) {
     }
 }
 
+TEST_F(VectorizedIfExprTest, ifJit) {
+    expr_node.type = gen_type_desc(TPrimitiveType::BOOLEAN);
+    MockMultiVectorizedExpr<TYPE_BOOLEAN> bol(expr_node, 10, true, false);
+    expr_node.type = gen_type_desc(TPrimitiveType::BIGINT);
+    MockVectorizedExpr<TYPE_BIGINT> col1(expr_node, 10, 10);
+    MockVectorizedExpr<TYPE_BIGINT> col2(expr_node, 10, 20);
+
+    auto expr = VectorizedConditionExprFactory::create_if_expr(expr_node);
+    std::unique_ptr<Expr> expr_ptr(expr);
+    expr->_children.push_back(&bol);
+    expr->_children.push_back(&col1);
+    expr->_children.push_back(&col2);
+
+    ColumnPtr ptr = expr->evaluate(nullptr, nullptr);
+    ExprsTestHelper::verify_with_jit(ptr, expr, &runtime_state, [](ColumnPtr const& ptr) {
+        ASSERT_TRUE(ptr->is_numeric());
+        auto v = ColumnHelper::cast_to_raw<TYPE_BIGINT>(ptr);
+        ASSERT_EQ(10, v->size());
+        for (int j = 0; j < v->size(); ++j) {
+            ASSERT_EQ(j % 2 == 0 ? 10 : 20, v->get_data()[j]);
+        }
+    });
+}
+
 } // namespace starrocks
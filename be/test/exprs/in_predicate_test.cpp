@@ -17,6 +17,8 @@
 #include <glog/logging.h>
 #include <gtest/gtest.h>
 
+#include <limits>
+
 #include "butil/time.h"
 #include "column/binary_column.h"
 #include "column/column_helper.h"
@@ -479,4 +481,40 @@ TEST_F(VectorizedInPredicateTest, inArrayConstAllNULL) {
     }
 }
 
+TEST_F(VectorizedInPredicateTest, bigintInDenseRange) {
+    expr_node.child_type = TPrimitiveType::BIGINT;
+    expr_node.opcode = TExprOpcode::FILTER_IN;
+    expr_node.type = gen_type_desc(TPrimitiveType::BIGINT);
+    expr_node.in_predicate.is_not_in = false;
+
+    auto expr = std::unique_ptr<Expr>(VectorizedInPredicateFactory::from_thrift(expr_node));
+
+    auto probe = Int64Column::create();
+    std::vector<int64_t> probe_values = {-4, -3, -2, 99, 100, 101, std::numeric_limits<int64_t>::min(),
+                                         std::numeric_limits<int64_t>::max()};
+    probe->append_numbers(probe_values.data(), probe_values.size() * sizeof(int64_t));
+    MockColumnExpr col(expr_node, probe);
+    expr->_children.push_back(&col);
+
+    // odd values in [-3, 99] and 100
+    std::vector<std::unique_ptr<MockConstVectorizedExpr<TYPE_BIGINT>>> values;
+    for (int64_t v = -3; v <= 99; v += 2) {
+        values.emplace_back(std::make_unique<MockConstVectorizedExpr<TYPE_BIGINT>>(expr_node, v));
+    }
+    values.emplace_back(std::make_unique<MockConstVectorizedExpr<TYPE_BIGINT>>(expr_node, 100));
+    for (auto& value : values) {
+        expr->_children.push_back(value.get());
+    }
+
+    ASSERT_TRUE(expr->prepare(nullptr, nullptr).ok());
+    ASSERT_TRUE(expr->open(nullptr, nullptr, FunctionContext::FunctionStateScope::FRAGMENT_LOCAL).ok());
+    ColumnPtr ptr = expr->evaluate(nullptr, nullptr);
+    auto v = ColumnHelper::cast_to_raw<TYPE_BOOLEAN>(ptr);
+    std::vector<uint8_t> expected = {0, 1, 0, 1, 1, 0, 0, 0};
+    ASSERT_EQ(expected.size(), v->size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        ASSERT_EQ(expected[i], v->get_data()[i]) << i;
+    }
+}
+
 } // namespace starrocks
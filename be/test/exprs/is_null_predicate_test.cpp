@@ -22,7 +22,9 @@
 #include "column/chunk.h"
 #include "column/column_helper.h"
 #include "column/fixed_length_column.h"
+#include "exprs/exprs_test_helper.h"
 #include "exprs/mock_vectorized_expr.h"
+#include "runtime/runtime_state.h"
 
 namespace starrocks {
 
@@ -39,6 +41,7 @@ public:
     }
 
 public:
+    RuntimeState runtime_state;
     TExprNode expr_node;
 };
 
@@ -191,4 +194,29 @@ TEST_F(VectorizedIsNullExprTest, isNotNullTest) {
         ASSERT_TRUE(v);
     }
 }
+TEST_F(VectorizedIsNullExprTest, isNullJitTest) {
+    for (const std::string fn_name : {"is_null_pred", "is_not_null_pred"}) {
+        bool is_null_pred = fn_name == "is_null_pred";
+        expr_node.fn.name.function_name = fn_name;
+        expr_node.is_nullable = true;
+        MockNullVectorizedExpr<TYPE_BIGINT> col1(expr_node, 10, 10);
+
+        expr_node.is_nullable = false;
+        expr_node.type = gen_type_desc(TPrimitiveType::BOOLEAN);
+        auto expr = std::unique_ptr<Expr>(VectorizedIsNullPredicateFactory::from_thrift(expr_node));
+        expr->_children.push_back(&col1);
+
+        Chunk chunk;
+        ColumnPtr ptr = expr->evaluate(nullptr, &chunk);
+        ExprsTestHelper::verify_with_jit(ptr, expr.get(), &runtime_state, [is_null_pred](ColumnPtr const& ptr) {
+            ASSERT_FALSE(ptr->is_nullable());
+            auto v = ColumnHelper::cast_to_raw<TYPE_BOOLEAN>(ptr);
+            ASSERT_EQ(10, v->size());
+            for (int j = 0; j < v->size(); ++j) {
+                ASSERT_EQ((j % 2 == 1) == is_null_pred, (bool)v->get_data()[j]);
+            }
+        });
+    }
+}
+
 } // namespace starrocks
@@ -15,13 +15,17 @@
 #include <glog/logging.h>
 #include <gtest/gtest.h>
 
+#include <filesystem>
+
 #include "butil/time.h"
 #include "column/column_hash.h"
 #include "column/fixed_length_column.h"
+#include "common/config.h"
 #include "exprs/arithmetic_expr.h"
 #include "exprs/exprs_test_helper.h"
 #include "exprs/mock_vectorized_expr.h"
 #include "runtime/runtime_state.h"
+#include "util/defer_op.h"
 
 namespace starrocks {
 
@@ -200,4 +204,56 @@ TEST_F(JITFunctionCacheTest, cache) {
         }
     }
 }
+
+TEST_F(JITFunctionCacheTest, object_file_cache) {
+    if (!engine->support_jit()) {
+        return;
+    }
+    const std::string cache_dir = "./jit_object_cache_test";
+    std::filesystem::remove_all(cache_dir);
+    auto old_cache_dir = config::jit_object_cache_dir;
+    config::jit_object_cache_dir = cache_dir;
+    DeferOp defer([&]() {
+        config::jit_object_cache_dir = old_cache_dir;
+        std::filesystem::remove_all(cache_dir);
+    });
+
+    expr_node.opcode = TExprOpcode::SUBTRACT;
+    expr_node.type = gen_type_desc(TPrimitiveType::BIGINT);
+    std::unique_ptr<Expr> expr(VectorizedArithmeticExprFactory::from_thrift(expr_node));
+    MockVectorizedExpr<TYPE_BIGINT> col1(expr_node, 10, 5);
+    MockVectorizedExpr<TYPE_BIGINT> col2(expr_node, 10, 2);
+    expr->_children.push_back(&col1);
+    expr->_children.push_back(&col2);
+
+    runtime_state.set_jit_level(-1);
+    auto expr_name = expr->jit_func_name(&runtime_state);
+    auto check = [](ColumnPtr const& ptr) {
+        auto v = std::static_pointer_cast<Int64Column>(ptr);
+        ASSERT_EQ(10, v->size());
+        for (int j = 0; j < v->size(); ++j) {
+            ASSERT_EQ(3, v->get_data()[j]);
+        }
+    };
+
+    // compile and persist the object code
+    engine->get_func_cache()->erase(expr_name);
+    ColumnPtr ptr = expr->evaluate(nullptr, nullptr);
+    ExprsTestHelper::verify_with_jit(ptr, expr.get(), &runtime_state, check);
+    ASSERT_FALSE(std::filesystem::is_empty(cache_dir));
+
+    // the object code is loaded from the file instead of compiling
+    auto func_obj = std::make_unique<JitObjectCache>(expr_name, engine->get_func_cache());
+    ASSERT_TRUE(func_obj->getObject(nullptr) != nullptr);
+    ASSERT_GT(func_obj->get_code_size(), 0);
+
+    // the loaded object works after the in-memory cache is dropped
+    engine->get_func_cache()->erase(expr_name);
+    ExprsTestHelper::verify_with_jit(ptr, expr.get(), &runtime_state, check);
+
+    // an object of another expression is not loaded
+    auto other_obj = std::make_unique<JitObjectCache>(expr_name + "x", engine->get_func_cache());
+    ASSERT_TRUE(other_obj->getObject(nullptr) == nullptr);
+}
+
 } // namespace starrocks
@@ -658,4 +658,29 @@ TEST_F(LikeTest, constValueLikeComplicateForHyperscan) {
                         .ok());
 }
 
+TEST_F(LikeTest, multiPatternMatch) {
+    LikePredicate::MultiPatternMatcher matcher;
+    ASSERT_TRUE(matcher.init({"abc%", "%x_z%", "^[0-9]+$"}, {true, true, false}).ok());
+
+    auto str = NullableColumn::create(BinaryColumn::create(), NullColumn::create());
+    str->append_datum(Datum(Slice("abcd")));
+    str->append_datum(Datum(Slice("aaxyzbb")));
+    str->append_datum(Datum(Slice("12345")));
+    str->append_datum(Datum(Slice("12a45")));
+    str->append_datum(Datum(Slice("")));
+    str->append_nulls(1);
+
+    auto result = matcher.match(str).value();
+    ASSERT_EQ(6, result->size());
+    ASSERT_TRUE(result->get(0).get_int8());
+    ASSERT_TRUE(result->get(1).get_int8());
+    ASSERT_TRUE(result->get(2).get_int8());
+    ASSERT_FALSE(result->get(3).get_int8());
+    ASSERT_FALSE(result->get(4).get_int8());
+    ASSERT_TRUE(result->is_null(5));
+
+    LikePredicate::MultiPatternMatcher invalid;
+    ASSERT_FALSE(invalid.init({"(a", "b%"}, {false, true}).ok());
+}
+
 } // namespace starrocks
@@ -162,6 +162,53 @@ TEST_F(RuntimeFilterTest, TestJoinRuntimeFilter) {
     EXPECT_EQ(chunk.num_rows(), 12);
 }
 
+TEST_F(RuntimeFilterTest, TestEarlyJoinRuntimeFilter) {
+    RuntimeBloomFilter<TYPE_INT> partial;
+    partial.init(100);
+    partial.set_join_mode(TRuntimeFilterBuildJoinMode::PARTITIONED);
+    for (int i = 0; i <= 200; i += 17) {
+        partial.insert(i);
+    }
+
+    // partition 0 is ready, and partition 1 is not.
+    RuntimeBloomFilter<TYPE_INT> early;
+    early.init_early();
+    early.concat_early(&partial);
+    early.concat_pass_all();
+    EXPECT_TRUE(early.is_early());
+    EXPECT_TRUE(early.has_null());
+    EXPECT_EQ(early.num_hash_partitions(), 2);
+    // the partial filter is copied, so that it still can be merged into the final one.
+    EXPECT_TRUE(partial.can_use_bf());
+
+    TypeDescriptor type_desc(TYPE_INT);
+    ColumnPtr column = ColumnHelper::create_column(type_desc, false);
+    auto* col = ColumnHelper::as_raw_column<RunTimeTypeTraits<TYPE_INT>::ColumnType>(column);
+    for (int i = 0; i <= 200; i += 1) {
+        col->append(i);
+    }
+    JoinRuntimeFilter::RunningContext ctx;
+    ctx.use_merged_selection = false;
+    ctx.hash_values.resize(column->size());
+    for (size_t i = 0; i < column->size(); i++) {
+        ctx.hash_values[i] = i % 2;
+    }
+    early.evaluate(column.get(), &ctx);
+    size_t selected = 0;
+    for (int i = 0; i <= 200; i += 1) {
+        if (i % 2 == 1 || i % 17 == 0) {
+            EXPECT_TRUE(ctx.selection[i]) << i;
+        }
+        selected += ctx.selection[i];
+    }
+    EXPECT_LT(selected, column->size());
+
+    // early runtime filter has no min/max.
+    int32_t min_value = 1000;
+    int32_t max_value = 2000;
+    EXPECT_FALSE(early.filter_zonemap_with_min_max(&min_value, &max_value));
+}
+
 TEST_F(RuntimeFilterTest, TestJoinRuntimeFilterSlice) {
     RuntimeBloomFilter<TYPE_VARCHAR> bf;
     // JoinRuntimeFilter* rf = &bf;
@@ -205,6 +252,38 @@ TEST_F(RuntimeFilterTest, TestJoinRuntimeFilterSerialize) {
     EXPECT_TRUE(rf1->check_equal(*rf0));
 }
 
+TEST_F(RuntimeFilterTest, TestJoinRuntimeFilterSerializeCompressed) {
+    // a sparse bloom filter, which is large enough to be compressed.
+    RuntimeBloomFilter<TYPE_INT> bf0;
+    bf0.init(100000);
+    for (int i = 0; i < 1000; i++) {
+        bf0.insert(i * 17);
+    }
+    // a small bloom filter is not compressed.
+    RuntimeBloomFilter<TYPE_INT> bf1;
+    bf1.init(10);
+    bf1.insert(1);
+
+    RuntimeBloomFilter<TYPE_INT> grf;
+    grf.concat(&bf0);
+    grf.concat(&bf1);
+    EXPECT_EQ(grf.num_hash_partitions(), 2);
+
+    size_t max_size = RuntimeFilterHelper::max_runtime_filter_serialized_size(&grf);
+    std::vector<uint8_t> buffer_v2(max_size, 0);
+    size_t size_v2 = RuntimeFilterHelper::serialize_runtime_filter(RF_VERSION_V2, &grf, buffer_v2.data());
+    std::vector<uint8_t> buffer_v3(max_size, 0);
+    size_t size_v3 = RuntimeFilterHelper::serialize_runtime_filter(RF_VERSION_V3, &grf, buffer_v3.data());
+    EXPECT_LT(size_v3, size_v2 / 2);
+
+    JoinRuntimeFilter* rf1 = nullptr;
+    ObjectPool pool;
+    EXPECT_EQ(RF_VERSION_V3, RuntimeFilterHelper::deserialize_runtime_filter(&pool, &rf1, buffer_v3.data(), size_v3));
+    ASSERT_NE(rf1, nullptr);
+    EXPECT_TRUE(rf1->check_equal(grf));
+    EXPECT_TRUE(rf1->can_use_bf());
+}
+
 TEST_F(RuntimeFilterTest, TestJoinRuntimeFilterSerialize2) {
     RuntimeBloomFilter<TYPE_INT> bf0;
     JoinRuntimeFilter* rf0 = &bf0;
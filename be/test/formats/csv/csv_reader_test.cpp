@@ -0,0 +1,65 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "formats/csv/csv_reader.h"
+
+#include <gtest/gtest.h>
+
+namespace starrocks {
+
+class SplitOnlyCSVReader final : public CSVReader {
+public:
+    explicit SplitOnlyCSVReader(const CSVParseOptions& options) : CSVReader(options) {}
+
+protected:
+    char* _find_line_delimiter(CSVBuffer& buffer, size_t pos) override { return nullptr; }
+};
+
+static std::vector<std::string> split(const std::string& line, const std::string& delimiter, bool trim_space) {
+    SplitOnlyCSVReader reader(CSVParseOptions("\n", delimiter, 0, trim_space));
+    CSVReader::Fields fields;
+    reader.split_record(CSVReader::Record(line.data(), line.size()), &fields);
+    std::vector<std::string> result;
+    for (const auto& field : fields) {
+        result.emplace_back(field.to_string());
+    }
+    return result;
+}
+
+// NOLINTNEXTLINE
+TEST(CSVReaderTest, test_split_record_wide) {
+    std::vector<std::string> expected;
+    std::string line;
+    for (int i = 0; i < 100; i++) {
+        // fields of different lengths put delimiters at every offset of a 16-byte block
+        expected.emplace_back(std::string(i % 7, 'a' + i % 26));
+        if (i > 0) {
+            line.append(",");
+        }
+        line.append(expected.back());
+    }
+    EXPECT_EQ(expected, split(line, ",", false));
+}
+
+// NOLINTNEXTLINE
+TEST(CSVReaderTest, test_split_record_edge) {
+    EXPECT_EQ(std::vector<std::string>({""}), split("", ",", false));
+    EXPECT_EQ(std::vector<std::string>({"", "", ""}), split(",,", ",", false));
+    EXPECT_EQ(std::vector<std::string>({"0123456789abcdef", ""}), split("0123456789abcdef,", ",", false));
+    EXPECT_EQ(std::vector<std::string>({"0123456789abcde", "x"}), split("0123456789abcde,x", ",", false));
+    EXPECT_EQ(std::vector<std::string>({"a", "bb", "c"}), split(" a ,  bb,c  ", ",", true));
+    EXPECT_EQ(std::vector<std::string>({"a", "bb", "c"}), split("a||bb||c", "||", false));
+}
+
+} // namespace starrocks
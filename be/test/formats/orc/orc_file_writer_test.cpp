@@ -515,6 +515,51 @@ TEST_F(OrcFileWriterTest, TestWriteStringsNotNull) {
     assert_equal_chunk(chunk.get(), read_chunk.get());
 }
 
+TEST_F(OrcFileWriterTest, TestWriteStringsDictionaryEncoding) {
+    ASSERT_OK(ignore_not_found(_fs->delete_file(_file_path)));
+    auto type_varchar = TypeDescriptor::from_logical_type(TYPE_VARCHAR);
+    std::vector<TypeDescriptor> type_descs{type_varchar, type_varchar};
+
+    auto column_names = _make_type_names(type_descs);
+    auto output_file = _fs->new_writable_file(_file_path).value();
+    auto output_stream = std::make_unique<OrcOutputStream>(std::move(output_file));
+    auto column_evaluators = ColumnSlotIdEvaluator::from_types(type_descs);
+    auto writer_options = std::make_shared<formats::ORCWriterOptions>();
+    auto writer = std::make_unique<formats::ORCFileWriter>(
+            _file_path, std::move(output_stream), column_names, type_descs, std::move(column_evaluators),
+            TCompressionType::NO_COMPRESSION, writer_options, []() {}, nullptr, nullptr);
+    ASSERT_OK(writer->init());
+
+    // the first column only has 4 distinct values, the second one has no duplicate value.
+    const int num_rows = 1000;
+    auto chunk = std::make_shared<Chunk>();
+    {
+        auto low_card_column = BinaryColumn::create();
+        auto high_card_column = BinaryColumn::create();
+        for (int i = 0; i < num_rows; i++) {
+            low_card_column->append("value_" + std::to_string(i % 4));
+            high_card_column->append("value_" + std::to_string(i));
+        }
+        chunk->append_column(low_card_column, chunk->num_columns());
+        chunk->append_column(high_card_column, chunk->num_columns());
+    }
+
+    ASSERT_OK(writer->write(chunk).get());
+    auto result = writer->commit().get();
+    ASSERT_OK(result.io_status);
+    ASSERT_EQ(result.file_statistics.record_count, num_rows);
+
+    auto reader = orc::createReader(orc::readLocalFile(_file_path), orc::ReaderOptions());
+    auto stripe = reader->getStripe(0);
+    // column 0 of the orc file is the root struct.
+    ASSERT_EQ(orc::ColumnEncodingKind_DICTIONARY_V2, stripe->getColumnEncoding(1));
+    ASSERT_EQ(orc::ColumnEncodingKind_DIRECT_V2, stripe->getColumnEncoding(2));
+
+    ChunkPtr read_chunk;
+    ASSERT_OK(_read_chunk(read_chunk, column_names, type_descs, false));
+    assert_equal_chunk(chunk.get(), read_chunk.get());
+}
+
 TEST_F(OrcFileWriterTest, TestWriteDecimal) {
     ASSERT_OK(ignore_not_found(_fs->delete_file(_file_path)));
     std::vector<TypeDescriptor> type_descs{
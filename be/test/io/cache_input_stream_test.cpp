@@ -478,4 +478,56 @@ TEST_F(CacheInputStreamTest, test_peek) {
     }
 }
 
+TEST_F(CacheInputStreamTest, test_peek_block_buffer) {
+    CacheOptions options = cache_options();
+    ASSERT_OK(BlockCache::instance()->init(options));
+
+    const int64_t block_count = 2;
+
+    int64_t data_size = block_size * block_count;
+    char data[data_size + 1];
+    gen_test_data(data, data_size, block_size);
+
+    const std::string file_name = "test_file7";
+    std::shared_ptr<io::SeekableInputStream> stream(new MockSeekableInputStream(data, data_size));
+    std::shared_ptr<io::SharedBufferedInputStream> sb_stream(
+            new io::SharedBufferedInputStream(stream, file_name, data_size));
+    io::CacheInputStream cache_stream(sb_stream, file_name, data_size, 1000000);
+    cache_stream.set_enable_populate_cache(true);
+    cache_stream.set_enable_block_buffer(true);
+    auto& stats = cache_stream.stats();
+
+    // first read from backend
+    {
+        char buffer[block_size];
+        read_stream_data(&cache_stream, 0, block_size, buffer);
+        ASSERT_TRUE(check_data_content(buffer, block_size, 'a'));
+    }
+    ASSERT_EQ(stats.write_cache_count, 1);
+
+    // peek from the cached block without shared buffer
+    {
+        const int64_t peek_size = 1024;
+        ASSERT_OK(cache_stream.seek(100));
+        auto res = cache_stream.peek(peek_size);
+        ASSERT_TRUE(res.ok()) << res.status();
+        ASSERT_EQ(res.value().size(), peek_size);
+        ASSERT_TRUE(check_data_content((char*)res.value().data(), peek_size, 'a'));
+        ASSERT_EQ(stats.read_cache_count, 1);
+
+        // peek again from the block buffer
+        ASSERT_OK(cache_stream.seek(200));
+        res = cache_stream.peek(peek_size);
+        ASSERT_TRUE(res.ok()) << res.status();
+        ASSERT_TRUE(check_data_content((char*)res.value().data(), peek_size, 'a'));
+        ASSERT_EQ(stats.read_cache_count, 1);
+    }
+
+    // the range crosses the block boundary
+    {
+        ASSERT_OK(cache_stream.seek(block_size - 10));
+        ASSERT_FALSE(cache_stream.peek(100).ok());
+    }
+}
+
 } // namespace starrocks::io
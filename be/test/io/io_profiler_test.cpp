@@ -131,4 +131,35 @@ TEST(IOProfilerTest, test_profile_and_get_topn_stats) {
     ASSERT_TRUE(IOProfiler::is_empty());
 }
 
+TEST(IOProfilerTest, test_context_io_latency_percentile) {
+    IOProfiler::reset();
+    auto scope = IOProfiler::scope(IOProfiler::TAG_QUERY, 3);
+    ASSERT_OK(IOProfiler::start(IOProfiler::IOMode::IOMODE_READ));
+    for (int i = 0; i < 98; ++i) {
+        IOProfiler::add_read(100, 1500);
+    }
+    IOProfiler::add_read(100, 5000000);
+    IOProfiler::add_read(100, 5000000);
+    IOProfiler::stop();
+
+    ASSIGN_OR_ABORT(auto stats, IOProfiler::get_topn_read_stats(1));
+    ASSERT_EQ(2, stats.size());
+    std::stringstream ss(stats[1]);
+    std::vector<std::string> fields;
+    std::string field;
+    while (ss >> field) {
+        fields.emplace_back(field);
+    }
+    ASSERT_EQ(12, fields.size());
+    ASSERT_EQ("3", fields[0]);
+    ASSERT_EQ("QUERY", fields[1]);
+    ASSERT_EQ("10000", fields[2]);
+    // 1.5us falls into [1, 2)us, and 5ms falls into [4096, 8192)us
+    ASSERT_EQ("2", fields[8]);
+    ASSERT_EQ("8192", fields[9]);
+    ASSERT_EQ("0", fields[10]);
+    ASSERT_EQ("0", fields[11]);
+    IOProfiler::reset();
+}
+
 } // namespace starrocks
\ No newline at end of file
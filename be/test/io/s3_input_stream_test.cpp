@@ -204,4 +204,21 @@ TEST_F(S3InputStreamTest, test_read_all) {
     EXPECT_EQ(kObjectContent, s);
 }
 
+TEST_F(S3InputStreamTest, test_read_parallel) {
+    int64_t old_part_size = config::s3_read_parallel_part_size;
+    config::s3_read_parallel_part_size = 3;
+    auto f = new_random_access_file();
+    char buf[16];
+    // 10 bytes are fetched by 3 requests: [0, 4), [4, 8), [8, 10)
+    ASSIGN_OR_ABORT(auto r, f->read(buf, sizeof(buf)));
+    ASSERT_EQ(kObjectContent, std::string_view(buf, r));
+    ASSERT_EQ(10, *f->position());
+
+    // shorter than 2 parts, fetched by a single request
+    ASSERT_OK(f->seek(5));
+    ASSIGN_OR_ABORT(r, f->read(buf, 5));
+    ASSERT_EQ("56789", std::string_view(buf, r));
+    config::s3_read_parallel_part_size = old_part_size;
+}
+
 } // namespace starrocks::io
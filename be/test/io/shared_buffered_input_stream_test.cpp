@@ -179,4 +179,39 @@ TEST_F(SharedBufferedInputStreamTest, test_orc) {
             sb.value()->debug_string());
 }
 
-} // namespace starrocks::io
\ No newline at end of file
+
+PARALLEL_TEST(SharedBufferedInputStreamTest, test_cost_model) {
+    IOCostModel* model = IOCostModel::get("cost-model-test://bucket/file");
+    ASSERT_EQ(model, IOCostModel::get("cost-model-test://bucket/another_file"));
+    ASSERT_NE(model, IOCostModel::get("/local/file"));
+    ASSERT_EQ(0, model->break_even_gap());
+
+    // 10ms per small request, 100MB/s for large requests
+    model->update(4 * 1024, 10 * 1000 * 1000);
+    ASSERT_EQ(0, model->break_even_gap());
+    model->update(100 * 1024 * 1024, 1000 * 1000 * 1000);
+    ASSERT_EQ(10 * 1000 * 1000, model->latency_ns());
+    ASSERT_EQ(100 * 1024 * 1024, model->bytes_per_second());
+    ASSERT_EQ(1024 * 1024, model->break_even_gap());
+}
+
+PARALLEL_TEST(SharedBufferedInputStreamTest, test_request_io_bytes) {
+    size_t len = 1 * 1024 * 1024; // 1MB
+    const std::string rand_string = random_string(len);
+    auto in = std::make_shared<TestInputStream>(rand_string, len);
+    auto sb_stream = std::make_shared<io::SharedBufferedInputStream>(in, "test", len);
+    std::vector<io::SharedBufferedInputStream::IORange> ranges;
+    // merged into one shared buffer [0, 300k) with a 100k gap
+    ranges.emplace_back(0, 100 * 1024);
+    ranges.emplace_back(200 * 1024, 100 * 1024);
+    ASSERT_OK(sb_stream->set_io_ranges(ranges));
+
+    std::string buf(100 * 1024, 0);
+    ASSERT_OK(sb_stream->read_at_fully(200 * 1024, buf.data(), buf.size()));
+    ASSERT_EQ(rand_string.substr(200 * 1024, 100 * 1024), buf);
+    ASSERT_EQ(1, sb_stream->shared_io_count());
+    ASSERT_EQ(300 * 1024, sb_stream->shared_io_bytes());
+    ASSERT_EQ(200 * 1024, sb_stream->shared_request_io_bytes());
+}
+
+} // namespace starrocks::io
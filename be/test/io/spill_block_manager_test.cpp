@@ -160,6 +160,25 @@ TEST_F(SpillBlockManagerTest, dir_choose_strategy) {
     }
 }
 
+TEST_F(SpillBlockManagerTest, dir_available_space) {
+    auto dir = create_spill_dir(local_path, INT64_MAX);
+    auto dir_mgr = create_spill_dir_manager({dir});
+    auto space_info = FileSystem::Default()->space(local_path);
+    ASSERT_OK(space_info.status());
+    {
+        // the capacity limit is satisfied, but the disk has no such space
+        spill::AcquireDirOptions opts{.data_size = static_cast<size_t>(space_info.value().capacity) + 1};
+        ASSERT_FALSE(dir_mgr->acquire_writable_dir(opts).ok());
+        ASSERT_EQ(0, dir->get_current_size());
+    }
+    {
+        spill::AcquireDirOptions opts{.data_size = 10};
+        auto res = dir_mgr->acquire_writable_dir(opts);
+        ASSERT_OK(res.status());
+        ASSERT_EQ(local_path, res.value()->dir());
+    }
+}
+
 TEST_F(SpillBlockManagerTest, log_block_allocation_test) {
     auto log_block_mgr = std::make_shared<spill::LogBlockManager>(dummy_query_id, local_dir_mgr.get());
     ASSERT_OK(log_block_mgr->open());
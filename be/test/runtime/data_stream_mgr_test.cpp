@@ -16,6 +16,8 @@
 
 #include <gtest/gtest.h>
 
+#include "gen_cpp/internal_service.pb.h"
+
 namespace starrocks {
 
 TEST(DataStreamMgr, pass_through_buffer_test) {
@@ -39,4 +41,34 @@ TEST(DataStreamMgr, pass_through_buffer_test) {
     mgr.reset();
 }
 
+TEST(DataStreamMgr, transmit_batched_chunks_to_non_existing_receivers) {
+    class CountingClosure : public google::protobuf::Closure {
+    public:
+        void Run() override { ++num_runs; }
+        int num_runs = 0;
+    };
+
+    auto mgr = std::make_unique<DataStreamMgr>();
+
+    PTransmitChunkParams request;
+    for (int i = 0; i < 3; i++) {
+        auto* batched_request = request.add_batched_requests();
+        batched_request->mutable_finst_id()->set_hi(2023);
+        batched_request->mutable_finst_id()->set_lo(i);
+        batched_request->set_node_id(1);
+        batched_request->set_sender_id(0);
+        batched_request->set_be_number(0);
+        batched_request->set_eos(false);
+    }
+
+    CountingClosure closure;
+    google::protobuf::Closure* done = &closure;
+    ASSERT_TRUE(mgr->transmit_chunk(request, &done).ok());
+    // No receiver holds the closure, so it is returned to the caller without being run.
+    ASSERT_EQ(&closure, done);
+    ASSERT_EQ(0, closure.num_runs);
+
+    mgr->close();
+}
+
 } // namespace starrocks
@@ -25,6 +25,7 @@
 #include "column/json_column.h"
 #include "column/nullable_column.h"
 #include "gutil/strings/substitute.h"
+#include "serde/encode_context.h"
 #include "testutil/parallel_test.h"
 #include "util/json.h"
 
@@ -349,4 +350,104 @@ PARALLEL_TEST(ColumnArraySerdeTest, array_column) {
     }
 }
 
+
+// NOLINTNEXTLINE
+PARALLEL_TEST(ColumnArraySerdeTest, dict_encode_binary_column) {
+    std::vector<std::string> words{"ASIA", "AMERICA", "AFRICA", "EUROPE", "MIDDLE EAST"};
+    auto c1 = BinaryColumn::create();
+    for (size_t i = 0; i < 4096; i++) {
+        c1->append(Slice(words[i * 7 % words.size()]));
+    }
+    const int64_t plain_size = ColumnArraySerde::max_serialized_size(*c1, 0);
+
+    std::vector<uint8_t> buffer;
+    for (auto level : {8, 9, 12, 13, 30, 31, -1}) {
+        buffer.resize(ColumnArraySerde::max_serialized_size(*c1, level));
+        uint8_t* end = ColumnArraySerde::serialize(*c1, buffer.data(), false, level);
+        ASSERT_LT(end - buffer.data(), plain_size / 4);
+
+        auto c2 = BinaryColumn::create();
+        ASSERT_EQ(end, ColumnArraySerde::deserialize(buffer.data(), c2.get(), false, level));
+        ASSERT_EQ(c1->size(), c2->size());
+        for (size_t i = 0; i < c1->size(); i++) {
+            ASSERT_EQ(c1->get_slice(i), c2->get_slice(i));
+        }
+    }
+
+    // high cardinality columns fall back to the other encodings
+    auto c3 = BinaryColumn::create();
+    for (size_t i = 0; i < 4096; i++) {
+        c3->append(Slice(strings::Substitute("$0-$1", words[i % words.size()], i)));
+    }
+    for (auto level : {8, 12, 30, -1}) {
+        buffer.resize(ColumnArraySerde::max_serialized_size(*c3, level));
+        uint8_t* end = ColumnArraySerde::serialize(*c3, buffer.data(), false, level);
+        ASSERT_LE(end - buffer.data(), buffer.size());
+
+        auto c4 = BinaryColumn::create();
+        ASSERT_EQ(end, ColumnArraySerde::deserialize(buffer.data(), c4.get(), false, level));
+        for (size_t i = 0; i < c3->size(); i++) {
+            ASSERT_EQ(c3->get_slice(i), c4->get_slice(i));
+        }
+    }
+}
+
+// NOLINTNEXTLINE
+PARALLEL_TEST(ColumnArraySerdeTest, frame_of_reference_integer_column) {
+    auto c1 = Int64Column::create();
+    auto c2 = Int32Column::create();
+    auto c3 = Int8Column::create();
+    for (int64_t i = 0; i < 4096; i++) {
+        c1->append(1000000000000L + (i * 7919) % 1000 - 500);
+        c2->append(i * 3);
+        c3->append(static_cast<int8_t>(i * 31));
+    }
+    const int64_t plain_size = ColumnArraySerde::max_serialized_size(*c1, 0);
+
+    std::vector<uint8_t> buffer;
+    for (auto level : {16, 17, 18, 19, 30, 31, -1}) {
+        buffer.resize(ColumnArraySerde::max_serialized_size(*c1, level));
+        uint8_t* end = ColumnArraySerde::serialize(*c1, buffer.data(), false, level);
+        ASSERT_LT(end - buffer.data(), plain_size / 4);
+        auto d1 = Int64Column::create();
+        ASSERT_EQ(end, ColumnArraySerde::deserialize(buffer.data(), d1.get(), false, level));
+        ASSERT_EQ(c1->get_data(), d1->get_data());
+
+        // sorted integers are encoded by delta + frame-of-reference
+        buffer.resize(ColumnArraySerde::max_serialized_size(*c2, level));
+        end = ColumnArraySerde::serialize(*c2, buffer.data(), true, level);
+        ASSERT_LT(end - buffer.data(), 64);
+        auto d2 = Int32Column::create();
+        ASSERT_EQ(end, ColumnArraySerde::deserialize(buffer.data(), d2.get(), true, level));
+        ASSERT_EQ(c2->get_data(), d2->get_data());
+
+        // the full range of int8_t can't be encoded by frame-of-reference
+        buffer.resize(ColumnArraySerde::max_serialized_size(*c3, level));
+        end = ColumnArraySerde::serialize(*c3, buffer.data(), false, level);
+        auto d3 = Int8Column::create();
+        ASSERT_EQ(end, ColumnArraySerde::deserialize(buffer.data(), d3.get(), false, level));
+        ASSERT_EQ(c3->get_data(), d3->get_data());
+    }
+}
+
+// NOLINTNEXTLINE
+PARALLEL_TEST(ColumnArraySerdeTest, encode_context_candidate_levels) {
+    ASSERT_EQ(std::vector<int>{7}, EncodeContext(1, 7).get_candidate_levels());
+    ASSERT_EQ(std::vector<int>{30}, EncodeContext(1, 30).get_candidate_levels());
+    ASSERT_EQ((std::vector<int>{25, 31, 7}), EncodeContext(1, 31).get_candidate_levels());
+
+    // the sampled chunks take turns to use each candidate, and the column picks the one with the lowest ratio
+    EncodeContext context(2, 31);
+    for (uint32_t i = 0; i < EncodeSamplingNum; i++) {
+        int level = context.get_encode_level(0);
+        ASSERT_EQ(context.get_candidate_levels()[i % 3], level);
+        ASSERT_EQ(level, context.get_encode_level(1));
+        context.update(0, 100, level == 31 ? 20 : 50);
+        context.update(1, 100, 95);
+        context.adjust_encode_levels();
+    }
+    ASSERT_EQ(31, context.get_encode_level(0));
+    ASSERT_EQ(0, context.get_encode_level(1));
+}
+
 } // namespace starrocks::serde
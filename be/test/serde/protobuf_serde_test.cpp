@@ -96,6 +96,30 @@ PARALLEL_TEST(ProtobufChunkSerde, test_serde) {
     }
 }
 
+// NOLINTNEXTLINE
+PARALLEL_TEST(ProtobufChunkSerde, test_serde_to_raw_buffer) {
+    auto chunk = std::make_unique<Chunk>(make_columns(2), make_schema(2));
+
+    StatusOr<ChunkPB> expected = serde::ProtobufChunkSerde::serialize_without_meta(*chunk);
+    ASSERT_TRUE(expected.ok()) << expected.status();
+
+    std::unique_ptr<uint8_t[]> data;
+    StatusOr<ChunkPB> res = serde::ProtobufChunkSerde::serialize_without_meta(*chunk, nullptr, &data);
+    ASSERT_TRUE(res.ok()) << res.status();
+    ASSERT_TRUE(data != nullptr);
+    ASSERT_TRUE(res->data().empty());
+    ASSERT_EQ(expected->serialized_size(), res->serialized_size());
+    ASSERT_EQ(expected->uncompressed_size(), res->uncompressed_size());
+    ASSERT_EQ(res->uncompressed_size(), res->data_size());
+    std::string_view serialized_data(reinterpret_cast<const char*>(data.get()), res->data_size());
+    ASSERT_EQ(expected->data(), serialized_data);
+
+    ASSERT_TRUE(serde::ProtobufChunkSerde::serialize_meta(*chunk, &res.value()).ok());
+    ASSERT_EQ(4, res->slot_id_map_size());
+    ASSERT_EQ(2, res->is_nulls_size());
+    ASSERT_EQ(2, res->is_consts_size());
+}
+
 // NOLINTNEXTLINE
 PARALLEL_TEST(ProtobufChunkSerde, TestChunkWithExtraData) {
     auto chunk = std::make_unique<Chunk>(make_columns(2), make_schema(2));
@@ -209,6 +209,41 @@ TEST(ConjunctivePredicatesTest, test_evaluate_and) {
     }
 }
 
+// NOLINTNEXTLINE
+TEST(ConjunctivePredicatesTest, test_predicate_tree_adaptive_order) {
+    SchemaPtr schema(new Schema());
+    schema->append(std::make_shared<Field>(0, "c0", TYPE_INT, true));
+
+    auto c0 = ChunkHelper::column_from_field_type(TYPE_INT, true);
+    c0->append_datum(Datum());
+    c0->append_datum(Datum(1));
+    c0->append_datum(Datum(2));
+    c0->append_datum(Datum(3));
+
+    ChunkPtr chunk = std::make_shared<Chunk>(Columns{c0}, schema);
+
+    // c0 is not null and c0 >= 2 and c0 <= 2
+    PredicatePtr p0(new_column_null_predicate(get_type_info(TYPE_INT), 0, false));
+    PredicatePtr p1(new_column_ge_predicate(get_type_info(TYPE_INT), 0, "2"));
+    PredicatePtr p2(new_column_le_predicate(get_type_info(TYPE_INT), 0, "2"));
+
+    PredicateAndNode root;
+    root.add_child(PredicateColumnNode{p0.get()});
+    root.add_child(PredicateColumnNode{p1.get()});
+    root.add_child(PredicateColumnNode{p2.get()});
+    auto pred_tree = PredicateTree::create(std::move(root));
+
+    // The children are reordered several times by their observed selectivity, which must not change the result.
+    std::vector<uint8_t> selection(chunk->num_rows(), 0);
+    for (size_t i = 0; i < 4 * CompoundNodeContext::CompoundAndContext::kReorderInterval; i++) {
+        ASSERT_OK(pred_tree.evaluate(chunk.get(), selection.data()));
+        ASSERT_EQ("0,0,1,0", to_string(selection));
+
+        ASSERT_OK(pred_tree.evaluate(chunk.get(), selection.data(), 2, 4));
+        ASSERT_EQ("0,0,1,0", to_string(selection));
+    }
+}
+
 // NOLINTNEXTLINE
 TEST(ConjunctivePredicatesTest, test_evaluate_or) {
     SchemaPtr schema(new Schema());
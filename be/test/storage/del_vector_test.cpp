@@ -54,4 +54,31 @@ TEST(DelVector, testLoadSave) {
     ASSERT_EQ(dv2.cardinality(), dels.size());
 };
 
+// NOLINTNEXTLINE
+TEST(DelVector, testConsecutiveDelsCompressed) {
+    DelVector dv;
+    dv.set_empty();
+    std::vector<uint32_t> dels(60000);
+    for (uint32_t i = 0; i < dels.size(); i++) {
+        dels[i] = 1000 + i;
+    }
+    std::shared_ptr<DelVector> ndv;
+    dv.add_dels_as_new_version(dels, 2, &ndv);
+    ASSERT_EQ(2, ndv->version());
+    ASSERT_EQ(dels.size(), ndv->cardinality());
+    // consecutive deletes are kept as run containers
+    ASSERT_LT(ndv->memory_usage(), 1024);
+
+    std::shared_ptr<DelVector> ndv2;
+    ndv->add_dels_as_new_version({5, 100000}, 3, &ndv2);
+    ASSERT_EQ(dels.size() + 2, ndv2->cardinality());
+    std::string raw = ndv2->save();
+    DelVector dv2;
+    ASSERT_TRUE(dv2.load(3, raw.data(), raw.size()).ok());
+    ASSERT_EQ(ndv2->cardinality(), dv2.cardinality());
+    ASSERT_TRUE(dv2.roaring()->contains(5));
+    ASSERT_TRUE(dv2.roaring()->contains(30000));
+    ASSERT_FALSE(dv2.roaring()->contains(61000));
+}
+
 } // namespace starrocks
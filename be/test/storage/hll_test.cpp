@@ -19,6 +19,8 @@
 
 #include <gtest/gtest.h>
 
+#include <vector>
+
 #include "util/hash_util.hpp"
 #include "util/phmap/phmap.h"
 #include "util/slice.h"
@@ -205,4 +207,23 @@ TEST_F(TestHll, InvalidPtr) {
     }
 }
 
+TEST_F(TestHll, UpdateBatch) {
+    for (int num_values : {0, 10, 200, 10000}) {
+        std::vector<uint64_t> hash_values;
+        for (int i = 0; i < num_values; ++i) {
+            hash_values.push_back(i == 3 ? 0 : hash(i));
+        }
+        HyperLogLog expected;
+        for (auto value : hash_values) {
+            if (value != 0) {
+                expected.update(value);
+            }
+        }
+        HyperLogLog hll;
+        hll.update_batch(hash_values.data(), hash_values.size());
+        ASSERT_EQ(expected.estimate_cardinality(), hll.estimate_cardinality());
+        ASSERT_EQ(expected.to_string(), hll.to_string());
+    }
+}
+
 } // namespace starrocks
@@ -0,0 +1,116 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "fs/fs_util.h"
+#include "storage/inverted/inverted_plugin_factory.h"
+#include "storage/page_cache.h"
+#include "storage/tablet_index.h"
+#include "storage/types.h"
+#include "testutil/assert.h"
+#include "util/slice.h"
+
+namespace starrocks {
+
+class BuiltinInvertedIndexTest : public testing::Test {
+public:
+    const std::string kTestDir = "./builtin_inverted_index_test";
+
+protected:
+    void SetUp() override {
+        (void)fs::remove_all(kTestDir);
+        ASSERT_OK(fs::create_directories(kTestDir));
+        _tablet_index = std::make_shared<TabletIndex>();
+        _tablet_index->add_common_properties(INVERTED_IMP_KEY, TYPE_BUILTIN);
+        _tablet_index->add_index_properties(INVERTED_INDEX_PARSER_KEY, INVERTED_INDEX_PARSER_NONE);
+    }
+
+    void TearDown() override {
+        StoragePageCache::instance()->prune();
+        ASSERT_OK(fs::remove_all(kTestDir));
+    }
+
+    // rows: "a0", null, "a1", null, ..., "b0", null, "b1", null, ...
+    void write_index(const std::string& path) {
+        ASSIGN_OR_ABORT(auto plugin, InvertedPluginFactory::get_plugin(InvertedImplementType::BUILTIN));
+        std::unique_ptr<InvertedWriter> writer;
+        ASSERT_OK(plugin->create_inverted_index_writer(get_type_info(TYPE_VARCHAR), "c1", path, _tablet_index.get(),
+                                                       &writer));
+        ASSERT_OK(writer->init());
+        for (const auto& value : _values) {
+            Slice slice(value);
+            writer->add_values(&slice, 1);
+            writer->add_nulls(1);
+        }
+        ASSERT_OK(writer->finish());
+    }
+
+    roaring::Roaring query(InvertedReader* reader, const std::string& value, InvertedIndexQueryType query_type) {
+        Slice slice(value);
+        roaring::Roaring result;
+        CHECK(reader->query(&_stats, "c1", &slice, query_type, &result).ok());
+        return result;
+    }
+
+    std::vector<std::string> _values{"a0", "a1", "a2", "b0", "b1"};
+    std::shared_ptr<TabletIndex> _tablet_index;
+    OlapReaderStatistics _stats;
+};
+
+TEST_F(BuiltinInvertedIndexTest, test_query) {
+    std::string path = kTestDir + "/0_0_0.ivt";
+    write_index(path);
+
+    ASSIGN_OR_ABORT(auto plugin, InvertedPluginFactory::get_plugin(InvertedImplementType::BUILTIN));
+    std::unique_ptr<InvertedReader> reader;
+    ASSERT_OK(plugin->create_inverted_index_reader(path, _tablet_index, TYPE_VARCHAR, &reader));
+
+    ASSERT_EQ(roaring::Roaring({2}), query(reader.get(), "a1", InvertedIndexQueryType::EQUAL_QUERY));
+    ASSERT_TRUE(query(reader.get(), "a3", InvertedIndexQueryType::EQUAL_QUERY).isEmpty());
+    ASSERT_EQ(roaring::Roaring({0, 2}), query(reader.get(), "a2", InvertedIndexQueryType::LESS_THAN_QUERY));
+    ASSERT_EQ(roaring::Roaring({0, 2, 4}), query(reader.get(), "a2", InvertedIndexQueryType::LESS_EQUAL_QUERY));
+    ASSERT_EQ(roaring::Roaring({8}), query(reader.get(), "b0", InvertedIndexQueryType::GREATER_THAN_QUERY));
+    ASSERT_EQ(roaring::Roaring({6, 8}), query(reader.get(), "b", InvertedIndexQueryType::GREATER_EQUAL_QUERY));
+    ASSERT_TRUE(query(reader.get(), "c", InvertedIndexQueryType::GREATER_EQUAL_QUERY).isEmpty());
+    ASSERT_EQ(roaring::Roaring({0, 2, 4}), query(reader.get(), "a%", InvertedIndexQueryType::MATCH_WILDCARD_QUERY));
+    ASSERT_EQ(roaring::Roaring({6, 8}), query(reader.get(), "b*", InvertedIndexQueryType::MATCH_WILDCARD_QUERY));
+    ASSERT_EQ(roaring::Roaring({0, 2, 4, 6, 8}),
+              query(reader.get(), "%", InvertedIndexQueryType::MATCH_WILDCARD_QUERY));
+
+    Slice pattern("%1");
+    roaring::Roaring result;
+    ASSERT_TRUE(reader->query(&_stats, "c1", &pattern, InvertedIndexQueryType::MATCH_WILDCARD_QUERY, &result)
+                        .is_not_supported());
+
+    roaring::Roaring nulls;
+    ASSERT_OK(reader->query_null(&_stats, "c1", &nulls));
+    ASSERT_EQ(roaring::Roaring({1, 3, 5, 7, 9}), nulls);
+}
+
+TEST_F(BuiltinInvertedIndexTest, test_tokenized_not_supported) {
+    auto tablet_index = std::make_shared<TabletIndex>();
+    tablet_index->add_common_properties(INVERTED_IMP_KEY, TYPE_BUILTIN);
+    tablet_index->add_index_properties(INVERTED_INDEX_PARSER_KEY, INVERTED_INDEX_PARSER_ENGLISH);
+    ASSIGN_OR_ABORT(auto plugin, InvertedPluginFactory::get_plugin(InvertedImplementType::BUILTIN));
+    std::unique_ptr<InvertedWriter> writer;
+    ASSERT_TRUE(plugin->create_inverted_index_writer(get_type_info(TYPE_VARCHAR), "c1", kTestDir + "/0_0_1.ivt",
+                                                     tablet_index.get(), &writer)
+                        .is_not_supported());
+}
+
+} // namespace starrocks
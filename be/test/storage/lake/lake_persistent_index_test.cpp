@@ -242,4 +242,28 @@ TEST_F(LakePersistentIndexTest, test_major_compaction) {
     config::l0_max_mem_usage = l0_max_mem_usage;
 }
 
+TEST_F(LakePersistentIndexTest, test_pick_compaction_sstables) {
+    auto make_meta = [](const std::vector<int64_t>& filesizes) {
+        PersistentIndexSstableMetaPB sstable_meta;
+        for (auto filesize : filesizes) {
+            sstable_meta.add_sstables()->set_filesize(filesize);
+        }
+        return sstable_meta;
+    };
+    using Range = std::pair<int, int>;
+    // similar sizes are merged together
+    ASSERT_EQ(Range(0, 4), LakePersistentIndex::pick_compaction_sstables(make_meta({10, 10, 10, 10})));
+    // a large old sstable is not rewritten together with small new ones
+    ASSERT_EQ(Range(1, 4), LakePersistentIndex::pick_compaction_sstables(make_meta({1000, 10, 10, 10})));
+    // a tiny newest sstable does not block merging the older ones
+    ASSERT_EQ(Range(1, 3), LakePersistentIndex::pick_compaction_sstables(make_meta({1000, 10, 10, 1})));
+    // nothing to merge when the sizes grow fast enough
+    ASSERT_EQ(Range(0, 0), LakePersistentIndex::pick_compaction_sstables(make_meta({1000, 100, 10, 1})));
+
+    auto size_tiered = config::lake_pk_index_sst_size_tiered_compaction;
+    config::lake_pk_index_sst_size_tiered_compaction = false;
+    ASSERT_EQ(Range(0, 4), LakePersistentIndex::pick_compaction_sstables(make_meta({1000, 100, 10, 1})));
+    config::lake_pk_index_sst_size_tiered_compaction = size_tiered;
+}
+
 } // namespace starrocks::lake
@@ -420,6 +420,58 @@ TEST_F(PersistentIndexSstableTest, test_persistent_index_sstable) {
     }
 }
 
+TEST_F(PersistentIndexSstableTest, test_multi_get_with_key_range) {
+    const int N = 1000;
+    // 1. build sstable with the even keys in [N, 2N)
+    const std::string filename = "test_multi_get_with_key_range.sst";
+    ASSIGN_OR_ABORT(auto file, fs::new_writable_file(lake::join_path(kTestDir, filename)));
+    phmap::btree_map<std::string, std::list<IndexValueWithVer>, std::less<>> map;
+    for (int i = N; i < 2 * N; i += 2) {
+        std::list<IndexValueWithVer> index_value_vers;
+        index_value_vers.emplace_front(100, i);
+        map.insert({fmt::format("test_key_{:016X}", i), index_value_vers});
+    }
+    uint64_t filesize = 0;
+    PersistentIndexSstablePB sstable_pb;
+    ASSERT_OK(PersistentIndexSstable::build_sstable(map, file.get(), &filesize, sstable_pb.mutable_range()));
+    ASSERT_OK(file->close());
+    ASSERT_EQ(fmt::format("test_key_{:016X}", N), sstable_pb.range().start_key());
+    ASSERT_EQ(fmt::format("test_key_{:016X}", 2 * N - 2), sstable_pb.range().end_key());
+
+    // 2. open sstable
+    std::unique_ptr<PersistentIndexSstable> sst = std::make_unique<PersistentIndexSstable>();
+    ASSIGN_OR_ABORT(auto read_file, fs::new_random_access_file(lake::join_path(kTestDir, filename)));
+    std::unique_ptr<Cache> cache_ptr;
+    cache_ptr.reset(new_lru_cache(1024 * 1024));
+    sstable_pb.set_filename(filename);
+    sstable_pb.set_filesize(filesize);
+    ASSERT_OK(sst->init(std::move(read_file), sstable_pb, cache_ptr.get()));
+
+    // 3. multi get keys in [0, 3N) in descending order
+    std::vector<std::string> keys_str(3 * N);
+    std::vector<Slice> keys(3 * N);
+    std::vector<IndexValue> values(3 * N, IndexValue(NullIndexValue));
+    KeyIndexSet key_indexes;
+    KeyIndexSet found_key_indexes;
+    for (int i = 0; i < 3 * N; i++) {
+        keys_str[i] = fmt::format("test_key_{:016X}", 3 * N - 1 - i);
+        keys[i] = Slice(keys_str[i]);
+        key_indexes.insert(i);
+    }
+    ASSERT_OK(sst->multi_get(keys.data(), key_indexes, -1, values.data(), &found_key_indexes));
+    ASSERT_EQ(N / 2, found_key_indexes.size());
+    for (int i = 0; i < 3 * N; i++) {
+        int key = 3 * N - 1 - i;
+        if (key >= N && key < 2 * N && key % 2 == 0) {
+            ASSERT_TRUE(found_key_indexes.count(i) > 0);
+            ASSERT_EQ(IndexValue(key), values[i]);
+        } else {
+            ASSERT_TRUE(found_key_indexes.count(i) == 0);
+            ASSERT_EQ(IndexValue(NullIndexValue), values[i]);
+        }
+    }
+}
+
 TEST_F(PersistentIndexSstableTest, test_index_value_protobuf) {
     IndexValuesWithVerPB index_value_pb;
     for (int i = 0; i < 10; i++) {
@@ -95,6 +95,38 @@ TEST_F(LakeTabletManagerTest, tablet_meta_write_and_read) {
     EXPECT_TRUE(res.status().is_not_found());
 }
 
+// NOLINTNEXTLINE
+TEST_F(LakeTabletManagerTest, combined_tablet_meta_write_and_read) {
+    CombinedTabletMetadataPB metas;
+    for (int64_t tablet_id : {12345, 12346}) {
+        auto meta = metas.add_tablet_metas();
+        meta->set_id(tablet_id);
+        meta->set_version(3);
+        meta->add_rowsets()->set_id(tablet_id);
+    }
+    ASSERT_OK(_tablet_manager->put_combined_tablet_metadata(metas));
+    ASSERT_TRUE(FileSystem::Default()->path_exists(_tablet_manager->combined_tablet_metadata_location(1, 3)).ok());
+    // served from the metacache
+    ASSIGN_OR_ABORT(auto meta, _tablet_manager->get_tablet_metadata(12346, 3));
+    EXPECT_EQ(12346, meta->rowsets(0).id());
+
+    // read from the combined object after the cache is dropped
+    _tablet_manager->prune_metacache();
+    auto old_enable = config::lake_enable_combined_tablet_metadata;
+    DeferOp defer([&]() { config::lake_enable_combined_tablet_metadata = old_enable; });
+    config::lake_enable_combined_tablet_metadata = false;
+    EXPECT_TRUE(_tablet_manager->get_tablet_metadata(12345, 3).status().is_not_found());
+    config::lake_enable_combined_tablet_metadata = true;
+    ASSIGN_OR_ABORT(meta, _tablet_manager->get_tablet_metadata(12345, 3));
+    EXPECT_EQ(12345, meta->id());
+    EXPECT_EQ(3, meta->version());
+    EXPECT_TRUE(_tablet_manager->get_tablet_metadata(12347, 3).status().is_not_found());
+    EXPECT_TRUE(_tablet_manager->get_tablet_metadata(12345, 4).status().is_not_found());
+
+    metas.mutable_tablet_metas(1)->set_version(4);
+    EXPECT_FALSE(_tablet_manager->put_combined_tablet_metadata(metas).ok());
+}
+
 // NOLINTNEXTLINE
 TEST_F(LakeTabletManagerTest, txnlog_write_and_read) {
     starrocks::TxnLog txnLog;
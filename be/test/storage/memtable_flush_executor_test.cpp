@@ -300,6 +300,46 @@ TEST_F(MemTableFlushExecutorTest, testMemtableFlush) {
     checkResult(n);
 }
 
+TEST_F(MemTableFlushExecutorTest, testMemtableConcurrentFlush) {
+    const string path = "./MemTableFlushExecutorTest_testMemtableConcurrentFlush";
+    MySetUp("pk int,name varchar,pv int", "pk int,name varchar,pv int", 1, KeysType::DUP_KEYS, path);
+    auto mem_table_flush_executor = make_unique<MemTableFlushExecutor>();
+
+    std::vector<DataDir*> data_dirs = {nullptr, nullptr};
+    ASSERT_TRUE(mem_table_flush_executor->init(data_dirs).ok());
+
+    auto flush_token = mem_table_flush_executor->create_flush_token(ThreadPool::ExecutionMode::CONCURRENT);
+    ASSERT_NE(nullptr, flush_token);
+    const size_t n = 1000;
+    const size_t num_memtables = 8;
+    auto pchunk = gen_chunk(*_slots, n);
+    vector<uint32_t> indexes;
+    indexes.reserve(n);
+    for (int i = 0; i < n; i++) {
+        indexes.emplace_back(i);
+    }
+    std::atomic<size_t> ret_num_rows = 0;
+    for (size_t i = 0; i < num_memtables; i++) {
+        auto mem_table =
+                make_unique<MemTable>(1, &_vectorized_schema, _slots, _mem_table_sink.get(), _mem_tracker.get());
+        std::shuffle(indexes.begin(), indexes.end(), std::mt19937(std::random_device()()));
+        ASSERT_TRUE(mem_table->insert(*pchunk, indexes.data(), 0, indexes.size()).ok());
+        ASSERT_TRUE(mem_table->finalize().ok());
+        ASSERT_TRUE(flush_token
+                            ->submit(std::move(mem_table), false,
+                                     [&](std::unique_ptr<SegmentPB> seg, bool eos) {
+                                         ret_num_rows += seg->num_rows();
+                                     })
+                            .ok());
+    }
+
+    ASSERT_TRUE(flush_token->wait().ok());
+    ASSERT_EQ(num_memtables, flush_token->get_stats().flush_count.load());
+    ASSERT_EQ(num_memtables * n, ret_num_rows.load());
+
+    checkResult(num_memtables * n);
+}
+
 TEST_F(MemTableFlushExecutorTest, testMemtableFlushWithSeg) {
     const string path = "./MemTableFlushExecutorTest_testMemtableFlushWithSeg";
     MySetUp("pk int,name varchar,pv int", "pk int,name varchar,pv int", 1, KeysType::DUP_KEYS, path);
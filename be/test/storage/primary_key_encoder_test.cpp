@@ -17,6 +17,7 @@
 #include <gtest/gtest.h>
 
 #include <memory>
+#include <numeric>
 
 #include "column/chunk.h"
 #include "column/datum.h"
@@ -131,6 +132,53 @@ TEST(PrimaryKeyEncoderTest, testEncodeComposite) {
     }
 }
 
+TEST(PrimaryKeyEncoderTest, testEncodeFixedSizeComposite) {
+    auto sc = create_key_schema({TYPE_INT, TYPE_BIGINT, TYPE_SMALLINT, TYPE_BOOLEAN, TYPE_LARGEINT});
+    const int n = 1000;
+    auto pchunk = ChunkHelper::new_chunk(*sc, n);
+    for (int i = 0; i < n; i++) {
+        Datum tmp;
+        tmp.set_int32((i - n / 2) * 2343);
+        pchunk->columns()[0]->append_datum(tmp);
+        tmp.set_int64(-(int64_t)i * 1234567);
+        pchunk->columns()[1]->append_datum(tmp);
+        tmp.set_int16(i % 7 - 3);
+        pchunk->columns()[2]->append_datum(tmp);
+        tmp.set_uint8(i % 2);
+        pchunk->columns()[3]->append_datum(tmp);
+        tmp.set_int128((int128_t)i * 100000007 - 500);
+        pchunk->columns()[4]->append_datum(tmp);
+    }
+    unique_ptr<Column> dest;
+    PrimaryKeyEncoder::create_column(*sc, &dest);
+    // encode in two batches to cover a non-zero offset
+    PrimaryKeyEncoder::encode(*sc, *pchunk, 0, n / 3, dest.get());
+    PrimaryKeyEncoder::encode(*sc, *pchunk, n / 3, n - n / 3, dest.get());
+    ASSERT_EQ(n, dest->size());
+
+    // must be identical to the row by row encoding
+    unique_ptr<Column> expected;
+    PrimaryKeyEncoder::create_column(*sc, &expected);
+    vector<uint32_t> indexes(n);
+    std::iota(indexes.begin(), indexes.end(), 0);
+    PrimaryKeyEncoder::encode_selective(*sc, *pchunk, indexes.data(), n, expected.get());
+    const size_t key_size = PrimaryKeyEncoder::get_encoded_fixed_size(*sc);
+    for (int i = 0; i < n; i++) {
+        ASSERT_EQ(key_size, down_cast<BinaryColumn*>(dest.get())->get_slice(i).size);
+        ASSERT_EQ(down_cast<BinaryColumn*>(expected.get())->get_slice(i),
+                  down_cast<BinaryColumn*>(dest.get())->get_slice(i));
+    }
+
+    auto dchunk = pchunk->clone_empty_with_schema();
+    PrimaryKeyEncoder::decode(*sc, *dest, 0, n, dchunk.get());
+    ASSERT_EQ(pchunk->num_rows(), dchunk->num_rows());
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < sc->num_key_fields(); j++) {
+            ASSERT_EQ(pchunk->get_column_by_index(j)->debug_item(i), dchunk->get_column_by_index(j)->debug_item(i));
+        }
+    }
+}
+
 TEST(PrimaryKeyEncoderTest, testEncodeCompositeLimit) {
     {
         auto sc = create_key_schema({TYPE_INT, TYPE_VARCHAR, TYPE_SMALLINT, TYPE_BOOLEAN});
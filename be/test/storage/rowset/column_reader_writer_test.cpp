@@ -62,6 +62,7 @@
 #include "storage/types.h"
 #include "testutil/assert.h"
 #include "types/date_value.h"
+#include "util/defer_op.h"
 
 using std::string;
 
@@ -593,6 +594,34 @@ TEST_F(ColumnReaderWriterTest, test_binary) {
     test_nullable_data<TYPE_CHAR, DICT_ENCODING, 2>(*c, "1", "100");
 }
 
+// NOLINTNEXTLINE
+TEST_F(ColumnReaderWriterTest, test_data_page_max_rows) {
+    auto old_max_rows = config::data_page_max_rows;
+    config::data_page_max_rows = 1000;
+    DeferOp defer([&]() { config::data_page_max_rows = old_max_rows; });
+
+    // the file names must differ from the other cases, whose pages are laid out differently
+    auto col = numeric_data<TYPE_INT>(4);
+    test_nullable_data<TYPE_INT, BIT_SHUFFLE, 1>(*col, "0", "max_rows_4");
+    test_nullable_data<TYPE_INT, BIT_SHUFFLE, 2>(*col, "0", "max_rows_4");
+
+    auto c = low_cardinality_strings(10000);
+    test_nullable_data<TYPE_VARCHAR, DICT_ENCODING, 2>(*c, "0", "max_rows_10000");
+}
+
+// NOLINTNEXTLINE
+TEST_F(ColumnReaderWriterTest, test_keep_compressed_data_page) {
+    config::storage_page_cache_keep_compressed_data_page = true;
+    DeferOp defer([]() { config::storage_page_cache_keep_compressed_data_page = false; });
+
+    // the file names must differ from the other cases, whose pages are cached decoded
+    auto col = numeric_data<TYPE_INT>(4);
+    test_nullable_data<TYPE_INT, BIT_SHUFFLE, 2>(*col, "0", "keep_compressed_4");
+
+    auto c = low_cardinality_strings(10000);
+    test_nullable_data<TYPE_VARCHAR, DICT_ENCODING, 2>(*c, "0", "keep_compressed_10000");
+}
+
 #ifdef STRING_COLUMN_WRITER_TEST
 // NOLINTNEXTLINE
 TEST_F(ColumnReaderWriterTest, test_string_column_writer_benchmark) {
@@ -530,4 +530,72 @@ TEST_F(SegmentIteratorTest, TestGlobalDictNoLocalDict) {
     res_chunk->reset();
 }
 
+
+// Delete conditions that the segment zone map rules out are skipped, the others are still applied.
+TEST_F(SegmentIteratorTest, TestPruneDeletePredicatesBySegmentZoneMap) {
+    using namespace starrocks::test;
+
+    std::string file_name = kSegmentDir + "/prune_delete_predicates";
+    ASSIGN_OR_ABORT(auto wfile, _fs->new_writable_file(file_name));
+    SegmentWriterOptions opts;
+    opts.num_rows_per_block = 10;
+    TabletSchemaBuilder builder;
+    std::shared_ptr<TabletSchema> tablet_schema = builder.create(1, false, TYPE_INT, true).build();
+    SegmentWriter writer(std::move(wfile), 0, tablet_schema, opts);
+
+    const int32_t chunk_size = config::vector_chunk_size;
+    const size_t num_rows = 10000;
+
+    TabletDataBuilder segment_data_builder(writer, tablet_schema, chunk_size, num_rows);
+    ASSERT_OK(segment_data_builder.append(0, [](int32_t i) { return i; }));
+    ASSERT_OK(segment_data_builder.finalize_footer());
+
+    auto segment = *Segment::open(_fs, FileInfo{file_name}, 0, tablet_schema);
+    ASSERT_EQ(segment->num_rows(), num_rows);
+
+    VecSchemaBuilder schema_builder;
+    schema_builder.add(0, "c0", TYPE_INT);
+    auto vec_schema = schema_builder.build();
+
+    ObjectPool pool;
+    auto type_int = get_type_info(TYPE_INT);
+    // `c0 >= 20000` matches no row of the segment, `c0 < 100` matches the first 100 rows.
+    auto* out_of_range = pool.add(new ConjunctivePredicates());
+    out_of_range->add(pool.add(new_column_ge_predicate(type_int, 0, "20000")));
+    auto* in_range = pool.add(new ConjunctivePredicates());
+    in_range->add(pool.add(new_column_lt_predicate(type_int, 0, "100")));
+
+    auto check_read_rows = [&](const std::vector<ConjunctivePredicates*>& delete_conjuncts, size_t expected_rows) {
+        OlapReaderStatistics stats;
+        SegmentReadOptions seg_opts;
+        seg_opts.fs = _fs;
+        seg_opts.stats = &stats;
+        for (const auto* conjunct : delete_conjuncts) {
+            seg_opts.delete_predicates.add(*conjunct);
+        }
+
+        ASSIGN_OR_ABORT(auto chunk_iter, segment->new_iterator(vec_schema, seg_opts));
+        auto res_chunk = ChunkHelper::new_chunk(vec_schema, chunk_size);
+        size_t read_rows = 0;
+        while (true) {
+            res_chunk->reset();
+            auto st = chunk_iter->get_next(res_chunk.get());
+            if (st.is_end_of_file()) {
+                break;
+            }
+            ASSERT_OK(st);
+            for (size_t i = 0; i < res_chunk->num_rows(); i++) {
+                ASSERT_GE(res_chunk->get_column_by_index(0)->get(i).get_int32(), 100);
+            }
+            read_rows += res_chunk->num_rows();
+        }
+        ASSERT_EQ(expected_rows, read_rows);
+        ASSERT_EQ(num_rows - expected_rows, stats.rows_del_filtered);
+    };
+
+    check_read_rows({out_of_range}, num_rows);
+    check_read_rows({out_of_range, in_range}, num_rows - 100);
+    check_read_rows({in_range, out_of_range}, num_rows - 100);
+}
+
 } // namespace starrocks
@@ -1041,6 +1041,41 @@ TEST_F(BitmapValueTest, next_batch) {
     ASSERT_EQ(ret_size, 0);
 }
 
+TEST_F(BitmapValueTest, union_many) {
+    BitmapValue bitmap_1 = gen_bitmap(0, 100);
+    BitmapValue bitmap_2 = gen_bitmap(50, 200);
+    BitmapValue bitmap_3 = gen_bitmap((1ull << 32) + 0, (1ull << 32) + 100);
+    BitmapValue bitmap_4 = gen_bitmap(300, 310);
+    BitmapValue bitmap_5(1ull << 40);
+    std::vector<const BitmapValue*> values = {&bitmap_1, &_empty_bitmap, &bitmap_2, &bitmap_3, &bitmap_4, &bitmap_5};
+
+    BitmapValue expected(5000);
+    for (auto* value : values) {
+        expected |= *value;
+    }
+
+    BitmapValue bitmap(5000);
+    bitmap.union_many(values.data(), values.size());
+    ASSERT_EQ(BitmapDataType::BITMAP, bitmap.type());
+    ASSERT_EQ(expected.cardinality(), bitmap.cardinality());
+    ASSERT_EQ(expected.to_string(), bitmap.to_string());
+
+    // the inputs are not modified
+    check_bitmap(BitmapDataType::BITMAP, bitmap_1, 0, 100);
+    check_bitmap(BitmapDataType::BITMAP, bitmap_2, 50, 200);
+
+    // an existing shared bitmap is not modified either
+    BitmapValue shared = bitmap_3;
+    shared.union_many(values.data(), values.size());
+    ASSERT_EQ(expected.cardinality() - 1, shared.cardinality());
+    check_bitmap(BitmapDataType::BITMAP, bitmap_3, 1ull << 32, (1ull << 32) + 100);
+
+    // run_optimize keeps the content
+    bitmap.run_optimize();
+    ASSERT_EQ(expected.to_string(), bitmap.to_string());
+    ASSERT_LT(bitmap.serialize_size(), expected.serialize_size());
+}
+
 std::string convert_bitmap_to_string(BitmapValue& bitmap) {
     std::string buf;
     buf.resize(bitmap.get_size_in_bytes());
@@ -0,0 +1,77 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "util/mpsc_queue.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace starrocks {
+
+TEST(MpscQueueTest, test_basic) {
+    MpscQueue<std::unique_ptr<int>> queue;
+    std::unique_ptr<int> value;
+    ASSERT_EQ(0, queue.size_approx());
+    ASSERT_FALSE(queue.try_dequeue(value));
+
+    for (int i = 0; i < 10; ++i) {
+        queue.enqueue(std::make_unique<int>(i));
+    }
+    ASSERT_EQ(10, queue.size_approx());
+    for (int i = 0; i < 5; ++i) {
+        ASSERT_TRUE(queue.try_dequeue(value));
+        ASSERT_EQ(i, *value);
+    }
+    ASSERT_EQ(5, queue.size_approx());
+
+    // The remaining elements are released by the destructor.
+}
+
+TEST(MpscQueueTest, test_concurrent_enqueue) {
+    constexpr int num_values = 100000;
+    constexpr int num_producers = 4;
+    MpscQueue<std::pair<int, int>> queue;
+
+    std::vector<std::thread> producers;
+    for (int i = 0; i < num_producers; ++i) {
+        producers.emplace_back([&queue, i] {
+            for (int j = 0; j < num_values; ++j) {
+                queue.enqueue({i, j});
+            }
+        });
+    }
+
+    // The elements of each producer are dequeued in the order they are enqueued.
+    std::vector<int> next_values(num_producers, 0);
+    int num_dequeued = 0;
+    std::pair<int, int> value;
+    while (num_dequeued < num_values * num_producers) {
+        if (queue.try_dequeue(value)) {
+            ASSERT_EQ(next_values[value.first], value.second);
+            ++next_values[value.first];
+            ++num_dequeued;
+        }
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    ASSERT_EQ(0, queue.size_approx());
+    ASSERT_FALSE(queue.try_dequeue(value));
+}
+
+} // namespace starrocks
@@ -254,4 +254,27 @@ TEST_F(TDigestTest, Montonicity) {
     }
 }
 
+TEST_F(TDigestTest, AddBatch) {
+    TDigest digest(100);
+    TDigest batch_digest(100);
+    std::mt19937 gen(0);
+    std::uniform_real_distribution<> reals(0.0, 1.0);
+    std::vector<double> values;
+    for (int i = 0; i < 10000; i++) {
+        values.push_back(reals(gen));
+    }
+    values.push_back(NAN);
+
+    for (auto value : values) {
+        digest.add(static_cast<Value>(value));
+    }
+    batch_digest.add(values.data(), 10);
+    batch_digest.add(values.data() + 10, values.size() - 10);
+
+    ASSERT_EQ(digest.totalWeight(), batch_digest.totalWeight());
+    for (double q = 0; q <= 1; q += 0.01) {
+        ASSERT_EQ(digest.quantile(q), batch_digest.quantile(q)) << "q = " << q;
+    }
+}
+
 } // namespace starrocks
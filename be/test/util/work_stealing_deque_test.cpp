@@ -0,0 +1,96 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "util/work_stealing_deque.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace starrocks {
+
+TEST(WorkStealingDequeTest, test_basic) {
+    WorkStealingDeque<int*> deque(3);
+    ASSERT_EQ(4, deque.capacity());
+    ASSERT_TRUE(deque.empty());
+    ASSERT_EQ(nullptr, deque.pop());
+    ASSERT_EQ(nullptr, deque.steal());
+
+    int values[5] = {0, 1, 2, 3, 4};
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(deque.push(&values[i]));
+    }
+    // The deque is full.
+    ASSERT_FALSE(deque.push(&values[4]));
+    ASSERT_EQ(4, deque.size());
+
+    // pop() takes from the bottom, and steal() takes from the top.
+    ASSERT_EQ(&values[3], deque.pop());
+    ASSERT_EQ(&values[0], deque.steal());
+    ASSERT_EQ(&values[1], deque.steal());
+    ASSERT_EQ(&values[2], deque.pop());
+    ASSERT_TRUE(deque.empty());
+
+    // The slots are reused after wrapping around.
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(deque.push(&values[i + 1]));
+    }
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_EQ(&values[i + 1], deque.steal());
+    }
+    ASSERT_TRUE(deque.empty());
+}
+
+TEST(WorkStealingDequeTest, test_concurrent_steal) {
+    constexpr int num_values = 100000;
+    constexpr int num_thieves = 4;
+    WorkStealingDeque<int*> deque(64);
+    std::vector<int> values(num_values, 1);
+
+    std::atomic<bool> done = false;
+    std::atomic<int64_t> num_stolen = 0;
+    std::vector<std::thread> thieves;
+    for (int i = 0; i < num_thieves; ++i) {
+        thieves.emplace_back([&] {
+            while (!done || !deque.empty()) {
+                if (auto* value = deque.steal(); value != nullptr) {
+                    num_stolen += *value;
+                }
+            }
+        });
+    }
+
+    int64_t num_popped = 0;
+    for (int i = 0; i < num_values; ++i) {
+        while (!deque.push(&values[i])) {
+            if (auto* value = deque.pop(); value != nullptr) {
+                num_popped += *value;
+            }
+        }
+    }
+    while (auto* value = deque.pop()) {
+        num_popped += *value;
+    }
+    done = true;
+    for (auto& thief : thieves) {
+        thief.join();
+    }
+
+    // Every element is taken exactly once.
+    ASSERT_EQ(num_values, num_popped + num_stolen);
+}
+
+} // namespace starrocks
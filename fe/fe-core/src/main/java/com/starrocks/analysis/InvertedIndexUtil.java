@@ -29,6 +29,7 @@ import java.util.Map;
 import java.util.stream.Collectors;
 
 import static com.starrocks.common.InvertedIndexParams.CommonIndexParamKey.IMP_LIB;
+import static com.starrocks.common.InvertedIndexParams.InvertedIndexImpType.BUILTIN;
 import static com.starrocks.common.InvertedIndexParams.InvertedIndexImpType.CLUCENE;
 
 public class InvertedIndexUtil {
@@ -83,8 +84,12 @@ public class InvertedIndexUtil {
         String impLibKey = IMP_LIB.name().toLowerCase(Locale.ROOT);
         if (properties.containsKey(impLibKey)) {
             String impValue = properties.get(impLibKey);
-            if (!CLUCENE.name().equalsIgnoreCase(impValue)) {
-                throw new SemanticException("Only support clucene implement for now. ");
+            if (BUILTIN.name().equalsIgnoreCase(impValue)) {
+                if (!getInvertedIndexParser(properties).equals(INVERTED_INDEX_PARSER_NONE)) {
+                    throw new SemanticException("Builtin implement only supports the inverted index without parser. ");
+                }
+            } else if (!CLUCENE.name().equalsIgnoreCase(impValue)) {
+                throw new SemanticException("Only support clucene and builtin implement for now. ");
             }
         }
 
@@ -37,7 +37,9 @@ public class InvertedIndexParams {
 
 
     public enum InvertedIndexImpType {
-        CLUCENE
+        CLUCENE,
+        // native StarRocks index for untokenized columns, stored as a sorted dictionary and roaring bitmaps
+        BUILTIN
     }
 
     public enum CommonIndexParamKey implements ParamsKey {
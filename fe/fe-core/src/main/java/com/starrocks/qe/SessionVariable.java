@@ -1238,7 +1238,10 @@ public class SessionVariable implements Serializable, Writable, Cloneable {
     // encode integers/binary per column for exchange, controlled by transmission_encode_level
     // if transmission_encode_level & 2, intergers are encode by streamvbyte, in order or not;
     // if transmission_encode_level & 4, binary columns are compressed by lz4
-    // if transmission_encode_level & 1, enable adaptive encoding.
+    // if transmission_encode_level & 8, low-cardinality binary columns are encoded by a per-chunk dictionary;
+    // if transmission_encode_level & 16, intergers are encoded by frame-of-reference, sorted ones by delta first;
+    // if transmission_encode_level & 1, enable adaptive encoding, and if both 8/16 and 2/4 are set,
+    // each column picks the encoding with the lowest ratio by sampling.
     // e.g.
     // if transmission_encode_level = 7, SR will adaptively encode numbers and string columns according to the proper encoding
     // ratio(< 0.9);
@@ -1247,6 +1250,8 @@ public class SessionVariable implements Serializable, Writable, Cloneable {
     // for transmission_encode_level,
     // 2 for encoding integers or types supported by integers,
     // 4 for encoding string,
+    // 8 for dictionary encoding string,
+    // 16 for frame-of-reference encoding integers,
     // json and object columns are left to be supported later.
     @VariableMgr.VarAttr(name = TRANSMISSION_ENCODE_LEVEL)
     private int transmissionEncodeLevel = 7;
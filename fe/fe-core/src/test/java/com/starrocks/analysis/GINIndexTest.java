@@ -85,7 +85,15 @@ public class GINIndexTest extends PlanTestBase {
                 () -> InvertedIndexUtil.checkInvertedIndexValid(c2, new HashMap<String, String>() {{
                     put(IMP_LIB.name().toLowerCase(Locale.ROOT), "???");
                 }}, KeysType.DUP_KEYS),
-                "Only support clucene implement for now");
+                "Only support clucene and builtin implement for now");
+
+        Assertions.assertThrows(
+                SemanticException.class,
+                () -> InvertedIndexUtil.checkInvertedIndexValid(c2, new HashMap<String, String>() {{
+                    put(IMP_LIB.name().toLowerCase(Locale.ROOT), InvertedIndexImpType.BUILTIN.name());
+                    put(InvertedIndexUtil.INVERTED_INDEX_PARSER_KEY, InvertedIndexUtil.INVERTED_INDEX_PARSER_ENGLISH);
+                }}, KeysType.DUP_KEYS),
+                "Builtin implement only supports the inverted index without parser");
 
         Assertions.assertThrows(
                 SemanticException.class,